@@ -52,6 +52,7 @@
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/ConstrainedDoubleFilterParameter.h"
 #include "SIMPLib/FilterParameters/ConstrainedIntFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
@@ -67,6 +68,8 @@
 #include "SIMPLib/Messages/GenericStatusMessage.h"
 #include "SIMPLib/Messages/GenericWarningMessage.h"
 
+#include "SyntheticBuilding/SyntheticBuildingFilters/Utils/FixedRandomSeed.hpp"
+
 /**
  * @brief This message handler is used by EMMPMFilter instances to re-emit incoming generic messages from the
  * EMMPM observable object as its own filter messages
@@ -137,6 +140,10 @@ EMMPMFilter::EMMPMFilter()
 , m_CurvatureBetaC(1.0f)
 , m_CurvatureRMax(15.0f)
 , m_CurvatureEMLoopDelay(1)
+, m_UseFixedSeed(false)
+, m_RandomSeed(5489)
+, m_UseVolumeSegmentation(false)
+, m_VolumeNeighborhood(0)
 , m_OutputDataArrayPath("", "", "")
 , m_EmmpmInitType(EMMPM_Basic)
 , m_Data(EMMPM_Data::New())
@@ -204,6 +211,18 @@ void EMMPMFilter::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("Beta C", CurvatureBetaC, FilterParameter::Category::Parameter, EMMPMFilter));
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("R Max", CurvatureRMax, FilterParameter::Category::Parameter, EMMPMFilter));
   parameters.push_back(SIMPL_NEW_INTEGER_FP("EM Loop Delay", CurvatureEMLoopDelay, FilterParameter::Category::Parameter, EMMPMFilter));
+  FIXED_RANDOM_SEED_NEW_FPS(parameters, EMMPMFilter)
+  {
+    std::vector<QString> linkedProps;
+    linkedProps.push_back("VolumeNeighborhood");
+    parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Segment as 3D Volume", UseVolumeSegmentation, FilterParameter::Category::Parameter, EMMPMFilter, linkedProps));
+  }
+  {
+    std::vector<QString> choices;
+    choices.push_back("6 Face Neighbors");
+    choices.push_back("26 Face, Edge and Corner Neighbors");
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Volume Neighborhood", VolumeNeighborhood, FilterParameter::Category::Parameter, EMMPMFilter, choices, false));
+  }
 
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
@@ -236,6 +255,10 @@ void EMMPMFilter::readFilterParameters(AbstractFilterParametersReader* reader, i
   setCurvatureBetaC(reader->readValue("CurvaturePenalty", getCurvatureBetaC()));
   setCurvatureRMax(reader->readValue("RMax", getCurvatureRMax()));
   setCurvatureEMLoopDelay(reader->readValue("EMLoopDelay", getCurvatureEMLoopDelay()));
+  setUseFixedSeed(reader->readValue("UseFixedSeed", getUseFixedSeed()));
+  setRandomSeed(reader->readValue("RandomSeed", getRandomSeed()));
+  setUseVolumeSegmentation(reader->readValue("UseVolumeSegmentation", getUseVolumeSegmentation()));
+  setVolumeNeighborhood(reader->readValue("VolumeNeighborhood", getVolumeNeighborhood()));
   setOutputDataArrayPath(reader->readDataArrayPath("OutputDataArrayPath", getOutputDataArrayPath()));
   reader->closeFilterGroup();
 }
@@ -297,6 +320,11 @@ void EMMPMFilter::dataCheck()
     QString ss = QObject::tr("The minimum number of classes is 2");
     setErrorCondition(-89101, ss);
   }
+  if(getUseVolumeSegmentation() && (getUseGradientPenalty() || getUseCurvaturePenalty()))
+  {
+    QString ss = QObject::tr("The gradient and curvature penalties are only available when segmenting 2D images");
+    setErrorCondition(-89102, ss);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -376,6 +404,14 @@ void EMMPMFilter::segment(EMMPM_InitializationType initType)
 
   m_Data->columns = tDims[0];
   m_Data->rows = tDims[1];
+  m_Data->slices = 1;
+  if(getUseVolumeSegmentation() && tDims.size() > 2 && tDims[2] > 1)
+  {
+    // The EM/MPM data treats the volume as the slices stacked along the rows
+    m_Data->rows = tDims[1] * tDims[2];
+    m_Data->slices = tDims[2];
+    m_Data->volumeNeighbors = (getVolumeNeighborhood() == 1) ? 26 : 6;
+  }
   m_Data->inputImageChannels = cDims[0];
 
   m_Data->simulatedAnnealing = (char)(getUseSimulatedAnnealing());
@@ -385,6 +421,7 @@ void EMMPMFilter::segment(EMMPM_InitializationType initType)
   m_Data->beta_c = getCurvatureBetaC();
   m_Data->r_max = getCurvatureRMax();
   m_Data->ccostLoopDelay = getCurvatureEMLoopDelay();
+  m_Data->rngSeed = FixedRandomSeed::Resolve(getUseFixedSeed(), getRandomSeed());
 
   // Assign our Data array allocated input and output images into the EMMPData class
   m_Data->inputImage = m_InputImage;
@@ -741,6 +778,54 @@ int EMMPMFilter::getCurvatureEMLoopDelay() const
   return m_CurvatureEMLoopDelay;
 }
 
+// -----------------------------------------------------------------------------
+void EMMPMFilter::setUseFixedSeed(bool value)
+{
+  m_UseFixedSeed = value;
+}
+
+// -----------------------------------------------------------------------------
+bool EMMPMFilter::getUseFixedSeed() const
+{
+  return m_UseFixedSeed;
+}
+
+// -----------------------------------------------------------------------------
+void EMMPMFilter::setRandomSeed(int value)
+{
+  m_RandomSeed = value;
+}
+
+// -----------------------------------------------------------------------------
+int EMMPMFilter::getRandomSeed() const
+{
+  return m_RandomSeed;
+}
+
+// -----------------------------------------------------------------------------
+void EMMPMFilter::setUseVolumeSegmentation(bool value)
+{
+  m_UseVolumeSegmentation = value;
+}
+
+// -----------------------------------------------------------------------------
+bool EMMPMFilter::getUseVolumeSegmentation() const
+{
+  return m_UseVolumeSegmentation;
+}
+
+// -----------------------------------------------------------------------------
+void EMMPMFilter::setVolumeNeighborhood(int value)
+{
+  m_VolumeNeighborhood = value;
+}
+
+// -----------------------------------------------------------------------------
+int EMMPMFilter::getVolumeNeighborhood() const
+{
+  return m_VolumeNeighborhood;
+}
+
 // -----------------------------------------------------------------------------
 void EMMPMFilter::setOutputDataArrayPath(const DataArrayPath& value)
 {
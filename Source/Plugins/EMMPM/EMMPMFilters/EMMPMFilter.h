@@ -75,6 +75,10 @@ class EMMPM_EXPORT EMMPMFilter : public AbstractFilter
   PYB11_PROPERTY(double CurvatureBetaC READ getCurvatureBetaC WRITE setCurvatureBetaC)
   PYB11_PROPERTY(double CurvatureRMax READ getCurvatureRMax WRITE setCurvatureRMax)
   PYB11_PROPERTY(int CurvatureEMLoopDelay READ getCurvatureEMLoopDelay WRITE setCurvatureEMLoopDelay)
+  PYB11_PROPERTY(bool UseFixedSeed READ getUseFixedSeed WRITE setUseFixedSeed)
+  PYB11_PROPERTY(int RandomSeed READ getRandomSeed WRITE setRandomSeed)
+  PYB11_PROPERTY(bool UseVolumeSegmentation READ getUseVolumeSegmentation WRITE setUseVolumeSegmentation)
+  PYB11_PROPERTY(int VolumeNeighborhood READ getVolumeNeighborhood WRITE setVolumeNeighborhood)
   PYB11_PROPERTY(DataArrayPath OutputDataArrayPath READ getOutputDataArrayPath WRITE setOutputDataArrayPath)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
@@ -265,6 +269,50 @@ public:
   int getCurvatureEMLoopDelay() const;
   Q_PROPERTY(int CurvatureEMLoopDelay READ getCurvatureEMLoopDelay WRITE setCurvatureEMLoopDelay)
 
+  /**
+   * @brief Setter property for UseFixedSeed
+   */
+  void setUseFixedSeed(bool value);
+  /**
+   * @brief Getter property for UseFixedSeed
+   * @return Value of UseFixedSeed
+   */
+  bool getUseFixedSeed() const;
+  Q_PROPERTY(bool UseFixedSeed READ getUseFixedSeed WRITE setUseFixedSeed)
+
+  /**
+   * @brief Setter property for RandomSeed
+   */
+  void setRandomSeed(int value);
+  /**
+   * @brief Getter property for RandomSeed
+   * @return Value of RandomSeed
+   */
+  int getRandomSeed() const;
+  Q_PROPERTY(int RandomSeed READ getRandomSeed WRITE setRandomSeed)
+
+  /**
+   * @brief Setter property for UseVolumeSegmentation
+   */
+  void setUseVolumeSegmentation(bool value);
+  /**
+   * @brief Getter property for UseVolumeSegmentation
+   * @return Value of UseVolumeSegmentation
+   */
+  bool getUseVolumeSegmentation() const;
+  Q_PROPERTY(bool UseVolumeSegmentation READ getUseVolumeSegmentation WRITE setUseVolumeSegmentation)
+
+  /**
+   * @brief Setter property for VolumeNeighborhood. 0 = 6 face neighbors, 1 = 26 neighbors
+   */
+  void setVolumeNeighborhood(int value);
+  /**
+   * @brief Getter property for VolumeNeighborhood
+   * @return Value of VolumeNeighborhood
+   */
+  int getVolumeNeighborhood() const;
+  Q_PROPERTY(int VolumeNeighborhood READ getVolumeNeighborhood WRITE setVolumeNeighborhood)
+
   /**
    * @brief Setter property for OutputDataArrayPath
    */
@@ -414,6 +462,10 @@ private:
   double m_CurvatureBetaC = {};
   double m_CurvatureRMax = {};
   int m_CurvatureEMLoopDelay = {};
+  bool m_UseFixedSeed = {};
+  int m_RandomSeed = {};
+  bool m_UseVolumeSegmentation = {};
+  int m_VolumeNeighborhood = {};
   DataArrayPath m_OutputDataArrayPath = {};
   EMMPM_InitializationType m_EmmpmInitType = {};
 
@@ -372,6 +372,10 @@ AbstractFilter::Pointer MultiEmmpmFilter::newFilterInstance(bool copyFilterParam
     filter->setCurvatureBetaC(getCurvatureBetaC());
     filter->setCurvatureRMax(getCurvatureRMax());
     filter->setCurvatureEMLoopDelay(getCurvatureEMLoopDelay());
+    filter->setUseFixedSeed(getUseFixedSeed());
+    filter->setRandomSeed(getRandomSeed());
+    filter->setUseVolumeSegmentation(getUseVolumeSegmentation());
+    filter->setVolumeNeighborhood(getVolumeNeighborhood());
     filter->setOutputAttributeMatrixName(getOutputAttributeMatrixName());
   }
   return filter;
@@ -190,11 +190,14 @@ void EMMPM::printData(EMMPM_Data::Pointer data)
   PRINT_DATA( classes); /**<  */
   PRINT_DATA( rows); /**< The height of the image.  Applicable for both input and output images */
   PRINT_DATA( columns); /**< The width of the image. Applicable for both input and output images */
+  PRINT_DATA( slices); /**< The depth of a volume */
+  PRINT_DATA( volumeNeighbors); /**< The size of the 3D clique */
   PRINT_DATA( channels); /**< The number of color channels in the images. This should always be 1 */
   PRINT_DATA( initType); /**< The type of initialization algorithm to use  */
   PRINT_2D_UINT_ARRAY( initCoords, EMMPM_MAX_CLASSES, 4); /**<  MAX_CLASSES rows x 4 Columns  */
 
   PRINT_DATA( simulatedAnnealing); /**<  */
+  PRINT_DATA( rngSeed); /**<  */
 
   PRINT_INT_ARRAY( grayTable);
   PRINT_DATA( verbose); /**<  */
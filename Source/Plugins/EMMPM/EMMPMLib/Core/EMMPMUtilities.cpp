@@ -245,9 +245,9 @@ public:
   void calc(int rowStart, int rowEnd, int colStart, int colEnd) const
   {
     int dims = data->dims;
-    int rows = data->rows;
-    int cols = data->columns;
-    int32_t k_, k2_, lij, ld, ijd, k_temp, k2_temp;
+    size_t rows = data->rows;
+    size_t cols = data->columns;
+    size_t k_, k2_, lij, ld, ijd, k_temp, k2_temp;
     real_t* m = data->mean;
     unsigned char* y = data->y;
     real_t* probs = data->probs;
@@ -302,9 +302,9 @@ public:
   void calc(int rowStart, int rowEnd, int colStart, int colEnd) const
   {
     int dims = data->dims;
-    int rows = data->rows;
-    int cols = data->columns;
-    int32_t k_, k2_, lij, ld, ijd, k_temp, k2_temp;
+    size_t rows = data->rows;
+    size_t cols = data->columns;
+    size_t k_, k2_, lij, ld, ijd, k_temp, k2_temp;
     real_t* m = data->mean;
     unsigned char* y = data->y;
     real_t* probs = data->probs;
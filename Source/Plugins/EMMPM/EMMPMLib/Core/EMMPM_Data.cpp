@@ -94,7 +94,7 @@ int EMMPM_Data::allocateDataStructureMemory()
 {
   if(nullptr == this->y)
   {
-    this->y = new unsigned char[this->columns * this->rows * this->dims]();
+    this->y = new unsigned char[static_cast<size_t>(this->columns) * this->rows * this->dims]();
   }
   if(nullptr == this->y)
   {
@@ -103,7 +103,7 @@ int EMMPM_Data::allocateDataStructureMemory()
 
   if(nullptr == this->xt)
   {
-    this->xt = new unsigned char[this->columns * this->rows * this->dims]();
+    this->xt = new unsigned char[static_cast<size_t>(this->columns) * this->rows * this->dims]();
   }
   if(nullptr == this->xt)
   {
@@ -148,7 +148,7 @@ int EMMPM_Data::allocateDataStructureMemory()
 
   if(nullptr == this->probs)
   {
-    this->probs = new real_t[this->classes * this->columns * this->rows]();
+    this->probs = new real_t[static_cast<size_t>(this->classes) * this->columns * this->rows]();
   }
   if(nullptr == this->probs)
   {
@@ -189,7 +189,7 @@ void EMMPM_Data::allocateOutputImage()
     this->outputImage = nullptr;
   }
 
-  this->outputImage = new unsigned char[this->columns * this->rows * this->dims]();
+  this->outputImage = new unsigned char[static_cast<size_t>(this->columns) * this->rows * this->dims]();
 }
 
 // -----------------------------------------------------------------------------
@@ -206,6 +206,8 @@ void EMMPM_Data::initVariables()
   this->classes = 0;
   this->rows = 0;
   this->columns = 0;
+  this->slices = 1;
+  this->volumeNeighbors = 6;
   this->dims = 1;
   this->initType = EMMPM_Basic;
   this->couplingBeta = nullptr;
@@ -221,6 +223,7 @@ void EMMPM_Data::initVariables()
     this->min_variance[c] = 1.0;
   }
   this->verbose = 0;
+  this->rngSeed = 0;
   this->cancel = 0;
 
   this->mean = nullptr;
@@ -39,6 +39,7 @@
 #include <memory>
 
 #include <cstddef>
+#include <cstdint>
 
 // C++ Includes
 #include <vector>
@@ -112,6 +113,8 @@ public:
   int classes;                                   /**<  */
   unsigned int rows;                             /**< The height of the image.  Applicable for both input and output images */
   unsigned int columns;                          /**< The width of the image. Applicable for both input and output images */
+  unsigned int slices;                           /**< The depth of a volume. When > 1 the slices are stacked along the rows so rows = height * slices */
+  unsigned int volumeNeighbors;                  /**< The size of the 3D clique (6 or 26) used when slices > 1 */
   unsigned int dims;                             /**< The number of vector elements in the image.*/
   enum EMMPM_InitializationType initType;        /**< The type of initialization algorithm to use  */
   unsigned int initCoords[EMMPM_MAX_CLASSES][4]; /**<  MAX_CLASSES rows x 4 Columns  */
@@ -119,6 +122,7 @@ public:
   unsigned int colorTable[EMMPM_MAX_CLASSES];
   real_t min_variance[EMMPM_MAX_CLASSES]; /**< The minimum value that the variance can be for each class */
   char simulatedAnnealing;                /**<  */
+  uint64_t rngSeed;                       /**< Seed for the counter based random numbers used by the initialization and MPM loops */
   char verbose;                           /**<  */
 
   // -----------------------------------------------------------------------------
@@ -0,0 +1,123 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+/**
+ * @brief Philox4x32-10 counter based random number generator (Salmon et al., "Parallel
+ * Random Numbers: As Easy as 1, 2, 3", SC 2011). Each output block is a pure function
+ * of the 64 bit key (the user seed) and a 128 bit counter, so any pixel of any MPM
+ * iteration can draw its random number directly without sharing generator state
+ * between threads or pre-generating a buffer for the whole image.
+ */
+namespace EMMPM_Random
+{
+/**
+ * @brief Identifies which part of the algorithm is drawing numbers so that the
+ * initial random labeling and the MPM sweeps never reuse a counter.
+ */
+enum class Stream : uint32_t
+{
+  XtInitialization = 0,
+  MPM = 1
+};
+
+using Counter = std::array<uint32_t, 4>;
+
+namespace Detail
+{
+constexpr uint32_t k_PhiloxM0 = 0xD2511F53;
+constexpr uint32_t k_PhiloxM1 = 0xCD9E8D57;
+constexpr uint32_t k_PhiloxW0 = 0x9E3779B9;
+constexpr uint32_t k_PhiloxW1 = 0xBB67AE85;
+
+inline void MulHiLo(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo)
+{
+  const uint64_t product = static_cast<uint64_t>(a) * static_cast<uint64_t>(b);
+  hi = static_cast<uint32_t>(product >> 32);
+  lo = static_cast<uint32_t>(product);
+}
+
+inline Counter Round(const Counter& ctr, uint32_t key0, uint32_t key1)
+{
+  uint32_t hi0 = 0;
+  uint32_t lo0 = 0;
+  uint32_t hi1 = 0;
+  uint32_t lo1 = 0;
+  MulHiLo(k_PhiloxM0, ctr[0], hi0, lo0);
+  MulHiLo(k_PhiloxM1, ctr[2], hi1, lo1);
+  return {hi1 ^ ctr[1] ^ key0, lo1, hi0 ^ ctr[3] ^ key1, lo0};
+}
+} // namespace Detail
+
+/**
+ * @brief Runs the 10 rounds of Philox4x32 on the given counter
+ * @param ctr 128 bit counter
+ * @param seed 64 bit key
+ * @return Four independent 32 bit random words
+ */
+inline Counter Philox4x32(Counter ctr, uint64_t seed)
+{
+  uint32_t key0 = static_cast<uint32_t>(seed);
+  uint32_t key1 = static_cast<uint32_t>(seed >> 32);
+  for(int r = 0; r < 9; r++)
+  {
+    ctr = Detail::Round(ctr, key0, key1);
+    key0 += Detail::k_PhiloxW0;
+    key1 += Detail::k_PhiloxW1;
+  }
+  return Detail::Round(ctr, key0, key1);
+}
+
+/**
+ * @brief Returns a uniform number in [0, 1) for the given pixel of the given iteration.
+ * @param seed User supplied seed
+ * @param stream Which part of the algorithm is asking
+ * @param pass Outer loop counter (EM loop)
+ * @param iteration Inner loop counter (MPM iteration)
+ * @param index Linear pixel index
+ */
+inline double Uniform(uint64_t seed, Stream stream, uint32_t pass, uint32_t iteration, uint64_t index)
+{
+  Counter ctr = {static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32), iteration, (pass << 1) | static_cast<uint32_t>(stream)};
+  Counter out = Philox4x32(ctr, seed);
+  // 53 random bits mapped onto [0, 1)
+  const uint64_t bits = (static_cast<uint64_t>(out[0]) << 21) | (static_cast<uint64_t>(out[1]) >> 11);
+  return static_cast<double>(bits & ((uint64_t(1) << 53) - 1)) * (1.0 / 9007199254740992.0);
+}
+} // namespace EMMPM_Random
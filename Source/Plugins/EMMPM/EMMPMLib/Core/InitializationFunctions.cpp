@@ -39,14 +39,11 @@
 #include <cstdlib>
 #include <cstring>
 
-//-- C++ includes
-#include <chrono>
-#include <random>
-
 //-- EMMMPM Lib Includes
 #include "EMMPMLib/Common/EMMPM_Math.h"
 #include "EMMPMLib/Common/MSVCDefines.h"
 #include "EMMPMLib/Core/EMMPM.h"
+#include "EMMPMLib/Core/EMMPM_Random.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -215,19 +212,12 @@ void XtArrayInitialization::initialize(EMMPM_Data::Pointer data)
 
   total = data->rows * data->columns;
 
-  const double rangeMin = 0.0;
-  const double rangeMax = 1.0;
-
-  std::random_device randomDevice;           // Will be used to obtain a seed for the random number engine
-  std::mt19937_64 generator(randomDevice()); // Standard mersenne_twister_engine seeded with rd()
-  std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-  generator.seed(seed);
-  std::uniform_real_distribution<> distribution(rangeMin, rangeMax);
+  const uint64_t seed = data->rngSeed;
 
   /* Initialize classification of each pixel randomly with a uniform disribution */
   for(size_t i = 0; i < total; i++)
   {
-    data->xt[i] = distribution(generator) * data->classes;
+    data->xt[i] = EMMPM_Random::Uniform(seed, EMMPM_Random::Stream::XtInitialization, 0, 0, i) * data->classes;
   }
 }
 
@@ -51,27 +51,26 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <cstring>
 
 //-- C++ includes
-#include <chrono>
-#include <random>
+#include <algorithm>
 #include <sstream>
 #include <thread>
+#include <vector>
 
 #include "EMMPMLib/Common/EMMPM_Math.h"
 #include "EMMPMLib/Common/MSVCDefines.h"
 #include "EMMPMLib/Core/EMMPM.h"
 #include "EMMPMLib/Core/EMMPMUtilities.h"
+#include "EMMPMLib/Core/EMMPM_Random.h"
 
-#define USE_TBB_TASK_GROUP 0
 #ifdef EMMPM_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
 #include <tbb/blocked_range2d.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_group.h>
-
 #endif
 
 #define COMPUTE_C_CLIQUE(C, x, y, ci, cj)                                                                                                                                                              \
-  if((x) < 0 || (x) >= colEnd || (y) < 0 || (y) >= rowEnd)                                                                                                                                             \
+  if((x) < 0 || (x) >= cols || (y) < 0 || (y) >= rows)                                                                                                                                                 \
   {                                                                                                                                                                                                    \
     C[ci][cj] = classes;                                                                                                                                                                               \
   }                                                                                                                                                                                                    \
@@ -83,7 +82,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 /**
  * @class ParallelCalcLoop ParallelCalcLoop.h EMMPM/Curvature/ParallelCalcLoop.h
- * @brief This class can calculate the parts of the MPM loop in parallel
+ * @brief This class can calculate the parts of the MPM loop in parallel. Each
+ * instance only updates the pixels of one "color" of a 2x2 checkerboard (the
+ * pixels whose x and y parities match xParity and yParity). No two pixels of the
+ * same color share an 8-neighbor clique so the pixels of one color can be updated
+ * in any order, by any number of threads, and always produce the same result.
+ * The random number for each pixel is drawn from a counter based generator keyed
+ * on the seed, EM loop, MPM iteration and pixel index.
  *
  * @date March 11, 2012
  * @version 1.0
@@ -91,21 +96,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 class ParallelMPMLoop
 {
 public:
-#if USE_TBB_TASK_GROUP
-  ParallelCalcLoop(EMMPM_Data* dPtr, real_t* ykPtr, real_t* rnd, int rowStart, int rowEnd, int colStart, int colEnd)
-  : m_RowStart(rowStart)
-  , m_RowEnd(rowEnd)
-  , m_ColStart(colStart)
-  , m_ColEnd(colEnd)
-  ,
-#else
-  ParallelMPMLoop(EMMPM_Data* dPtr, real_t* ykPtr, real_t* rnd)
-  :
-#endif
-
-  data(dPtr)
+  ParallelMPMLoop(EMMPM_Data* dPtr, real_t* ykPtr, uint32_t iteration, int xParity, int yParity)
+  : data(dPtr)
   , yk(ykPtr)
-  , rnd(rnd)
+  , m_Iteration(iteration)
+  , m_XParity(xParity)
+  , m_YParity(yParity)
   {
   }
   virtual ~ParallelMPMLoop() = default;
@@ -154,10 +150,15 @@ public:
     std::stringstream ss;
     unsigned int cSize = classes + 1;
     real_t* coupling = data->couplingBeta;
+    const uint64_t seed = data->rngSeed;
+    const uint32_t pass = static_cast<uint32_t>(data->currentEMLoop);
 
-    for(int32_t y = rowStart; y < rowEnd; y++)
+    // Snap the start of the block onto the first pixel of this color
+    const int32_t yStart = rowStart + ((rowStart ^ m_YParity) & 1);
+    const int32_t xStart = colStart + ((colStart ^ m_XParity) & 1);
+    for(int32_t y = yStart; y < rowEnd; y += 2)
     {
-      for(int32_t x = colStart; x < colEnd; x++)
+      for(int32_t x = xStart; x < colEnd; x += 2)
       {
 
         /* -------------  */
@@ -255,7 +256,7 @@ public:
           sum += post[l];
         }
 
-        xrnd = rnd[ij];
+        xrnd = EMMPM_Random::Uniform(seed, EMMPM_Random::Stream::MPM, pass, m_Iteration, static_cast<uint64_t>(ij));
         current = 0.0;
 
         for(int l = 0; l < classes; l++)
@@ -294,29 +295,165 @@ public:
   }
 
 #if EMMPM_USE_PARALLEL_ALGORITHMS
-#if USE_TBB_TASK_GROUP
-  void operator()() const
-  {
-    calc(m_RowStart, m_RowEnd, m_ColStart, m_ColEnd);
-  }
-#else
   void operator()(const tbb::blocked_range2d<int>& r) const
   {
     calc(r.rows().begin(), r.rows().end(), r.cols().begin(), r.cols().end());
   }
 #endif
-#endif
 
 private:
-#if USE_TBB_TASK_GROUP
-  int m_RowStart;
-  int m_RowEnd;
-  int m_ColStart;
-  int m_ColEnd;
-#endif
   const EMMPM_Data* data;
   const real_t* yk;
-  const real_t* rnd;
+  uint32_t m_Iteration;
+  int m_XParity;
+  int m_YParity;
+};
+
+/**
+ * @class ParallelMPMVolumeLoop
+ * @brief Calculates the MPM loop for a 3D volume using either a 6 (faces) or a
+ * 26 (faces, edges and corners) neighbor clique. The slices are stacked along the
+ * rows of the EMMPM_Data so slice z occupies rows [z * height, (z + 1) * height).
+ *
+ * Each instance updates every other slice (those whose z parity matches zParity)
+ * and each slice is swept in raster order by a single thread. A slice only reads
+ * labels from the slices directly above and below it, which are not updated in the
+ * same pass, so the result does not depend on how the slices are distributed over
+ * the threads. Instead of the classes * voxels "yk" array used by the 2D loop the
+ * Gaussian log likelihood is looked up from a table indexed by gray level, which
+ * keeps the per voxel working set to the xt labels and the probs array.
+ */
+class ParallelMPMVolumeLoop
+{
+public:
+  ParallelMPMVolumeLoop(EMMPM_Data* dPtr, const real_t* ykTable, uint32_t iteration, int zParity)
+  : data(dPtr)
+  , m_YkTable(ykTable)
+  , m_Iteration(iteration)
+  , m_ZParity(zParity)
+  {
+  }
+  virtual ~ParallelMPMVolumeLoop() = default;
+
+  /**
+   * @brief Updates the slices z = 2 * i + zParity for i in [pairStart, pairEnd)
+   */
+  void calc(int pairStart, int pairEnd) const
+  {
+    const int64_t cols = data->columns;
+    const int64_t slices = data->slices;
+    const int64_t height = data->rows / data->slices;
+    const size_t sliceSize = static_cast<size_t>(cols * height);
+    const size_t totalVoxels = sliceSize * static_cast<size_t>(slices);
+    const int classes = data->classes;
+    const unsigned int dims = data->dims;
+    const unsigned int cSize = classes + 1;
+    const bool useFullClique = (data->volumeNeighbors == 26);
+    const uint64_t seed = data->rngSeed;
+    const uint32_t pass = static_cast<uint32_t>(data->currentEMLoop);
+
+    unsigned char* xt = data->xt;
+    const unsigned char* y = data->y;
+    real_t* probs = data->probs;
+    const real_t* coupling = data->couplingBeta;
+
+    int neighborCount[EMMPM_MAX_CLASSES + 1];
+    real_t post[EMMPM_MAX_CLASSES];
+
+    for(int pair = pairStart; pair < pairEnd; pair++)
+    {
+      const int64_t z = 2 * pair + m_ZParity;
+      if(z >= slices)
+      {
+        break;
+      }
+      for(int64_t row = 0; row < height; row++)
+      {
+        for(int64_t x = 0; x < cols; x++)
+        {
+          const size_t ij = static_cast<size_t>(z) * sliceSize + static_cast<size_t>(row * cols + x);
+
+          // Count how many neighbors carry each label. Neighbors off the volume are skipped
+          // which is the same as the 2D loop where those positions couple with a zero beta
+          ::memset(neighborCount, 0, sizeof(neighborCount));
+          for(int64_t dz = -1; dz <= 1; dz++)
+          {
+            const int64_t nz = z + dz;
+            if(nz < 0 || nz >= slices)
+            {
+              continue;
+            }
+            for(int64_t dy = -1; dy <= 1; dy++)
+            {
+              const int64_t ny = row + dy;
+              if(ny < 0 || ny >= height)
+              {
+                continue;
+              }
+              for(int64_t dx = -1; dx <= 1; dx++)
+              {
+                const int64_t nx = x + dx;
+                if(nx < 0 || nx >= cols)
+                {
+                  continue;
+                }
+                const int64_t offsets = (dx != 0) + (dy != 0) + (dz != 0);
+                if(offsets == 0 || (!useFullClique && offsets != 1))
+                {
+                  continue;
+                }
+                neighborCount[xt[static_cast<size_t>(nz) * sliceSize + static_cast<size_t>(ny * cols + nx)]]++;
+              }
+            }
+          }
+
+          real_t sum = 0.0;
+          for(int l = 0; l < classes; ++l)
+          {
+            real_t prior = 0.0;
+            for(int c = 0; c < classes; c++)
+            {
+              prior += neighborCount[c] * coupling[(cSize * l) + c];
+            }
+            real_t yk = 0.0;
+            for(unsigned int d = 0; d < dims; d++)
+            {
+              yk += m_YkTable[(dims * l + d) * 256 + y[dims * ij + d]];
+            }
+            real_t arg = data->workingKappa * (yk - prior - data->w_gamma[l]);
+            post[l] = expf(arg);
+            sum += post[l];
+          }
+
+          real_t xrnd = EMMPM_Random::Uniform(seed, EMMPM_Random::Stream::MPM, pass, m_Iteration, static_cast<uint64_t>(ij));
+          real_t current = 0.0;
+          for(int l = 0; l < classes; l++)
+          {
+            real_t arg = post[l] / sum;
+            if((xrnd >= current) && (xrnd <= (current + arg)))
+            {
+              xt[ij] = l;
+              probs[totalVoxels * l + ij] += 1.0;
+            }
+            current += arg;
+          }
+        }
+      }
+    }
+  }
+
+#if EMMPM_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<int>& r) const
+  {
+    calc(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const EMMPM_Data* data;
+  const real_t* m_YkTable;
+  uint32_t m_Iteration;
+  int m_ZParity;
 };
 
 // -----------------------------------------------------------------------------
@@ -368,8 +505,6 @@ void MPMCalculation::execute()
   memset(msgbuff, 0, 256);
   data->progress++;
 
-  yk = new real_t[cols * rows * classes]();
-
   sqrt2pi = sqrt(2.0 * M_PI);
 
   for(uint32_t l = 0; l < classes; l++)
@@ -382,43 +517,61 @@ void MPMCalculation::execute()
     }
   }
 
-  for(uint32_t i = 0; i < rows; i++)
+  // A volume is segmented with the 3D clique. The slices are stacked along the rows.
+  const bool segmentVolume = (data->slices > 1);
+  const int slicePairs = static_cast<int>((data->slices + 1) / 2);
+
+  // For a volume the Gaussian term only depends on the class and the gray level so it
+  // is tabulated instead of being stored for every voxel of every class.
+  std::vector<real_t> ykTable;
+  yk = nullptr;
+  if(segmentVolume)
   {
-    for(uint32_t j = 0; j < cols; j++)
+    ykTable.resize(static_cast<size_t>(classes) * dims * 256);
+    for(uint32_t l = 0; l < classes; l++)
     {
-      for(uint32_t l = 0; l < classes; l++)
+      for(uint32_t d = 0; d < dims; d++)
       {
-        lij = (cols * rows * l) + (cols * i) + j;
-        probs[lij] = 0;
-        yk[lij] = con[l];
-        for(uint32_t d = 0; d < dims; d++)
+        ld = dims * l + d;
+        for(uint32_t gray = 0; gray < 256; gray++)
         {
-          ld = dims * l + d;
-          ijd = (dims * cols * i) + (dims * j) + d;
-          yk[lij] += ((y[ijd] - m[ld]) * (y[ijd] - m[ld]) / (-2.0 * v[ld]));
+          // The class constant is folded into the first dimension
+          real_t value = (d == 0) ? con[l] : 0.0;
+          value += ((gray - m[ld]) * (gray - m[ld]) / (-2.0 * v[ld]));
+          ykTable[ld * 256 + gray] = value;
         }
       }
     }
+    ::memset(probs, 0, static_cast<size_t>(cols) * rows * classes * sizeof(real_t));
   }
-
-  const double rangeMin = 0.0;
-  const double rangeMax = 1.0;
-
-  std::random_device randomDevice;           // Will be used to obtain a seed for the random number engine
-  std::mt19937_64 generator(randomDevice()); // Standard mersenne_twister_engine seeded with rd()
-  std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-  generator.seed(seed);
-  std::uniform_real_distribution<> distribution(rangeMin, rangeMax);
-
-  // Generate all the numbers up front
-  size_t total = rows * cols;
-  std::vector<real_t> rndNumbers(total);
-  real_t* rndNumbersPtr = &(rndNumbers.front());
-  for(size_t i = 0; i < total; ++i)
+  else
   {
-    rndNumbersPtr[i] = distribution(generator); // Work directly with the pointer for speed.
+    yk = new real_t[static_cast<size_t>(cols) * rows * classes]();
+    for(uint32_t i = 0; i < rows; i++)
+    {
+      for(uint32_t j = 0; j < cols; j++)
+      {
+        for(uint32_t l = 0; l < classes; l++)
+        {
+          lij = (static_cast<size_t>(cols) * rows * l) + (cols * i) + j;
+          probs[lij] = 0;
+          yk[lij] = con[l];
+          for(uint32_t d = 0; d < dims; d++)
+          {
+            ld = dims * l + d;
+            ijd = (dims * cols * i) + (dims * j) + d;
+            yk[lij] += ((y[ijd] - m[ld]) * (y[ijd] - m[ld]) / (-2.0 * v[ld]));
+          }
+        }
+      }
+    }
   }
 
+#if EMMPM_USE_PARALLEL_ALGORITHMS
+  int threads = std::thread::hardware_concurrency();
+  int rowGrain = std::max(2, static_cast<int>(rows) / std::max(1, threads));
+#endif
+
   // unsigned long long int millis = EMMPM_getMilliSeconds();
   // std::cout << "------------------------------------------------" << std::endl;
   /* Perform the MPM loops */
@@ -433,33 +586,35 @@ void MPMCalculation::execute()
     }
     data->inside_mpm_loop = 1;
 
-#if EMMPM_USE_PARALLEL_ALGORITHMS
-    int threads = std::thread::hardware_concurrency();
-#if USE_TBB_TASK_GROUP
-    std::shared_ptr<tbb::task_group> g(new tbb::task_group);
-    unsigned int rowIncrement = rows / threads;
-    unsigned int rowStop = 0 + rowIncrement;
-    unsigned int rowStart = 0;
-    for(int t = 0; t < threads; ++t)
+    if(segmentVolume)
     {
-      g->run(ParallelCalcLoop(data, yk, &(rndNumbers.front()), rowStart, rowStop, 0, cols));
-      rowStart = rowStop;
-      rowStop = rowStop + rowIncrement;
-      if(rowStop >= rows)
+      // Update the even slices and then the odd slices. Each slice is handled by a
+      // single task so the slabs are distributed over the threads.
+      for(int zParity = 0; zParity < 2; zParity++)
       {
-        rowStop = rows;
-      }
-    }
-    g->wait();
-
+        ParallelMPMVolumeLoop pvl(data, ykTable.data(), static_cast<uint32_t>(k), zParity);
+#if EMMPM_USE_PARALLEL_ALGORITHMS
+        tbb::parallel_for(tbb::blocked_range<int>(0, slicePairs, 1), pvl, tbb::simple_partitioner());
 #else
-    tbb::parallel_for(tbb::blocked_range2d<int>(0, rows, rows / threads, 0, cols, cols), ParallelMPMLoop(data, yk, &(rndNumbers.front())), tbb::simple_partitioner());
+        pvl.calc(0, slicePairs);
 #endif
-
+      }
+    }
+    else
+    {
+      // Sweep the four checkerboard colors one after another. Both the serial and the
+      // parallel code paths visit the pixels in the same color order, so the result is
+      // independent of the number of threads.
+      for(int color = 0; color < 4; color++)
+      {
+        ParallelMPMLoop pcl(data, yk, static_cast<uint32_t>(k), color & 1, color >> 1);
+#if EMMPM_USE_PARALLEL_ALGORITHMS
+        tbb::parallel_for(tbb::blocked_range2d<int>(0, rows, rowGrain, 0, cols, cols), pcl, tbb::simple_partitioner());
 #else
-    ParallelMPMLoop pcl(data, yk, &(rndNumbers.front()));
-    pcl.calc(0, rows, 0, cols);
+        pcl.calc(0, rows, 0, cols);
 #endif
+      }
+    }
 
     // std::cout << "Counter: " << counter << std::endl;
     EMMPMUtilities::ConvertXtToOutputImage(getData());
@@ -497,7 +652,7 @@ void MPMCalculation::execute()
       {
         for(uint32_t l = 0; l < classes; l++)
         {
-          lij = (cols * rows * l) + (cols * i) + j;
+          lij = (static_cast<size_t>(cols) * rows * l) + (cols * i) + j;
           data->probs[lij] = data->probs[lij] / (real_t)data->mpmIterations;
         }
       }
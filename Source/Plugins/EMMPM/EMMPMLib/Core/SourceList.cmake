@@ -17,6 +17,7 @@ set (EMMPMLib_Core_SRCS
 set (EMMPMLib_Core_HDRS
     ${EMMPMLib_SOURCE_DIR}/Core/EMMPM_Constants.h
     ${EMMPMLib_SOURCE_DIR}/Core/EMMPM_Data.h
+    ${EMMPMLib_SOURCE_DIR}/Core/EMMPM_Random.h
     ${EMMPMLib_SOURCE_DIR}/Core/EMMPMUtilities.h
     ${EMMPMLib_SOURCE_DIR}/Core/InitializationFunctions.h
 )
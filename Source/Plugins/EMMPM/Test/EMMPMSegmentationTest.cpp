@@ -39,10 +39,13 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 #include "UnitTestSupport.hpp"
@@ -347,6 +350,174 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  // Creates a noisy two phase gray scale image whose left half is darker than its right half
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createGrayScaleImage(size_t dims[3])
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("ImageDataContainer");
+    dca->addOrReplaceDataContainer(dc);
+
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(dims);
+    dc->setGeometry(image);
+
+    std::vector<size_t> tDims = {dims[0], dims[1], dims[2]};
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(cellAttrMat);
+
+    std::vector<size_t> cDims(1, 1);
+    UInt8ArrayType::Pointer gray = UInt8ArrayType::CreateArray(tDims, cDims, "GrayImageData", true);
+    uint32_t noise = 12345;
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          noise = noise * 1664525u + 1013904223u;
+          int32_t value = (x < dims[0] / 2) ? 70 : 170;
+          value += static_cast<int32_t>((noise >> 24) % 41) - 20;
+          gray->setValue((z * dims[1] + y) * dims[0] + x, static_cast<uint8_t>(value));
+        }
+      }
+    }
+    cellAttrMat->insertOrAssign(gray);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  UInt8ArrayType::Pointer runSeededEMMPMFilter(const DataContainerArray::Pointer& dca, int randomSeed, const QString& outputName, bool useVolumeSegmentation = false, int volumeNeighborhood = 0)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName("EMMPMFilter");
+    DREAM3D_REQUIRE_VALID_POINTER(filterFactory.get())
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+
+    var.setValue(DataArrayPath("ImageDataContainer", "CellData", "GrayImageData"));
+    propWasSet = filter->setProperty("InputDataArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(DataArrayPath("ImageDataContainer", "CellData", outputName));
+    propWasSet = filter->setProperty("OutputDataArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("UseFixedSeed", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(randomSeed);
+    propWasSet = filter->setProperty("RandomSeed", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(useVolumeSegmentation);
+    propWasSet = filter->setProperty("UseVolumeSegmentation", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(volumeNeighborhood);
+    propWasSet = filter->setProperty("VolumeNeighborhood", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), NO_ERROR)
+
+    UInt8ArrayType::Pointer output = dca->getAttributeMatrix(DataArrayPath("ImageDataContainer", "CellData", ""))->getAttributeArrayAs<UInt8ArrayType>(outputName);
+    DREAM3D_REQUIRE_VALID_POINTER(output.get())
+    return output;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFixedSeedDeterminism()
+  {
+    size_t dims[3] = {64, 48, 1};
+    DataContainerArray::Pointer dca = createGrayScaleImage(dims);
+
+    UInt8ArrayType::Pointer first = runSeededEMMPMFilter(dca, 42, "FirstRun");
+    UInt8ArrayType::Pointer second = runSeededEMMPMFilter(dca, 42, "SecondRun");
+    DREAM3D_REQUIRE_EQUAL(first->getNumberOfTuples(), second->getNumberOfTuples())
+
+    size_t classCounts[2] = {0, 0};
+    for(size_t i = 0; i < first->getNumberOfTuples(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(first->getValue(i), second->getValue(i))
+      DREAM3D_REQUIRED(first->getValue(i), <, 2)
+      classCounts[first->getValue(i)]++;
+    }
+    // Both phases of the image have to be found for the comparison to mean anything
+    DREAM3D_REQUIRED(classCounts[0], >, 0)
+    DREAM3D_REQUIRED(classCounts[1], >, 0)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestVolumeSegmentation()
+  {
+    size_t dims[3] = {24, 20, 8};
+    DataContainerArray::Pointer dca = createGrayScaleImage(dims);
+
+    // 0 selects the 6 face neighbors, 1 all 26 neighbors
+    for(int neighborhood = 0; neighborhood < 2; neighborhood++)
+    {
+      QString name = QString("Volume%1").arg(neighborhood);
+      UInt8ArrayType::Pointer first = runSeededEMMPMFilter(dca, 42, name + "First", true, neighborhood);
+      UInt8ArrayType::Pointer second = runSeededEMMPMFilter(dca, 42, name + "Second", true, neighborhood);
+      DREAM3D_REQUIRE_EQUAL(first->getNumberOfTuples(), dims[0] * dims[1] * dims[2])
+      DREAM3D_REQUIRE_EQUAL(second->getNumberOfTuples(), dims[0] * dims[1] * dims[2])
+
+      // The dark and the bright half of every slice have to end up in different classes
+      size_t darkCounts[2] = {0, 0};
+      size_t brightCounts[2] = {0, 0};
+      for(size_t z = 0; z < dims[2]; z++)
+      {
+        for(size_t y = 0; y < dims[1]; y++)
+        {
+          for(size_t x = 0; x < dims[0]; x++)
+          {
+            size_t index = (z * dims[1] + y) * dims[0] + x;
+            DREAM3D_REQUIRE_EQUAL(first->getValue(index), second->getValue(index))
+            DREAM3D_REQUIRED(first->getValue(index), <, 2)
+            size_t* counts = (x < dims[0] / 2) ? darkCounts : brightCounts;
+            counts[first->getValue(index)]++;
+          }
+        }
+      }
+      size_t halfVoxels = dims[0] * dims[1] * dims[2] / 2;
+      uint8_t darkClass = (darkCounts[0] > darkCounts[1]) ? 0 : 1;
+      DREAM3D_REQUIRED(darkCounts[darkClass], >=, halfVoxels * 95 / 100)
+      DREAM3D_REQUIRED(brightCounts[1 - darkClass], >=, halfVoxels * 95 / 100)
+    }
+
+    // The gradient penalty is only defined on 2D images
+    FilterManager* fm = FilterManager::Instance();
+    AbstractFilter::Pointer filter = fm->getFactoryFromClassName("EMMPMFilter")->create();
+    filter->setDataContainerArray(dca);
+    QVariant var;
+    var.setValue(DataArrayPath("ImageDataContainer", "CellData", "GrayImageData"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("InputDataArrayPath", var), true)
+    var.setValue(DataArrayPath("ImageDataContainer", "CellData", "PenaltyTest"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("OutputDataArrayPath", var), true)
+    var.setValue(true);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("UseVolumeSegmentation", var), true)
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("UseGradientPenalty", var), true)
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -89102)
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -355,6 +526,8 @@ public:
 
     int err = EXIT_SUCCESS;
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
+    DREAM3D_REGISTER_TEST(TestFixedSeedDeterminism())
+    DREAM3D_REGISTER_TEST(TestVolumeSegmentation())
     if(m_ImageProcessingPluginLoaded)
     {
       DREAM3D_REGISTER_TEST(TestEMMPMSegmentation())
@@ -34,6 +34,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "AbaqusHexahedronWriter.h"
 
+#include <vector>
+
 #include <QtCore/QDateTime>
 #include <QtCore/QDir>
 #include <QtCore/QTextStream>
@@ -51,6 +53,7 @@
 #include "SIMPLib/Utilities/TimeUtilities.h"
 
 #include "ImportExport/ImportExportConstants.h"
+#include "ImportExport/ImportExportFilters/util/BufferedFileWriter.h"
 #include "ImportExport/ImportExportVersion.h"
 
 // -----------------------------------------------------------------------------
@@ -191,6 +194,7 @@ void AbaqusHexahedronWriter::execute()
   {
     QString ss = QObject::tr("Error writing output nodes file '%1'").arg(nodesFile);
     setErrorCondition(-1, ss);
+    deleteFile(fileNames); // delete the partially written files
     return;
   }
   if(getCancel()) // Filter has been cancelled
@@ -204,6 +208,7 @@ void AbaqusHexahedronWriter::execute()
   {
     QString ss = QObject::tr("Error writing output elems file '%1'").arg(elemsFile);
     setErrorCondition(-1, ss);
+    deleteFile(fileNames); // delete the partially written files
     return;
   }
   if(getCancel()) // Filter has been cancelled
@@ -217,6 +222,7 @@ void AbaqusHexahedronWriter::execute()
   {
     QString ss = QObject::tr("Error writing output sects file '%1'").arg(sectsFile);
     setErrorCondition(-1, ss);
+    deleteFile(fileNames); // delete the partially written files
     return;
   }
   if(getCancel()) // Filter has been cancelled
@@ -230,6 +236,7 @@ void AbaqusHexahedronWriter::execute()
   {
     QString ss = QObject::tr("Error writing output elset file '%1'").arg(elsetFile);
     setErrorCondition(-1, ss);
+    deleteFile(fileNames); // delete the partially written files
     return;
   }
   if(getCancel()) // Filter has been cancelled
@@ -243,6 +250,7 @@ void AbaqusHexahedronWriter::execute()
   {
     QString ss = QObject::tr("Error writing output master file '%1'").arg(masterFile);
     setErrorCondition(-1, ss);
+    deleteFile(fileNames); // delete the partially written files
     return;
   }
   if(getCancel()) // Filter has been cancelled
@@ -266,17 +274,11 @@ int32_t AbaqusHexahedronWriter::writeNodes(const QList<QString>& fileNames, size
   QTextStream ss(&buf);
 
   size_t pDims[3] = {cDims[0] + 1, cDims[1] + 1, cDims[2] + 1};
-  size_t nodeIndex = 1;
   size_t totalPoints = pDims[0] * pDims[1] * pDims[2];
-  size_t increment = static_cast<size_t>(totalPoints * 0.01f);
-  if(increment == 0) // check to prevent divide by 0
-  {
-    increment = 1;
-  }
 
   int32_t err = 0;
   FILE* f = nullptr;
-  f = fopen(fileNames.at(0).toLatin1().data(), "wb");
+  f = BufferedFileWriter::OpenFile(fileNames.at(0), "wb");
   if(nullptr == f)
   {
     return -1;
@@ -285,43 +287,61 @@ int32_t AbaqusHexahedronWriter::writeNodes(const QList<QString>& fileNames, size
   fprintf(f, "** Generated by : %s\n", ImportExport::Version::PackageComplete().toLatin1().data());
   fprintf(f, "** ----------------------------------------------------------------\n**\n*Node\n");
 
-  for(size_t z = 0; z < pDims[2]; z++)
-  {
-    for(size_t y = 0; y < pDims[1]; y++)
+  const float originX = origin[0];
+  const float originY = origin[1];
+  const float originZ = origin[2];
+  const float spacingX = spacing[0];
+  const float spacingY = spacing[1];
+  const float spacingZ = spacing[2];
+  const size_t xyDim = pDims[0] * pDims[1];
+  const size_t xDim = pDims[0];
+  auto formatter = [=](FormatBuffer& out, size_t begin, size_t end) {
+    for(size_t i = begin; i < end; i++)
     {
-      for(size_t x = 0; x < pDims[0]; x++)
-      {
-        float xCoord = origin[0] + (x * spacing[0]);
-        float yCoord = origin[1] + (y * spacing[1]);
-        float zCoord = origin[2] + (z * spacing[2]);
-        fprintf(f, "%llu, %f, %f, %f\n", static_cast<unsigned long long int>(nodeIndex), xCoord, yCoord, zCoord);
-        if(nodeIndex % increment == 0)
-        {
-          currentMillis = QDateTime::currentMSecsSinceEpoch();
-          if(currentMillis - millis > 1000)
-          {
-            buf.clear();
-            ss << "Writing Nodes (File 1/5) " << static_cast<int>((float)(nodeIndex) / (float)(totalPoints)*100) << "% Completed ";
-            timeDiff = ((float)nodeIndex / (float)(currentMillis - startMillis));
-            estimatedTime = (float)(totalPoints - nodeIndex) / timeDiff;
-            ss << " || Est. Time Remain: " << DREAM3D::convertMillisToHrsMinSecs(estimatedTime);
-            notifyStatusMessage(buf);
-            millis = QDateTime::currentMSecsSinceEpoch();
-            if(getCancel()) // Filter has been cancelled
-            {
-              fclose(f);
-              return 1;
-            }
-          }
-        }
-        ++nodeIndex;
-      }
+      size_t z = i / xyDim;
+      size_t y = (i % xyDim) / xDim;
+      size_t x = i % xDim;
+      out.appendInteger(i + 1);
+      out.append(", ", 2);
+      out.appendFloat(originX + (x * spacingX));
+      out.append(", ", 2);
+      out.appendFloat(originY + (y * spacingY));
+      out.append(", ", 2);
+      out.appendFloat(originZ + (z * spacingZ));
+      out.append('\n');
+    }
+  };
+
+  auto progress = [&](size_t nodeIndex) {
+    currentMillis = QDateTime::currentMSecsSinceEpoch();
+    if(currentMillis - millis > 1000)
+    {
+      buf.clear();
+      ss << "Writing Nodes (File 1/5) " << static_cast<int>((float)(nodeIndex) / (float)(totalPoints)*100) << "% Completed ";
+      timeDiff = ((float)nodeIndex / (float)(currentMillis - startMillis));
+      estimatedTime = (float)(totalPoints - nodeIndex) / timeDiff;
+      ss << " || Est. Time Remain: " << DREAM3D::convertMillisToHrsMinSecs(estimatedTime);
+      notifyStatusMessage(buf);
+      millis = QDateTime::currentMSecsSinceEpoch();
     }
+    return !getCancel();
+  };
+
+  BufferedFileWriter writer(f);
+  if(!writer.writeRange(totalPoints, BufferedFileWriter::k_ItemsPerChunk, formatter, progress))
+  {
+    err = writer.hasError() ? -1 : 1;
+    fclose(f);
+    return err;
   }
 
   // Write the last node, which is a dummy node used for stress - strain curves.
-  fprintf(f, "%d, %f, %f, %f\n", 999999, 0.0f, 0.0f, 0.0f);
-  fprintf(f, "**\n** ----------------------------------------------------------------\n**\n");
+  writer.buffer().append("999999, 0, 0, 0\n");
+  writer.buffer().append("**\n** ----------------------------------------------------------------\n**\n");
+  if(!writer.flush())
+  {
+    err = -1;
+  }
 
   // Close the file
   notifyStatusMessage("Writing Nodes (File 1/5) Complete");
@@ -342,60 +362,69 @@ int32_t AbaqusHexahedronWriter::writeElems(const QList<QString>& fileNames, size
   QString buf;
   QTextStream ss(&buf);
   size_t totalPoints = cDims[0] * cDims[1] * cDims[2];
-  size_t increment = static_cast<size_t>(totalPoints * 0.01f);
-  if(increment == 0) // check to prevent divide by 0
-  {
-    increment = 1;
-  }
 
   int32_t err = 0;
   FILE* f = nullptr;
-  f = fopen(fileNames.at(1).toLatin1().data(), "wb");
+  f = BufferedFileWriter::OpenFile(fileNames.at(1), "wb");
   if(nullptr == f)
   {
     return -1;
   }
 
-  // Get a typedef to shorten up the printf codes
-  using _lli_t_ = long long int;
-
-  size_t index = 1;
   fprintf(f, "** Generated by : %s\n", ImportExport::Version::PackageComplete().toLatin1().data());
   fprintf(f, "** ----------------------------------------------------------------\n**\n*Element, type=C3D8\n");
-  for(size_t z = 0; z < cDims[2]; z++)
-  {
-    for(size_t y = 0; y < cDims[1]; y++)
+
+  const size_t nodeDims[3] = {pDims[0], pDims[1], pDims[2]};
+  const size_t xyDim = cDims[0] * cDims[1];
+  const size_t xDim = cDims[0];
+  // The order that the nodes of each hexahedron are written in
+  const int32_t nodeOrder[8] = {5, 1, 0, 4, 7, 3, 2, 6};
+  auto formatter = [this, nodeDims, xyDim, xDim, nodeOrder](FormatBuffer& out, size_t begin, size_t end) {
+    int64_t nodeId[8];
+    for(size_t i = begin; i < end; i++)
     {
-      for(size_t x = 0; x < cDims[0]; x++)
+      size_t z = i / xyDim;
+      size_t y = (i % xyDim) / xDim;
+      size_t x = i % xDim;
+      getNodeIds(x, y, z, nodeDims, nodeId);
+      out.appendInteger(i + 1);
+      for(int32_t n : nodeOrder)
       {
-        std::vector<int64_t> nodeId = getNodeIds(x, y, z, pDims);
-        fprintf(f, "%llu, %lld, %lld, %lld, %lld, %lld, %lld, %lld, %lld\n", (_lli_t_)index, (_lli_t_)nodeId[5], (_lli_t_)nodeId[1], (_lli_t_)nodeId[0], (_lli_t_)nodeId[4], (_lli_t_)nodeId[7],
-                (_lli_t_)nodeId[3], (_lli_t_)nodeId[2], (_lli_t_)nodeId[6]);
-        if(index % increment == 0)
-        {
-          currentMillis = QDateTime::currentMSecsSinceEpoch();
-          if(currentMillis - millis > 1000)
-          {
-            buf.clear();
-            ss << "Writing Elements (File 2/5) " << static_cast<int>((float)(index) / (float)(totalPoints)*100) << "% Completed ";
-            timeDiff = ((float)index / (float)(currentMillis - startMillis));
-            estimatedTime = (float)(totalPoints - index) / timeDiff;
-            ss << " || Est. Time Remain: " << DREAM3D::convertMillisToHrsMinSecs(estimatedTime);
-            notifyStatusMessage(buf);
-            millis = QDateTime::currentMSecsSinceEpoch();
-            if(getCancel()) // Filter has been cancelled
-            {
-              fclose(f);
-              return 1;
-            }
-          }
-        }
-        ++index;
+        out.append(", ", 2);
+        out.appendInteger(nodeId[n]);
       }
+      out.append('\n');
+    }
+  };
+
+  auto progress = [&](size_t index) {
+    currentMillis = QDateTime::currentMSecsSinceEpoch();
+    if(currentMillis - millis > 1000)
+    {
+      buf.clear();
+      ss << "Writing Elements (File 2/5) " << static_cast<int>((float)(index) / (float)(totalPoints)*100) << "% Completed ";
+      timeDiff = ((float)index / (float)(currentMillis - startMillis));
+      estimatedTime = (float)(totalPoints - index) / timeDiff;
+      ss << " || Est. Time Remain: " << DREAM3D::convertMillisToHrsMinSecs(estimatedTime);
+      notifyStatusMessage(buf);
+      millis = QDateTime::currentMSecsSinceEpoch();
     }
+    return !getCancel();
+  };
+
+  BufferedFileWriter writer(f);
+  if(!writer.writeRange(totalPoints, BufferedFileWriter::k_ItemsPerChunk, formatter, progress))
+  {
+    err = writer.hasError() ? -1 : 1;
+    fclose(f);
+    return err;
   }
 
-  fprintf(f, "**\n** ----------------------------------------------------------------\n**\n");
+  writer.buffer().append("**\n** ----------------------------------------------------------------\n**\n");
+  if(!writer.flush())
+  {
+    err = -1;
+  }
 
   // Close the file
   notifyStatusMessage("Writing Elements (File 2/5) Complete");
@@ -418,7 +447,7 @@ int32_t AbaqusHexahedronWriter::writeElset(const QList<QString>& fileNames, size
 
   int32_t err = 0;
   FILE* f = nullptr;
-  f = fopen(fileNames.at(3).toLatin1().data(), "wb");
+  f = BufferedFileWriter::OpenFile(fileNames.at(3), "wb");
   if(nullptr == f)
   {
     return -1;
@@ -441,59 +470,94 @@ int32_t AbaqusHexahedronWriter::writeElset(const QList<QString>& fileNames, size
     }
   }
 
-  int32_t increment = static_cast<int32_t>(maxGrainId * 0.1f);
-  if(increment == 0) // check to prevent divide by 0
+  // Bucket the element ids by grain with a counting sort so that each grain's set can be written
+  // without scanning the whole volume once per grain.
+  std::vector<size_t> grainStart(static_cast<size_t>(maxGrainId) + 2, 0);
+  for(size_t i = 0; i < totalPoints; i++)
+  {
+    if(m_FeatureIds[i] > 0)
+    {
+      grainStart[m_FeatureIds[i] + 1]++;
+    }
+  }
+  for(size_t g = 1; g < grainStart.size(); g++)
   {
-    increment = 1;
+    grainStart[g] += grainStart[g - 1];
   }
-
-  int32_t voxelId = 1;
-  while(voxelId <= maxGrainId)
+  std::vector<size_t> grainElements(grainStart.back());
   {
-    size_t elementPerLine = 0;
-    fprintf(f, "\n*Elset, elset=Grain%d_set\n", voxelId);
+    std::vector<size_t> fillIndex(grainStart.begin(), grainStart.end() - 1);
+    for(size_t i = 0; i < totalPoints; i++)
+    {
+      if(m_FeatureIds[i] > 0)
+      {
+        grainElements[fillIndex[m_FeatureIds[i]]++] = i + 1;
+      }
+    }
+  }
 
-    for(size_t i = 0; i < totalPoints + 1; i++)
+  const size_t* starts = grainStart.data();
+  const size_t* elements = grainElements.data();
+  auto formatter = [=](FormatBuffer& out, size_t begin, size_t end) {
+    // Items are grain ids minus 1
+    for(size_t g = begin + 1; g < end + 1; g++)
     {
-      if(m_FeatureIds[i] == voxelId)
+      out.append("\n*Elset, elset=Grain");
+      out.appendInteger(g);
+      out.append("_set\n");
+      for(size_t e = starts[g]; e < starts[g + 1]; e++)
       {
+        size_t elementPerLine = e - starts[g];
         if(elementPerLine != 0) // no comma at start
         {
           if((elementPerLine % 16) != 0u) // 16 per line
           {
-            fprintf(f, ", ");
+            out.append(", ", 2);
           }
           else
           {
-            fprintf(f, ",\n");
+            out.append(",\n", 2);
           }
         }
-        fprintf(f, "%llu", static_cast<unsigned long long int>(i + 1));
-        elementPerLine++;
+        out.appendInteger(elements[e]);
       }
     }
-    if(voxelId % increment == 0)
+  };
+
+  auto progress = [&](size_t voxelId) {
+    currentMillis = QDateTime::currentMSecsSinceEpoch();
+    if(currentMillis - millis > 1000)
     {
-      currentMillis = QDateTime::currentMSecsSinceEpoch();
-      if(currentMillis - millis > 1000)
-      {
-        buf.clear();
-        ss << "Writing Element Sets (File 4/5) " << static_cast<int>((float)(voxelId) / (float)(maxGrainId)*100) << "% Completed ";
-        timeDiff = ((float)voxelId / (float)(currentMillis - startMillis));
-        estimatedTime = (float)(maxGrainId - voxelId) / timeDiff;
-        ss << " || Est. Time Remain: " << DREAM3D::convertMillisToHrsMinSecs(estimatedTime);
-        notifyStatusMessage(buf);
-        millis = QDateTime::currentMSecsSinceEpoch();
-        if(getCancel()) // Filter has been cancelled
-        {
-          fclose(f);
-          return 1;
-        }
-      }
+      buf.clear();
+      ss << "Writing Element Sets (File 4/5) " << static_cast<int>((float)(voxelId) / (float)(maxGrainId)*100) << "% Completed ";
+      timeDiff = ((float)voxelId / (float)(currentMillis - startMillis));
+      estimatedTime = (float)(maxGrainId - voxelId) / timeDiff;
+      ss << " || Est. Time Remain: " << DREAM3D::convertMillisToHrsMinSecs(estimatedTime);
+      notifyStatusMessage(buf);
+      millis = QDateTime::currentMSecsSinceEpoch();
     }
-    voxelId++;
+    return !getCancel();
+  };
+
+  // Chunk the grains so that each chunk holds roughly k_ItemsPerChunk elements
+  size_t grainsPerChunk = 1;
+  if(totalPoints > 0)
+  {
+    grainsPerChunk = static_cast<size_t>(maxGrainId) * BufferedFileWriter::k_ItemsPerChunk / totalPoints + 1;
+  }
+
+  BufferedFileWriter writer(f);
+  if(!writer.writeRange(static_cast<size_t>(maxGrainId), grainsPerChunk, formatter, progress))
+  {
+    err = writer.hasError() ? -1 : 1;
+    fclose(f);
+    return err;
+  }
+  writer.buffer().append("\n**\n** ----------------------------------------------------------------\n**\n");
+  if(!writer.flush())
+  {
+    err = -1;
   }
-  fprintf(f, "\n**\n** ----------------------------------------------------------------\n**\n");
 
   // Close the file
   notifyStatusMessage("Writing Element Sets (File 4/5) Complete");
@@ -508,7 +572,7 @@ int32_t AbaqusHexahedronWriter::writeMaster(const QString& file)
 {
   int32_t err = 0;
   FILE* f = nullptr;
-  f = fopen(file.toLatin1().data(), "wb");
+  f = BufferedFileWriter::OpenFile(file, "wb");
   if(nullptr == f)
   {
     return -1;
@@ -539,7 +603,7 @@ int32_t AbaqusHexahedronWriter::writeSects(const QString& file, size_t totalPoin
 {
   int32_t err = 0;
   FILE* f = nullptr;
-  f = fopen(file.toLatin1().data(), "wb");
+  f = BufferedFileWriter::OpenFile(file, "wb");
   if(nullptr == f)
   {
     return -1;
@@ -578,10 +642,8 @@ int32_t AbaqusHexahedronWriter::writeSects(const QString& file, size_t totalPoin
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-std::vector<int64_t> AbaqusHexahedronWriter::getNodeIds(size_t x, size_t y, size_t z, size_t* pDims)
+void AbaqusHexahedronWriter::getNodeIds(size_t x, size_t y, size_t z, const size_t* pDims, int64_t* nodeId) const
 {
-  std::vector<int64_t> nodeId(8, 0);
-
   nodeId[0] = static_cast<int64_t>(1 + (pDims[0] * pDims[1] * z) + (pDims[0] * y) + x);
   nodeId[1] = static_cast<int64_t>(1 + (pDims[0] * pDims[1] * z) + (pDims[0] * y) + (x + 1));
   nodeId[2] = static_cast<int64_t>(1 + (pDims[0] * pDims[1] * z) + (pDims[0] * (y + 1)) + x);
@@ -605,7 +667,6 @@ std::vector<int64_t> AbaqusHexahedronWriter::getNodeIds(size_t x, size_t y, size
     printf("         | /        |/     \n");
     printf("        %lld--------%lld     \n", static_cast<long long int>(nodeId[2]), static_cast<long long int>(nodeId[3]));
 #endif
-  return nodeId;
 }
 
 // -----------------------------------------------------------------------------
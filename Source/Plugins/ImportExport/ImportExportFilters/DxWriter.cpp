@@ -35,6 +35,7 @@
 #include "DxWriter.h"
 
 #include <QtCore/QDir>
+#include <QtCore/QFile>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -49,6 +50,7 @@
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
 
 #include "ImportExport/ImportExportConstants.h"
+#include "ImportExport/ImportExportFilters/util/BufferedFileWriter.h"
 #include "ImportExport/ImportExportVersion.h"
 
 // -----------------------------------------------------------------------------
@@ -182,15 +184,14 @@ int32_t DxWriter::writeFile()
     return -1;
   }
 
-  QFile file(getOutputFile());
-  if(!file.open(QIODevice::WriteOnly | QIODevice::Text))
+  FILE* f = BufferedFileWriter::OpenFile(getOutputFile(), "wb");
+  if(nullptr == f)
   {
     QString ss = QObject::tr("Error opening output file '%1'").arg(getOutputFile());
     setErrorCondition(-100, ss);
     return getErrorCode();
   }
 
-  QTextStream out(&file);
   int64_t fileXDim = dims[0];
   int64_t fileYDim = dims[1];
   int64_t fileZDim = dims[2];
@@ -210,32 +211,32 @@ int32_t DxWriter::writeFile()
     posZDim = fileZDim;
   }
 
+  using _lli_t_ = long long int;
+
   // Write the header
-  out << "# object 1 are the regular positions. The grid is " << posZDim << " " << posYDim << " " << posXDim << ". The origin is\n";
-  out << "# at [0 0 0], and the deltas are 1 in the first and third dimensions, and\n";
-  out << "# 2 in the second dimension\n";
-  out << "#\n";
-  out << "object 1 class gridpositions counts " << posZDim << " " << posYDim << " " << posXDim << "\n";
-  out << "origin 0 0 0"
-      << "\n";
-  out << "delta  1 0 0"
-      << "\n";
-  out << "delta  0 1 0"
-      << "\n";
-  out << "delta  0 0 1"
-      << "\n";
-  out << "#\n";
-  out << "# object 2 are the regular connections\n";
-  out << "#\n";
-  out << "object 2 class gridconnections counts " << posZDim << " " << posYDim << " " << posXDim << "\n";
-  out << "#\n";
-  out << "# object 3 are the data, which are in a one-to-one correspondence with\n";
-  out << "# the positions (\"dep\" on positions). The positions increment in the order\n";
-  out << "# \"last index varies fastest\", i.e. (x0, y0, z0), (x0, y0, z1), (x0, y0, z2),\n";
-  out << "# (x0, y1, z0), etc.\n";
-  out << "#\n";
-  out << "object 3 class array type int rank 0 items " << fileXDim * fileYDim * fileZDim << " data follows"
-      << "\n";
+  fprintf(f, "# object 1 are the regular positions. The grid is %lld %lld %lld. The origin is\n", (_lli_t_)posZDim, (_lli_t_)posYDim, (_lli_t_)posXDim);
+  fprintf(f, "# at [0 0 0], and the deltas are 1 in the first and third dimensions, and\n");
+  fprintf(f, "# 2 in the second dimension\n");
+  fprintf(f, "#\n");
+  fprintf(f, "object 1 class gridpositions counts %lld %lld %lld\n", (_lli_t_)posZDim, (_lli_t_)posYDim, (_lli_t_)posXDim);
+  fprintf(f, "origin 0 0 0\n");
+  fprintf(f, "delta  1 0 0\n");
+  fprintf(f, "delta  0 1 0\n");
+  fprintf(f, "delta  0 0 1\n");
+  fprintf(f, "#\n");
+  fprintf(f, "# object 2 are the regular connections\n");
+  fprintf(f, "#\n");
+  fprintf(f, "object 2 class gridconnections counts %lld %lld %lld\n", (_lli_t_)posZDim, (_lli_t_)posYDim, (_lli_t_)posXDim);
+  fprintf(f, "#\n");
+  fprintf(f, "# object 3 are the data, which are in a one-to-one correspondence with\n");
+  fprintf(f, "# the positions (\"dep\" on positions). The positions increment in the order\n");
+  fprintf(f, "# \"last index varies fastest\", i.e. (x0, y0, z0), (x0, y0, z1), (x0, y0, z2),\n");
+  fprintf(f, "# (x0, y1, z0), etc.\n");
+  fprintf(f, "#\n");
+  fprintf(f, "object 3 class array type int rank 0 items %lld data follows\n", (_lli_t_)(fileXDim * fileYDim * fileZDim));
+
+  BufferedFileWriter writer(f);
+  FormatBuffer& out = writer.buffer();
 
   // Add a complete layer of surface voxels
   size_t rnIndex = 1;
@@ -243,65 +244,73 @@ int32_t DxWriter::writeFile()
   {
     for(int64_t i = 0; i < (fileXDim * fileYDim); ++i)
     {
-      out << "-3 ";
+      out.append("-3 ", 3);
       if(rnIndex == 20)
       {
         rnIndex = 0;
-        out << "\n";
+        out.append('\n');
       }
       rnIndex++;
     }
   }
 
-  int64_t index = 0;
-  for(int64_t x = 0; x < dims[0]; ++x)
-  {
-    // Add a leading surface Row for this plane if needed
-    if(m_AddSurfaceLayer)
-    {
-      for(int64_t i = 0; i < fileXDim; ++i)
-      {
-        out << "-4 ";
-      }
-      out << "\n";
-    }
-    for(int64_t y = 0; y < dims[1]; ++y)
+  // The voxel data is written one X plane at a time. Each plane is formatted independently so
+  // groups of planes are formatted in parallel and then written in order.
+  const int32_t* featureIds = m_FeatureIds;
+  const bool addSurfaceLayer = m_AddSurfaceLayer;
+  auto formatPlanes = [=](FormatBuffer& planes, size_t begin, size_t end) {
+    for(int64_t x = static_cast<int64_t>(begin); x < static_cast<int64_t>(end); ++x)
     {
-      // write leading surface voxel for this row
-      if(m_AddSurfaceLayer)
+      // Add a leading surface Row for this plane if needed
+      if(addSurfaceLayer)
       {
-        out << "-5 ";
+        for(int64_t i = 0; i < fileXDim; ++i)
+        {
+          planes.append("-4 ", 3);
+        }
+        planes.append('\n');
       }
-      // Write the actual voxel data
-      for(int64_t z = 0; z < dims[2]; ++z)
+      for(int64_t y = 0; y < dims[1]; ++y)
       {
-        index = (z * dims[0] * dims[1]) + (dims[0] * y) + x;
-        if(m_FeatureIds[index] == 0)
+        // write leading surface voxel for this row
+        if(addSurfaceLayer)
         {
-          out << "0"
-              << " ";
+          planes.append("-5 ", 3);
         }
-        else
+        // Write the actual voxel data
+        for(int64_t z = 0; z < dims[2]; ++z)
         {
-          out << m_FeatureIds[index] << " ";
+          int64_t index = (z * dims[0] * dims[1]) + (dims[0] * y) + x;
+          planes.appendInteger(featureIds[index]);
+          planes.append(' ');
         }
+        // write trailing surface voxel for this row
+        if(addSurfaceLayer)
+        {
+          planes.append("-6 ", 3);
+        }
+        planes.append('\n');
       }
-      // write trailing surface voxel for this row
-      if(m_AddSurfaceLayer)
-      {
-        out << "-6 ";
-      }
-      out << "\n";
-    }
-    // Add a trailing surface Row for this plane if needed
-    if(m_AddSurfaceLayer)
-    {
-      for(int64_t i = 0; i < fileXDim; ++i)
+      // Add a trailing surface Row for this plane if needed
+      if(addSurfaceLayer)
       {
-        out << "-7 ";
+        for(int64_t i = 0; i < fileXDim; ++i)
+        {
+          planes.append("-7 ", 3);
+        }
+        planes.append('\n');
       }
-      out << "\n";
     }
+  };
+  size_t voxelsPerPlane = static_cast<size_t>(dims[1] * dims[2]);
+  size_t planesPerChunk = voxelsPerPlane == 0 ? 1 : BufferedFileWriter::k_ItemsPerChunk * 4 / voxelsPerPlane;
+  if(!writer.writeRange(static_cast<size_t>(dims[0]), planesPerChunk, formatPlanes))
+  {
+    fclose(f);
+    QFile::remove(getOutputFile());
+    QString ss = QObject::tr("Error writing to output file '%1'").arg(getOutputFile());
+    setErrorCondition(-101, ss);
+    return getErrorCode();
   }
 
   // Add a complete layer of surface voxels
@@ -310,34 +319,36 @@ int32_t DxWriter::writeFile()
     rnIndex = 1;
     for(int64_t i = 0; i < (fileXDim * fileYDim); ++i)
     {
-      out << "-8 ";
+      out.append("-8 ", 3);
       if(rnIndex == 20)
       {
-        out << "\n";
+        out.append('\n');
         rnIndex = 0;
       }
       rnIndex++;
     }
   }
 
-  out << "attribute \"dep\" string \"positions\"\n";
-  out << "#\n";
-  out << "# A field is created with three components: \"positions\", \"connections\",\n";
-  out << "# and \"data\"\n";
-  out << "object \"regular positions regular connections\" class field"
-      << "\n";
-  out << "component  \"positions\"    value 1"
-      << "\n";
-  out << "component  \"connections\"  value 2"
-      << "\n";
-  out << "component  \"data\"         value 3"
-      << "\n";
-  out << "#"
-      << "\n";
-  out << "end"
-      << "\n";
-
-  file.close();
+  out.append("attribute \"dep\" string \"positions\"\n");
+  out.append("#\n");
+  out.append("# A field is created with three components: \"positions\", \"connections\",\n");
+  out.append("# and \"data\"\n");
+  out.append("object \"regular positions regular connections\" class field\n");
+  out.append("component  \"positions\"    value 1\n");
+  out.append("component  \"connections\"  value 2\n");
+  out.append("component  \"data\"         value 3\n");
+  out.append("#\n");
+  out.append("end\n");
+
+  if(!writer.flush())
+  {
+    fclose(f);
+    QFile::remove(getOutputFile());
+    QString ss = QObject::tr("Error writing to output file '%1'").arg(getOutputFile());
+    setErrorCondition(-101, ss);
+    return getErrorCode();
+  }
+  fclose(f);
 #if 0
   out.open("/tmp/m3cmesh.raw", std::ios_base::binary);
   out.write((const char*)(&dims[0]), 4);
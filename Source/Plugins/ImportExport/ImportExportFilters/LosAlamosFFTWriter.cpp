@@ -35,6 +35,7 @@
 #include "LosAlamosFFTWriter.h"
 
 #include <QtCore/QDir>
+#include <QtCore/QFile>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -49,6 +50,7 @@
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
 
 #include "ImportExport/ImportExportConstants.h"
+#include "ImportExport/ImportExportFilters/util/BufferedFileWriter.h"
 #include "ImportExport/ImportExportVersion.h"
 
 #define LLU_CAST(arg) static_cast<unsigned long long int>(arg)
@@ -195,7 +197,7 @@ int32_t LosAlamosFFTWriter::writeFile()
     return -1;
   }
 
-  FILE* f = fopen(getOutputFile().toLatin1().data(), "wb");
+  FILE* f = BufferedFileWriter::OpenFile(getOutputFile(), "wb");
   if(nullptr == f)
   {
     QString ss = QObject::tr("Error opening output file '%1'").arg(getOutputFile());
@@ -203,26 +205,57 @@ int32_t LosAlamosFFTWriter::writeFile()
     return -1;
   }
 
-  float phi1 = 0.0f, phi = 0.0f, phi2 = 0.0f;
-  int32_t featureId = 0;
-  int32_t phaseId = 0;
+  const float* eulers = m_CellEulerAngles;
+  const int32_t* featureIds = m_FeatureIds;
+  const int32_t* cellPhases = m_CellPhases;
+  const size_t xDim = dims[0];
+  const size_t xyDim = dims[0] * dims[1];
 
-  size_t index = 0;
-  for(size_t z = 0; z < dims[2]; ++z)
+  // Each line is formatted exactly as "%.3f %.3f %.3f %llu %llu %llu %d %d\n" would format it
+  auto formatter = [=](FormatBuffer& out, size_t begin, size_t end) {
+    for(size_t index = begin; index < end; index++)
+    {
+      size_t z = index / xyDim;
+      size_t y = (index % xyDim) / xDim;
+      size_t x = index % xDim;
+      float phi1 = eulers[index * 3] * 180.0 * SIMPLib::Constants::k_1OverPiD;
+      float phi = eulers[index * 3 + 1] * 180.0 * SIMPLib::Constants::k_1OverPiD;
+      float phi2 = eulers[index * 3 + 2] * 180.0 * SIMPLib::Constants::k_1OverPiD;
+      out.appendFixed(phi1, 3);
+      out.append(' ');
+      out.appendFixed(phi, 3);
+      out.append(' ');
+      out.appendFixed(phi2, 3);
+      out.append(' ');
+      out.appendInteger(x + 1);
+      out.append(' ');
+      out.appendInteger(y + 1);
+      out.append(' ');
+      out.appendInteger(z + 1);
+      out.append(' ');
+      out.appendInteger(featureIds[index]);
+      out.append(' ');
+      out.appendInteger(cellPhases[index]);
+      out.append('\n');
+    }
+  };
+
+  BufferedFileWriter writer(f);
+  if(!writer.writeRange(xyDim * dims[2], BufferedFileWriter::k_ItemsPerChunk, formatter, [this](size_t) { return !getCancel(); }) || !writer.flush())
   {
-    for(size_t y = 0; y < dims[1]; ++y)
+    // Do not leave a truncated file behind that looks like a complete one
+    bool writeFailed = writer.hasError();
+    fclose(f);
+    QFile::remove(getOutputFile());
+    if(writeFailed)
     {
-      for(size_t x = 0; x < dims[0]; ++x)
-      {
-        index = (z * dims[0] * dims[1]) + (dims[0] * y) + x;
-        phi1 = m_CellEulerAngles[index * 3] * 180.0 * SIMPLib::Constants::k_1OverPiD;
-        phi = m_CellEulerAngles[index * 3 + 1] * 180.0 * SIMPLib::Constants::k_1OverPiD;
-        phi2 = m_CellEulerAngles[index * 3 + 2] * 180.0 * SIMPLib::Constants::k_1OverPiD;
-        featureId = m_FeatureIds[index];
-        phaseId = m_CellPhases[index];
-        fprintf(f, "%.3f %.3f %.3f %llu %llu %llu %d %d\n", phi1, phi, phi2, LLU_CAST(x + 1), LLU_CAST(y + 1), LLU_CAST(z + 1), featureId, phaseId);
-      }
+      QString ss = QObject::tr("Error writing to output file '%1'").arg(getOutputFile());
+      setErrorCondition(-2, ss);
+      return -2;
     }
+    QString ss = QObject::tr("Writing the output file '%1' was canceled and the partial file was removed").arg(getOutputFile());
+    setErrorCondition(-3, ss);
+    return -3;
   }
 
   fclose(f);
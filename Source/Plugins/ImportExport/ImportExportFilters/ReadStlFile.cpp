@@ -35,9 +35,13 @@
 
 #include "ReadStlFile.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <tuple>
 
+#include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QTextStream>
 
@@ -46,6 +50,7 @@
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataContainerCreationFilterParameter.h"
+#include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
@@ -76,57 +81,267 @@ constexpr int32_t k_StlHeaderParseError = -1104;
 constexpr int32_t k_TriangleCountParseError = -1105;
 constexpr int32_t k_TriangleParseError = -1106;
 constexpr int32_t k_AttributeParseError = -1107;
+constexpr int32_t k_InvalidWeldTolerance = -1108;
 } // namespace ReadStlFileErrors
 
+namespace StlVertexWelding
+{
+constexpr size_t k_RecordSize = 50;
+constexpr size_t k_FirstRecordOffset = STL_HEADER_LENGTH + 4;
+constexpr size_t k_TrianglesPerChunk = 65536;
+constexpr size_t k_ShardBits = 8;
+constexpr size_t k_ShardCount = 1ULL << k_ShardBits;
+constexpr size_t k_NoEntry = std::numeric_limits<size_t>::max();
+
 /**
- * @brief The FindUniqueIdsImpl class implements a threaded algorithm that determines the set of
- * unique vertices in the triangle geometry
+ * @brief The Records class gives random access to the triangle records of a binary STL file that
+ * is held in memory. Records are 50 bytes apart unless the file uses the attribute byte count, in
+ * which case the offset of every record is looked up.
  */
-class FindUniqueIdsImpl
+class Records
 {
 public:
-  FindUniqueIdsImpl(SharedVertexList::Pointer vertex, const std::vector<std::vector<size_t>>& nodesInBin, int64_t* uniqueIds)
-  : m_Vertex(vertex)
-  , m_NodesInBin(nodesInBin)
-  , m_UniqueIds(uniqueIds)
+  Records(const uint8_t* fileData, const size_t* recordOffsets)
+  : m_FileData(fileData)
+  , m_RecordOffsets(recordOffsets)
   {
   }
 
-  // -----------------------------------------------------------------------------
-  void convert(size_t start, size_t end) const
+  const uint8_t* record(size_t t) const
   {
-    float* verts = m_Vertex->getPointer(0);
-    for(size_t i = start; i < end; i++)
+    return m_FileData + (nullptr != m_RecordOffsets ? m_RecordOffsets[t] : k_FirstRecordOffset + t * k_RecordSize);
+  }
+
+  /**
+   * @brief Copies corner c (triangle c / 3, vertex c % 3) into xyz
+   */
+  void corner(size_t c, float* xyz) const
+  {
+    ::memcpy(xyz, record(c / 3) + 12 + 12 * (c % 3), 3 * sizeof(float));
+  }
+
+private:
+  const uint8_t* m_FileData = nullptr;
+  const size_t* m_RecordOffsets = nullptr;
+};
+
+/**
+ * @brief The Key struct identifies the weld cell of a vertex. With a zero tolerance the key is the bit
+ * pattern of the coordinates so only identical vertices are welded.
+ */
+struct Key
+{
+  int64_t cell[3];
+
+  bool operator==(const Key& other) const
+  {
+    return cell[0] == other.cell[0] && cell[1] == other.cell[1] && cell[2] == other.cell[2];
+  }
+};
+
+inline Key MakeKey(const float* xyz, float tolerance)
+{
+  Key key = {{0, 0, 0}};
+  for(size_t i = 0; i < 3; i++)
+  {
+    if(tolerance > 0.0f)
     {
-      for(size_t j = 0; j < m_NodesInBin[i].size(); j++)
+      key.cell[i] = static_cast<int64_t>(std::floor(static_cast<double>(xyz[i]) / static_cast<double>(tolerance)));
+    }
+    else
+    {
+      // -0.0 and 0.0 compare equal so they have to produce the same key
+      float value = (xyz[i] == 0.0f) ? 0.0f : xyz[i];
+      uint32_t bits = 0;
+      ::memcpy(&bits, &value, sizeof(bits));
+      key.cell[i] = static_cast<int64_t>(bits);
+    }
+  }
+  return key;
+}
+
+inline uint64_t HashKey(const Key& key)
+{
+  uint64_t hash = 0x9E3779B97F4A7C15ULL;
+  for(int64_t value : key.cell)
+  {
+    hash ^= static_cast<uint64_t>(value) + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+  }
+  hash ^= hash >> 30;
+  hash *= 0xBF58476D1CE4E5B9ULL;
+  hash ^= hash >> 27;
+  hash *= 0x94D049BB133111EBULL;
+  hash ^= hash >> 31;
+  return hash;
+}
+
+inline size_t ShardOf(uint64_t hash)
+{
+  return static_cast<size_t>(hash >> (64 - k_ShardBits));
+}
+
+/**
+ * @brief The ReadRecordsImpl class decodes the face normals, stores the weld key hash of every
+ * triangle corner in the triangle list and counts how many corners of each chunk fall into each shard.
+ */
+class ReadRecordsImpl
+{
+public:
+  ReadRecordsImpl(const Records& records, size_t triCount, float tolerance, double* normals, MeshIndexType* cornerHashes, size_t* shardCounts)
+  : m_Records(records)
+  , m_TriCount(triCount)
+  , m_Tolerance(tolerance)
+  , m_Normals(normals)
+  , m_CornerHashes(cornerHashes)
+  , m_ShardCounts(shardCounts)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    float v[3] = {0.0f, 0.0f, 0.0f};
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      size_t* counts = m_ShardCounts + chunk * k_ShardCount;
+      size_t end = std::min(m_TriCount, (chunk + 1) * k_TrianglesPerChunk);
+      for(size_t t = chunk * k_TrianglesPerChunk; t < end; t++)
       {
-        size_t node1 = m_NodesInBin[i][j];
-        if(m_UniqueIds[node1] == static_cast<int64_t>(node1))
+        ::memcpy(v, m_Records.record(t), sizeof(v));
+        m_Normals[3 * t + 0] = static_cast<double>(v[0]);
+        m_Normals[3 * t + 1] = static_cast<double>(v[1]);
+        m_Normals[3 * t + 2] = static_cast<double>(v[2]);
+        for(size_t c = 3 * t; c < 3 * t + 3; c++)
         {
-          for(size_t k = j + 1; k < m_NodesInBin[i].size(); k++)
-          {
-            size_t node2 = m_NodesInBin[i][k];
-            if(verts[node1 * 3] == verts[node2 * 3] && verts[node1 * 3 + 1] == verts[node2 * 3 + 1] && verts[node1 * 3 + 2] == verts[node2 * 3 + 2])
-            {
-              m_UniqueIds[node2] = node1;
-            }
-          }
+          m_Records.corner(c, v);
+          uint64_t hash = HashKey(MakeKey(v, m_Tolerance));
+          m_CornerHashes[c] = static_cast<MeshIndexType>(hash);
+          counts[ShardOf(hash)]++;
         }
       }
     }
   }
 
-  // -----------------------------------------------------------------------------
+private:
+  const Records& m_Records;
+  size_t m_TriCount = 0;
+  float m_Tolerance = 0.0f;
+  double* m_Normals = nullptr;
+  MeshIndexType* m_CornerHashes = nullptr;
+  size_t* m_ShardCounts = nullptr;
+};
+
+/**
+ * @brief The ScatterCornersImpl class sorts the corner indices by shard. Each chunk writes to its own
+ * slice of every shard so the corners of a shard stay in ascending order.
+ */
+class ScatterCornersImpl
+{
+public:
+  ScatterCornersImpl(size_t triCount, const MeshIndexType* cornerHashes, size_t* shardOffsets, size_t* cornerOrder)
+  : m_TriCount(triCount)
+  , m_CornerHashes(cornerHashes)
+  , m_ShardOffsets(shardOffsets)
+  , m_CornerOrder(cornerOrder)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      size_t* offsets = m_ShardOffsets + chunk * k_ShardCount;
+      size_t end = 3 * std::min(m_TriCount, (chunk + 1) * k_TrianglesPerChunk);
+      for(size_t c = 3 * chunk * k_TrianglesPerChunk; c < end; c++)
+      {
+        m_CornerOrder[offsets[ShardOf(m_CornerHashes[c])]++] = c;
+      }
+    }
+  }
+
+private:
+  size_t m_TriCount = 0;
+  const MeshIndexType* m_CornerHashes = nullptr;
+  size_t* m_ShardOffsets = nullptr;
+  size_t* m_CornerOrder = nullptr;
+};
+
+/**
+ * @brief The WeldShardsImpl class finds the first corner with the same weld key for every corner of
+ * a shard using an open addressing hash table, and replaces the corner hash in the triangle list
+ * with the index of that corner.
+ */
+class WeldShardsImpl
+{
+public:
+  WeldShardsImpl(const Records& records, float tolerance, const size_t* cornerOrder, const size_t* shardStart, MeshIndexType* corners)
+  : m_Records(records)
+  , m_Tolerance(tolerance)
+  , m_CornerOrder(cornerOrder)
+  , m_ShardStart(shardStart)
+  , m_Corners(corners)
+  {
+  }
+
   void operator()(const SIMPLRange& range) const
   {
-    convert(range.min(), range.max());
+    struct Entry
+    {
+      uint64_t hash;
+      size_t corner;
+    };
+    std::vector<Entry> table;
+    float v[3] = {0.0f, 0.0f, 0.0f};
+    for(size_t shard = range.min(); shard < range.max(); shard++)
+    {
+      size_t count = m_ShardStart[shard + 1] - m_ShardStart[shard];
+      size_t tableSize = 16;
+      while(tableSize < 2 * count)
+      {
+        tableSize *= 2;
+      }
+      const size_t mask = tableSize - 1;
+      table.assign(tableSize, Entry{0, k_NoEntry});
+
+      for(size_t i = m_ShardStart[shard]; i < m_ShardStart[shard + 1]; i++)
+      {
+        size_t c = m_CornerOrder[i];
+        uint64_t hash = static_cast<uint64_t>(m_Corners[c]);
+        m_Records.corner(c, v);
+        Key key = MakeKey(v, m_Tolerance);
+
+        size_t slot = static_cast<size_t>(hash) & mask;
+        size_t representative = c;
+        while(table[slot].corner != k_NoEntry)
+        {
+          if(table[slot].hash == hash)
+          {
+            float other[3] = {0.0f, 0.0f, 0.0f};
+            m_Records.corner(table[slot].corner, other);
+            if(MakeKey(other, m_Tolerance) == key)
+            {
+              representative = table[slot].corner;
+              break;
+            }
+          }
+          slot = (slot + 1) & mask;
+        }
+        if(representative == c)
+        {
+          table[slot] = Entry{hash, c};
+        }
+        m_Corners[c] = static_cast<MeshIndexType>(representative);
+      }
+    }
   }
 
 private:
-  SharedVertexList::Pointer m_Vertex;
-  const std::vector<std::vector<size_t>>& m_NodesInBin;
-  int64_t* m_UniqueIds = nullptr;
+  const Records& m_Records;
+  float m_Tolerance = 0.0f;
+  const size_t* m_CornerOrder = nullptr;
+  const size_t* m_ShardStart = nullptr;
+  MeshIndexType* m_Corners = nullptr;
 };
+} // namespace StlVertexWelding
 
 // -----------------------------------------------------------------------------
 // Returns 0 for Binary, 1 for ASCII, anything else is an error.
@@ -190,6 +405,7 @@ void ReadStlFile::setupFilterParameters()
   FilterParameterVectorType parameters;
 
   parameters.push_back(SIMPL_NEW_INPUT_FILE_FP("STL File", StlFilePath, FilterParameter::Category::Parameter, ReadStlFile, "*.stl", "STL File"));
+  parameters.push_back(SIMPL_NEW_FLOAT_FP("Vertex Weld Tolerance", WeldTolerance, FilterParameter::Category::Parameter, ReadStlFile));
   parameters.push_back(SIMPL_NEW_DC_CREATION_FP("Data Container", SurfaceMeshDataContainerName, FilterParameter::Category::CreatedArray, ReadStlFile));
   parameters.push_back(SeparatorFilterParameter::Create("Face Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_AM_WITH_LINKED_DC_FP("Face Attribute Matrix", FaceAttributeMatrixName, SurfaceMeshDataContainerName, FilterParameter::Category::CreatedArray, ReadStlFile));
@@ -205,6 +421,7 @@ void ReadStlFile::readFilterParameters(AbstractFilterParametersReader* reader, i
 {
   reader->openFilterGroup(this, index);
   setStlFilePath(reader->readString("StlFilePath", getStlFilePath()));
+  setWeldTolerance(reader->readValue("WeldTolerance", getWeldTolerance()));
   setFaceAttributeMatrixName(reader->readString("FaceAttributeMatrixName", getFaceAttributeMatrixName()));
   setSurfaceMeshDataContainerName(reader->readDataArrayPath("SurfaceMeshDataContainerName", getSurfaceMeshDataContainerName()));
   setFaceNormalsArrayName(reader->readString("FaceNormalsArrayName", getFaceNormalsArrayName()));
@@ -230,12 +447,6 @@ void ReadStlFile::updateFaceInstancePointers()
 // -----------------------------------------------------------------------------
 void ReadStlFile::initialize()
 {
-  m_minXcoord = std::numeric_limits<float>::max();
-  m_maxXcoord = -std::numeric_limits<float>::max();
-  m_minYcoord = std::numeric_limits<float>::max();
-  m_maxYcoord = -std::numeric_limits<float>::max();
-  m_minZcoord = std::numeric_limits<float>::max();
-  m_maxZcoord = -std::numeric_limits<float>::max();
 }
 
 // -----------------------------------------------------------------------------
@@ -262,6 +473,11 @@ void ReadStlFile::dataCheck()
     setErrorCondition(ReadStlFileErrors::k_InputFileDoesNotExist, ss);
   }
 
+  if(getWeldTolerance() < 0.0f)
+  {
+    QString ss = QObject::tr("The vertex weld tolerance must be zero or positive");
+    setErrorCondition(ReadStlFileErrors::k_InvalidWeldTolerance, ss);
+  }
   int32_t fileType = getStlFileType(getStlFilePath().toStdString());
   if(fileType == 1)
   {
@@ -314,7 +530,6 @@ void ReadStlFile::execute()
   }
 
   readFile();
-  eliminate_duplicate_nodes();
 
   clearErrorCode();
   clearWarningCode();
@@ -325,24 +540,30 @@ void ReadStlFile::execute()
 // -----------------------------------------------------------------------------
 void ReadStlFile::readFile()
 {
-  DataContainer::Pointer sm = getDataContainerArray()->getDataContainer(m_SurfaceMeshDataContainerName);
-
   // Open File
-  FILE* f = std::fopen(m_StlFilePath.toLatin1().data(), "rb");
-  if(nullptr == f)
+  QFile file(m_StlFilePath);
+  if(!file.open(QIODevice::ReadOnly))
   {
     setErrorCondition(ReadStlFileErrors::k_ErrorOpeningFile, "Error opening STL file");
     return;
   }
 
+  // Map the whole file so the triangle records can be decoded in parallel. If the file can not
+  // be mapped then read it into memory instead.
+  const size_t fileSize = static_cast<size_t>(file.size());
+  QByteArray fileContents;
+  const uint8_t* fileData = file.map(0, file.size());
+  if(nullptr == fileData)
+  {
+    fileContents = file.readAll();
+    fileData = reinterpret_cast<const uint8_t*>(fileContents.constData());
+  }
+
   // Read Header
-  char h[STL_HEADER_LENGTH];
-  int32_t triCount = 0;
-  if(std::fread(h, STL_HEADER_LENGTH, 1, f) != 1)
+  if(fileSize < STL_HEADER_LENGTH)
   {
-    QString msg = QString("Error reading first 8 bytes of STL header. This can't be good.");
+    QString msg = QString("Error reading first 80 bytes of STL header. This can't be good.");
     setErrorCondition(ReadStlFileErrors::k_StlHeaderParseError, msg);
-    std::ignore = fclose(f);
     return;
   }
 
@@ -352,7 +573,7 @@ void ReadStlFile::readFile()
   // This NON Zero value does NOT indicate a length but is some sort of color
   // value encoded into the file. Instead of being normal like everyone else and
   // using the STL spec they went off and did their own thing.
-  QByteArray headerArray(h, STL_HEADER_LENGTH);
+  QByteArray headerArray(reinterpret_cast<const char*>(fileData), STL_HEADER_LENGTH);
   QString headerString(headerArray);
   bool magicsFile = false;
   static const QString k_ColorHeader("COLOR=");
@@ -361,245 +582,157 @@ void ReadStlFile::readFile()
   {
     magicsFile = true;
   }
+
   // Read the number of triangles in the file.
-  if(std::fread(&triCount, sizeof(int32_t), 1, f) != 1)
+  int32_t triCount = 0;
+  if(fileSize < StlVertexWelding::k_FirstRecordOffset)
   {
     QString msg = QString("Error reading number of triangles from file. This is bad.");
     setErrorCondition(ReadStlFileErrors::k_TriangleCountParseError, msg);
-    std::ignore = fclose(f);
     return;
   }
+  ::memcpy(&triCount, fileData + STL_HEADER_LENGTH, sizeof(int32_t));
+  if(triCount < 0)
+  {
+    QString msg = QString("The number of triangles in the file (%1) is negative.").arg(triCount);
+    setErrorCondition(ReadStlFileErrors::k_TriangleCountParseError, msg);
+    return;
+  }
+  const size_t numTris = static_cast<size_t>(triCount);
 
-  TriangleGeom::Pointer triangleGeom = sm->getGeometryAs<TriangleGeom>();
-  triangleGeom->resizeTriList(triCount);
-  triangleGeom->resizeVertexList(triCount * 3);
-  float* nodes = triangleGeom->getVertexPointer(0);
-  MeshIndexType* triangles = triangleGeom->getTriPointer(0);
-
-  // Resize the triangle attribute matrix to hold the normals and update the normals pointer
-  std::vector<size_t> tDims(1, static_cast<size_t>(triCount));
-  sm->getAttributeMatrix(getFaceAttributeMatrixName())->resizeAttributeArrays(tDims);
-  updateFaceInstancePointers();
-
-  // Read the triangles
-  static const size_t k_StlElementCount = 12;
-  float v[k_StlElementCount];
-  uint16_t attr;
-  std::vector<uint8_t> triangleAttributeBuffer(std::numeric_limits<uint16_t>::max()); // Just allocate a buffer of max UINT16 elements
-  for(int32_t t = 0; t < triCount; ++t)
+  // Every record is 50 bytes unless the file stores data behind some of the triangles. Only then
+  // is the offset of each record worked out by following the attribute byte counts.
+  std::vector<size_t> recordOffsets;
+  const size_t fixedSize = StlVertexWelding::k_FirstRecordOffset + numTris * StlVertexWelding::k_RecordSize;
+  if(magicsFile || fileSize == fixedSize)
   {
-    size_t objsRead = std::fread(reinterpret_cast<void*>(v), sizeof(float), k_StlElementCount, f); // Read the Triangle
-    if(k_StlElementCount != objsRead)
+    if(fileSize < fixedSize)
     {
-      QString msg = QString("Error reading Triangle '%1'. Object Count was %2 and should have been %3").arg(t, objsRead, k_StlElementCount);
+      size_t t = (fileSize - StlVertexWelding::k_FirstRecordOffset) / StlVertexWelding::k_RecordSize;
+      QString msg = QString("Error reading Triangle '%1'. The file ends before the data for %2 triangles.").arg(t).arg(triCount);
       setErrorCondition(ReadStlFileErrors::k_TriangleParseError, msg);
-      std::ignore = fclose(f);
       return;
     }
-
-    objsRead = std::fread(reinterpret_cast<void*>(&attr), sizeof(uint16_t), 1, f); // Read the Triangle Attribute Data length
-    if(objsRead != 1)
-    {
-      QString msg = QString("Error reading Number of attributes for triangle '%1'. Object Count was %2 and should have been 1").arg(t, objsRead);
-      setErrorCondition(ReadStlFileErrors::k_AttributeParseError, msg);
-      std::ignore = fclose(f);
-      return;
-    }
-    if(attr > 0 && !magicsFile)
-    {
-      std::ignore = std::fseek(f, static_cast<size_t>(attr), SEEK_CUR); // Skip past the Triangle Attribute data since we don't know how to read it anyways
-    }
-    if(v[3] < m_minXcoord)
-    {
-      m_minXcoord = v[3];
-    }
-    if(v[3] > m_maxXcoord)
-    {
-      m_maxXcoord = v[3];
-    }
-    if(v[4] < m_minYcoord)
-    {
-      m_minYcoord = v[4];
-    }
-    if(v[4] > m_maxYcoord)
-    {
-      m_maxYcoord = v[4];
-    }
-    if(v[5] < m_minZcoord)
-    {
-      m_minZcoord = v[5];
-    }
-    if(v[5] > m_maxZcoord)
-    {
-      m_maxZcoord = v[5];
-    }
-    if(v[6] < m_minXcoord)
-    {
-      m_minXcoord = v[6];
-    }
-    if(v[6] > m_maxXcoord)
-    {
-      m_maxXcoord = v[6];
-    }
-    if(v[7] < m_minYcoord)
-    {
-      m_minYcoord = v[7];
-    }
-    if(v[7] > m_maxYcoord)
-    {
-      m_maxYcoord = v[7];
-    }
-    if(v[8] < m_minZcoord)
-    {
-      m_minZcoord = v[8];
-    }
-    if(v[8] > m_maxZcoord)
-    {
-      m_maxZcoord = v[8];
-    }
-    if(v[9] < m_minXcoord)
-    {
-      m_minXcoord = v[9];
-    }
-    if(v[9] > m_maxXcoord)
-    {
-      m_maxXcoord = v[9];
-    }
-    if(v[10] < m_minYcoord)
-    {
-      m_minYcoord = v[10];
-    }
-    if(v[10] > m_maxYcoord)
-    {
-      m_maxYcoord = v[10];
-    }
-    if(v[11] < m_minZcoord)
-    {
-      m_minZcoord = v[11];
-    }
-    if(v[11] > m_maxZcoord)
-    {
-      m_maxZcoord = v[11];
-    }
-    m_FaceNormals[3 * t + 0] = static_cast<double>(v[0]);
-    m_FaceNormals[3 * t + 1] = static_cast<double>(v[1]);
-    m_FaceNormals[3 * t + 2] = static_cast<double>(v[2]);
-    nodes[3 * (3 * t + 0) + 0] = v[3];
-    nodes[3 * (3 * t + 0) + 1] = v[4];
-    nodes[3 * (3 * t + 0) + 2] = v[5];
-    nodes[3 * (3 * t + 1) + 0] = v[6];
-    nodes[3 * (3 * t + 1) + 1] = v[7];
-    nodes[3 * (3 * t + 1) + 2] = v[8];
-    nodes[3 * (3 * t + 2) + 0] = v[9];
-    nodes[3 * (3 * t + 2) + 1] = v[10];
-    nodes[3 * (3 * t + 2) + 2] = v[11];
-    triangles[t * 3] = 3 * t + 0;
-    triangles[t * 3 + 1] = 3 * t + 1;
-    triangles[t * 3 + 2] = 3 * t + 2;
-    if(getCancel())
+  }
+  else
+  {
+    recordOffsets.resize(numTris);
+    size_t offset = StlVertexWelding::k_FirstRecordOffset;
+    for(size_t t = 0; t < numTris; t++)
     {
-      std::ignore = fclose(f);
-      return;
+      if(offset + StlVertexWelding::k_RecordSize > fileSize)
+      {
+        QString msg = QString("Error reading Triangle '%1'. The file ends before the data for %2 triangles.").arg(t).arg(triCount);
+        setErrorCondition(ReadStlFileErrors::k_TriangleParseError, msg);
+        return;
+      }
+      recordOffsets[t] = offset;
+      uint16_t attr = 0;
+      ::memcpy(&attr, fileData + offset + 48, sizeof(uint16_t));
+      // Skip past the Triangle Attribute data since we don't know how to read it anyways
+      offset += StlVertexWelding::k_RecordSize + attr;
     }
   }
 
-  std::ignore = fclose(f);
+  readTriangles(fileData, recordOffsets, numTris);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ReadStlFile::eliminate_duplicate_nodes()
+void ReadStlFile::readTriangles(const uint8_t* fileData, const std::vector<size_t>& recordOffsets, size_t triCount)
 {
   DataContainer::Pointer sm = getDataContainerArray()->getDataContainer(m_SurfaceMeshDataContainerName);
-
   TriangleGeom::Pointer triangleGeom = sm->getGeometryAs<TriangleGeom>();
-  float* vertex = triangleGeom->getVertexPointer(0);
-  MeshIndexType nNodes_ = triangleGeom->getNumberOfVertices();
+  triangleGeom->resizeTriList(triCount);
   MeshIndexType* triangles = triangleGeom->getTriPointer(0);
-  MeshIndexType nTriangles = triangleGeom->getNumberOfTris();
-  size_t nNodes = 0;
-  if(nNodes_ > 0)
+
+  // Resize the triangle attribute matrix to hold the normals and update the normals pointer
+  std::vector<size_t> tDims(1, triCount);
+  sm->getAttributeMatrix(getFaceAttributeMatrixName())->resizeAttributeArrays(tDims);
+  updateFaceInstancePointers();
+
+  const size_t k_ShardCount = StlVertexWelding::k_ShardCount;
+  StlVertexWelding::Records records(fileData, recordOffsets.empty() ? nullptr : recordOffsets.data());
+  const size_t numChunks = (triCount + StlVertexWelding::k_TrianglesPerChunk - 1) / StlVertexWelding::k_TrianglesPerChunk;
+  const size_t numCorners = 3 * triCount;
+
+  // Decode the normals and hash the weld key of every triangle corner. The hashes are kept in the
+  // triangle list so the duplicated vertex list of the file is never created.
+  std::vector<size_t> shardOffsets(numChunks * k_ShardCount, 0);
   {
-    nNodes = static_cast<size_t>(nNodes_);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numChunks);
+    dataAlg.setGrain(1);
+    dataAlg.execute(StlVertexWelding::ReadRecordsImpl(records, triCount, m_WeldTolerance, m_FaceNormals, triangles, shardOffsets.data()));
+  }
+  if(getCancel())
+  {
+    return;
   }
-  float stepX = (m_maxXcoord - m_minXcoord) / 100.0f;
-  float stepY = (m_maxYcoord - m_minYcoord) / 100.0f;
-  float stepZ = (m_maxZcoord - m_minZcoord) / 100.0f;
-
-  std::vector<std::vector<size_t>> nodesInBin(100 * 100 * 100);
 
-  // determine (xyz) bin each node falls in - used to speed up node comparison
-  int32_t bin = 0, xBin = 0, yBin = 0, zBin = 0;
-  for(size_t i = 0; i < nNodes; i++)
+  // Turn the corner counts into the position that each chunk writes its corners of each shard to
+  std::vector<size_t> shardStart(k_ShardCount + 1, 0);
+  size_t position = 0;
+  for(size_t shard = 0; shard < k_ShardCount; shard++)
   {
-    xBin = static_cast<int32_t>((vertex[i * 3] - m_minXcoord) / stepX);
-    yBin = static_cast<int32_t>((vertex[i * 3 + 1] - m_minYcoord) / stepY);
-    zBin = static_cast<int32_t>((vertex[i * 3 + 2] - m_minZcoord) / stepZ);
-    if(xBin == 100)
-    {
-      xBin = 99;
-    }
-    if(yBin == 100)
+    shardStart[shard] = position;
+    for(size_t chunk = 0; chunk < numChunks; chunk++)
     {
-      yBin = 99;
+      size_t count = shardOffsets[chunk * k_ShardCount + shard];
+      shardOffsets[chunk * k_ShardCount + shard] = position;
+      position += count;
     }
-    if(zBin == 100)
-    {
-      zBin = 99;
-    }
-    bin = (zBin * 10000) + (yBin * 100) + xBin;
-    nodesInBin[bin].push_back(i);
   }
+  shardStart[k_ShardCount] = position;
 
-  // Create array to hold unique node numbers
-  Int64ArrayType::Pointer uniqueIdsPtr = Int64ArrayType::CreateArray(nNodes, std::string("uniqueIds"), true);
-  int64_t* uniqueIds = uniqueIdsPtr->getPointer(0);
-  for(MeshIndexType i = 0; i < nNodes_; i++)
+  std::vector<size_t> cornerOrder(numCorners);
   {
-    uniqueIds[i] = static_cast<int64_t>(i);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numChunks);
+    dataAlg.setGrain(1);
+    dataAlg.execute(StlVertexWelding::ScatterCornersImpl(triCount, triangles, shardOffsets.data(), cornerOrder.data()));
   }
 
-  // Parallel algorithm to find duplicate nodes
-  ParallelDataAlgorithm dataAlg;
-  dataAlg.setRange(0ULL, static_cast<size_t>(100 * 100 * 100));
-  dataAlg.execute(FindUniqueIdsImpl(triangleGeom->getVertices(), nodesInBin, uniqueIds));
+  // Weld each shard independently. Afterwards every corner holds the index of the first corner
+  // with the same weld key.
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, k_ShardCount);
+    dataAlg.setGrain(1);
+    dataAlg.execute(StlVertexWelding::WeldShardsImpl(records, m_WeldTolerance, cornerOrder.data(), shardStart.data(), triangles));
+  }
+  cornerOrder = std::vector<size_t>();
+  if(getCancel())
+  {
+    return;
+  }
 
-  // renumber the unique nodes
-  int64_t uniqueCount = 0;
-  for(size_t i = 0; i < nNodes; i++)
+  // Number the unique vertices in the order they first appear in the file and copy their coordinates
+  size_t uniqueCount = 0;
+  for(size_t c = 0; c < numCorners; c++)
   {
-    if(uniqueIds[i] == static_cast<int64_t>(i))
+    if(triangles[c] == c)
     {
-      uniqueIds[i] = uniqueCount;
       uniqueCount++;
     }
-    else
-    {
-      uniqueIds[i] = uniqueIds[uniqueIds[i]];
-    }
-  }
-
-  // Move nodes to unique Id and then resize nodes array
-  for(size_t i = 0; i < nNodes; i++)
-  {
-    vertex[uniqueIds[i] * 3] = vertex[i * 3];
-    vertex[uniqueIds[i] * 3 + 1] = vertex[i * 3 + 1];
-    vertex[uniqueIds[i] * 3 + 2] = vertex[i * 3 + 2];
   }
   triangleGeom->resizeVertexList(uniqueCount);
-
-  // Update the triangle nodes to reflect the unique ids
-  int64_t node1 = 0, node2 = 0, node3 = 0;
-  for(size_t i = 0; i < static_cast<size_t>(nTriangles); i++)
+  float* vertex = triangleGeom->getVertexPointer(0);
+  MeshIndexType nextId = 0;
+  for(size_t c = 0; c < numCorners; c++)
   {
-    node1 = triangles[i * 3];
-    node2 = triangles[i * 3 + 1];
-    node3 = triangles[i * 3 + 2];
-
-    triangles[i * 3] = uniqueIds[node1];
-    triangles[i * 3 + 1] = uniqueIds[node2];
-    triangles[i * 3 + 2] = uniqueIds[node3];
+    MeshIndexType representative = triangles[c];
+    if(representative == c)
+    {
+      records.corner(c, vertex + 3 * nextId);
+      triangles[c] = nextId;
+      nextId++;
+    }
+    else
+    {
+      triangles[c] = triangles[representative];
+    }
   }
 }
 
@@ -750,3 +883,15 @@ QString ReadStlFile::getFaceNormalsArrayName() const
 {
   return m_FaceNormalsArrayName;
 }
+
+// -----------------------------------------------------------------------------
+void ReadStlFile::setWeldTolerance(float value)
+{
+  m_WeldTolerance = value;
+}
+
+// -----------------------------------------------------------------------------
+float ReadStlFile::getWeldTolerance() const
+{
+  return m_WeldTolerance;
+}
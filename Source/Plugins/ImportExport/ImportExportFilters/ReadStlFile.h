@@ -36,6 +36,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
@@ -58,6 +59,7 @@ class ImportExport_EXPORT ReadStlFile : public AbstractFilter
   PYB11_PROPERTY(DataArrayPath SurfaceMeshDataContainerName READ getSurfaceMeshDataContainerName WRITE setSurfaceMeshDataContainerName)
   PYB11_PROPERTY(QString FaceAttributeMatrixName READ getFaceAttributeMatrixName WRITE setFaceAttributeMatrixName)
   PYB11_PROPERTY(QString StlFilePath READ getStlFilePath WRITE setStlFilePath)
+  PYB11_PROPERTY(float WeldTolerance READ getWeldTolerance WRITE setWeldTolerance)
   PYB11_PROPERTY(QString FaceNormalsArrayName READ getFaceNormalsArrayName WRITE setFaceNormalsArrayName)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
@@ -125,6 +127,17 @@ public:
   QString getStlFilePath() const;
   Q_PROPERTY(QString StlFilePath READ getStlFilePath WRITE setStlFilePath)
 
+  /**
+   * @brief Setter property for WeldTolerance
+   */
+  void setWeldTolerance(float value);
+  /**
+   * @brief Getter property for WeldTolerance
+   * @return Value of WeldTolerance
+   */
+  float getWeldTolerance() const;
+  Q_PROPERTY(float WeldTolerance READ getWeldTolerance WRITE setWeldTolerance)
+
   /**
    * @brief Setter property for FaceNormalsArrayName
    */
@@ -217,12 +230,7 @@ private:
   QString m_StlFilePath = {""};
   QString m_FaceNormalsArrayName = {SIMPL::FaceData::SurfaceMeshFaceNormals};
 
-  float m_minXcoord = {std::numeric_limits<float>::max()};
-  float m_maxXcoord = {-std::numeric_limits<float>::max()};
-  float m_minYcoord = {std::numeric_limits<float>::max()};
-  float m_maxYcoord = {-std::numeric_limits<float>::max()};
-  float m_minZcoord = {std::numeric_limits<float>::max()};
-  float m_maxZcoord = {-std::numeric_limits<float>::max()};
+  float m_WeldTolerance = {0.0f};
 
   /**
    * @brief updateFaceInstancePointers Updates raw Face pointers
@@ -235,10 +243,13 @@ private:
   void readFile();
 
   /**
-   * @brief eliminate_duplicate_nodes Removes duplicate nodes to ensure the
-   * created vertex list is shared
+   * @brief readTriangles Decodes the triangle records and welds coincident vertices
+   * so the created vertex list is shared
+   * @param fileData The contents of the STL file
+   * @param recordOffsets Byte offset of each triangle record, or empty if every record is 50 bytes long
+   * @param triCount Number of triangles in the file
    */
-  void eliminate_duplicate_nodes();
+  void readTriangles(const uint8_t* fileData, const std::vector<size_t>& recordOffsets, size_t triCount);
 
 public:
   ReadStlFile(const ReadStlFile&) = delete;            // Copy Constructor Not Implemented
@@ -35,6 +35,13 @@
 
 #include "SPParksDumpReader.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
 #include <QtCore/QFileInfo>
 #include <QtCore/QTextStream>
 
@@ -46,12 +53,13 @@
 #include "SIMPLib/FilterParameters/DataContainerCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
-#include "SIMPLib/Utilities/GenericDataParser.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "ImportExport/ImportExportConstants.h"
 #include "ImportExport/ImportExportVersion.h"
@@ -65,6 +73,303 @@ enum createdPathID : RenameDataPath::DataID_t
   DataContainerID = 1
 };
 
+namespace SPParksDump
+{
+constexpr size_t k_MinChunkSize = 1024 * 1024;
+
+/**
+ * @brief Zero based columns of the values read from each site line. A column that is missing from the header
+ * keeps its default
+ */
+struct Columns
+{
+  int32_t x = 0;
+  int32_t y = 0;
+  int32_t z = 0;
+  int32_t type = -1;
+};
+
+/**
+ * @brief First failing line of a chunk together with the error code
+ */
+struct ChunkError
+{
+  const char* line = nullptr;
+  int32_t code = 0;
+};
+
+// -----------------------------------------------------------------------------
+inline bool IsSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+// -----------------------------------------------------------------------------
+inline const char* NextLine(const char* pos, const char* end)
+{
+  const char* newLine = static_cast<const char*>(std::memchr(pos, '\n', static_cast<size_t>(end - pos)));
+  return nullptr == newLine ? end : newLine + 1;
+}
+
+// -----------------------------------------------------------------------------
+inline const char* SkipLines(const char* pos, const char* end, int32_t count)
+{
+  for(int32_t i = 0; i < count && pos < end; i++)
+  {
+    pos = NextLine(pos, end);
+  }
+  return pos;
+}
+
+// -----------------------------------------------------------------------------
+inline const char* SkipSpaces(const char* pos, const char* end)
+{
+  while(pos < end && IsSpace(*pos))
+  {
+    pos++;
+  }
+  return pos;
+}
+
+/**
+ * @brief Returns the start of the next line that begins with "ITEM:", or end. The site lines only hold
+ * numbers so searching for the 'I' skips over them quickly.
+ * @param start Must be the start of a line
+ */
+inline const char* FindNextItem(const char* start, const char* end)
+{
+  const char* pos = start;
+  while(pos < end)
+  {
+    const char* item = static_cast<const char*>(std::memchr(pos, 'I', static_cast<size_t>(end - pos)));
+    if(nullptr == item)
+    {
+      return end;
+    }
+    if((item == start || item[-1] == '\n') && end - item >= 5 && std::memcmp(item, "ITEM:", 5) == 0)
+    {
+      return item;
+    }
+    pos = item + 1;
+  }
+  return end;
+}
+
+/**
+ * @brief Scans a decimal number that starts at pos. Both '.' and ',' are accepted as the decimal separator
+ * so files written with European locales still parse.
+ * @return The position after the number or nullptr if no number ends at a white space
+ */
+inline const char* ScanNumber(const char* pos, const char* end, double& value)
+{
+  bool negative = false;
+  if(pos < end && (*pos == '-' || *pos == '+'))
+  {
+    negative = (*pos == '-');
+    pos++;
+  }
+
+  uint64_t mantissa = 0;
+  int32_t exponent = 0;
+  int32_t numDigits = 0;
+  for(; pos < end && *pos >= '0' && *pos <= '9'; pos++, numDigits++)
+  {
+    if(mantissa < 100000000000000000ULL)
+    {
+      mantissa = mantissa * 10 + static_cast<uint64_t>(*pos - '0');
+    }
+    else
+    {
+      exponent++;
+    }
+  }
+  if(pos < end && (*pos == '.' || *pos == ','))
+  {
+    for(pos++; pos < end && *pos >= '0' && *pos <= '9'; pos++, numDigits++)
+    {
+      if(mantissa < 100000000000000000ULL)
+      {
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*pos - '0');
+        exponent--;
+      }
+    }
+  }
+  if(numDigits == 0)
+  {
+    return nullptr;
+  }
+  if(pos < end && (*pos == 'e' || *pos == 'E'))
+  {
+    pos++;
+    bool negativeExp = false;
+    if(pos < end && (*pos == '-' || *pos == '+'))
+    {
+      negativeExp = (*pos == '-');
+      pos++;
+    }
+    int32_t exp = 0;
+    int32_t numExpDigits = 0;
+    for(; pos < end && *pos >= '0' && *pos <= '9'; pos++, numExpDigits++)
+    {
+      exp = std::min(exp * 10 + (*pos - '0'), 10000);
+    }
+    if(numExpDigits == 0)
+    {
+      return nullptr;
+    }
+    exponent += negativeExp ? -exp : exp;
+  }
+  if(pos < end && !IsSpace(*pos) && *pos != '\n')
+  {
+    return nullptr;
+  }
+
+  value = static_cast<double>(mantissa);
+  if(exponent != 0)
+  {
+    value *= std::pow(10.0, exponent);
+  }
+  if(negative)
+  {
+    value = -value;
+  }
+  return pos;
+}
+
+// -----------------------------------------------------------------------------
+inline bool ScanInteger(const char* pos, const char* end, int64_t& value)
+{
+  double number = 0.0;
+  if(nullptr == ScanNumber(pos, end, number) || number != std::floor(number))
+  {
+    return false;
+  }
+  value = static_cast<int64_t>(number);
+  return true;
+}
+
+/**
+ * @brief The SiteParser struct parses one site line and writes its value straight into the Feature Ids. Every
+ * site position is claimed before it is written, so a position listed twice is reported instead of being written
+ * concurrently by two chunks
+ */
+struct SiteParser
+{
+  Columns columns;
+  std::array<size_t, 3> dims;
+  int32_t oneBase;
+  int32_t* featureIds;
+  std::atomic<uint8_t>* claimed;
+
+  /**
+   * @brief Parses the line [pos, lineEnd)
+   * @return 0 on success or the error code
+   */
+  int32_t parseLine(const char* pos, const char* lineEnd) const
+  {
+    pos = SkipSpaces(pos, lineEnd);
+    if(pos == lineEnd || *pos == '\n')
+    {
+      return 0; // Blank lines are skipped
+    }
+
+    const int32_t lastColumn = std::max(std::max(columns.x, columns.y), std::max(columns.z, columns.type));
+    double coords[3] = {0.0, 0.0, 0.0};
+    double type = 0.0;
+    for(int32_t column = 0; column <= lastColumn; column++)
+    {
+      pos = SkipSpaces(pos, lineEnd);
+      if(pos == lineEnd || *pos == '\n')
+      {
+        return -48101;
+      }
+      if(column != columns.x && column != columns.y && column != columns.z && column != columns.type)
+      {
+        while(pos < lineEnd && !IsSpace(*pos) && *pos != '\n')
+        {
+          pos++;
+        }
+        continue;
+      }
+
+      double value = 0.0;
+      pos = ScanNumber(pos, lineEnd, value);
+      if(nullptr == pos)
+      {
+        return -48101;
+      }
+      coords[0] = (column == columns.x) ? value : coords[0];
+      coords[1] = (column == columns.y) ? value : coords[1];
+      coords[2] = (column == columns.z) ? value : coords[2];
+      type = (column == columns.type) ? value : type;
+    }
+
+    // Calculate the offset into the actual array based on the x, y & z values from the data line
+    size_t offset = 0;
+    size_t stride = 1;
+    for(size_t d = 0; d < 3; d++)
+    {
+      if(coords[d] != std::floor(coords[d]))
+      {
+        return -48103;
+      }
+      double idx = coords[d] - oneBase;
+      if(idx < 0.0 || idx >= static_cast<double>(dims[d]))
+      {
+        return -48100;
+      }
+      offset += static_cast<size_t>(idx) * stride;
+      stride *= dims[d];
+    }
+    if(claimed[offset].exchange(1, std::memory_order_relaxed) != 0)
+    {
+      return -48102;
+    }
+    featureIds[offset] = static_cast<int32_t>(type);
+    return 0;
+  }
+};
+
+/**
+ * @brief The ParseSitesImpl class parses a range of line aligned chunks of the site lines
+ */
+class ParseSitesImpl
+{
+public:
+  ParseSitesImpl(const SiteParser& parser, const std::vector<const char*>& chunkStarts, std::vector<ChunkError>& chunkErrors)
+  : m_Parser(parser)
+  , m_ChunkStarts(chunkStarts)
+  , m_ChunkErrors(chunkErrors)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t c = range.min(); c < range.max(); c++)
+    {
+      const char* pos = m_ChunkStarts[c];
+      const char* chunkEnd = m_ChunkStarts[c + 1];
+      while(pos < chunkEnd)
+      {
+        const char* lineEnd = NextLine(pos, chunkEnd);
+        int32_t err = m_Parser.parseLine(pos, lineEnd);
+        if(err < 0)
+        {
+          m_ChunkErrors[c] = {pos, err};
+          break;
+        }
+        pos = lineEnd;
+      }
+    }
+  }
+
+private:
+  SiteParser m_Parser;
+  const std::vector<const char*>& m_ChunkStarts;
+  std::vector<ChunkError>& m_ChunkErrors;
+};
+} // namespace SPParksDump
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -102,6 +407,7 @@ void SPParksDumpReader::setupFilterParameters()
   parameters.back()->setLegacyPropertyName("Resolution");
 
   parameters.push_back(SIMPL_NEW_BOOL_FP("One Based Arrays", OneBasedArrays, FilterParameter::Category::Parameter, SPParksDumpReader));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Timestep Index", TimestepIndex, FilterParameter::Category::Parameter, SPParksDumpReader));
   parameters.push_back(SIMPL_NEW_DC_CREATION_FP("Data Container", VolumeDataContainerName, FilterParameter::Category::CreatedArray, SPParksDumpReader));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_AM_WITH_LINKED_DC_FP("Cell Attribute Matrix", CellAttributeMatrixName, VolumeDataContainerName, FilterParameter::Category::CreatedArray, SPParksDumpReader));
@@ -123,6 +429,7 @@ void SPParksDumpReader::readFilterParameters(AbstractFilterParametersReader* rea
   setOrigin(reader->readFloatVec3("Origin", getOrigin()));
   setSpacing(reader->readFloatVec3("Spacing", getSpacing()));
   setOneBasedArrays(reader->readValue("OneBasedArrays", getOneBasedArrays()));
+  setTimestepIndex(reader->readValue("TimestepIndex", getTimestepIndex()));
   reader->closeFilterGroup();
 }
 
@@ -143,7 +450,6 @@ void SPParksDumpReader::updateCellInstancePointers()
 // -----------------------------------------------------------------------------
 void SPParksDumpReader::initialize()
 {
-  m_NamePointerMap.clear();
   if(m_InStream.isOpen())
   {
     m_InStream.close();
@@ -177,6 +483,12 @@ void SPParksDumpReader::dataCheck()
     setErrorCondition(-388, ss);
   }
 
+  if(getTimestepIndex() < 0)
+  {
+    QString ss = QObject::tr("The timestep index must be zero or larger");
+    setErrorCondition(-389, ss);
+  }
+
   ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
   m->setGeometry(image);
 
@@ -221,16 +533,6 @@ void SPParksDumpReader::execute()
   m_InStream.setFileName(getInputFile());
   m_InStream.open(QFile::ReadOnly);
 
-  // We need to skip the header since it is already read
-  QByteArray buf = m_InStream.readLine(); // ITEM: TIMESTEP
-  buf = m_InStream.readLine();            // 210    21000.6
-  buf = m_InStream.readLine();            // ITEM: NUMBER OF ATOMS
-  buf = m_InStream.readLine();            // 106480
-  buf = m_InStream.readLine();            // ITEM: BOX BOUNDS
-  buf = m_InStream.readLine();            // 0.5 44.5
-  buf = m_InStream.readLine();            // 0.5 44.5
-  buf = m_InStream.readLine();            // 0.5 55.5
-
   err = readFile();
   m_InStream.close();
   if(err < 0)
@@ -450,206 +752,169 @@ int32_t SPParksDumpReader::readFile()
   m->getAttributeMatrix(getCellAttributeMatrixName())->resizeAttributeArrays(tDims);
   updateCellInstancePointers();
 
-  QByteArray buf = m_InStream.readLine(); // ITEM: ATOMS id type x y z
-  buf = buf.trimmed();
+  // The whole file is mapped and the site lines are parsed in place instead of being copied line by line
+  const char* begin = reinterpret_cast<const char*>(m_InStream.map(0, m_InStream.size()));
+  if(nullptr == begin)
+  {
+    QString msg = QObject::tr("Input SPParks file could not be memory mapped: %1").arg(getInputFile());
+    setErrorCondition(-103, msg);
+    return getErrorCode();
+  }
+  const char* end = begin + m_InStream.size();
+
+  // Every timestep starts with a 9 line header and its site lines run up to the next "ITEM:" line
+  const char* frame = begin;
+  for(int32_t t = 0; t < m_TimestepIndex; t++)
+  {
+    frame = SPParksDump::FindNextItem(SPParksDump::SkipLines(frame, end, 9), end);
+    if(frame == end)
+    {
+      QString msg = QObject::tr("The dump file only holds %1 timestep(s) but timestep index %2 was requested").arg(t + 1).arg(m_TimestepIndex);
+      setErrorCondition(-26011, msg);
+      return getErrorCode();
+    }
+  }
+
+  // All the timesteps of a dump share the lattice read by readHeader() so only the number of sites is checked
+  const char* line = SPParksDump::SkipLines(frame, end, 3); // 106480
+  int64_t numAtoms = 0;
+  if(!SPParksDump::ScanInteger(SPParksDump::SkipSpaces(line, end), end, numAtoms) || numAtoms != static_cast<int64_t>(totalPoints))
+  {
+    QString msg = QObject::tr("Number of sites in timestep %1 does not match the %2 sites of the first timestep").arg(m_TimestepIndex).arg(totalPoints);
+    setErrorCondition(-26010, msg);
+    return getErrorCode();
+  }
+
+  line = SPParksDump::SkipLines(frame, end, 8); // ITEM: ATOMS id type x y z
+  const char* dataStart = SPParksDump::NextLine(line, end);
+  QByteArray buf = QByteArray(line, static_cast<int>(dataStart - line)).trimmed();
   QList<QByteArray> tokens = buf.split(' '); // Tokenize the array with a tab
-  SIMPL::NumericTypes::Type pType = SIMPL::NumericTypes::Type::UnknownNumType;
 
-  int64_t xCol = 0;
-  int64_t yCol = 0;
-  int64_t zCol = 0;
+  SPParksDump::Columns columns;
   qint32 size = tokens.size();
-  bool didAllocate = false;
   for(qint32 i = 2; i < size; ++i)
   {
     QString name = QString::fromLatin1(tokens[i]);
-    pType = getPointerType(name);
-
-    // We don't need to parse the X, Y & Z or id values into arrays.
-    if(name.compare("x") == 0)
+    int32_t column = i - 2;
+    if(name.isEmpty())
     {
-      xCol = i - 2;
       continue;
     }
-    if(name.compare("y") == 0)
-    {
-      yCol = i - 2;
-      continue;
-    }
-    if(name.compare("z") == 0)
-    {
-      zCol = i - 2;
-      continue;
-    }
-    if(name.compare("id") == 0)
-    {
-      zCol = i - 2;
-      continue;
-    }
-
-    if(SIMPL::NumericTypes::Type::Int32 == pType)
-    {
-      Int32DataParser::Pointer dparser = Int32DataParser::New(nullptr, totalPoints, name, i - 2);
-      if((didAllocate = dparser->allocateArray(totalPoints)))
-      {
-        ::memset(dparser->getVoidPointer(), 0xAB, sizeof(int32_t) * totalPoints);
-        m_NamePointerMap.insert(name, dparser);
-      }
-    }
-    else if(SIMPL::NumericTypes::Type::Float == pType)
-    {
-      FloatDataParser::Pointer dparser = FloatDataParser::New(nullptr, totalPoints, name, i - 2);
-      if((didAllocate = dparser->allocateArray(totalPoints)))
-      {
-        ::memset(dparser->getVoidPointer(), 0xAB, sizeof(float) * totalPoints);
-        m_NamePointerMap.insert(name, dparser);
-      }
-    }
-    else
+    if(SIMPL::NumericTypes::Type::UnknownNumType == getPointerType(name))
     {
       QString msg = QObject::tr("Column header %1 is not a recognized column for SPParks files. Please recheck your file and report this error to the DREAM.3D developers").arg(QString(tokens[i]));
       setErrorCondition(-107, msg);
       return getErrorCode();
     }
 
-    if(!didAllocate)
+    // The site values are the only column kept. The x, y & z columns place them in the volume
+    if(name.compare("x") == 0)
     {
-      QString msg = QObject::tr("Unable to allocate memory for the data");
-      setErrorCondition(-106, msg);
-      return getErrorCode();
+      columns.x = column;
     }
-  }
-
-  // Now loop over all the points in the file. This could get REALLY slow if the file gets large.
-  // Thank goodness we all like to save text files
-  for(size_t n = 0; n < totalPoints; ++n)
-  {
-    buf = m_InStream.readLine(); // Read the line into a QByteArray including the newline
-    buf = buf.trimmed();         // Remove leading and trailing whitespace
-
-    if(m_InStream.atEnd() && buf.isEmpty()) // We have to have read to the end of the file AND the buffer is empty
+    else if(name.compare("y") == 0)
+    {
+      columns.y = column;
+    }
+    else if(name.compare("z") == 0)
     {
-      // otherwise we read EXACTLY the last line and we still need to parse the line.
-      break;
+      columns.z = column;
     }
-    parseDataLine(buf, tDims, xCol, yCol, zCol, n + 9);
-    if(getErrorCode() < 0)
+    else if(name.compare("type") == 0)
     {
-      break;
+      columns.type = column;
     }
   }
-  if(getErrorCode() < 0)
+
+  std::vector<size_t> cDims(1, 1);
+  Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(totalPoints, cDims, getFeatureIdsArrayName(), true);
+  if(nullptr == featureIds.get())
   {
+    QString msg = QObject::tr("Unable to allocate memory for the data");
+    setErrorCondition(-106, msg);
     return getErrorCode();
   }
+  featureIds->initializeWithZeros();
 
-  GenericDataParser::Pointer parser = m_NamePointerMap["type"];
-  if(nullptr != parser.get())
+  if(columns.type >= 0)
   {
-    std::vector<size_t> cDims(1, 1);
-    // Create a new DataArray that wraps the already allocated memory
-    Int32ArrayType::Pointer typePtr = Int32ArrayType::WrapPointer(static_cast<int*>(parser->getVoidPointer()), totalPoints, cDims, getFeatureIdsArrayName(), true);
-    // Release the GenericDataParser from having to delete the memory
-    parser->setManageMemory(false);
+    const char* dataEnd = SPParksDump::FindNextItem(dataStart, end);
 
-    AttributeMatrix::Pointer attrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
-    if(nullptr != attrMat.get())
+    // Split the site lines into line aligned chunks that are parsed concurrently
+    size_t numChunks = std::max<size_t>(1, std::min<size_t>(static_cast<size_t>(dataEnd - dataStart) / SPParksDump::k_MinChunkSize, 1024));
+    std::vector<const char*> chunkStarts(numChunks + 1, dataEnd);
+    chunkStarts[0] = dataStart;
+    for(size_t c = 1; c < numChunks; c++)
     {
-      attrMat->insertOrAssign(typePtr);
+      const char* split = dataStart + (dataEnd - dataStart) * c / numChunks;
+      chunkStarts[c] = std::max(chunkStarts[c - 1], SPParksDump::NextLine(split, dataEnd));
     }
-  }
 
-  // Now set the Spacing and Origin that the user provided on the GUI or as parameters
-  m->getGeometryAs<ImageGeom>()->setSpacing(std::make_tuple(m_Spacing[0], m_Spacing[1], m_Spacing[2]));
-  m->getGeometryAs<ImageGeom>()->setOrigin(std::make_tuple(m_Origin[0], m_Origin[1], m_Origin[2]));
-
-  return 0;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void SPParksDumpReader::parseDataLine(QByteArray& line, std::vector<size_t> dims, int64_t xCol, int64_t yCol, int64_t zCol, size_t lineNum)
-{
-  // Filter the line to convert European command style decimals to US/UK style points
-  for(qint32 c = 0; c < line.size(); ++c)
-  {
-    if(line.at(c) == ',')
+    std::vector<SPParksDump::ChunkError> chunkErrors(numChunks);
+    std::vector<std::atomic<uint8_t>> claimed(totalPoints);
+    SPParksDump::SiteParser parser = {columns, {tDims[0], tDims[1], tDims[2]}, getOneBasedArrays() ? 1 : 0, featureIds->getPointer(0), claimed.data()};
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numChunks);
+    dataAlg.setGrain(1);
+    dataAlg.execute(SPParksDump::ParseSitesImpl(parser, chunkStarts, chunkErrors));
+
+    // Which occurrence of a duplicated site is reported depends on the order the chunks ran in. Parsing the
+    // file again in order reports the first failing line of the file
+    if(std::any_of(chunkErrors.begin(), chunkErrors.end(), [](const SPParksDump::ChunkError& chunkError) { return chunkError.code != 0; }))
     {
-      line[c] = '.';
+      for(std::atomic<uint8_t>& flag : claimed)
+      {
+        flag.store(0, std::memory_order_relaxed);
+      }
+      chunkErrors.assign(numChunks, SPParksDump::ChunkError());
+      dataAlg.setParallelizationEnabled(false);
+      dataAlg.execute(SPParksDump::ParseSitesImpl(parser, chunkStarts, chunkErrors));
     }
-  }
-
-  int64_t xIdx = 0, yIdx = 0, zIdx = 0;
-  bool ok = false;
-  QList<QByteArray> tokens = line.split(' ');
 
-  int32_t oneBase = 0;
-  if(getOneBasedArrays())
-  {
-    oneBase = 1;
+    for(const SPParksDump::ChunkError& chunkError : chunkErrors)
+    {
+      if(chunkError.code == 0)
+      {
+        continue;
+      }
+      // Line numbers are only counted when something went wrong
+      size_t lineNum = static_cast<size_t>(std::count(begin, chunkError.line, '\n')) + 1;
+      QByteArray content(chunkError.line, static_cast<int>(SPParksDump::NextLine(chunkError.line, end) - chunkError.line));
+      QString msg;
+      QTextStream ss(&msg);
+      if(chunkError.code == -48100)
+      {
+        ss << "The site position lies outside of the " << tDims[0] << " x " << tDims[1] << " x " << tDims[2] << " volume. ";
+      }
+      else if(chunkError.code == -48102)
+      {
+        ss << "The site position was already listed on an earlier line. ";
+      }
+      else if(chunkError.code == -48103)
+      {
+        ss << "The site position is not an integer lattice position. ";
+      }
+      else
+      {
+        ss << "The site line could not be parsed. ";
+      }
+      ss << "Line Number: " << lineNum << " Content\"" << content.trimmed() << "\"\n";
+      setErrorCondition(chunkError.code, msg);
+      return getErrorCode();
+    }
   }
 
-  xIdx = tokens[xCol].toInt(&ok) - oneBase;
-  if(!ok)
-  {
-    xIdx = static_cast<int64_t>(tokens[xCol].toFloat(&ok) - oneBase);
-  }
-  yIdx = tokens[yCol].toInt(&ok) - oneBase;
-  if(!ok)
+  AttributeMatrix::Pointer attrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
+  if(nullptr != attrMat.get())
   {
-    yIdx = static_cast<int64_t>(tokens[yCol].toFloat(&ok) - oneBase);
-  }
-  zIdx = tokens[zCol].toInt(&ok) - oneBase;
-  if(!ok)
-  {
-    zIdx = static_cast<int64_t>(tokens[zCol].toFloat(&ok) - oneBase);
+    attrMat->insertOrAssign(featureIds);
   }
 
-  float coords[3] = {static_cast<float>(xIdx), static_cast<float>(yIdx), static_cast<float>(zIdx)};
-  // Calculate the offset into the actual array based on the x, y & z values from the data line we just read
-  // size_t offset = static_cast<size_t>((dims[1] * dims[0] * zIdx) + (dims[0] * yIdx) + xIdx);
-  size_t offset = std::numeric_limits<size_t>::max();
-  ImageGeom::ErrorType err = m_CachedGeometry->computeCellIndex(coords, offset);
-  if(err != ImageGeom::ErrorType::NoError)
-  {
-    QString msg;
-    QTextStream ss(&msg);
-    ss << "The calculated offset into the data array " << offset << " is larger "
-       << " than the total number of elements " << m_CachedGeometry->getNumberOfElements() << " in the array."
-       << "Line Number: " << lineNum << " Content\"" << line << "\"\n";
-    setErrorCondition(-48100, msg);
-    return;
-  }
+  // Now set the Spacing and Origin that the user provided on the GUI or as parameters
+  m->getGeometryAs<ImageGeom>()->setSpacing(std::make_tuple(m_Spacing[0], m_Spacing[1], m_Spacing[2]));
+  m->getGeometryAs<ImageGeom>()->setOrigin(std::make_tuple(m_Origin[0], m_Origin[1], m_Origin[2]));
 
-  QMapIterator<QString, GenericDataParser::Pointer> iter(m_NamePointerMap);
-  while(iter.hasNext())
-  {
-    iter.next();
-    GenericDataParser::Pointer dparser = iter.value();
-    // Make sure we dont' parse the x, y, z or id columns since they are pretty much useless data. At some point
-    // if the SPParks users actually wanted to read in the matching XYZ lattice site for the data then actually
-    // parsing and storing the data _may_ be of interest to them
-    if(dparser->getColumnName() == "x" || dparser->getColumnName() == "y" || dparser->getColumnName() == "z" || dparser->getColumnName() == "id")
-    {
-      continue;
-    }
-    if(offset < dparser->getSize())
-    {
-      dparser->parse(tokens[dparser->getColumnIndex()], offset);
-    }
-    else
-    {
-      QString msg;
-      QTextStream ss(&msg);
-      ss << "The calculated offset into the data array " << offset << " is larger "
-         << " than the total number of elements " << dparser->getSize() << " in the array."
-         << "The content of the current line is\"\n"
-         << line << "\"\n";
-      setErrorCondition(-48100, msg);
-      return;
-    }
-  }
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -917,6 +1182,18 @@ bool SPParksDumpReader::getOneBasedArrays() const
   return m_OneBasedArrays;
 }
 
+// -----------------------------------------------------------------------------
+void SPParksDumpReader::setTimestepIndex(int value)
+{
+  m_TimestepIndex = value;
+}
+
+// -----------------------------------------------------------------------------
+int SPParksDumpReader::getTimestepIndex() const
+{
+  return m_TimestepIndex;
+}
+
 // -----------------------------------------------------------------------------
 void SPParksDumpReader::setFeatureIdsArrayName(const QString& value)
 {
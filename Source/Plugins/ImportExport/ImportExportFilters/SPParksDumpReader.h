@@ -47,8 +47,6 @@
 
 // Forward Declare classes.
 class ImageGeom;
-class GenericDataParser;
-using GenericDataParserShPtr = std::shared_ptr<GenericDataParser>;
 
 #include "ImportExport/ImportExportDLLExport.h"
 
@@ -71,6 +69,7 @@ class ImportExport_EXPORT SPParksDumpReader : public FileReader
   PYB11_PROPERTY(FloatVec3Type Origin READ getOrigin WRITE setOrigin)
   PYB11_PROPERTY(FloatVec3Type Spacing READ getSpacing WRITE setSpacing)
   PYB11_PROPERTY(bool OneBasedArrays READ getOneBasedArrays WRITE setOneBasedArrays)
+  PYB11_PROPERTY(int TimestepIndex READ getTimestepIndex WRITE setTimestepIndex)
   PYB11_PROPERTY(QString FeatureIdsArrayName READ getFeatureIdsArrayName WRITE setFeatureIdsArrayName)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
@@ -171,6 +170,17 @@ public:
   bool getOneBasedArrays() const;
   Q_PROPERTY(bool OneBasedArrays READ getOneBasedArrays WRITE setOneBasedArrays)
 
+  /**
+   * @brief Setter property for TimestepIndex
+   */
+  void setTimestepIndex(int value);
+  /**
+   * @brief Getter property for TimestepIndex
+   * @return Value of TimestepIndex
+   */
+  int getTimestepIndex() const;
+  Q_PROPERTY(int TimestepIndex READ getTimestepIndex WRITE setTimestepIndex)
+
   /**
    * @brief Setter property for FeatureIdsArrayName
    */
@@ -284,17 +294,6 @@ protected:
    */
   int32_t getTypeSize(const QString& featureName);
 
-  /**
-   * @brief parseDataLine Reads a line of data from the .dump file
-   * @param line Line of data to read
-   * @param dims Dimensional offset
-   * @param xCol X coordinate
-   * @param yCol Y coordinate
-   * @param zCol Z coordinate
-   * @param lineNum
-   */
-  void parseDataLine(QByteArray& line, std::vector<size_t> dims, int64_t xCol, int64_t yCol, int64_t zCol, size_t lineNum);
-
 private:
   DataArrayPath m_VolumeDataContainerName = {};
   QString m_CellAttributeMatrixName = {};
@@ -302,10 +301,10 @@ private:
   FloatVec3Type m_Origin = {};
   FloatVec3Type m_Spacing = {};
   bool m_OneBasedArrays = {};
+  int m_TimestepIndex = {0};
   QString m_FeatureIdsArrayName = {};
 
   QFile m_InStream;
-  QMap<QString, GenericDataParserShPtr> m_NamePointerMap;
   ImageGeom* m_CachedGeometry = nullptr;
 
 public:
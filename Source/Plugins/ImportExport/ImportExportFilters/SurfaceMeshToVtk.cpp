@@ -52,6 +52,7 @@
 #include "SIMPLib/Utilities/SIMPLibEndian.h"
 
 #include "ImportExport/ImportExportConstants.h"
+#include "ImportExport/ImportExportFilters/util/BufferedFileWriter.h"
 #include "ImportExport/ImportExportVersion.h"
 
 // -----------------------------------------------------------------------------
@@ -181,28 +182,6 @@ void SurfaceMeshToVtk::dataCheck()
   } /* Now assign the raw pointer to data from the DataArray<T> object */
 }
 
-/**
- * @brief The ScopedFileMonitor class will automatically close an open FILE pointer
- * when the object goes out of scope.
- */
-class ScopedFileMonitor
-{
-public:
-  ScopedFileMonitor(FILE* f)
-  : m_File(f)
-  {
-  }
-  virtual ~ScopedFileMonitor()
-  {
-    fclose(m_File);
-  }
-
-private:
-  FILE* m_File;
-  ScopedFileMonitor(const ScopedFileMonitor&); // Copy Constructor Not Implemented
-  void operator=(const ScopedFileMonitor&);    // Move assignment Not Implemented
-};
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -239,7 +218,7 @@ void SurfaceMeshToVtk::execute()
 
   // Open the output VTK File for writing
   FILE* vtkFile = nullptr;
-  vtkFile = fopen(getOutputVtkFile().toLatin1().data(), "wb");
+  vtkFile = BufferedFileWriter::OpenFile(getOutputVtkFile(), "wb");
   if(nullptr == vtkFile)
   {
 
@@ -247,7 +226,6 @@ void SurfaceMeshToVtk::execute()
     setErrorCondition(-18542, ss);
     return;
   }
-  ScopedFileMonitor vtkFileMonitor(vtkFile);
 
   fprintf(vtkFile, "# vtk DataFile Version 2.0\n");
   fprintf(vtkFile, "Data set from DREAM.3D Surface Meshing Module\n");
@@ -273,86 +251,114 @@ void SurfaceMeshToVtk::execute()
 
   fprintf(vtkFile, "POINTS %d float\n", numberWrittenumNodes);
 
-  float pos[3] = {0.0f, 0.0f, 0.0f};
-
-  size_t totalWritten = 0;
-
-  // Write the POINTS data (Vertex)
-  for(int i = 0; i < numNodes; i++)
+  const int8_t* nodeType = m_SurfaceMeshNodeType;
+  const bool writeBinary = m_WriteBinaryFile;
+  const bool writeConformal = m_WriteConformalMesh;
+  bool completed = false;
   {
-    if(m_SurfaceMeshNodeType[i] > 0)
-    {
-      pos[0] = static_cast<float>(nodes[i * 3]);
-      pos[1] = static_cast<float>(nodes[i * 3 + 1]);
-      pos[2] = static_cast<float>(nodes[i * 3 + 2]);
+    BufferedFileWriter writer(vtkFile);
 
-      if(m_WriteBinaryFile)
+    // Write the POINTS data (Vertex)
+    completed = writer.writeRange(numNodes, BufferedFileWriter::k_ItemsPerChunk, [=](FormatBuffer& out, size_t begin, size_t end) {
+      for(size_t i = begin; i < end; i++)
       {
-        SIMPLib::Endian::FromSystemToBig::convert(pos[0]);
-        SIMPLib::Endian::FromSystemToBig::convert(pos[1]);
-        SIMPLib::Endian::FromSystemToBig::convert(pos[2]);
-        totalWritten = fwrite(pos, sizeof(float), 3, vtkFile);
-        if(totalWritten != sizeof(float) * 3)
+        if(nodeType[i] <= 0)
         {
+          continue;
+        }
+        if(writeBinary)
+        {
+          out.appendBigEndian(nodes[i * 3]);
+          out.appendBigEndian(nodes[i * 3 + 1]);
+          out.appendBigEndian(nodes[i * 3 + 2]);
+        }
+        else
+        {
+          out.appendFloat(nodes[i * 3]);
+          out.append(' ');
+          out.appendFloat(nodes[i * 3 + 1]);
+          out.append(' ');
+          out.appendFloat(nodes[i * 3 + 2]);
+          out.append('\n');
         }
       }
-      else
-      {
-        fprintf(vtkFile, "%f %f %f\n", pos[0], pos[1], pos[2]); // Write the positions to the output file
-      }
-    }
-  }
+    });
 
-  int tData[4];
-  int triangleCount = numTriangles;
-  //  int tn1, tn2, tn3;
-  if(!m_WriteConformalMesh)
-  {
-    triangleCount = numTriangles * 2;
-  }
-  // Write the POLYGONS
-  fprintf(vtkFile, "\nPOLYGONS %d %d\n", triangleCount, (triangleCount * 4));
-  for(int j = 0; j < numTriangles; j++)
-  {
-    //  Triangle& t = triangles[j];
-    tData[1] = triangles[j * 3];
-    tData[2] = triangles[j * 3 + 1];
-    tData[3] = triangles[j * 3 + 2];
-
-    if(m_WriteBinaryFile)
+    int triangleCount = numTriangles;
+    if(!m_WriteConformalMesh)
     {
-      tData[0] = 3; // Push on the total number of entries for this entry
-      SIMPLib::Endian::FromSystemToBig::convert(tData[0]);
-      SIMPLib::Endian::FromSystemToBig::convert(tData[1]); // Index of Vertex 0
-      SIMPLib::Endian::FromSystemToBig::convert(tData[2]); // Index of Vertex 1
-      SIMPLib::Endian::FromSystemToBig::convert(tData[3]); // Index of Vertex 2
-      fwrite(tData, sizeof(int), 4, vtkFile);
-      if(!m_WriteConformalMesh)
-      {
-        tData[0] = tData[1];
-        tData[1] = tData[3];
-        tData[3] = tData[0];
-        tData[0] = 3;
-        SIMPLib::Endian::FromSystemToBig::convert(tData[0]);
-        fwrite(tData, sizeof(int), 4, vtkFile);
-      }
+      triangleCount = numTriangles * 2;
     }
-    else
-    {
-      fprintf(vtkFile, "3 %d %d %d\n", tData[1], tData[2], tData[3]);
-      if(!m_WriteConformalMesh)
+    // Write the POLYGONS
+    completed = completed && writer.flush();
+    fprintf(vtkFile, "\nPOLYGONS %d %d\n", triangleCount, (triangleCount * 4));
+    completed = completed && writer.writeRange(numTriangles, BufferedFileWriter::k_ItemsPerChunk, [=](FormatBuffer& out, size_t begin, size_t end) {
+      for(size_t j = begin; j < end; j++)
       {
-        fprintf(vtkFile, "3 %d %d %d\n", tData[3], tData[2], tData[1]);
+        int32_t t0 = static_cast<int32_t>(triangles[j * 3]);
+        int32_t t1 = static_cast<int32_t>(triangles[j * 3 + 1]);
+        int32_t t2 = static_cast<int32_t>(triangles[j * 3 + 2]);
+        if(writeBinary)
+        {
+          out.appendBigEndian(static_cast<int32_t>(3)); // Push on the total number of entries for this entry
+          out.appendBigEndian(t0);
+          out.appendBigEndian(t1);
+          out.appendBigEndian(t2);
+          if(!writeConformal)
+          {
+            out.appendBigEndian(static_cast<int32_t>(3));
+            out.appendBigEndian(t2);
+            out.appendBigEndian(t1);
+            out.appendBigEndian(t0);
+          }
+        }
+        else
+        {
+          out.append("3 ", 2);
+          out.appendInteger(t0);
+          out.append(' ');
+          out.appendInteger(t1);
+          out.append(' ');
+          out.appendInteger(t2);
+          out.append('\n');
+          if(!writeConformal)
+          {
+            out.append("3 ", 2);
+            out.appendInteger(t2);
+            out.append(' ');
+            out.appendInteger(t1);
+            out.append(' ');
+            out.appendInteger(t0);
+            out.append('\n');
+          }
+        }
       }
-    }
+    });
   }
 
   // Write the POINT_DATA section
-  int err = writePointData(vtkFile);
+  int err = completed ? writePointData(vtkFile) : -1;
   // Write the CELL_DATA section
-  err = writeCellData(vtkFile);
-
-  fprintf(vtkFile, "\n");
+  if(err >= 0)
+  {
+    err = writeCellData(vtkFile);
+  }
+  if(err >= 0)
+  {
+    fprintf(vtkFile, "\n");
+  }
+  if(fclose(vtkFile) != 0)
+  {
+    err = -1;
+  }
+  if(err < 0)
+  {
+    // Do not leave a truncated file behind that looks like a complete one
+    QFile::remove(getOutputVtkFile());
+    QString ss = QObject::tr("Error writing to output file '%1'").arg(getOutputVtkFile());
+    setErrorCondition(-18543, ss);
+    return;
+  }
 
   clearErrorCode();
   clearWarningCode();
@@ -362,83 +368,71 @@ void SurfaceMeshToVtk::execute()
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void writePointScalarData(DataContainer::Pointer dc, const QString& vertexAttributeMatrixName, const QString& dataName, const QString& dataType, bool writeBinaryData, bool writeConformalMesh,
+bool writePointScalarData(DataContainer::Pointer dc, const QString& vertexAttributeMatrixName, const QString& dataName, const QString& dataType, bool writeBinaryData, bool writeConformalMesh,
                           FILE* vtkFile, int nT)
 {
   IDataArray::Pointer data = dc->getAttributeMatrix(vertexAttributeMatrixName)->getAttributeArray(dataName);
-  QString ss;
   if(nullptr != data.get())
   {
-    T* m = reinterpret_cast<T*>(data->getVoidPointer(0));
+    const T* m = reinterpret_cast<T*>(data->getVoidPointer(0));
     fprintf(vtkFile, "\n");
     fprintf(vtkFile, "SCALARS %s %s\n", dataName.toLatin1().data(), dataType.toLatin1().data());
     fprintf(vtkFile, "LOOKUP_TABLE default\n");
-    for(int i = 0; i < nT; ++i)
-    {
-      T swapped = 0x00;
-      if(writeBinaryData)
+    BufferedFileWriter writer(vtkFile);
+    return writer.writeRange(static_cast<size_t>(nT), BufferedFileWriter::k_ItemsPerChunk, [=](FormatBuffer& out, size_t begin, size_t end) {
+      for(size_t i = begin; i < end; ++i)
       {
-        swapped = static_cast<T>(m[i]);
-        SIMPLib::Endian::FromSystemToBig::convert(swapped);
-        fwrite(&swapped, sizeof(T), 1, vtkFile);
-      }
-      else
-      {
-
-        ss = QString::number(m[i]) + " ";
-        fprintf(vtkFile, "%s ", ss.toLatin1().data());
-        // if (i%50 == 0)
+        if(writeBinaryData)
+        {
+          out.appendBigEndian(m[i]);
+        }
+        else
         {
-          fprintf(vtkFile, "\n");
+          out.appendNumber(m[i]);
+          out.append('\n');
         }
       }
-    }
+    });
   }
+  return true;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void writePointVectorData(DataContainer::Pointer dc, const QString& vertexAttributeMatrixName, const QString& dataName, const QString& dataType, bool writeBinaryData, bool writeConformalMesh,
+bool writePointVectorData(DataContainer::Pointer dc, const QString& vertexAttributeMatrixName, const QString& dataName, const QString& dataType, bool writeBinaryData, bool writeConformalMesh,
                           const QString& vtkAttributeType, FILE* vtkFile, int nT)
 {
   IDataArray::Pointer data = dc->getAttributeMatrix(vertexAttributeMatrixName)->getAttributeArray(dataName);
-  QString ss;
   if(nullptr != data.get())
   {
-    T* m = reinterpret_cast<T*>(data->getVoidPointer(0));
+    const T* m = reinterpret_cast<T*>(data->getVoidPointer(0));
     fprintf(vtkFile, "\n");
     fprintf(vtkFile, "%s %s %s\n", vtkAttributeType.toLatin1().data(), dataName.toLatin1().data(), dataType.toLatin1().data());
-    for(int i = 0; i < nT; ++i)
-    {
-      T s0 = 0x00;
-      T s1 = 0x00;
-      T s2 = 0x00;
-      if(writeBinaryData)
-      {
-        s0 = static_cast<T>(m[i * 3 + 0]);
-        s1 = static_cast<T>(m[i * 3 + 1]);
-        s2 = static_cast<T>(m[i * 3 + 2]);
-        SIMPLib::Endian::FromSystemToBig::convert(s0);
-        SIMPLib::Endian::FromSystemToBig::convert(s1);
-        SIMPLib::Endian::FromSystemToBig::convert(s2);
-        fwrite(&s0, sizeof(T), 1, vtkFile);
-        fwrite(&s1, sizeof(T), 1, vtkFile);
-        fwrite(&s1, sizeof(T), 1, vtkFile);
-      }
-      else
+    BufferedFileWriter writer(vtkFile);
+    return writer.writeRange(static_cast<size_t>(nT), BufferedFileWriter::k_ItemsPerChunk, [=](FormatBuffer& out, size_t begin, size_t end) {
+      for(size_t i = begin; i < end; ++i)
       {
-
-        ss = QString::number(m[i * 3 + 0]) + " " + QString::number(m[i * 3 + 1]) + " " + QString::number(m[i * 3 + 2]) + " ";
-        fprintf(vtkFile, "%s ", ss.toLatin1().data());
-        // if (i%50 == 0)
+        if(writeBinaryData)
+        {
+          out.appendBigEndian(m[i * 3 + 0]);
+          out.appendBigEndian(m[i * 3 + 1]);
+          out.appendBigEndian(m[i * 3 + 2]);
+        }
+        else
         {
-          fprintf(vtkFile, "\n");
+          out.appendNumber(m[i * 3 + 0]);
+          out.append(' ');
+          out.appendNumber(m[i * 3 + 1]);
+          out.append(' ');
+          out.appendNumber(m[i * 3 + 2]);
+          out.append('\n');
         }
       }
-    }
+    });
   }
+  return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -473,20 +467,32 @@ int SurfaceMeshToVtk::writePointData(FILE* vtkFile)
   fprintf(vtkFile, "SCALARS Node_Type char 1\n");
   fprintf(vtkFile, "LOOKUP_TABLE default\n");
 
-  for(int i = 0; i < numNodes; ++i)
+  const int8_t* nodeType = m_SurfaceMeshNodeType;
+  const bool writeBinary = m_WriteBinaryFile;
   {
-    if(m_SurfaceMeshNodeType[i] > 0)
-    {
-      if(m_WriteBinaryFile)
-      {
-        // Normally, we would byte swap to big endian but since we are only writing
-        // 1 byte Char values, nothing to swap.
-        fwrite(m_SurfaceMeshNodeType + i, sizeof(char), 1, vtkFile);
-      }
-      else
+    BufferedFileWriter writer(vtkFile);
+    if(!writer.writeRange(static_cast<size_t>(numNodes), BufferedFileWriter::k_ItemsPerChunk, [=](FormatBuffer& out, size_t begin, size_t end) {
+      for(size_t i = begin; i < end; ++i)
       {
-        fprintf(vtkFile, "%d ", m_SurfaceMeshNodeType[i]);
+        if(nodeType[i] <= 0)
+        {
+          continue;
+        }
+        if(writeBinary)
+        {
+          // Normally, we would byte swap to big endian but since we are only writing
+          // 1 byte Char values, nothing to swap.
+          out.append(static_cast<char>(nodeType[i]));
+        }
+        else
+        {
+          out.appendInteger(static_cast<int32_t>(nodeType[i]));
+          out.append(' ');
+        }
       }
+    }))
+    {
+      return -1;
     }
   }
 
@@ -494,19 +500,34 @@ int SurfaceMeshToVtk::writePointData(FILE* vtkFile)
 
 #if 1
   // This is from the Goldfeather Paper
-  writePointVectorData<double>(sm, attrMatName, "Principal_Direction_1", "double", m_WriteBinaryFile, m_WriteConformalMesh, "VECTORS", vtkFile, numNodes);
+  if(!writePointVectorData<double>(sm, attrMatName, "Principal_Direction_1", "double", m_WriteBinaryFile, m_WriteConformalMesh, "VECTORS", vtkFile, numNodes))
+  {
+    return -1;
+  }
   // This is from the Goldfeather Paper
-  writePointVectorData<double>(sm, attrMatName, "Principal_Direction_2", "double", m_WriteBinaryFile, m_WriteConformalMesh, "VECTORS", vtkFile, numNodes);
+  if(!writePointVectorData<double>(sm, attrMatName, "Principal_Direction_2", "double", m_WriteBinaryFile, m_WriteConformalMesh, "VECTORS", vtkFile, numNodes))
+  {
+    return -1;
+  }
 
   // This is from the Goldfeather Paper
-  writePointScalarData<double>(sm, attrMatName, "Principal_Curvature_1", "double", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, numNodes);
+  if(!writePointScalarData<double>(sm, attrMatName, "Principal_Curvature_1", "double", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, numNodes))
+  {
+    return -1;
+  }
 
   // This is from the Goldfeather Paper
-  writePointScalarData<double>(sm, attrMatName, "Principal_Curvature_2", "double", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, numNodes);
+  if(!writePointScalarData<double>(sm, attrMatName, "Principal_Curvature_2", "double", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, numNodes))
+  {
+    return -1;
+  }
 #endif
 
   // This is from the Goldfeather Paper
-  writePointVectorData<double>(sm, attrMatName, SIMPL::VertexData::SurfaceMeshNodeNormals, "double", m_WriteBinaryFile, m_WriteConformalMesh, "VECTORS", vtkFile, numNodes);
+  if(!writePointVectorData<double>(sm, attrMatName, SIMPL::VertexData::SurfaceMeshNodeNormals, "double", m_WriteBinaryFile, m_WriteConformalMesh, "VECTORS", vtkFile, numNodes))
+  {
+    return -1;
+  }
 
   return err;
 }
@@ -515,168 +536,145 @@ int SurfaceMeshToVtk::writePointData(FILE* vtkFile)
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void writeCellScalarData(DataContainer::Pointer dc, const QString& faceAttributeMatrixName, const QString& dataName, const QString& dataType, bool writeBinaryData, bool writeConformalMesh,
+bool writeCellScalarData(DataContainer::Pointer dc, const QString& faceAttributeMatrixName, const QString& dataName, const QString& dataType, bool writeBinaryData, bool writeConformalMesh,
                          FILE* vtkFile, int nT)
 {
   // Write the Feature Face ID Data to the file
   IDataArray::Pointer data = dc->getAttributeMatrix(faceAttributeMatrixName)->getAttributeArray(dataName);
-  QString buf;
-  QTextStream ss(&buf);
   if(nullptr != data.get())
   {
-    T* m = reinterpret_cast<T*>(data->getVoidPointer(0));
+    const T* m = reinterpret_cast<T*>(data->getVoidPointer(0));
     fprintf(vtkFile, "\n");
     fprintf(vtkFile, "SCALARS %s %s 1\n", dataName.toLatin1().data(), dataType.toLatin1().data());
     fprintf(vtkFile, "LOOKUP_TABLE default\n");
-    for(int i = 0; i < nT; ++i)
-    {
-      T swapped = 0x00;
-      if(writeBinaryData)
+    BufferedFileWriter writer(vtkFile);
+    return writer.writeRange(static_cast<size_t>(nT), BufferedFileWriter::k_ItemsPerChunk, [=](FormatBuffer& out, size_t begin, size_t end) {
+      for(size_t i = begin; i < end; ++i)
       {
-        swapped = static_cast<T>(m[i]);
-        SIMPLib::Endian::FromSystemToBig::convert(swapped);
-        fwrite(&swapped, sizeof(T), 1, vtkFile);
-        if(!writeConformalMesh)
+        if(writeBinaryData)
         {
-          fwrite(&swapped, sizeof(T), 1, vtkFile);
+          out.appendBigEndian(m[i]);
+          if(!writeConformalMesh)
+          {
+            out.appendBigEndian(m[i]);
+          }
         }
-      }
-      else
-      {
-
-        ss << m[i] << " ";
-        if(!writeConformalMesh)
-        {
-          ss << m[i] << " ";
-        }
-        fprintf(vtkFile, "%s", buf.toLatin1().data());
-        buf.clear();
-        if(i % 50 == 0)
+        else
         {
-          fprintf(vtkFile, "\n");
+          out.appendNumber(m[i]);
+          out.append(' ');
+          if(!writeConformalMesh)
+          {
+            out.appendNumber(m[i]);
+            out.append(' ');
+          }
+          if(i % 50 == 0)
+          {
+            out.append('\n');
+          }
         }
       }
-    }
+    });
   }
+  return true;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void writeCellVectorData(DataContainer::Pointer dc, const QString& faceAttributeMatrixName, const QString& dataName, const QString& dataType, bool writeBinaryData, bool writeConformalMesh,
+bool writeCellVectorData(DataContainer::Pointer dc, const QString& faceAttributeMatrixName, const QString& dataName, const QString& dataType, bool writeBinaryData, bool writeConformalMesh,
                          const QString& vtkAttributeType, FILE* vtkFile, int nT)
 {
   IDataArray::Pointer data = dc->getAttributeMatrix(faceAttributeMatrixName)->getAttributeArray(dataName);
-  QString buf;
-  QTextStream ss(&buf);
   if(nullptr != data.get())
   {
-    T* m = reinterpret_cast<T*>(data->getVoidPointer(0));
+    const T* m = reinterpret_cast<T*>(data->getVoidPointer(0));
     fprintf(vtkFile, "\n");
     fprintf(vtkFile, "%s %s %s\n", vtkAttributeType.toLatin1().data(), dataName.toLatin1().data(), dataType.toLatin1().data());
-    for(int i = 0; i < nT; ++i)
-    {
-      T s0 = 0x00;
-      T s1 = 0x00;
-      T s2 = 0x00;
-      if(writeBinaryData)
-      {
-        s0 = static_cast<T>(m[i * 3 + 0]);
-        s1 = static_cast<T>(m[i * 3 + 1]);
-        s2 = static_cast<T>(m[i * 3 + 2]);
-        SIMPLib::Endian::FromSystemToBig::convert(s0);
-        SIMPLib::Endian::FromSystemToBig::convert(s1);
-        SIMPLib::Endian::FromSystemToBig::convert(s2);
-        fwrite(&s0, sizeof(T), 1, vtkFile);
-        fwrite(&s1, sizeof(T), 1, vtkFile);
-        fwrite(&s2, sizeof(T), 1, vtkFile);
-        if(!writeConformalMesh)
-        {
-          fwrite(&s0, sizeof(T), 1, vtkFile);
-          fwrite(&s1, sizeof(T), 1, vtkFile);
-          fwrite(&s2, sizeof(T), 1, vtkFile);
-        }
-      }
-      else
+    BufferedFileWriter writer(vtkFile);
+    return writer.writeRange(static_cast<size_t>(nT), BufferedFileWriter::k_ItemsPerChunk, [=](FormatBuffer& out, size_t begin, size_t end) {
+      const int numCopies = writeConformalMesh ? 1 : 2;
+      for(size_t i = begin; i < end; ++i)
       {
-        ss << m[i * 3 + 0] << " " << m[i * 3 + 1] << " " << m[i * 3 + 2] << " ";
-        if(!writeConformalMesh)
+        for(int c = 0; c < numCopies; c++)
         {
-          ss << m[i * 3 + 0] << " " << m[i * 3 + 1] << " " << m[i * 3 + 2] << " ";
+          if(writeBinaryData)
+          {
+            out.appendBigEndian(m[i * 3 + 0]);
+            out.appendBigEndian(m[i * 3 + 1]);
+            out.appendBigEndian(m[i * 3 + 2]);
+          }
+          else
+          {
+            out.appendNumber(m[i * 3 + 0]);
+            out.append(' ');
+            out.appendNumber(m[i * 3 + 1]);
+            out.append(' ');
+            out.appendNumber(m[i * 3 + 2]);
+            out.append(' ');
+          }
         }
-        fprintf(vtkFile, "%s ", buf.toLatin1().data());
-        buf.clear();
-        if(i % 25 == 0)
+        if(!writeBinaryData && i % 25 == 0)
         {
-          fprintf(vtkFile, "\n");
+          out.append('\n');
         }
       }
-    }
+    });
   }
+  return true;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void writeCellNormalData(DataContainer::Pointer dc, const QString& faceAttributeMatrixName, const QString& dataName, const QString& dataType, bool writeBinaryData, bool writeConformalMesh,
+bool writeCellNormalData(DataContainer::Pointer dc, const QString& faceAttributeMatrixName, const QString& dataName, const QString& dataType, bool writeBinaryData, bool writeConformalMesh,
                          FILE* vtkFile, int nT)
 {
   IDataArray::Pointer data = dc->getAttributeMatrix(faceAttributeMatrixName)->getAttributeArray(dataName);
-  QString buf;
-  QTextStream ss(&buf);
   if(nullptr != data.get())
   {
-    T* m = reinterpret_cast<T*>(data->getVoidPointer(0));
+    const T* m = reinterpret_cast<T*>(data->getVoidPointer(0));
     fprintf(vtkFile, "\n");
     fprintf(vtkFile, "NORMALS %s %s\n", dataName.toLatin1().data(), dataType.toLatin1().data());
-    for(int i = 0; i < nT; ++i)
-    {
-      T s0 = 0x00;
-      T s1 = 0x00;
-      T s2 = 0x00;
-      if(writeBinaryData)
-      {
-        s0 = static_cast<T>(m[i * 3 + 0]);
-        s1 = static_cast<T>(m[i * 3 + 1]);
-        s2 = static_cast<T>(m[i * 3 + 2]);
-        SIMPLib::Endian::FromSystemToBig::convert(s0);
-        SIMPLib::Endian::FromSystemToBig::convert(s1);
-        SIMPLib::Endian::FromSystemToBig::convert(s2);
-        fwrite(&s0, sizeof(T), 1, vtkFile);
-        fwrite(&s1, sizeof(T), 1, vtkFile);
-        fwrite(&s2, sizeof(T), 1, vtkFile);
-        if(!writeConformalMesh)
-        {
-          s0 = static_cast<T>(m[i * 3 + 0]) * -1.0;
-          s1 = static_cast<T>(m[i * 3 + 1]) * -1.0;
-          s2 = static_cast<T>(m[i * 3 + 2]) * -1.0;
-          SIMPLib::Endian::FromSystemToBig::convert(s0);
-          SIMPLib::Endian::FromSystemToBig::convert(s1);
-          SIMPLib::Endian::FromSystemToBig::convert(s2);
-          fwrite(&s0, sizeof(T), 1, vtkFile);
-          fwrite(&s1, sizeof(T), 1, vtkFile);
-          fwrite(&s2, sizeof(T), 1, vtkFile);
-        }
-      }
-      else
+    BufferedFileWriter writer(vtkFile);
+    return writer.writeRange(static_cast<size_t>(nT), BufferedFileWriter::k_ItemsPerChunk, [=](FormatBuffer& out, size_t begin, size_t end) {
+      // The back side of each triangle in a non-conformal mesh gets the flipped normal
+      const int numCopies = writeConformalMesh ? 1 : 2;
+      for(size_t i = begin; i < end; ++i)
       {
-
-        ss << m[i * 3 + 0] << " " << m[i * 3 + 1] << " " << m[i * 3 + 2] << " ";
-        if(!writeConformalMesh)
+        T sign = static_cast<T>(1);
+        for(int c = 0; c < numCopies; c++)
         {
-          ss << -1.0 * m[i * 3 + 0] << " " << -1.0 * m[i * 3 + 1] << " " << -1.0 * m[i * 3 + 2] << " ";
+          T s0 = sign * m[i * 3 + 0];
+          T s1 = sign * m[i * 3 + 1];
+          T s2 = sign * m[i * 3 + 2];
+          if(writeBinaryData)
+          {
+            out.appendBigEndian(s0);
+            out.appendBigEndian(s1);
+            out.appendBigEndian(s2);
+          }
+          else
+          {
+            out.appendNumber(s0);
+            out.append(' ');
+            out.appendNumber(s1);
+            out.append(' ');
+            out.appendNumber(s2);
+            out.append(' ');
+          }
+          sign = static_cast<T>(-1);
         }
-        fprintf(vtkFile, "%s ", buf.toLatin1().data());
-        buf.clear();
-        if(i % 50 == 0)
+        if(!writeBinaryData && i % 50 == 0)
         {
-          fprintf(vtkFile, "\n");
+          out.append('\n');
         }
       }
-    }
+    });
   }
+  return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -698,7 +696,6 @@ int SurfaceMeshToVtk::writeCellData(FILE* vtkFile)
   int64_t nT = triangleGeom->getNumberOfTris();
 
   int numTriangles = nT;
-  int swapped;
   if(!m_WriteConformalMesh)
   {
     numTriangles = nT * 2;
@@ -711,29 +708,36 @@ int SurfaceMeshToVtk::writeCellData(FILE* vtkFile)
   // Write the FeatureId Data to the file
   fprintf(vtkFile, "SCALARS FeatureID int 1\n");
   fprintf(vtkFile, "LOOKUP_TABLE default\n");
-  for(int i = 0; i < nT; ++i)
+  const int32_t* faceLabels = m_SurfaceMeshFaceLabels;
+  const bool writeBinary = m_WriteBinaryFile;
+  const bool writeConformal = m_WriteConformalMesh;
   {
-    // FaceArray::Face_t& t = triangles[i]; // Get the current Node
-
-    if(m_WriteBinaryFile)
-    {
-      swapped = m_SurfaceMeshFaceLabels[i * 2];
-      SIMPLib::Endian::FromSystemToBig::convert(swapped);
-      fwrite(&swapped, sizeof(int), 1, vtkFile);
-      if(!m_WriteConformalMesh)
+    BufferedFileWriter writer(vtkFile);
+    if(!writer.writeRange(static_cast<size_t>(nT), BufferedFileWriter::k_ItemsPerChunk, [=](FormatBuffer& out, size_t begin, size_t end) {
+      for(size_t i = begin; i < end; ++i)
       {
-        swapped = m_SurfaceMeshFaceLabels[i * 2 + 1];
-        SIMPLib::Endian::FromSystemToBig::convert(swapped);
-        fwrite(&swapped, sizeof(int), 1, vtkFile);
+        if(writeBinary)
+        {
+          out.appendBigEndian(faceLabels[i * 2]);
+          if(!writeConformal)
+          {
+            out.appendBigEndian(faceLabels[i * 2 + 1]);
+          }
+        }
+        else
+        {
+          out.appendInteger(faceLabels[i * 2]);
+          out.append('\n');
+          if(!writeConformal)
+          {
+            out.appendInteger(faceLabels[i * 2 + 1]);
+            out.append('\n');
+          }
+        }
       }
-    }
-    else
+    }))
     {
-      fprintf(vtkFile, "%d\n", m_SurfaceMeshFaceLabels[i * 2]);
-      if(!m_WriteConformalMesh)
-      {
-        fprintf(vtkFile, "%d\n", m_SurfaceMeshFaceLabels[i * 2 + 1]);
-      }
+      return -1;
     }
   }
 
@@ -769,23 +773,50 @@ int SurfaceMeshToVtk::writeCellData(FILE* vtkFile)
 
   QString attrMatName = m_SurfaceMeshFaceLabelsArrayPath.getAttributeMatrixName();
 
-  writeCellScalarData<int32_t>(sm, attrMatName, SIMPL::FaceData::SurfaceMeshFeatureFaceId, "int", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, nT);
+  if(!writeCellScalarData<int32_t>(sm, attrMatName, SIMPL::FaceData::SurfaceMeshFeatureFaceId, "int", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, nT))
+  {
+    return -1;
+  }
 
-  writeCellScalarData<double>(sm, attrMatName, SIMPL::FaceData::SurfaceMeshPrincipalCurvature1, "double", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, nT);
+  if(!writeCellScalarData<double>(sm, attrMatName, SIMPL::FaceData::SurfaceMeshPrincipalCurvature1, "double", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, nT))
+  {
+    return -1;
+  }
 
-  writeCellScalarData<double>(sm, attrMatName, SIMPL::FaceData::SurfaceMeshPrincipalCurvature2, "double", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, nT);
+  if(!writeCellScalarData<double>(sm, attrMatName, SIMPL::FaceData::SurfaceMeshPrincipalCurvature2, "double", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, nT))
+  {
+    return -1;
+  }
 
-  writeCellVectorData<double>(sm, attrMatName, SIMPL::FaceData::SurfaceMeshPrincipalDirection1, "double", m_WriteBinaryFile, m_WriteConformalMesh, "VECTORS", vtkFile, nT);
+  if(!writeCellVectorData<double>(sm, attrMatName, SIMPL::FaceData::SurfaceMeshPrincipalDirection1, "double", m_WriteBinaryFile, m_WriteConformalMesh, "VECTORS", vtkFile, nT))
+  {
+    return -1;
+  }
 
-  writeCellVectorData<double>(sm, attrMatName, SIMPL::FaceData::SurfaceMeshPrincipalDirection2, "double", m_WriteBinaryFile, m_WriteConformalMesh, "VECTORS", vtkFile, nT);
+  if(!writeCellVectorData<double>(sm, attrMatName, SIMPL::FaceData::SurfaceMeshPrincipalDirection2, "double", m_WriteBinaryFile, m_WriteConformalMesh, "VECTORS", vtkFile, nT))
+  {
+    return -1;
+  }
 
-  writeCellScalarData<double>(sm, attrMatName, SIMPL::FaceData::SurfaceMeshGaussianCurvatures, "double", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, nT);
+  if(!writeCellScalarData<double>(sm, attrMatName, SIMPL::FaceData::SurfaceMeshGaussianCurvatures, "double", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, nT))
+  {
+    return -1;
+  }
 
-  writeCellScalarData<double>(sm, attrMatName, SIMPL::FaceData::SurfaceMeshMeanCurvatures, "double", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, nT);
+  if(!writeCellScalarData<double>(sm, attrMatName, SIMPL::FaceData::SurfaceMeshMeanCurvatures, "double", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, nT))
+  {
+    return -1;
+  }
 
-  writeCellNormalData<double>(sm, attrMatName, SIMPL::FaceData::SurfaceMeshFaceNormals, "double", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, nT);
+  if(!writeCellNormalData<double>(sm, attrMatName, SIMPL::FaceData::SurfaceMeshFaceNormals, "double", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, nT))
+  {
+    return -1;
+  }
 
-  writeCellNormalData<double>(sm, attrMatName, "Goldfeather_Triangle_Normals", "double", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, nT);
+  if(!writeCellNormalData<double>(sm, attrMatName, "Goldfeather_Triangle_Normals", "double", m_WriteBinaryFile, m_WriteConformalMesh, vtkFile, nT))
+  {
+    return -1;
+  }
 
   return err;
 }
@@ -35,8 +35,6 @@
 
 #include "VtkRectilinearGridWriter.h"
 
-#include <sstream>
-
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
@@ -44,7 +42,6 @@
 
 #include <QtCore/QDebug>
 
-#include "SIMPLib/Common/ScopedFileMonitor.hpp"
 #include "SIMPLib/Common/TemplateHelpers.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
@@ -58,6 +55,7 @@
 #include "SIMPLib/VTKUtils/VTKUtil.hpp"
 
 #include "ImportExport/ImportExportConstants.h"
+#include "ImportExport/ImportExportFilters/util/BufferedFileWriter.h"
 #include "ImportExport/ImportExportVersion.h"
 
 #define LD_CAST(arg) static_cast<long int>(arg)
@@ -126,7 +124,6 @@ int WriteCoords(FILE* f, const char* axis, const char* type, int64_t npoints, T
     if(totalWritten != static_cast<size_t>(npoints))
     {
       qDebug() << "Error Writing Binary VTK Data into file ";
-      fclose(f);
       return -1;
     }
   }
@@ -170,50 +167,42 @@ void WriteDataArray(AbstractFilter* filter, FILE* f, IDataArray::Pointer iDataPt
     dName = dName.replace(" ", "_");
 
     QString vtkTypeString = VTKUtil::TypeForPrimitive<T>(val[0]);
-    bool useIntCast = false;
-    if(vtkTypeString.compare("unsigned_char") == 0 || vtkTypeString.compare("char") == 0)
-    {
-      useIntCast = true;
-    }
 
     fprintf(f, "SCALARS %s %s %d\n", dName.toLatin1().data(), vtkTypeString.toLatin1().data(), numComps);
     fprintf(f, "LOOKUP_TABLE default\n");
+
+    // The values are converted to big endian (binary) or formatted (ASCII) into per chunk buffers
+    // in parallel so the array itself is never modified.
+    BufferedFileWriter writer(f);
+    bool completed = false;
     if(writeBinary)
     {
-      if(BIGENDIAN == 0)
-      {
-        array->byteSwapElements();
-      }
-      size_t totalWritten = fwrite(val, array->getTypeSize(), totalElements, f);
-      if(totalWritten != totalElements)
-      {
-      }
-      fprintf(f, "\n");
-      if(BIGENDIAN == 0)
-      {
-        array->byteSwapElements();
-      }
+      completed = writer.writeRange(totalElements, BufferedFileWriter::k_ItemsPerChunk, [val](FormatBuffer& out, size_t begin, size_t end) {
+        for(size_t i = begin; i < end; i++)
+        {
+          out.appendBigEndian(val[i]);
+        }
+      });
     }
     else
     {
-      std::stringstream ss;
-      for(size_t i = 0; i < totalElements; i++)
-      {
-        if(i % 20 == 0 && i > 0)
-        {
-          ss << "\n";
-        }
-        if(useIntCast)
+      completed = writer.writeRange(totalElements, BufferedFileWriter::k_ItemsPerChunk, [val](FormatBuffer& out, size_t begin, size_t end) {
+        for(size_t i = begin; i < end; i++)
         {
-          ss << " " << static_cast<int>(val[i]);
+          if(i % 20 == 0 && i > 0)
+          {
+            out.append('\n');
+          }
+          out.append(' ');
+          out.appendNumber(val[i]);
         }
-        else
-        {
-          ss << " " << val[i];
-        }
-      }
-      ss << "\n";
-      fprintf(f, "%s", ss.str().c_str());
+      });
+    }
+    writer.buffer().append('\n');
+    if(!completed || !writer.flush())
+    {
+      QString msg = QObject::tr("Error writing Cell Data %1").arg(iDataPtr->getName());
+      filter->setErrorCondition(-2031003, msg);
     }
   }
 }
@@ -340,14 +329,18 @@ void VtkRectilinearGridWriter::execute()
 
   int err = 0;
   FILE* f = nullptr;
-  f = fopen(getOutputFile().toLatin1().data(), "wb");
-  ScopedFileMonitor fMon(f);
+  f = BufferedFileWriter::OpenFile(getOutputFile(), "wb");
   if(nullptr == f)
   {
     QString ss = QObject::tr("Error opening output vtk file '%1'\n ").arg(m_OutputFile);
     setErrorCondition(-2031001, ss);
     return;
   }
+  // A failed or canceled write must not leave a truncated file behind
+  auto removePartialFile = [this, f]() {
+    fclose(f);
+    QFile::remove(getOutputFile());
+  };
 
   // write the header
   Detail::WriteVTKHeader<ImageGeom>(f, m, getWriteBinaryFile());
@@ -358,6 +351,7 @@ void VtkRectilinearGridWriter::execute()
   {
     QString ss = QObject::tr("Error writing X Coordinates in vtk file %s'\n ").arg(m_OutputFile);
     setErrorCondition(-2031002, ss);
+    removePartialFile();
     return;
   }
   err = Detail::WriteCoords<float>(f, "Y_COORDINATES", "float", dims[1] + 1, origin[1] - res[1] * 0.5f, (float)(dims[1] + 1 * res[1]), res[1], m_WriteBinaryFile);
@@ -365,6 +359,7 @@ void VtkRectilinearGridWriter::execute()
   {
     QString ss = QObject::tr("Error writing Y Coordinates in vtk file %s'\n ").arg(m_OutputFile);
     setErrorCondition(-2031002, ss);
+    removePartialFile();
     return;
   }
   err = Detail::WriteCoords<float>(f, "Z_COORDINATES", "float", dims[2] + 1, origin[2] - res[2] * 0.5f, (float)(dims[2] + 1 * res[2]), res[2], m_WriteBinaryFile);
@@ -372,6 +367,7 @@ void VtkRectilinearGridWriter::execute()
   {
     QString ss = QObject::tr("Error writing Z Coordinates in vtk file %s'\n ").arg(m_OutputFile);
     setErrorCondition(-2031002, ss);
+    removePartialFile();
     return;
   }
 
@@ -384,6 +380,11 @@ void VtkRectilinearGridWriter::execute()
     IDataArray::Pointer iDataPtr = getDataContainerArray()->getPrereqIDataArrayFromPath(this, arrayPath);
 
     EXECUTE_FUNCTION_TEMPLATE(this, Detail::WriteDataArray, iDataPtr, this, f, iDataPtr, m_WriteBinaryFile);
+    if(getErrorCode() < 0 || getCancel())
+    {
+      removePartialFile();
+      return;
+    }
 
 #if 0
     QString className = iDataPtr->getNameOfClass();
@@ -412,7 +413,7 @@ void VtkRectilinearGridWriter::execute()
 #endif
   }
 
-  // The scopedFileMonitor will fclose() the FILE pointer for us
+  fclose(f);
 }
 
 // -----------------------------------------------------------------------------
@@ -34,6 +34,10 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "WriteStlFile.h"
 
+#include <utility>
+#include <vector>
+
+#include <QtCore/QHash>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -48,8 +52,10 @@
 #include "SIMPLib/Math/SIMPLibMath.h"
 
 #include <QtCore/QDir>
+#include <QtCore/QFile>
 
 #include "ImportExport/ImportExportConstants.h"
+#include "ImportExport/ImportExportFilters/util/BufferedFileWriter.h"
 #include "ImportExport/ImportExportVersion.h"
 
 // -----------------------------------------------------------------------------
@@ -234,86 +240,70 @@ void WriteStlFile::execute()
     }
   }
 
-  unsigned char data[50];
-  float* normal = reinterpret_cast<float*>(data);
-  float* vert1 = reinterpret_cast<float*>(data + 12);
-  float* vert2 = reinterpret_cast<float*>(data + 24);
-  float* vert3 = reinterpret_cast<float*>(data + 36);
-  uint16_t* attrByteCount = reinterpret_cast<uint16_t*>(data + 48);
-  *attrByteCount = 0;
-
-  size_t totalWritten = 0;
-  float u[3] = {0.0f, 0.0f, 0.0f}, w[3] = {0.0f, 0.0f, 0.0f};
-  float length = 0.0f;
-
-  int32_t spin = 0;
-  int32_t triCount = 0;
-
-  // Loop over the unique Spins
+  // Sort the triangles by Feature with a counting sort so that each Feature's file is streamed out
+  // without looping over every triangle once per Feature. Each triangle is listed for both of its
+  // Features; the low bit of an entry marks the side that is written with the reversed winding.
+  QHash<int32_t, size_t> featureSlots;
   for(QMap<int32_t, int32_t>::iterator spinIter = uniqueGrainIdtoPhase.begin(); spinIter != uniqueGrainIdtoPhase.end(); ++spinIter)
   {
-    spin = spinIter.key();
-
-    // Generate the output file name
-    QString filename = getOutputStlDirectory() + "/" + getOutputStlPrefix();
-    if(m_GroupByPhase)
-    {
-      filename = filename + QString("Ensemble_") + QString::number(spinIter.value()) + QString("_");
-    }
-    filename = filename + QString("Feature_") + QString::number(spin) + ".stl";
-    FILE* f = fopen(filename.toLatin1().data(), "wb");
-
-    QString ss = QObject::tr("Writing STL for Feature Id %1").arg(spin);
-    notifyStatusMessage(ss);
-
-    QString header = "DREAM3D Generated For Feature ID " + QString::number(spin);
-    if(m_GroupByPhase)
+    featureSlots.insert(spinIter.key(), static_cast<size_t>(featureSlots.size()));
+  }
+  std::vector<size_t> slotStart(static_cast<size_t>(featureSlots.size()) + 1, 0);
+  for(MeshIndexType t = 0; t < nTriangles; t++)
+  {
+    slotStart[featureSlots.value(m_SurfaceMeshFaceLabels[t * 2]) + 1]++;
+    if(m_SurfaceMeshFaceLabels[t * 2 + 1] != m_SurfaceMeshFaceLabels[t * 2])
     {
-      header = header + " Phase " + QString::number(spinIter.value());
+      slotStart[featureSlots.value(m_SurfaceMeshFaceLabels[t * 2 + 1]) + 1]++;
     }
-    err = writeHeader(f, header, 0);
-    if(err < 0)
+  }
+  for(size_t i = 1; i < slotStart.size(); i++)
+  {
+    slotStart[i] += slotStart[i - 1];
+  }
+  std::vector<size_t> slotTriangles(slotStart.back());
+  {
+    std::vector<size_t> fillIndex(slotStart.begin(), slotStart.end() - 1);
+    for(MeshIndexType t = 0; t < nTriangles; t++)
     {
+      slotTriangles[fillIndex[featureSlots.value(m_SurfaceMeshFaceLabels[t * 2])]++] = t * 2;
+      if(m_SurfaceMeshFaceLabels[t * 2 + 1] != m_SurfaceMeshFaceLabels[t * 2])
+      {
+        slotTriangles[fillIndex[featureSlots.value(m_SurfaceMeshFaceLabels[t * 2 + 1])]++] = t * 2 + 1;
+      }
     }
-    triCount = 0; // Reset this to Zero. Increment for every triangle written
+  }
 
-    // Loop over all the triangles for this spin
-    for(MeshIndexType t = 0; t < nTriangles; ++t)
+  // Encodes the 50 byte binary STL record of each listed triangle
+  auto formatTriangles = [nodes, triangles](const size_t* entries, FormatBuffer& out, size_t begin, size_t end) {
+    float record[12] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    float* normal = record;
+    float* vert1 = record + 3;
+    float* vert2 = record + 6;
+    float* vert3 = record + 9;
+    const char attrByteCount[2] = {0, 0};
+    float u[3] = {0.0f, 0.0f, 0.0f}, w[3] = {0.0f, 0.0f, 0.0f};
+    for(size_t i = begin; i < end; i++)
     {
+      MeshIndexType t = entries[i] / 2;
+
       // Get the true indices of the 3 nodes
       MeshIndexType nId0 = triangles[t * 3];
       MeshIndexType nId1 = triangles[t * 3 + 1];
       MeshIndexType nId2 = triangles[t * 3 + 2];
-
-      vert1[0] = static_cast<float>(nodes[nId0 * 3]);
-      vert1[1] = static_cast<float>(nodes[nId0 * 3 + 1]);
-      vert1[2] = static_cast<float>(nodes[nId0 * 3 + 2]);
-
-      if(m_SurfaceMeshFaceLabels[t * 2] == spin)
-      {
-        // winding = 0; // 0 = Write it using forward spin
-      }
-      else if(m_SurfaceMeshFaceLabels[t * 2 + 1] == spin)
+      if((entries[i] & 1) != 0)
       {
-        // winding = 1; // Write it using backward spin
-        // Switch the 2 node indices
-        MeshIndexType temp = nId1;
-        nId1 = nId2;
-        nId2 = temp;
+        // Write it using backward spin
+        std::swap(nId1, nId2);
       }
-      else
+
+      for(size_t j = 0; j < 3; j++)
       {
-        continue; // We do not match either spin so move to the next triangle
+        vert1[j] = static_cast<float>(nodes[nId0 * 3 + j]);
+        vert2[j] = static_cast<float>(nodes[nId1 * 3 + j]);
+        vert3[j] = static_cast<float>(nodes[nId2 * 3 + j]);
       }
 
-      vert2[0] = static_cast<float>(nodes[nId1 * 3]);
-      vert2[1] = static_cast<float>(nodes[nId1 * 3 + 1]);
-      vert2[2] = static_cast<float>(nodes[nId1 * 3 + 2]);
-
-      vert3[0] = static_cast<float>(nodes[nId2 * 3]);
-      vert3[1] = static_cast<float>(nodes[nId2 * 3 + 1]);
-      vert3[2] = static_cast<float>(nodes[nId2 * 3 + 2]);
-
       // Compute the normal
       u[0] = vert2[0] - vert1[0];
       u[1] = vert2[1] - vert1[1];
@@ -327,21 +317,79 @@ void WriteStlFile::execute()
       normal[1] = u[2] * w[0] - u[0] * w[2];
       normal[2] = u[0] * w[1] - u[1] * w[0];
 
-      length = sqrtf(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+      float length = sqrtf(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
       normal[0] = normal[0] / length;
       normal[1] = normal[1] / length;
       normal[2] = normal[2] / length;
 
-      totalWritten = fwrite(data, 1, 50, f);
-      if(totalWritten != 50)
-      {
-        QString ss = QObject::tr("Error Writing STL File. Not enough elements written for Feature Id %1. Wrote %2 of 50.").arg(spin).arg(totalWritten);
-        setErrorCondition(-1201, ss);
-      }
-      triCount++;
+      out.append(reinterpret_cast<const char*>(record), sizeof(record));
+      out.append(attrByteCount, 2);
+    }
+  };
+
+  // Loop over the unique Spins
+  size_t slot = 0;
+  for(QMap<int32_t, int32_t>::iterator spinIter = uniqueGrainIdtoPhase.begin(); spinIter != uniqueGrainIdtoPhase.end(); ++spinIter, ++slot)
+  {
+    int32_t spin = spinIter.key();
+
+    // Generate the output file name
+    QString filename = getOutputStlDirectory() + "/" + getOutputStlPrefix();
+    if(m_GroupByPhase)
+    {
+      filename = filename + QString("Ensemble_") + QString::number(spinIter.value()) + QString("_");
+    }
+    filename = filename + QString("Feature_") + QString::number(spin) + ".stl";
+    FILE* f = BufferedFileWriter::OpenFile(filename, "wb");
+    if(nullptr == f)
+    {
+      QString ss = QObject::tr("Error opening output STL file '%1'").arg(filename);
+      setErrorCondition(-1202, ss);
+      return;
+    }
+
+    QString ss = QObject::tr("Writing STL for Feature Id %1").arg(spin);
+    notifyStatusMessage(ss);
+
+    QString header = "DREAM3D Generated For Feature ID " + QString::number(spin);
+    if(m_GroupByPhase)
+    {
+      header = header + " Phase " + QString::number(spinIter.value());
+    }
+
+    // The number of triangles is known up front so the header is written once and the
+    // triangles are streamed out behind it
+    const size_t* entries = slotTriangles.data() + slotStart[slot];
+    size_t triCount = slotStart[slot + 1] - slotStart[slot];
+    err = writeHeader(f, header, static_cast<int32_t>(triCount));
+    if(err < 0)
+    {
+      fclose(f);
+      QFile::remove(filename);
+      QString ss = QObject::tr("Error writing the header of STL file '%1'").arg(filename);
+      setErrorCondition(-1203, ss);
+      return;
+    }
+
+    bool writeOk = true;
+    {
+      BufferedFileWriter writer(f);
+      writeOk = writer.writeRange(triCount, BufferedFileWriter::k_ItemsPerChunk,
+                                  [&formatTriangles, entries](FormatBuffer& out, size_t begin, size_t end) { formatTriangles(entries, out, begin, end); });
+      writeOk = writeOk && writer.flush();
     }
     fclose(f);
-    err = writeNumTrianglesToFile(filename, triCount);
+    if(!writeOk)
+    {
+      QFile::remove(filename);
+      QString ss = QObject::tr("Error Writing STL File for Feature Id %1").arg(spin);
+      setErrorCondition(-1201, ss);
+      return;
+    }
+    if(getCancel())
+    {
+      return;
+    }
   }
 
   clearErrorCode();
@@ -367,28 +415,17 @@ int32_t WriteStlFile::writeHeader(FILE* f, const QString& header, int32_t triCou
   std::string c_str = header.toStdString();
   ::memset(h, 0, 80);
   ::memcpy(h, c_str.data(), headlength);
-  // Return the number of bytes written - which should be 80
-  fwrite(h, 1, 80, f);
-  fwrite(&triCount, 1, 4, f);
+  if(fwrite(h, 1, 80, f) != 80)
+  {
+    return -1;
+  }
+  if(fwrite(&triCount, 1, 4, f) != 4)
+  {
+    return -1;
+  }
   return 0;
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int32_t WriteStlFile::writeNumTrianglesToFile(const QString& filename, int32_t triCount)
-{
-  // We need to update the number of triangles in the file
-  int32_t err = 0;
-
-  FILE* out = fopen(filename.toLatin1().data(), "r+b");
-  fseek(out, 80L, SEEK_SET);
-  fwrite(reinterpret_cast<char*>(&triCount), 1, 4, out);
-  fclose(out);
-
-  return err;
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -0,0 +1,157 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "BufferedFileWriter.h"
+
+#include <cstdio>
+
+#include <QtCore/QFile>
+
+// Shortest round trip formatting of floating point values needs the C++17 floating point
+// overloads of std::to_chars which not every standard library ships yet. Fall back to
+// printf with enough significant digits to round trip in that case.
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define IMPORTEXPORT_FLOAT_TO_CHARS 1
+#else
+#define IMPORTEXPORT_FLOAT_TO_CHARS 0
+#endif
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FormatBuffer::appendFloat(float value)
+{
+  char tmp[32];
+#if IMPORTEXPORT_FLOAT_TO_CHARS
+  std::to_chars_result result = std::to_chars(tmp, tmp + sizeof(tmp), value);
+  m_Data.append(tmp, static_cast<size_t>(result.ptr - tmp));
+#else
+  int length = snprintf(tmp, sizeof(tmp), "%.9g", static_cast<double>(value));
+  m_Data.append(tmp, static_cast<size_t>(length));
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FormatBuffer::appendFloat(double value)
+{
+  char tmp[32];
+#if IMPORTEXPORT_FLOAT_TO_CHARS
+  std::to_chars_result result = std::to_chars(tmp, tmp + sizeof(tmp), value);
+  m_Data.append(tmp, static_cast<size_t>(result.ptr - tmp));
+#else
+  int length = snprintf(tmp, sizeof(tmp), "%.17g", value);
+  m_Data.append(tmp, static_cast<size_t>(length));
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FormatBuffer::appendFixed(double value, int precision)
+{
+  char tmp[64];
+#if IMPORTEXPORT_FLOAT_TO_CHARS
+  std::to_chars_result result = std::to_chars(tmp, tmp + sizeof(tmp), value, std::chars_format::fixed, precision);
+  if(result.ec == std::errc())
+  {
+    m_Data.append(tmp, static_cast<size_t>(result.ptr - tmp));
+    return;
+  }
+#endif
+  // Very large magnitudes do not fit into the stack buffer
+  int length = snprintf(nullptr, 0, "%.*f", precision, value);
+  std::vector<char> large(static_cast<size_t>(length) + 1);
+  snprintf(large.data(), large.size(), "%.*f", precision, value);
+  m_Data.append(large.data(), static_cast<size_t>(length));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BufferedFileWriter::BufferedFileWriter(FILE* file)
+: m_File(file)
+{
+  m_Buffer.reserve(k_FlushSize + k_FlushSize / 4);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BufferedFileWriter::~BufferedFileWriter()
+{
+  flush();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FILE* BufferedFileWriter::OpenFile(const QString& filePath, const char* mode)
+{
+#if defined(_MSC_VER)
+  QString wideMode = QString::fromLatin1(mode);
+  return _wfopen(reinterpret_cast<const wchar_t*>(filePath.utf16()), reinterpret_cast<const wchar_t*>(wideMode.utf16()));
+#else
+  return fopen(QFile::encodeName(filePath).constData(), mode);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BufferedFileWriter::flush()
+{
+  bool ok = writeBytes(m_Buffer.data(), m_Buffer.size());
+  m_Buffer.clear();
+  return ok;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BufferedFileWriter::writeBytes(const char* data, size_t numBytes)
+{
+  if(m_Error || nullptr == m_File)
+  {
+    m_Error = true;
+    return false;
+  }
+  if(numBytes == 0)
+  {
+    return true;
+  }
+  if(fwrite(data, 1, numBytes, m_File) != numBytes)
+  {
+    m_Error = true;
+  }
+  return !m_Error;
+}
@@ -0,0 +1,333 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+#include "SIMPLib/Utilities/SIMPLibEndian.h"
+
+#include "ImportExport/ImportExportDLLExport.h"
+
+/**
+ * @brief The FormatBuffer class accumulates formatted ASCII text and/or big endian binary values
+ * in memory so that they can be handed to the operating system in a few large writes instead of
+ * one fprintf() per value. Integers are formatted with std::to_chars and floating point values are
+ * written with the shortest representation that reads back to the identical value.
+ */
+class ImportExport_EXPORT FormatBuffer
+{
+public:
+  FormatBuffer() = default;
+  ~FormatBuffer() = default;
+
+  FormatBuffer(const FormatBuffer&) = default;
+  FormatBuffer(FormatBuffer&&) = default;
+  FormatBuffer& operator=(const FormatBuffer&) = default;
+  FormatBuffer& operator=(FormatBuffer&&) = default;
+
+  void clear()
+  {
+    m_Data.clear();
+  }
+
+  void reserve(size_t numBytes)
+  {
+    m_Data.reserve(numBytes);
+  }
+
+  const char* data() const
+  {
+    return m_Data.data();
+  }
+
+  size_t size() const
+  {
+    return m_Data.size();
+  }
+
+  void append(char c)
+  {
+    m_Data.push_back(c);
+  }
+
+  void append(const char* str)
+  {
+    m_Data.append(str);
+  }
+
+  void append(const char* str, size_t length)
+  {
+    m_Data.append(str, length);
+  }
+
+  void append(const std::string& str)
+  {
+    m_Data.append(str);
+  }
+
+  /**
+   * @brief Appends the decimal representation of an integer value
+   * @param value
+   */
+  template <typename T>
+  void appendInteger(T value)
+  {
+    static_assert(std::is_integral<T>::value, "FormatBuffer::appendInteger requires an integral type");
+    char tmp[24];
+    std::to_chars_result result = std::to_chars(tmp, tmp + sizeof(tmp), value);
+    m_Data.append(tmp, static_cast<size_t>(result.ptr - tmp));
+  }
+
+  /**
+   * @brief Appends the shortest decimal representation of value that parses back to the same float
+   * @param value
+   */
+  void appendFloat(float value);
+
+  /**
+   * @brief Appends the shortest decimal representation of value that parses back to the same double
+   * @param value
+   */
+  void appendFloat(double value);
+
+  /**
+   * @brief Appends value with a fixed number of decimals. This matches printf("%.*f", precision, value)
+   * @param value
+   * @param precision
+   */
+  void appendFixed(double value, int precision);
+
+  /**
+   * @brief Appends any arithmetic value. 8 bit types are written as numbers rather than characters.
+   * @param value
+   */
+  template <typename T>
+  void appendNumber(T value)
+  {
+    if constexpr(std::is_floating_point<T>::value)
+    {
+      appendFloat(value);
+    }
+    else if constexpr(sizeof(T) == 1)
+    {
+      appendInteger(static_cast<int32_t>(value));
+    }
+    else
+    {
+      appendInteger(value);
+    }
+  }
+
+  /**
+   * @brief Appends the raw bytes of value converted to big endian byte order, which is what
+   * the legacy binary VTK format expects.
+   * @param value
+   */
+  template <typename T>
+  void appendBigEndian(T value)
+  {
+    SIMPLib::Endian::FromSystemToBig::convert(value);
+    m_Data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+private:
+  std::string m_Data;
+};
+
+/**
+ * @brief The BufferedFileWriter class writes to an already opened FILE* through a large in memory
+ * FormatBuffer. Large blocks of items can be written with writeRange() which formats fixed size chunks
+ * of the range in parallel and then writes the chunks to the file in order, so the output is identical
+ * to formatting the items one after another. The FILE* is not closed by this class.
+ */
+class ImportExport_EXPORT BufferedFileWriter
+{
+public:
+  using ProgressFunctionType = std::function<bool(size_t)>;
+
+  static constexpr size_t k_FlushSize = 4 * 1024 * 1024;
+  static constexpr size_t k_ItemsPerChunk = 16384;
+  static constexpr size_t k_ChunksPerBatch = 64;
+
+  explicit BufferedFileWriter(FILE* file);
+  ~BufferedFileWriter();
+
+  BufferedFileWriter(const BufferedFileWriter&) = delete;            // Copy Constructor Not Implemented
+  BufferedFileWriter(BufferedFileWriter&&) = delete;                 // Move Constructor Not Implemented
+  BufferedFileWriter& operator=(const BufferedFileWriter&) = delete; // Copy Assignment Not Implemented
+  BufferedFileWriter& operator=(BufferedFileWriter&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Opens filePath with the given fopen() mode. Unlike fopen(filePath.toLatin1().data(), ...)
+   * this keeps paths that contain characters outside of Latin-1 intact.
+   * @param filePath
+   * @param mode
+   * @return The opened file or nullptr if it could not be opened
+   */
+  static FILE* OpenFile(const QString& filePath, const char* mode);
+
+  /**
+   * @brief Returns the buffer that serial output should be appended to. Call commit() regularly
+   * when appending inside of a loop.
+   */
+  FormatBuffer& buffer()
+  {
+    return m_Buffer;
+  }
+
+  /**
+   * @brief Writes the buffer to the file once it has grown past k_FlushSize
+   * @return false if a write to the file failed
+   */
+  bool commit()
+  {
+    if(m_Buffer.size() < k_FlushSize)
+    {
+      return !m_Error;
+    }
+    return flush();
+  }
+
+  /**
+   * @brief Writes everything that is buffered to the file
+   * @return false if a write to the file failed
+   */
+  bool flush();
+
+  /**
+   * @brief Returns true if any write to the file has failed
+   */
+  bool hasError() const
+  {
+    return m_Error;
+  }
+
+  /**
+   * @brief Formats the items [0, count) and writes them to the file. The range is split into chunks of
+   * itemsPerChunk items which are formatted concurrently by calling formatter(FormatBuffer&, begin, end)
+   * so the formatter must only read shared data.
+   * @param count The number of items to write
+   * @param itemsPerChunk The number of items that each call to the formatter handles
+   * @param formatter The functor that appends the items [begin, end) to the given buffer
+   * @param progress Optional callback that receives the number of items written so far after each
+   * batch of chunks. Returning false from it stops the write.
+   * @return false if a write failed or the progress callback stopped the write
+   */
+  template <typename FormatterType>
+  bool writeRange(size_t count, size_t itemsPerChunk, const FormatterType& formatter, const ProgressFunctionType& progress = ProgressFunctionType())
+  {
+    if(!flush())
+    {
+      return false;
+    }
+    if(itemsPerChunk == 0)
+    {
+      itemsPerChunk = 1;
+    }
+    size_t numChunks = (count + itemsPerChunk - 1) / itemsPerChunk;
+    m_Chunks.resize(numChunks < k_ChunksPerBatch ? numChunks : k_ChunksPerBatch);
+    for(size_t firstChunk = 0; firstChunk < numChunks; firstChunk += k_ChunksPerBatch)
+    {
+      size_t batchSize = numChunks - firstChunk < k_ChunksPerBatch ? numChunks - firstChunk : k_ChunksPerBatch;
+
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, batchSize);
+      dataAlg.setGrain(1);
+      dataAlg.execute(FormatChunksImpl<FormatterType>(formatter, m_Chunks.data(), firstChunk, itemsPerChunk, count));
+
+      for(size_t i = 0; i < batchSize; i++)
+      {
+        if(!writeBytes(m_Chunks[i].data(), m_Chunks[i].size()))
+        {
+          return false;
+        }
+      }
+
+      size_t itemsWritten = (firstChunk + batchSize) * itemsPerChunk;
+      if(progress && !progress(itemsWritten < count ? itemsWritten : count))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  template <typename FormatterType>
+  class FormatChunksImpl
+  {
+  public:
+    FormatChunksImpl(const FormatterType& formatter, FormatBuffer* chunks, size_t firstChunk, size_t itemsPerChunk, size_t count)
+    : m_Formatter(formatter)
+    , m_Chunks(chunks)
+    , m_FirstChunk(firstChunk)
+    , m_ItemsPerChunk(itemsPerChunk)
+    , m_Count(count)
+    {
+    }
+
+    void operator()(const SIMPLRange& range) const
+    {
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        size_t begin = (m_FirstChunk + i) * m_ItemsPerChunk;
+        size_t end = begin + m_ItemsPerChunk < m_Count ? begin + m_ItemsPerChunk : m_Count;
+        FormatBuffer& chunk = m_Chunks[i];
+        chunk.clear();
+        m_Formatter(chunk, begin, end);
+      }
+    }
+
+  private:
+    const FormatterType& m_Formatter;
+    FormatBuffer* m_Chunks = nullptr;
+    size_t m_FirstChunk = 0;
+    size_t m_ItemsPerChunk = 0;
+    size_t m_Count = 0;
+  };
+
+  bool writeBytes(const char* data, size_t numBytes);
+
+  FILE* m_File = nullptr;
+  bool m_Error = false;
+  FormatBuffer m_Buffer;
+  std::vector<FormatBuffer> m_Chunks;
+};
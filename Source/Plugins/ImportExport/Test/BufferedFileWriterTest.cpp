@@ -0,0 +1,289 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include <QtCore/QFile>
+
+#include "SIMPLib/SIMPLib.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "ImportExport/ImportExportFilters/util/BufferedFileWriter.h"
+#include "ImportExportTestFileLocations.h"
+
+/**
+ * @brief The BufferedFileWriterTest class checks that BufferedFileWriter::writeRange() produces the same bytes as
+ * formatting the items one after another, and that a canceled or failed write is reported to the caller.
+ */
+class BufferedFileWriterTest
+{
+  // Small chunks so that the range spans several batches of BufferedFileWriter::k_ChunksPerBatch chunks
+  const size_t k_ItemsPerChunk = 100;
+  const size_t k_NumItems = 3 * BufferedFileWriter::k_ChunksPerBatch * 100 + 17;
+
+public:
+  BufferedFileWriterTest() = default;
+  ~BufferedFileWriterTest() = default;
+  BufferedFileWriterTest(const BufferedFileWriterTest&) = delete;            // Copy Constructor Not Implemented
+  BufferedFileWriterTest(BufferedFileWriterTest&&) = delete;                 // Move Constructor Not Implemented
+  BufferedFileWriterTest& operator=(const BufferedFileWriterTest&) = delete; // Copy Assignment Not Implemented
+  BufferedFileWriterTest& operator=(BufferedFileWriterTest&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Returns the name of the class for BufferedFileWriterTest
+   */
+  QString getNameOfClass() const
+  {
+    return QString("BufferedFileWriterTest");
+  }
+
+  /**
+   * @brief Returns the name of the class for BufferedFileWriterTest
+   */
+  QString ClassName()
+  {
+    return QString("BufferedFileWriterTest");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString unicodeTestFile() const
+  {
+    // "BufferedFileWriterTest_" followed by characters that are not part of Latin-1
+    QString fileName = QString("BufferedFileWriterTest_") + QChar(0x65E5) + QChar(0x672C) + QChar(0x0416) + QString(".txt");
+    return UnitTest::TestTempDir + "/" + fileName;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::BufferedFileWriterTest::TestFile);
+    QFile::remove(unicodeTestFile());
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  static void FormatItems(FormatBuffer& out, size_t begin, size_t end)
+  {
+    for(size_t i = begin; i < end; i++)
+    {
+      out.appendInteger(i);
+      out.append(' ');
+      out.appendFixed(static_cast<double>(i) * -0.0125, 3);
+      out.append('\n');
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::string expectedItems(size_t count) const
+  {
+    std::string expected;
+    char line[64];
+    for(size_t i = 0; i < count; i++)
+    {
+      int length = snprintf(line, sizeof(line), "%llu %.3f\n", static_cast<unsigned long long>(i), static_cast<double>(i) * -0.0125);
+      expected.append(line, static_cast<size_t>(length));
+    }
+    return expected;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::string readFile(const QString& filePath) const
+  {
+    QFile file(filePath);
+    if(!file.open(QIODevice::ReadOnly))
+    {
+      return std::string();
+    }
+    return file.readAll().toStdString();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestWriteRange()
+  {
+    FILE* f = BufferedFileWriter::OpenFile(UnitTest::BufferedFileWriterTest::TestFile, "wb");
+    DREAM3D_REQUIRE_VALID_POINTER(f)
+    {
+      BufferedFileWriter writer(f);
+      writer.buffer().append("header\n");
+      size_t lastProgress = 0;
+      bool completed = writer.writeRange(k_NumItems, k_ItemsPerChunk, FormatItems, [&lastProgress](size_t itemsWritten) {
+        lastProgress = itemsWritten;
+        return true;
+      });
+      DREAM3D_REQUIRE_EQUAL(completed, true)
+      DREAM3D_REQUIRE_EQUAL(lastProgress, k_NumItems)
+      writer.buffer().append("footer\n");
+      DREAM3D_REQUIRE_EQUAL(writer.flush(), true)
+      DREAM3D_REQUIRE_EQUAL(writer.hasError(), false)
+    }
+    fclose(f);
+
+    std::string expected = "header\n" + expectedItems(k_NumItems) + "footer\n";
+    std::string written = readFile(UnitTest::BufferedFileWriterTest::TestFile);
+    DREAM3D_REQUIRE_EQUAL(written.size(), expected.size())
+    DREAM3D_REQUIRE(written == expected)
+
+    // An empty range writes nothing and still succeeds
+    f = BufferedFileWriter::OpenFile(UnitTest::BufferedFileWriterTest::TestFile, "wb");
+    DREAM3D_REQUIRE_VALID_POINTER(f)
+    {
+      BufferedFileWriter writer(f);
+      DREAM3D_REQUIRE_EQUAL(writer.writeRange(0, k_ItemsPerChunk, FormatItems), true)
+    }
+    fclose(f);
+    DREAM3D_REQUIRE_EQUAL(QFile(UnitTest::BufferedFileWriterTest::TestFile).size(), 0)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestCancel()
+  {
+    FILE* f = BufferedFileWriter::OpenFile(UnitTest::BufferedFileWriterTest::TestFile, "wb");
+    DREAM3D_REQUIRE_VALID_POINTER(f)
+    size_t numProgressCalls = 0;
+    {
+      BufferedFileWriter writer(f);
+      // Cancel after the first batch of chunks has been written
+      bool completed = writer.writeRange(k_NumItems, k_ItemsPerChunk, FormatItems, [&numProgressCalls](size_t) {
+        numProgressCalls++;
+        return false;
+      });
+      DREAM3D_REQUIRE_EQUAL(completed, false)
+      DREAM3D_REQUIRE_EQUAL(numProgressCalls, 1)
+      // A cancel is not a write error
+      DREAM3D_REQUIRE_EQUAL(writer.hasError(), false)
+    }
+    fclose(f);
+
+    // Only the first batch made it into the file
+    std::string expected = expectedItems(BufferedFileWriter::k_ChunksPerBatch * k_ItemsPerChunk);
+    std::string written = readFile(UnitTest::BufferedFileWriterTest::TestFile);
+    DREAM3D_REQUIRE(written == expected)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestWriteError()
+  {
+    // A file that could not be opened
+    {
+      BufferedFileWriter writer(nullptr);
+      bool completed = writer.writeRange(k_NumItems, k_ItemsPerChunk, FormatItems);
+      DREAM3D_REQUIRE_EQUAL(completed, false)
+      DREAM3D_REQUIRE_EQUAL(writer.hasError(), true)
+    }
+
+    // A file that was opened read only, so every fwrite() fails
+    {
+      QFile file(UnitTest::BufferedFileWriterTest::TestFile);
+      DREAM3D_REQUIRE_EQUAL(file.open(QIODevice::WriteOnly | QIODevice::Truncate), true)
+      file.close();
+    }
+    FILE* f = BufferedFileWriter::OpenFile(UnitTest::BufferedFileWriterTest::TestFile, "rb");
+    DREAM3D_REQUIRE_VALID_POINTER(f)
+    {
+      BufferedFileWriter writer(f);
+      bool completed = writer.writeRange(k_NumItems, k_ItemsPerChunk, FormatItems);
+      DREAM3D_REQUIRE_EQUAL(completed, false)
+      DREAM3D_REQUIRE_EQUAL(writer.hasError(), true)
+
+      // The error sticks to the writer
+      writer.buffer().append("more\n");
+      DREAM3D_REQUIRE_EQUAL(writer.flush(), false)
+    }
+    fclose(f);
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestUnicodePath()
+  {
+    const QString filePath = unicodeTestFile();
+    QFile::remove(filePath);
+
+    FILE* f = BufferedFileWriter::OpenFile(filePath, "wb");
+    DREAM3D_REQUIRE_VALID_POINTER(f)
+    {
+      BufferedFileWriter writer(f);
+      DREAM3D_REQUIRE_EQUAL(writer.writeRange(10, 3, FormatItems), true)
+    }
+    fclose(f);
+
+    // The file has to exist under its real name, not under a name with the characters replaced by '?'
+    DREAM3D_REQUIRE_EQUAL(QFile::exists(filePath), true)
+    std::string written = readFile(filePath);
+    DREAM3D_REQUIRE(written == expectedItems(10))
+
+    return EXIT_SUCCESS;
+  }
+
+  /**
+   * @brief
+   */
+  void operator()()
+  {
+    std::cout << "#-- BufferedFileWriterTest Starting " << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestWriteRange())
+    DREAM3D_REGISTER_TEST(TestCancel())
+    DREAM3D_REGISTER_TEST(TestWriteError())
+    DREAM3D_REGISTER_TEST(TestUnicodePath())
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+};
@@ -1,4 +1,7 @@
 
+#include <fstream>
+
+#include <QtCore/QFile>
 #include <QtCore/QString>
 
 #include "SIMPLib/Common/Observer.h"
@@ -39,6 +42,124 @@ public:
     return QString("PhIOTest");
   }
 
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::SPParksDumpReaderTest::TestFile);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  // Writes one 2x2x1 timestep. The sites are listed in the given order and the site values are offset by base
+  // -----------------------------------------------------------------------------
+  void writeTimestep(std::ofstream& out, int32_t timestep, int32_t base, const std::vector<std::string>& positions)
+  {
+    out << "ITEM: TIMESTEP\n" << timestep << "\n";
+    out << "ITEM: NUMBER OF ATOMS\n" << positions.size() << "\n";
+    out << "ITEM: BOX BOUNDS\n0 2\n0 2\n0 1\n";
+    out << "ITEM: ATOMS id type x y z\n";
+    for(size_t i = 0; i < positions.size(); i++)
+    {
+      out << (i + 1) << " " << (base + static_cast<int32_t>(i)) << " " << positions[i] << "\n";
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  SPParksDumpReader::Pointer createReader(int32_t timestepIndex)
+  {
+    SPParksDumpReader::Pointer reader = SPParksDumpReader::New();
+    reader->setVolumeDataContainerName({k_VolumeDataContainerName, "", ""});
+    reader->setCellAttributeMatrixName(k_CellAttributeMatrixName);
+    reader->setInputFile(UnitTest::SPParksDumpReaderTest::TestFile);
+    reader->setOrigin({0.0F, 0.0F, 0.0F});
+    reader->setSpacing({1.0F, 1.0F, 1.0F});
+    reader->setOneBasedArrays(false);
+    reader->setFeatureIdsArrayName(k_FeatureIdsName);
+    reader->setTimestepIndex(timestepIndex);
+    reader->setDataContainerArray(DataContainerArray::New());
+    return reader;
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestMultipleTimesteps()
+  {
+    {
+      std::ofstream out(UnitTest::SPParksDumpReaderTest::TestFile.toStdString());
+      DREAM3D_REQUIRE(out.is_open());
+      writeTimestep(out, 0, 10, {"0 0 0", "1 0 0", "0 1 0", "1 1 0"});
+      // The second timestep lists its sites in a different order
+      writeTimestep(out, 100, 20, {"1 1 0", "0 1 0", "1 0 0", "0 0 0"});
+    }
+
+    const std::vector<std::vector<int32_t>> expected = {{10, 11, 12, 13}, {23, 22, 21, 20}};
+    for(int32_t t = 0; t < 2; t++)
+    {
+      SPParksDumpReader::Pointer reader = createReader(t);
+      reader->execute();
+      DREAM3D_REQUIRE_EQUAL(reader->getErrorCode(), 0);
+
+      AttributeMatrix::Pointer am = reader->getDataContainerArray()->getDataContainer({k_VolumeDataContainerName, "", ""})->getAttributeMatrix(k_CellAttributeMatrixName);
+      DREAM3D_REQUIRE_VALID_POINTER(am.get());
+      Int32ArrayType::Pointer idsPtr = am->getAttributeArrayAs<Int32ArrayType>(k_FeatureIdsName);
+      DREAM3D_REQUIRE_VALID_POINTER(idsPtr.get());
+      DREAM3D_REQUIRE_EQUAL(idsPtr->getNumberOfTuples(), 4);
+      for(size_t i = 0; i < 4; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(idsPtr->getValue(i), expected[t][i]);
+      }
+    }
+
+    // There is no third timestep
+    SPParksDumpReader::Pointer reader = createReader(2);
+    reader->execute();
+    DREAM3D_REQUIRE_EQUAL(reader->getErrorCode(), -26011);
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestMalformedSites()
+  {
+    // A negative fractional coordinate must not be truncated onto the first lattice position
+    {
+      std::ofstream out(UnitTest::SPParksDumpReaderTest::TestFile.toStdString());
+      DREAM3D_REQUIRE(out.is_open());
+      writeTimestep(out, 0, 10, {"-0.5 0 0", "1 0 0", "0 1 0", "1 1 0"});
+    }
+    SPParksDumpReader::Pointer reader = createReader(0);
+    reader->execute();
+    DREAM3D_REQUIRE_EQUAL(reader->getErrorCode(), -48103);
+
+    // A coordinate past the end of the volume
+    {
+      std::ofstream out(UnitTest::SPParksDumpReaderTest::TestFile.toStdString());
+      DREAM3D_REQUIRE(out.is_open());
+      writeTimestep(out, 0, 10, {"0 0 0", "2 0 0", "0 1 0", "1 1 0"});
+    }
+    reader = createReader(0);
+    reader->execute();
+    DREAM3D_REQUIRE_EQUAL(reader->getErrorCode(), -48100);
+
+    // A coordinate that is not a number
+    {
+      std::ofstream out(UnitTest::SPParksDumpReaderTest::TestFile.toStdString());
+      DREAM3D_REQUIRE(out.is_open());
+      writeTimestep(out, 0, 10, {"0 0 0", "1 0 0", "0 y 0", "1 1 0"});
+    }
+    reader = createReader(0);
+    reader->execute();
+    DREAM3D_REQUIRE_EQUAL(reader->getErrorCode(), -48101);
+
+    // The same position listed twice leaves another position unset
+    {
+      std::ofstream out(UnitTest::SPParksDumpReaderTest::TestFile.toStdString());
+      DREAM3D_REQUIRE(out.is_open());
+      writeTimestep(out, 0, 10, {"0 0 0", "1 0 0", "1 0 0", "1 1 0"});
+    }
+    reader = createReader(0);
+    reader->execute();
+    DREAM3D_REQUIRE_EQUAL(reader->getErrorCode(), -48102);
+  }
+
   // -----------------------------------------------------------------------------
   void RunTest()
   {
@@ -108,6 +229,11 @@ public:
     DREAM3D_REGISTER_TEST(RunTest());
     m_InputFile = UnitTest::ImportExportTestFilesDir + "/SPParks_Pizza.dump";
     DREAM3D_REGISTER_TEST(RunTest());
+
+    DREAM3D_REGISTER_TEST(TestMultipleTimesteps());
+    DREAM3D_REGISTER_TEST(TestMalformedSites());
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles());
   }
 
 public:
@@ -0,0 +1,477 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "ImportExportTestFileLocations.h"
+
+/**
+ * @brief The StlIOTest class checks the vertex welding of ReadStlFile on generated binary STL files and the
+ * per Feature files that WriteStlFile creates from a small labeled triangle mesh.
+ */
+class StlIOTest
+{
+  // One binary STL triangle record: the normal, 3 vertices and the attribute byte count
+  const size_t k_RecordSize = 50;
+  const size_t k_HeaderSize = 80;
+
+public:
+  StlIOTest() = default;
+  ~StlIOTest() = default;
+  StlIOTest(const StlIOTest&) = delete;            // Copy Constructor Not Implemented
+  StlIOTest(StlIOTest&&) = delete;                 // Move Constructor Not Implemented
+  StlIOTest& operator=(const StlIOTest&) = delete; // Copy Assignment Not Implemented
+  StlIOTest& operator=(StlIOTest&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Returns the name of the class for StlIOTest
+   */
+  QString getNameOfClass() const
+  {
+    return QString("StlIOTest");
+  }
+
+  /**
+   * @brief Returns the name of the class for StlIOTest
+   */
+  QString ClassName()
+  {
+    return QString("StlIOTest");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::StlIOTest::InputFile);
+    QDir(UnitTest::StlIOTest::OutputDir).removeRecursively();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFilterAvailability()
+  {
+    QStringList filterNames = {"ReadStlFile", "WriteStlFile"};
+    FilterManager* fm = FilterManager::Instance();
+    for(const QString& filtName : filterNames)
+    {
+      IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+      if(nullptr == filterFactory.get())
+      {
+        std::stringstream ss;
+        ss << "The StlIOTest Requires the use of the " << filtName.toStdString() << " filter which is found in the ImportExport Plugin";
+        DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+      }
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AbstractFilter::Pointer createFilter(const QString& filtName)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    if(nullptr == filterFactory.get())
+    {
+      return AbstractFilter::NullPointer();
+    }
+    return filterFactory->create();
+  }
+
+  /**
+   * @brief Writes a binary STL file of a flat n x n grid of squares, each split into two triangles. The
+   * corner coordinates are returned in file order. With jitter every corner is moved by a different tiny
+   * amount so that no two corners are identical, but all corners of a grid point stay inside the same
+   * 0.1 sized weld cube. Without jitter the z coordinate alternates between 0.0 and -0.0, which must
+   * still weld.
+   */
+  std::vector<float> writeGridStl(const QString& filePath, size_t n, bool jitter)
+  {
+    std::vector<float> corners;
+    corners.reserve(n * n * 18);
+    const float offset = jitter ? 0.05f : 0.0f;
+    for(size_t j = 0; j < n; j++)
+    {
+      for(size_t i = 0; i < n; i++)
+      {
+        const size_t quad[6][2] = {{i, j}, {i + 1, j}, {i + 1, j + 1}, {i, j}, {i + 1, j + 1}, {i, j + 1}};
+        for(const size_t* gridPoint : quad)
+        {
+          size_t c = corners.size() / 3;
+          float delta = jitter ? static_cast<float>(c + 1) * 4.0E-6f : 0.0f;
+          corners.push_back(static_cast<float>(gridPoint[0]) + offset + delta);
+          corners.push_back(static_cast<float>(gridPoint[1]) + offset + delta);
+          corners.push_back(c % 2 == 0 ? 0.0f : -0.0f);
+        }
+      }
+    }
+
+    const int32_t triCount = static_cast<int32_t>(corners.size() / 9);
+    QByteArray contents(static_cast<int>(k_HeaderSize), '\0');
+    contents.append(reinterpret_cast<const char*>(&triCount), sizeof(triCount));
+    const float normal[3] = {0.0f, 0.0f, 1.0f};
+    const char attrByteCount[2] = {0, 0};
+    for(int32_t t = 0; t < triCount; t++)
+    {
+      contents.append(reinterpret_cast<const char*>(normal), sizeof(normal));
+      contents.append(reinterpret_cast<const char*>(corners.data() + 9 * t), 9 * sizeof(float));
+      contents.append(attrByteCount, 2);
+    }
+
+    QFile file(filePath);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate) || file.write(contents) != contents.size())
+    {
+      return std::vector<float>();
+    }
+    return corners;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int32_t readStl(const DataContainerArray::Pointer& dca, const QString& filePath, float weldTolerance)
+  {
+    AbstractFilter::Pointer reader = createFilter("ReadStlFile");
+    if(nullptr == reader.get())
+    {
+      return -1;
+    }
+    reader->setDataContainerArray(dca);
+    reader->setProperty("StlFilePath", filePath);
+    reader->setProperty("WeldTolerance", weldTolerance);
+    reader->execute();
+    return reader->getErrorCode();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestReadExactWeld()
+  {
+    // 80000 triangles, so the corners are spread over more than one chunk and every shard
+    const size_t n = 200;
+    std::vector<float> corners = writeGridStl(UnitTest::StlIOTest::InputFile, n, false);
+    DREAM3D_REQUIRE_EQUAL(corners.size(), n * n * 18)
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    int32_t err = readStl(dca, UnitTest::StlIOTest::InputFile, 0.0f);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+
+    DataContainer::Pointer dc = dca->getDataContainer(SIMPL::Defaults::TriangleDataContainerName);
+    DREAM3D_REQUIRE_VALID_POINTER(dc.get())
+    TriangleGeom::Pointer triangleGeom = dc->getGeometryAs<TriangleGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(triangleGeom.get())
+    DREAM3D_REQUIRE_EQUAL(triangleGeom->getNumberOfTris(), 2 * n * n)
+    DREAM3D_REQUIRE_EQUAL(triangleGeom->getNumberOfVertices(), (n + 1) * (n + 1))
+
+    // Every corner points at a vertex with its own coordinates, and the vertices are numbered in the
+    // order in which they first appear in the file
+    const float* vertices = triangleGeom->getVertexPointer(0);
+    const MeshIndexType* tris = triangleGeom->getTriPointer(0);
+    MeshIndexType nextNewVertex = 0;
+    for(size_t c = 0; c < corners.size() / 3; c++)
+    {
+      MeshIndexType v = tris[c];
+      DREAM3D_REQUIRED(v, <=, nextNewVertex)
+      if(v == nextNewVertex)
+      {
+        nextNewVertex++;
+      }
+      DREAM3D_REQUIRE_EQUAL(vertices[3 * v + 0], corners[3 * c + 0])
+      DREAM3D_REQUIRE_EQUAL(vertices[3 * v + 1], corners[3 * c + 1])
+      DREAM3D_REQUIRE_EQUAL(vertices[3 * v + 2], corners[3 * c + 2])
+    }
+
+    DoubleArrayType::Pointer normals = dc->getAttributeMatrix(SIMPL::Defaults::FaceAttributeMatrixName)->getAttributeArrayAs<DoubleArrayType>(SIMPL::FaceData::SurfaceMeshFaceNormals);
+    DREAM3D_REQUIRE_VALID_POINTER(normals.get())
+    DREAM3D_REQUIRE_EQUAL(normals->getNumberOfTuples(), 2 * n * n)
+    DREAM3D_REQUIRE_EQUAL(normals->getComponent(2 * n * n - 1, 2), 1.0)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestReadWeldTolerance()
+  {
+    const size_t n = 20;
+    const size_t numCorners = n * n * 6;
+    std::vector<float> corners = writeGridStl(UnitTest::StlIOTest::InputFile, n, true);
+    DREAM3D_REQUIRE_EQUAL(corners.size(), numCorners * 3)
+
+    // Without a tolerance no two corners are identical, so nothing is welded
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      int32_t err = readStl(dca, UnitTest::StlIOTest::InputFile, 0.0f);
+      DREAM3D_REQUIRE_EQUAL(err, 0)
+      TriangleGeom::Pointer triangleGeom = dca->getDataContainer(SIMPL::Defaults::TriangleDataContainerName)->getGeometryAs<TriangleGeom>();
+      DREAM3D_REQUIRE_EQUAL(triangleGeom->getNumberOfVertices(), numCorners)
+    }
+
+    // With a 0.1 tolerance all corners of a grid point fall into one weld cube and are welded onto the
+    // first of them in the file
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      int32_t err = readStl(dca, UnitTest::StlIOTest::InputFile, 0.1f);
+      DREAM3D_REQUIRE_EQUAL(err, 0)
+      TriangleGeom::Pointer triangleGeom = dca->getDataContainer(SIMPL::Defaults::TriangleDataContainerName)->getGeometryAs<TriangleGeom>();
+      DREAM3D_REQUIRE_EQUAL(triangleGeom->getNumberOfTris(), 2 * n * n)
+      DREAM3D_REQUIRE_EQUAL(triangleGeom->getNumberOfVertices(), (n + 1) * (n + 1))
+
+      const float* vertices = triangleGeom->getVertexPointer(0);
+      const MeshIndexType* tris = triangleGeom->getTriPointer(0);
+      std::vector<MeshIndexType> firstCorner((n + 1) * (n + 1), std::numeric_limits<MeshIndexType>::max());
+      for(size_t c = 0; c < numCorners; c++)
+      {
+        size_t gx = static_cast<size_t>(std::floor(corners[3 * c + 0]));
+        size_t gy = static_cast<size_t>(std::floor(corners[3 * c + 1]));
+        size_t gridPoint = gy * (n + 1) + gx;
+        if(firstCorner[gridPoint] == std::numeric_limits<MeshIndexType>::max())
+        {
+          firstCorner[gridPoint] = c;
+        }
+        size_t first = firstCorner[gridPoint];
+        MeshIndexType v = tris[c];
+        DREAM3D_REQUIRE_EQUAL(v, tris[first])
+        DREAM3D_REQUIRE_EQUAL(vertices[3 * v + 0], corners[3 * first + 0])
+        DREAM3D_REQUIRE_EQUAL(vertices[3 * v + 1], corners[3 * first + 1])
+      }
+    }
+
+    // A negative tolerance is rejected
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      int32_t err = readStl(dca, UnitTest::StlIOTest::InputFile, -1.0f);
+      DREAM3D_REQUIRE_EQUAL(err, -1108)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  /**
+   * @brief Creates a 6 vertex, 5 triangle mesh with the Face Labels and Face Phases below.
+   *   t0 (0,1,2) labels  1,  2   t1 (1,3,2) labels  2,  1   t2 (0,4,1) labels 1, -1
+   *   t3 (1,4,5) labels  3,  3   t4 (2,3,5) labels  2,  3
+   */
+  DataContainerArray::Pointer createLabeledMesh()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer tdc = DataContainer::New(SIMPL::Defaults::TriangleDataContainerName);
+    dca->addOrReplaceDataContainer(tdc);
+
+    const float vertexCoords[6][3] = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 1.0f}};
+    const MeshIndexType triVerts[5][3] = {{0, 1, 2}, {1, 3, 2}, {0, 4, 1}, {1, 4, 5}, {2, 3, 5}};
+    const int32_t labels[5][2] = {{1, 2}, {2, 1}, {1, -1}, {3, 3}, {2, 3}};
+
+    SharedVertexList::Pointer vertexList = TriangleGeom::CreateSharedVertexList(6);
+    TriangleGeom::Pointer triangleGeom = TriangleGeom::CreateGeometry(5, vertexList, SIMPL::Geometry::TriangleGeometry);
+    tdc->setGeometry(triangleGeom);
+    ::memcpy(triangleGeom->getVertexPointer(0), vertexCoords, sizeof(vertexCoords));
+    MeshIndexType* tris = triangleGeom->getTriPointer(0);
+    for(size_t i = 0; i < 15; i++)
+    {
+      tris[i] = triVerts[i / 3][i % 3];
+    }
+
+    std::vector<size_t> tDims(1, 5);
+    AttributeMatrix::Pointer faceAttrMat = AttributeMatrix::New(tDims, SIMPL::Defaults::FaceAttributeMatrixName, AttributeMatrix::Type::Face);
+    tdc->addOrReplaceAttributeMatrix(faceAttrMat);
+    std::vector<size_t> cDims(1, 2);
+    Int32ArrayType::Pointer faceLabels = Int32ArrayType::CreateArray(5, cDims, SIMPL::FaceData::SurfaceMeshFaceLabels, true);
+    Int32ArrayType::Pointer facePhases = Int32ArrayType::CreateArray(5, cDims, SIMPL::FaceData::SurfaceMeshFacePhases, true);
+    for(size_t i = 0; i < 10; i++)
+    {
+      int32_t label = labels[i / 2][i % 2];
+      faceLabels->setValue(i, label);
+      // Feature -1 is the outside of the mesh, Features 1 and 2 are phase 1 and Feature 3 is phase 2
+      facePhases->setValue(i, label < 0 ? 0 : (label == 3 ? 2 : 1));
+    }
+    faceAttrMat->insertOrAssign(faceLabels);
+    faceAttrMat->insertOrAssign(facePhases);
+    return dca;
+  }
+
+  /**
+   * @brief Checks that an STL file written by WriteStlFile holds the given triangles in the given order.
+   * A negative entry -(t + 1) means triangle t is written with its winding reversed.
+   */
+  int checkStlFile(const QString& filePath, const QString& expectedHeader, const std::vector<int32_t>& expectedTriangles, const DataContainerArray::Pointer& dca)
+  {
+    QFile file(filePath);
+    DREAM3D_REQUIRE_EQUAL(file.open(QIODevice::ReadOnly), true)
+    QByteArray contents = file.readAll();
+    DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(contents.size()), k_HeaderSize + 4 + expectedTriangles.size() * k_RecordSize)
+
+    QString header = QString::fromLatin1(contents.constData());
+    DREAM3D_REQUIRE_EQUAL(header, expectedHeader)
+    int32_t triCount = 0;
+    ::memcpy(&triCount, contents.constData() + k_HeaderSize, sizeof(triCount));
+    DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(triCount), expectedTriangles.size())
+
+    TriangleGeom::Pointer triangleGeom = dca->getDataContainer(SIMPL::Defaults::TriangleDataContainerName)->getGeometryAs<TriangleGeom>();
+    const float* vertices = triangleGeom->getVertexPointer(0);
+    const MeshIndexType* tris = triangleGeom->getTriPointer(0);
+    for(size_t i = 0; i < expectedTriangles.size(); i++)
+    {
+      size_t t = static_cast<size_t>(expectedTriangles[i] < 0 ? -expectedTriangles[i] - 1 : expectedTriangles[i]);
+      MeshIndexType ids[3] = {tris[3 * t], tris[3 * t + 1], tris[3 * t + 2]};
+      if(expectedTriangles[i] < 0)
+      {
+        std::swap(ids[1], ids[2]);
+      }
+
+      float record[12] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+      const char* recordData = contents.constData() + k_HeaderSize + 4 + i * k_RecordSize;
+      ::memcpy(record, recordData, sizeof(record));
+      for(size_t v = 0; v < 3; v++)
+      {
+        for(size_t j = 0; j < 3; j++)
+        {
+          DREAM3D_REQUIRE_EQUAL(record[3 + 3 * v + j], vertices[3 * ids[v] + j])
+        }
+      }
+
+      // The normal follows the written winding
+      const float* p0 = vertices + 3 * ids[0];
+      const float* p1 = vertices + 3 * ids[1];
+      const float* p2 = vertices + 3 * ids[2];
+      float u[3] = {p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]};
+      float w[3] = {p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2]};
+      float normal[3] = {u[1] * w[2] - u[2] * w[1], u[2] * w[0] - u[0] * w[2], u[0] * w[1] - u[1] * w[0]};
+      float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+      for(size_t j = 0; j < 3; j++)
+      {
+        DREAM3D_REQUIRED(std::fabs(record[j] - normal[j] / length), <, 1.0E-6f)
+      }
+      DREAM3D_REQUIRE_EQUAL(recordData[48], 0)
+      DREAM3D_REQUIRE_EQUAL(recordData[49], 0)
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int32_t writeStl(const DataContainerArray::Pointer& dca, const QString& prefix, bool groupByPhase)
+  {
+    AbstractFilter::Pointer writer = createFilter("WriteStlFile");
+    if(nullptr == writer.get())
+    {
+      return -1;
+    }
+    writer->setDataContainerArray(dca);
+    writer->setProperty("OutputStlDirectory", UnitTest::StlIOTest::OutputDir);
+    writer->setProperty("OutputStlPrefix", prefix);
+    writer->setProperty("GroupByPhase", groupByPhase);
+    writer->execute();
+    return writer->getErrorCode();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestWriteByFeature()
+  {
+    DataContainerArray::Pointer dca = createLabeledMesh();
+    int32_t err = writeStl(dca, "Mesh_", false);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+
+    // Each Feature's file lists its triangles in mesh order. A triangle is reversed in the file of the
+    // Feature on its second side, and a triangle with the same Feature on both sides is written once.
+    const QString dir = UnitTest::StlIOTest::OutputDir + "/";
+    DREAM3D_REQUIRE_EQUAL(checkStlFile(dir + "Mesh_Feature_-1.stl", "DREAM3D Generated For Feature ID -1", {-3}, dca), EXIT_SUCCESS)
+    DREAM3D_REQUIRE_EQUAL(checkStlFile(dir + "Mesh_Feature_1.stl", "DREAM3D Generated For Feature ID 1", {0, -2, 2}, dca), EXIT_SUCCESS)
+    DREAM3D_REQUIRE_EQUAL(checkStlFile(dir + "Mesh_Feature_2.stl", "DREAM3D Generated For Feature ID 2", {-1, 1, 4}, dca), EXIT_SUCCESS)
+    DREAM3D_REQUIRE_EQUAL(checkStlFile(dir + "Mesh_Feature_3.stl", "DREAM3D Generated For Feature ID 3", {3, -5}, dca), EXIT_SUCCESS)
+    DREAM3D_REQUIRE_EQUAL(QDir(UnitTest::StlIOTest::OutputDir).entryList(QStringList() << "Mesh_*.stl", QDir::Files).size(), 4)
+
+    // Grouping by phase only changes the names and headers of the files
+    err = writeStl(dca, "Phase_", true);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE_EQUAL(checkStlFile(dir + "Phase_Ensemble_0_Feature_-1.stl", "DREAM3D Generated For Feature ID -1 Phase 0", {-3}, dca), EXIT_SUCCESS)
+    DREAM3D_REQUIRE_EQUAL(checkStlFile(dir + "Phase_Ensemble_1_Feature_1.stl", "DREAM3D Generated For Feature ID 1 Phase 1", {0, -2, 2}, dca), EXIT_SUCCESS)
+    DREAM3D_REQUIRE_EQUAL(checkStlFile(dir + "Phase_Ensemble_1_Feature_2.stl", "DREAM3D Generated For Feature ID 2 Phase 1", {-1, 1, 4}, dca), EXIT_SUCCESS)
+    DREAM3D_REQUIRE_EQUAL(checkStlFile(dir + "Phase_Ensemble_2_Feature_3.stl", "DREAM3D Generated For Feature ID 3 Phase 2", {3, -5}, dca), EXIT_SUCCESS)
+
+    // Reading a written file back welds the shared corners of its triangles again
+    DataContainerArray::Pointer readDca = DataContainerArray::New();
+    err = readStl(readDca, dir + "Mesh_Feature_1.stl", 0.0f);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    TriangleGeom::Pointer triangleGeom = readDca->getDataContainer(SIMPL::Defaults::TriangleDataContainerName)->getGeometryAs<TriangleGeom>();
+    DREAM3D_REQUIRE_EQUAL(triangleGeom->getNumberOfTris(), 3)
+    DREAM3D_REQUIRE_EQUAL(triangleGeom->getNumberOfVertices(), 5)
+
+    return EXIT_SUCCESS;
+  }
+
+  /**
+   * @brief
+   */
+  void operator()()
+  {
+    std::cout << "#-- StlIOTest Starting " << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestFilterAvailability())
+
+    DREAM3D_REGISTER_TEST(TestReadExactWeld())
+    DREAM3D_REGISTER_TEST(TestReadWeldTolerance())
+    DREAM3D_REGISTER_TEST(TestWriteByFeature())
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+};
@@ -0,0 +1,147 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/Common/SIMPLRange.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+#include "EbsdLib/Core/EbsdLibConstants.h"
+
+namespace EbsdArrayTransfer
+{
+
+/**
+ * @brief AdoptReaderArray wraps the reader's buffer for the named column in a new DataArray and hands the ownership
+ * of that buffer to the DataArray, so the column is never copied. The reader will not free the buffer afterwards.
+ * @param reader The EbsdLib reader that parsed the data
+ * @param columnName The name of the column inside the reader
+ * @param numTuples Number of tuples held by the buffer
+ * @param cDims Component dimensions of the new array
+ * @param arrayName Name of the new DataArray
+ * @return The new DataArray or a null pointer when the reader does not hold the column
+ */
+template <typename T, class Reader>
+typename DataArray<T>::Pointer AdoptReaderArray(Reader* reader, const std::string& columnName, size_t numTuples, const std::vector<size_t>& cDims, const QString& arrayName)
+{
+  T* ptr = reinterpret_cast<T*>(reader->getPointerByName(columnName));
+  if(nullptr == ptr)
+  {
+    return DataArray<T>::NullPointer();
+  }
+  typename DataArray<T>::Pointer array = DataArray<T>::WrapPointer(ptr, numTuples, cDims, arrayName, true);
+  reader->releaseOwnership(columnName);
+  return array;
+}
+
+/**
+ * @brief The InterleaveEulersImpl class condenses the three separate Euler angle columns of a reader into a single
+ * 3 component array. In the same pass it optionally clamps the phase values to a minimum of 1, adds the 30 degree
+ * correction to phi2 of hexagonal phases and scales the angles (e.g., degrees to radians).
+ */
+class InterleaveEulersImpl
+{
+public:
+  /**
+   * @param phi1 First Euler angle column
+   * @param phi Second Euler angle column
+   * @param phi2 Third Euler angle column
+   * @param eulers Output array with 3 components per tuple
+   * @param phases Phase column that is clamped in place to a minimum of 1. May be nullptr
+   * @param crystalStructures When not nullptr, phi2 of every Hexagonal_High phase is offset by 30 degrees before scaling
+   * @param scale Factor applied to all three angles
+   */
+  InterleaveEulersImpl(const float* phi1, const float* phi, const float* phi2, float* eulers, int32_t* phases, const uint32_t* crystalStructures, double scale)
+  : m_Phi1(phi1)
+  , m_Phi(phi)
+  , m_Phi2(phi2)
+  , m_Eulers(eulers)
+  , m_Phases(phases)
+  , m_CrystalStructures(crystalStructures)
+  , m_Scale(scale)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      if(nullptr != m_Phases && m_Phases[i] < 1)
+      {
+        m_Phases[i] = 1;
+      }
+      float e0 = m_Phi1[i];
+      float e1 = m_Phi[i];
+      float e2 = m_Phi2[i];
+      if(nullptr != m_CrystalStructures && nullptr != m_Phases && m_CrystalStructures[m_Phases[i]] == EbsdLib::CrystalStructure::Hexagonal_High)
+      {
+        e2 = e2 + 30.0f; // See the ReadCtfData documentation for this correction factor
+      }
+      if(m_Scale != 1.0)
+      {
+        e0 = static_cast<float>(e0 * m_Scale);
+        e1 = static_cast<float>(e1 * m_Scale);
+        e2 = static_cast<float>(e2 * m_Scale);
+      }
+      m_Eulers[3 * i] = e0;
+      m_Eulers[3 * i + 1] = e1;
+      m_Eulers[3 * i + 2] = e2;
+    }
+  }
+
+private:
+  const float* m_Phi1 = nullptr;
+  const float* m_Phi = nullptr;
+  const float* m_Phi2 = nullptr;
+  float* m_Eulers = nullptr;
+  int32_t* m_Phases = nullptr;
+  const uint32_t* m_CrystalStructures = nullptr;
+  double m_Scale = 1.0;
+};
+
+/**
+ * @brief InterleaveEulers runs InterleaveEulersImpl over numTuples tuples in parallel
+ */
+inline void InterleaveEulers(const float* phi1, const float* phi, const float* phi2, float* eulers, int32_t* phases, const uint32_t* crystalStructures, double scale, size_t numTuples)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTuples);
+  dataAlg.execute(InterleaveEulersImpl(phi1, phi, phi2, eulers, phases, crystalStructures, scale));
+}
+
+} // namespace EbsdArrayTransfer
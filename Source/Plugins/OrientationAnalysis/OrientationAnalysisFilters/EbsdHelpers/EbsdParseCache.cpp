@@ -0,0 +1,435 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "EbsdParseCache.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+
+namespace
+{
+constexpr char k_Magic[8] = {'D', '3', 'D', 'E', 'B', 'S', 'D', 'C'};
+constexpr uint32_t k_Version = 1;
+constexpr uint64_t k_BlockAlignment = 64;
+constexpr size_t k_NameLength = 112;
+constexpr size_t k_TypeNameLength = 16;
+constexpr qint64 k_HashChunkSize = 4 * 1024 * 1024;
+
+const std::array<QString, 11> k_CachedTypes = {"int8_t", "uint8_t", "int16_t", "uint16_t", "int32_t", "uint32_t", "int64_t", "uint64_t", "float", "double", "bool"};
+
+constexpr uint64_t k_FnvOffsetBasis = 14695981039346656037ULL;
+constexpr uint64_t k_FnvPrime = 1099511628211ULL;
+
+struct CacheFileHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t arrayCount;
+  uint64_t fileSize;
+  int64_t modifiedTime;
+  uint64_t contentHash;
+  uint64_t keyHash;
+  uint64_t numTuples;
+};
+
+struct CacheArrayEntry
+{
+  char name[k_NameLength];
+  char typeName[k_TypeNameLength];
+  uint64_t numComponents;
+  uint64_t offset;
+  uint64_t byteCount;
+};
+
+/**
+ * @brief FNV-1a style hash that consumes 8 bytes per step. The buffers handed in by the file hash are
+ * always a multiple of 8 bytes long except for the last one so the hash does not depend on how the
+ * file was split into chunks.
+ */
+uint64_t HashBytes(uint64_t hash, const char* data, size_t count)
+{
+  const size_t numWords = count / sizeof(uint64_t);
+  for(size_t i = 0; i < numWords; i++)
+  {
+    uint64_t word = 0;
+    std::memcpy(&word, data + i * sizeof(uint64_t), sizeof(uint64_t));
+    hash ^= word;
+    hash *= k_FnvPrime;
+  }
+  for(size_t i = numWords * sizeof(uint64_t); i < count; i++)
+  {
+    hash ^= static_cast<uint8_t>(data[i]);
+    hash *= k_FnvPrime;
+  }
+  return hash;
+}
+
+/**
+ * @brief Hash of the absolute input path and the variant, used to name the cache file
+ */
+uint64_t KeyHash(const QString& inputFile, const QString& variant)
+{
+  QByteArray key = (inputFile + "\n" + variant).toUtf8();
+  return HashBytes(k_FnvOffsetBasis, key.constData(), static_cast<size_t>(key.size()));
+}
+
+uint64_t AlignOffset(uint64_t offset)
+{
+  return (offset + k_BlockAlignment - 1) / k_BlockAlignment * k_BlockAlignment;
+}
+
+template <typename T>
+IDataArray::Pointer CreateCachedArray(size_t numTuples, size_t numComponents, const QString& name)
+{
+  std::vector<size_t> cDims(1, numComponents);
+  return DataArray<T>::CreateArray(numTuples, cDims, name, true);
+}
+
+/**
+ * @brief Creates an array of the type named by IDataArray::getTypeAsString(). Returns a null pointer for
+ * any type the cache does not store.
+ */
+IDataArray::Pointer CreateArrayOfType(const QString& typeName, size_t numTuples, size_t numComponents, const QString& name)
+{
+  if(typeName == "int8_t")
+  {
+    return CreateCachedArray<int8_t>(numTuples, numComponents, name);
+  }
+  if(typeName == "uint8_t")
+  {
+    return CreateCachedArray<uint8_t>(numTuples, numComponents, name);
+  }
+  if(typeName == "int16_t")
+  {
+    return CreateCachedArray<int16_t>(numTuples, numComponents, name);
+  }
+  if(typeName == "uint16_t")
+  {
+    return CreateCachedArray<uint16_t>(numTuples, numComponents, name);
+  }
+  if(typeName == "int32_t")
+  {
+    return CreateCachedArray<int32_t>(numTuples, numComponents, name);
+  }
+  if(typeName == "uint32_t")
+  {
+    return CreateCachedArray<uint32_t>(numTuples, numComponents, name);
+  }
+  if(typeName == "int64_t")
+  {
+    return CreateCachedArray<int64_t>(numTuples, numComponents, name);
+  }
+  if(typeName == "uint64_t")
+  {
+    return CreateCachedArray<uint64_t>(numTuples, numComponents, name);
+  }
+  if(typeName == "float")
+  {
+    return CreateCachedArray<float>(numTuples, numComponents, name);
+  }
+  if(typeName == "double")
+  {
+    return CreateCachedArray<double>(numTuples, numComponents, name);
+  }
+  if(typeName == "bool")
+  {
+    return CreateCachedArray<bool>(numTuples, numComponents, name);
+  }
+  return IDataArray::NullPointer();
+}
+
+bool WritePadding(QSaveFile& file, uint64_t alignedOffset)
+{
+  static const char zeros[k_BlockAlignment] = {0};
+  qint64 padding = static_cast<qint64>(alignedOffset) - file.pos();
+  return padding >= 0 && file.write(zeros, padding) == padding;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+EbsdParseCache::EbsdParseCache(const QString& cacheDirectory, const QString& inputFile, const QString& variant)
+: m_CacheDirectory(cacheDirectory)
+, m_InputFile(QFileInfo(inputFile).absoluteFilePath())
+, m_Variant(variant)
+{
+}
+
+// -----------------------------------------------------------------------------
+EbsdParseCache::~EbsdParseCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool EbsdParseCache::HashFileContents(const QString& filePath, uint64_t& hash)
+{
+  QFile file(filePath);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+
+  hash = k_FnvOffsetBasis;
+  std::vector<char> buffer(static_cast<size_t>(k_HashChunkSize));
+  while(true)
+  {
+    // Fill the whole chunk so that only the last chunk can end on a partial word
+    qint64 filled = 0;
+    while(filled < k_HashChunkSize)
+    {
+      qint64 count = file.read(buffer.data() + filled, k_HashChunkSize - filled);
+      if(count < 0)
+      {
+        return false;
+      }
+      if(count == 0)
+      {
+        break;
+      }
+      filled += count;
+    }
+    hash = HashBytes(hash, buffer.data(), static_cast<size_t>(filled));
+    if(filled < k_HashChunkSize)
+    {
+      break;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool EbsdParseCache::contentHash(uint64_t& hash)
+{
+  if(!m_ContentHashValid)
+  {
+    m_ContentHashValid = HashFileContents(m_InputFile, m_ContentHash);
+  }
+  hash = m_ContentHash;
+  return m_ContentHashValid;
+}
+
+// -----------------------------------------------------------------------------
+void EbsdParseCache::setVerifyContents(bool value)
+{
+  m_VerifyContents = value;
+}
+
+// -----------------------------------------------------------------------------
+bool EbsdParseCache::getVerifyContents() const
+{
+  return m_VerifyContents;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString EbsdParseCache::getCacheFilePath() const
+{
+  return QDir(m_CacheDirectory).filePath(QString("%1.d3debsd").arg(KeyHash(m_InputFile, m_Variant), 16, 16, QChar('0')));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool EbsdParseCache::load(AttributeMatrix* cellAttrMat)
+{
+  if(m_CacheDirectory.isEmpty() || nullptr == cellAttrMat)
+  {
+    return false;
+  }
+
+  QFile cacheFile(getCacheFilePath());
+  if(!cacheFile.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+
+  CacheFileHeader header;
+  if(cacheFile.read(reinterpret_cast<char*>(&header), sizeof(header)) != static_cast<qint64>(sizeof(header)))
+  {
+    return false;
+  }
+
+  // The cheap checks come first so a stale cache file is rejected without reading the input file
+  QFileInfo fi(m_InputFile);
+  if(std::memcmp(header.magic, k_Magic, sizeof(k_Magic)) != 0 || header.version != k_Version || header.keyHash != KeyHash(m_InputFile, m_Variant) || header.fileSize != static_cast<uint64_t>(fi.size()) ||
+     header.modifiedTime != fi.lastModified().toMSecsSinceEpoch() || header.numTuples != cellAttrMat->getNumberOfTuples())
+  {
+    return false;
+  }
+
+  uint64_t hash = 0;
+  if(m_VerifyContents && (!contentHash(hash) || hash != header.contentHash))
+  {
+    return false;
+  }
+
+  // The entry count is bounded by the size of the cache file before anything is allocated for it
+  const uint64_t cacheFileSize = static_cast<uint64_t>(cacheFile.size());
+  if(header.arrayCount > (cacheFileSize - sizeof(header)) / sizeof(CacheArrayEntry))
+  {
+    return false;
+  }
+
+  std::vector<CacheArrayEntry> entries(header.arrayCount);
+  qint64 entryBytes = static_cast<qint64>(entries.size() * sizeof(CacheArrayEntry));
+  if(cacheFile.read(reinterpret_cast<char*>(entries.data()), entryBytes) != entryBytes)
+  {
+    return false;
+  }
+
+  const uchar* mapped = cacheFile.map(0, cacheFile.size());
+
+  std::vector<IDataArray::Pointer> arrays;
+  arrays.reserve(entries.size());
+  for(const CacheArrayEntry& entry : entries)
+  {
+    QString name = QString::fromUtf8(entry.name, static_cast<int>(strnlen(entry.name, k_NameLength)));
+    QString typeName = QString::fromLatin1(entry.typeName, static_cast<int>(strnlen(entry.typeName, k_TypeNameLength)));
+    // Every value takes at least one byte, so a block that fits in the cache file also bounds the allocation
+    if(entry.offset > cacheFileSize || entry.byteCount > cacheFileSize - entry.offset || entry.numComponents == 0 || entry.numComponents > entry.byteCount / std::max(header.numTuples, uint64_t(1)))
+    {
+      return false;
+    }
+    IDataArray::Pointer array = CreateArrayOfType(typeName, header.numTuples, entry.numComponents, name);
+    if(nullptr == array.get() || entry.byteCount != array->getSize() * array->getTypeSize())
+    {
+      return false;
+    }
+
+    char* dest = reinterpret_cast<char*>(array->getVoidPointer(0));
+    if(nullptr != mapped)
+    {
+      std::memcpy(dest, mapped + entry.offset, entry.byteCount);
+    }
+    else if(!cacheFile.seek(static_cast<qint64>(entry.offset)) || cacheFile.read(dest, static_cast<qint64>(entry.byteCount)) != static_cast<qint64>(entry.byteCount))
+    {
+      return false;
+    }
+    arrays.push_back(array);
+  }
+
+  for(const IDataArray::Pointer& array : arrays)
+  {
+    cellAttrMat->insertOrAssign(array);
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool EbsdParseCache::store(AttributeMatrix* cellAttrMat)
+{
+  if(m_CacheDirectory.isEmpty() || nullptr == cellAttrMat || !QDir().mkpath(m_CacheDirectory))
+  {
+    return false;
+  }
+
+  CacheFileHeader header;
+  std::memcpy(header.magic, k_Magic, sizeof(k_Magic));
+  header.version = k_Version;
+  header.numTuples = cellAttrMat->getNumberOfTuples();
+  QFileInfo fi(m_InputFile);
+  header.fileSize = static_cast<uint64_t>(fi.size());
+  header.modifiedTime = fi.lastModified().toMSecsSinceEpoch();
+  header.keyHash = KeyHash(m_InputFile, m_Variant);
+  header.contentHash = 0;
+  if(m_VerifyContents && !contentHash(header.contentHash))
+  {
+    return false;
+  }
+
+  // Every array has to be storable, otherwise a later load would hand back an incomplete attribute matrix
+  std::vector<IDataArray::Pointer> arrays;
+  std::vector<CacheArrayEntry> entries;
+  QList<QString> names = cellAttrMat->getAttributeArrayNames();
+  for(const QString& name : names)
+  {
+    IDataArray::Pointer array = cellAttrMat->getAttributeArray(name);
+    QByteArray nameBytes = name.toUtf8();
+    QByteArray typeBytes = array->getTypeAsString().toLatin1();
+    if(std::find(k_CachedTypes.begin(), k_CachedTypes.end(), array->getTypeAsString()) == k_CachedTypes.end() || array->getNumberOfTuples() != header.numTuples || nameBytes.size() >= static_cast<int>(k_NameLength))
+    {
+      return false;
+    }
+
+    CacheArrayEntry entry;
+    std::memset(&entry, 0, sizeof(entry));
+    std::memcpy(entry.name, nameBytes.constData(), static_cast<size_t>(nameBytes.size()));
+    std::memcpy(entry.typeName, typeBytes.constData(), static_cast<size_t>(typeBytes.size()));
+    entry.numComponents = static_cast<uint64_t>(array->getNumberOfComponents());
+    entry.byteCount = array->getSize() * array->getTypeSize();
+    entries.push_back(entry);
+    arrays.push_back(array);
+  }
+  header.arrayCount = static_cast<uint32_t>(entries.size());
+
+  uint64_t offset = AlignOffset(sizeof(CacheFileHeader) + entries.size() * sizeof(CacheArrayEntry));
+  for(CacheArrayEntry& entry : entries)
+  {
+    entry.offset = offset;
+    offset = AlignOffset(offset + entry.byteCount);
+  }
+
+  // QSaveFile writes into a temporary file and only replaces the cache file once everything is written
+  QSaveFile cacheFile(getCacheFilePath());
+  if(!cacheFile.open(QIODevice::WriteOnly))
+  {
+    return false;
+  }
+  cacheFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  cacheFile.write(reinterpret_cast<const char*>(entries.data()), static_cast<qint64>(entries.size() * sizeof(CacheArrayEntry)));
+  for(size_t i = 0; i < arrays.size(); i++)
+  {
+    if(!WritePadding(cacheFile, entries[i].offset))
+    {
+      cacheFile.cancelWriting();
+      return false;
+    }
+    cacheFile.write(reinterpret_cast<const char*>(arrays[i]->getVoidPointer(0)), static_cast<qint64>(entries[i].byteCount));
+  }
+  return cacheFile.commit();
+}
@@ -0,0 +1,122 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <cstdint>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+
+#include "OrientationAnalysis/OrientationAnalysisDLLExport.h"
+
+/**
+ * @brief The EbsdParseCache class keeps the parsed cell data of an EBSD file in a binary file on disk so
+ * that the text of the EBSD file does not need to be parsed again by the next import of the same file, even
+ * from a different process. A cache file is only used when the size and the modification time of the EBSD
+ * file match the values that were recorded when the cache file was written. Hashing the whole EBSD file as
+ * well is opt-in through setVerifyContents() as it costs a full read of the file on every load.
+ *
+ * The cache file starts with a fixed size header followed by one entry per array. The raw values of each
+ * array follow in blocks that are aligned to 64 bytes. load() maps the cache file when it can and copies
+ * each block into a newly allocated DataArray; the arrays never point into the cache file.
+ */
+class OrientationAnalysis_EXPORT EbsdParseCache
+{
+public:
+  /**
+   * @brief EbsdParseCache
+   * @param cacheDirectory Directory that holds the cache files
+   * @param inputFile The EBSD file whose parsed data is cached
+   * @param variant Describes any option of the reading filter that changes the parsed values. Files read
+   * with different variants are cached separately.
+   */
+  EbsdParseCache(const QString& cacheDirectory, const QString& inputFile, const QString& variant);
+  ~EbsdParseCache();
+
+  /**
+   * @brief Sets whether a hash of the contents of the input file is recorded by store() and compared by
+   * load(). Off by default, the size and the modification time are compared in any case.
+   */
+  void setVerifyContents(bool value);
+
+  /**
+   * @brief Returns whether the contents of the input file are hashed to validate the cache file
+   */
+  bool getVerifyContents() const;
+
+  /**
+   * @brief Returns the path of the cache file used for the input file and variant
+   */
+  QString getCacheFilePath() const;
+
+  /**
+   * @brief Replaces the arrays of the attribute matrix with the arrays stored in the cache file. Nothing
+   * is changed unless the cache file is present, matches the input file and holds arrays with the same
+   * number of tuples as the attribute matrix. A truncated or otherwise inconsistent cache file is treated
+   * like a stale one.
+   * @param cellAttrMat The attribute matrix to fill
+   * @return True when the arrays were loaded from the cache file
+   */
+  bool load(AttributeMatrix* cellAttrMat);
+
+  /**
+   * @brief Writes every array of the attribute matrix into the cache file, replacing any older cache file
+   * @param cellAttrMat The attribute matrix holding the freshly parsed arrays
+   * @return True when the cache file was written
+   */
+  bool store(AttributeMatrix* cellAttrMat);
+
+  /**
+   * @brief Computes the hash of the contents of a file that is used to validate the cache files
+   * @param filePath The file to hash
+   * @param hash Receives the hash
+   * @return False when the file could not be read
+   */
+  static bool HashFileContents(const QString& filePath, uint64_t& hash);
+
+private:
+  QString m_CacheDirectory;
+  QString m_InputFile;
+  QString m_Variant;
+  uint64_t m_ContentHash = 0;
+  bool m_ContentHashValid = false;
+  bool m_VerifyContents = false;
+
+  bool contentHash(uint64_t& hash);
+
+public:
+  EbsdParseCache(const EbsdParseCache&) = delete;            // Copy Constructor Not Implemented
+  EbsdParseCache(EbsdParseCache&&) = delete;                 // Move Constructor Not Implemented
+  EbsdParseCache& operator=(const EbsdParseCache&) = delete; // Copy Assignment Not Implemented
+  EbsdParseCache& operator=(EbsdParseCache&&) = delete;      // Move Assignment Not Implemented
+};
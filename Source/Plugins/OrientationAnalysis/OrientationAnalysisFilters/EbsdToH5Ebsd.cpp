@@ -34,6 +34,14 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "EbsdToH5Ebsd.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <QtCore/QDir>
 #include <QtCore/QTextStream>
 
@@ -41,7 +49,9 @@
 #include "H5Support/H5Utilities.h"
 #include "H5Support/QH5Lite.h"
 
+#include "EbsdLib/IO/HKL/CtfReader.h"
 #include "EbsdLib/IO/HKL/H5CtfImporter.h"
+#include "EbsdLib/IO/TSL/AngReader.h"
 #include "EbsdLib/IO/TSL/H5AngImporter.h"
 
 #include "SIMPLib/Common/Constants.h"
@@ -52,6 +62,194 @@
 #include "OrientationAnalysis/OrientationAnalysisConstants.h"
 #include "OrientationAnalysis/OrientationAnalysisVersion.h"
 
+namespace
+{
+/**
+ * @brief NumberOfSlices Returns the number of Z slices a parsed reader holds. A .ang file is always a single slice
+ * while a 3D .ctf file can contain several.
+ */
+int NumberOfSlices(AngReader& /* reader */)
+{
+  return 1;
+}
+
+int NumberOfSlices(CtfReader& reader)
+{
+  return std::max(static_cast<int>(reader.getZCells()), 1);
+}
+
+/**
+ * @brief The PipelinedEbsdImporter class wraps one of the EbsdLib HDF5 importers so that the text parsing of the
+ * slices runs ahead of the HDF5 writes. Worker threads parse the files of the list in parallel while the caller keeps
+ * calling importFile() in slice order; each call takes the already parsed reader for that slice and only performs
+ * the HDF5 write, so all HDF5 access stays on the calling thread. At most 'capacity' parsed slices are held in memory,
+ * the workers block until the writer catches up.
+ */
+template <typename ImporterType, typename ReaderType>
+class PipelinedEbsdImporter : public ImporterType
+{
+public:
+  PipelinedEbsdImporter(const QVector<QString>& fileList, size_t numThreads, size_t capacity)
+  : m_FileList(fileList)
+  , m_Capacity(std::max(capacity, static_cast<size_t>(1)))
+  , m_Readers(static_cast<size_t>(fileList.size()))
+  , m_Errors(static_cast<size_t>(fileList.size()), 0)
+  , m_ErrorMessages(static_cast<size_t>(fileList.size()))
+  , m_Parsed(static_cast<size_t>(fileList.size()), false)
+  {
+    for(size_t t = 0; t < numThreads; t++)
+    {
+      m_Workers.emplace_back(&PipelinedEbsdImporter::parseSlices, this);
+    }
+  }
+
+  ~PipelinedEbsdImporter() override
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      m_Stop = true;
+    }
+    m_SpaceAvailable.notify_all();
+    for(auto& worker : m_Workers)
+    {
+      worker.join();
+    }
+  }
+
+  PipelinedEbsdImporter(const PipelinedEbsdImporter&) = delete;
+  PipelinedEbsdImporter(PipelinedEbsdImporter&&) = delete;
+  PipelinedEbsdImporter& operator=(const PipelinedEbsdImporter&) = delete;
+  PipelinedEbsdImporter& operator=(PipelinedEbsdImporter&&) = delete;
+
+  int importFile(hid_t fileId, int64_t z, const std::string& filePath) override
+  {
+    // Slices are expected in list order. Files further down the list skip the slices in between, anything else falls
+    // back to the plain parse + write of the importer
+    size_t index = m_NextToWrite;
+    while(index < m_Readers.size() && m_FileList.at(static_cast<int>(index)).toStdString() != filePath)
+    {
+      index++;
+    }
+    if(index >= m_Readers.size())
+    {
+      int err = ImporterType::importFile(fileId, z, filePath);
+      m_SlicesImported = ImporterType::numberOfSlicesImported();
+      return err;
+    }
+    m_SlicesImported = 0;
+
+    std::shared_ptr<ReaderType> reader;
+    int32_t err = 0;
+    std::string errorMessage;
+    {
+      std::unique_lock<std::mutex> lock(m_Mutex);
+      m_SliceParsed.wait(lock, [this, index] { return m_Parsed[index]; });
+      reader.swap(m_Readers[index]);
+      err = m_Errors[index];
+      errorMessage.swap(m_ErrorMessages[index]);
+      for(size_t i = m_NextToWrite; i < index; i++)
+      {
+        m_Readers[i].reset();
+      }
+      m_NextToWrite = index + 1;
+    }
+    m_SpaceAvailable.notify_all();
+
+    if(err < 0)
+    {
+      if(errorMessage.empty() && nullptr != reader)
+      {
+        errorMessage = reader->getErrorMessage();
+      }
+      this->setPipelineErrorCode(err);
+      this->setPipelineMessage(errorMessage);
+      return err;
+    }
+
+    int numSlices = NumberOfSlices(*reader);
+    for(int slice = 0; slice < numSlices; slice++)
+    {
+      err = this->writeSliceData(fileId, *reader, static_cast<int>(z) + slice, slice);
+      if(err < 0)
+      {
+        return err;
+      }
+      m_SlicesImported++;
+    }
+    return err;
+  }
+
+  int numberOfSlicesImported() override
+  {
+    return m_SlicesImported;
+  }
+
+private:
+  void parseSlices()
+  {
+    while(true)
+    {
+      size_t index = 0;
+      {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_SpaceAvailable.wait(lock, [this] { return m_Stop || m_NextToParse >= m_Readers.size() || m_NextToParse < m_NextToWrite + m_Capacity; });
+        if(m_Stop || m_NextToParse >= m_Readers.size())
+        {
+          return;
+        }
+        index = m_NextToParse++;
+      }
+
+      std::shared_ptr<ReaderType> reader = std::make_shared<ReaderType>();
+      reader->setFileName(m_FileList.at(static_cast<int>(index)).toStdString());
+      int32_t err = 0;
+      std::string errorMessage;
+      // An exception must not escape the worker thread, it is reported through the writer like any other read error
+      try
+      {
+        err = reader->readFile();
+      } catch(const std::exception& e)
+      {
+        err = -1;
+        errorMessage = "Error reading file '" + m_FileList.at(static_cast<int>(index)).toStdString() + "': " + e.what();
+      } catch(...)
+      {
+        err = -1;
+        errorMessage = "Unknown error reading file '" + m_FileList.at(static_cast<int>(index)).toStdString() + "'";
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        // Slices the writer already skipped past are not kept
+        if(index >= m_NextToWrite)
+        {
+          m_Readers[index] = reader;
+        }
+        m_Errors[index] = err;
+        m_ErrorMessages[index] = errorMessage;
+        m_Parsed[index] = true;
+      }
+      m_SliceParsed.notify_all();
+    }
+  }
+
+  QVector<QString> m_FileList;
+  size_t m_Capacity = 1;
+  std::vector<std::shared_ptr<ReaderType>> m_Readers;
+  std::vector<int32_t> m_Errors;
+  std::vector<std::string> m_ErrorMessages;
+  std::vector<bool> m_Parsed;
+  size_t m_NextToParse = 0;
+  size_t m_NextToWrite = 0;
+  int m_SlicesImported = 0;
+  bool m_Stop = false;
+  std::mutex m_Mutex;
+  std::condition_variable m_SliceParsed;
+  std::condition_variable m_SpaceAvailable;
+  std::vector<std::thread> m_Workers;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -300,6 +498,15 @@ void EbsdToH5Ebsd::execute()
 
   EbsdImporter::Pointer fileImporter;
 
+  // With more than one slice the text parsing is spread over worker threads while this thread writes the slices in order.
+  // A single file (which may be a 3D .ctf file) goes straight through the importer.
+  size_t numParseThreads = 0;
+  if(fileList.size() > 1)
+  {
+    size_t hardwareThreads = std::max(static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(2));
+    numParseThreads = std::min(hardwareThreads - 1, static_cast<size_t>(fileList.size()));
+  }
+
   // Write the Manufacturer of the OIM file here
   // This list will grow to be the number of EBSD file formats we support
   QFileInfo fiExt(fileList.front());
@@ -313,7 +520,14 @@ void EbsdToH5Ebsd::execute()
       QString ss = QObject::tr("Could not write the Manufacturer Data to the HDF5 File");
       setErrorCondition(-1, ss);
     }
-    fileImporter = H5AngImporter::New();
+    if(numParseThreads > 0)
+    {
+      fileImporter = EbsdImporter::Pointer(new PipelinedEbsdImporter<H5AngImporter, AngReader>(fileList, numParseThreads, 2 * numParseThreads));
+    }
+    else
+    {
+      fileImporter = H5AngImporter::New();
+    }
   }
   else if(ext == EbsdLib::Ctf::FileExt)
   {
@@ -324,7 +538,14 @@ void EbsdToH5Ebsd::execute()
       QString ss = QObject::tr("Could not write the Manufacturer Data to the HDF5 File");
       setErrorCondition(-1, ss);
     }
-    fileImporter = H5CtfImporter::New();
+    if(numParseThreads > 0)
+    {
+      fileImporter = EbsdImporter::Pointer(new PipelinedEbsdImporter<H5CtfImporter, CtfReader>(fileList, numParseThreads, 2 * numParseThreads));
+    }
+    else
+    {
+      fileImporter = H5CtfImporter::New();
+    }
     CtfReader ctfReader;
     ctfReader.setFileName(fileList.front().toStdString());
     err = ctfReader.readHeaderOnly();
@@ -34,7 +34,10 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "FindGBCD.h"
 
+#include <algorithm>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include <QtCore/QDateTime>
 #include <QtCore/QTextStream>
@@ -51,6 +54,7 @@
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Math/MatrixMath.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 #include "SIMPLib/Utilities/TimeUtilities.h"
 
 #include "EbsdLib/Core/Orientation.hpp"
@@ -61,12 +65,6 @@
 #include "OrientationAnalysis/OrientationAnalysisConstants.h"
 #include "OrientationAnalysis/OrientationAnalysisVersion.h"
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-#include <tbb/blocked_range.h>
-#include <tbb/parallel_for.h>
-#include <tbb/partitioner.h>
-#endif
-
 using LaueOpsShPtrType = std::shared_ptr<LaueOps>;
 using LaueOpsContainer = std::vector<LaueOpsShPtrType>;
 
@@ -79,49 +77,88 @@ enum createdPathID : RenameDataPath::DataID_t
   DataArrayID31 = 31,
 };
 
+namespace
+{
+// Upper bound on the memory used by the partial GBCD histograms; finer GBCD resolutions bucket the bins instead
+constexpr size_t k_PartialHistogramBytes = 512 * 1024 * 1024;
+// Faces that each partial histogram takes from every chunk of faces
+constexpr size_t k_FacesPerPartialChunk = 10000;
+// Faces per chunk when the GBCD bins of a chunk are bucketed by the thread that owns them
+constexpr size_t k_FacesPerBucketChunk = 8192;
+
+/**
+ * @brief One area that a face adds to one entry of the GBCD array
+ */
+struct GBCDBinEntry
+{
+  size_t entry;
+  double area;
+};
+using GBCDBinBuckets = std::vector<std::vector<GBCDBinEntry>>;
+} // namespace
+
 /**
  * @brief The CalculateGBCDImpl class implements a threaded algorithm that calculates the
- * grain boundary character distribution (GBCD) for a surface mesh
+ * grain boundary character distribution (GBCD) for a surface mesh. The area of each face is
+ * added directly to the GBCD histogram and per phase face area totals that it is given, so
+ * instances that run at the same time must be given separate histograms. When bin buckets
+ * are set instead, each area is appended to the bucket of the GBCD entry range it falls in
+ * and only the face area totals are added to.
  */
 class CalculateGBCDImpl
 {
-  size_t startOffset;
-  size_t numEntriesPerTri;
   Int32ArrayType::Pointer m_LabelsArray;
   DoubleArrayType::Pointer m_NormalsArray;
+  DoubleArrayType::Pointer m_AreasArray;
   Int32ArrayType::Pointer m_PhasesArray;
   FloatArrayType::Pointer m_EulersArray;
 
   FloatArrayType::Pointer m_GbcdDeltasArray;
   FloatArrayType::Pointer m_GbcdLimitsArray;
   Int32ArrayType::Pointer m_GbcdSizesArray;
-  Int32ArrayType::Pointer m_GbcdBinsArray;
-  BoolArrayType::Pointer m_GbcdHemiCheckArray;
 
   UInt32ArrayType::Pointer m_CrystalStructuresArray;
   LaueOpsContainer m_OrientationOps;
 
+  double* m_Gbcd;
+  double* m_TotalFaceArea;
+  size_t m_TotalGBCDBins = 0;
+
+  GBCDBinBuckets* m_Buckets = nullptr;
+  size_t m_EntriesPerBucket = 1;
+
 public:
-  CalculateGBCDImpl(size_t i, size_t numMisoReps, Int32ArrayType::Pointer labels, DoubleArrayType::Pointer normals, FloatArrayType::Pointer eulers, Int32ArrayType::Pointer phases,
-                    UInt32ArrayType::Pointer crystalStructures, Int32ArrayType::Pointer bins, BoolArrayType::Pointer hemiCheck, FloatArrayType::Pointer gbcdDeltas, Int32ArrayType::Pointer gbcdSizes,
-                    FloatArrayType::Pointer gbcdLimits)
-  : startOffset(i)
-  , numEntriesPerTri(numMisoReps)
-  , m_LabelsArray(std::move(labels))
+  CalculateGBCDImpl(Int32ArrayType::Pointer labels, DoubleArrayType::Pointer normals, DoubleArrayType::Pointer areas, FloatArrayType::Pointer eulers, Int32ArrayType::Pointer phases,
+                    UInt32ArrayType::Pointer crystalStructures, FloatArrayType::Pointer gbcdDeltas, Int32ArrayType::Pointer gbcdSizes, FloatArrayType::Pointer gbcdLimits, double* gbcd,
+                    double* totalFaceArea)
+  : m_LabelsArray(std::move(labels))
   , m_NormalsArray(std::move(normals))
+  , m_AreasArray(std::move(areas))
   , m_PhasesArray(std::move(phases))
   , m_EulersArray(std::move(eulers))
   , m_GbcdDeltasArray(std::move(gbcdDeltas))
   , m_GbcdLimitsArray(std::move(gbcdLimits))
   , m_GbcdSizesArray(std::move(gbcdSizes))
-  , m_GbcdBinsArray(std::move(bins))
-  , m_GbcdHemiCheckArray(std::move(hemiCheck))
   , m_CrystalStructuresArray(std::move(crystalStructures))
+  , m_Gbcd(gbcd)
+  , m_TotalFaceArea(totalFaceArea)
   {
     m_OrientationOps = LaueOps::GetAllOrientationOps();
+    int32_t* gbcdSizes = m_GbcdSizesArray->getPointer(0);
+    m_TotalGBCDBins = static_cast<size_t>(gbcdSizes[0] * gbcdSizes[1] * gbcdSizes[2] * gbcdSizes[3] * gbcdSizes[4] * 2);
   }
   virtual ~CalculateGBCDImpl() = default;
 
+  /**
+   * @brief Makes generate() append every (GBCD entry, area) pair to buckets[entry / entriesPerBucket] instead
+   * of adding it to the histogram. Within a bucket the pairs stay in the order the faces were visited.
+   */
+  void setBinBuckets(GBCDBinBuckets* buckets, size_t entriesPerBucket)
+  {
+    m_Buckets = buckets;
+    m_EntriesPerBucket = entriesPerBucket;
+  }
+
   void generate(size_t start, size_t end) const
   {
 
@@ -129,11 +166,10 @@ public:
     float* gbcdDeltas = m_GbcdDeltasArray->getPointer(0);
     float* gbcdLimits = m_GbcdLimitsArray->getPointer(0);
     int* gbcdSizes = m_GbcdSizesArray->getPointer(0);
-    int32_t* bins = m_GbcdBinsArray->getPointer(0);
-    bool* hemiCheck = m_GbcdHemiCheckArray->getPointer(0);
 
     int32_t* labels = m_LabelsArray->getPointer(0);
     double* normals = m_NormalsArray->getPointer(0);
+    double* areas = m_AreasArray->getPointer(0);
     int32_t* phases = m_PhasesArray->getPointer(0);
     float* eulers = m_EulersArray->getPointer(0);
     uint32_t* crystalStructures = m_CrystalStructuresArray->getPointer(0);
@@ -156,13 +192,9 @@ public:
     int32_t gbcd_index = 0;
     float sqCoord[2] = {0.0f, 0.0f}, sqCoordInv[2] = {0.0f, 0.0f};
     bool nhCheck = false, nhCheckInv = true;
-    int32_t SYMcounter = 0;
-    auto TRIcounter = static_cast<int64_t>(start - startOffset);
-    int64_t TRIcounterShift = 0;
 
     for(size_t i = start; i < end; i++)
     {
-      SYMcounter = 0;
       feature1 = labels[2 * i];
       feature2 = labels[2 * i + 1];
       normal[0] = normals[3 * i];
@@ -176,7 +208,8 @@ public:
 
       if(phases[feature1] == phases[feature2] && phases[feature1] > 0)
       {
-        TRIcounterShift = (TRIcounter * numEntriesPerTri);
+        int32_t phase = phases[feature1];
+        double area = areas[i];
         uint32_t cryst = crystalStructures[phases[feature1]];
         for(int32_t q = 0; q < 2; q++)
         {
@@ -240,39 +273,38 @@ public:
                 gbcd_index = GBCDIndex(gbcdDeltas, gbcdSizes, gbcdLimits, euler_mis, sqCoord);
                 if(gbcd_index != -1)
                 {
-                  hemiCheck[TRIcounterShift + SYMcounter] = nhCheck;
-                  bins[TRIcounterShift + SYMcounter] = gbcd_index;
+                  addToGBCD(phase, gbcd_index, nhCheck, area);
                 }
-                SYMcounter++;
                 if(inversion == 1)
                 {
                   gbcd_index = GBCDIndex(gbcdDeltas, gbcdSizes, gbcdLimits, euler_mis, sqCoordInv);
                   if(gbcd_index != -1)
                   {
-                    hemiCheck[TRIcounterShift + SYMcounter] = nhCheckInv;
-                    bins[TRIcounterShift + SYMcounter] = gbcd_index;
+                    addToGBCD(phase, gbcd_index, nhCheckInv, area);
                   }
-                  SYMcounter++;
                 }
               }
-              else
-              {
-                SYMcounter += 2;
-              }
             }
           }
         }
       }
-      TRIcounter++;
     }
   }
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  void operator()(const tbb::blocked_range<size_t>& r) const
+  void addToGBCD(int32_t phase, int32_t gbcdIndex, bool northernHemisphere, double area) const
   {
-    generate(r.begin(), r.end());
+    size_t hemisphere = northernHemisphere ? 0 : 1;
+    size_t entry = (phase * m_TotalGBCDBins) + (2 * gbcdIndex + hemisphere);
+    if(m_Buckets != nullptr)
+    {
+      (*m_Buckets)[entry / m_EntriesPerBucket].push_back({entry, area});
+    }
+    else
+    {
+      m_Gbcd[entry] += area;
+    }
+    m_TotalFaceArea[phase] += area;
   }
-#endif
 
   int32_t GBCDIndex(const float* gbcddelta, const int32_t* gbcdsz, const float* gbcdlimits, const float* eulerN, const float* sqCoord) const
   {
@@ -365,8 +397,6 @@ FindGBCD::FindGBCD()
   m_GbcdDeltasArray = FloatArrayType::NullPointer();
   m_GbcdSizesArray = Int32ArrayType::NullPointer();
   m_GbcdLimitsArray = FloatArrayType::NullPointer();
-  m_GbcdBinsArray = Int32ArrayType::NullPointer();
-  m_GbcdHemiCheckArray = BoolArrayType::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -447,14 +477,10 @@ void FindGBCD::initialize()
   m_GbcdDeltasArray = FloatArrayType::NullPointer();
   m_GbcdSizesArray = Int32ArrayType::NullPointer();
   m_GbcdLimitsArray = FloatArrayType::NullPointer();
-  m_GbcdBinsArray = Int32ArrayType::NullPointer();
-  m_GbcdHemiCheckArray = BoolArrayType::NullPointer();
 
   m_GbcdDeltas = nullptr;
   m_GbcdSizes = nullptr;
   m_GbcdLimits = nullptr;
-  m_GbcdBins = nullptr;
-  m_HemiCheck = nullptr;
 }
 
 // -----------------------------------------------------------------------------
@@ -500,8 +526,8 @@ void FindGBCD::dataCheckSurfaceMesh()
     m_SurfaceMeshFaceAreas = m_SurfaceMeshFaceAreasPtr.lock()->getPointer(0);
   } /* Now assign the raw pointer to data from the DataArray<T> object */
 
-  // call the sizeGBCD function to get the GBCD ranges, dimensions, etc.  Note that the input parameters do not affect the size and can be dummy values here;
-  sizeGBCD(0, 0);
+  // call the sizeGBCD function to get the GBCD ranges, dimensions, etc.
+  sizeGBCD();
   cDims.resize(6);
   cDims[0] = m_GbcdSizes[0];
   cDims[1] = m_GbcdSizes[1];
@@ -578,15 +604,37 @@ void FindGBCD::execute()
 
   size_t totalPhases = m_CrystalStructuresPtr.lock()->getNumberOfTuples();
   size_t totalFaces = m_SurfaceMeshFaceLabelsPtr.lock()->getNumberOfTuples();
-  size_t faceChunkSize = 50000;
-  size_t numMisoReps = 576 * 4;
-  if(totalFaces < faceChunkSize)
+  // call the sizeGBCD function to get the GBCD ranges, dimensions, etc.
+  sizeGBCD();
+  int32_t totalGBCDBins = m_GbcdSizes[0] * m_GbcdSizes[1] * m_GbcdSizes[2] * m_GbcdSizes[3] * m_GbcdSizes[4] * 2;
+  size_t histogramSize = totalPhases * static_cast<size_t>(totalGBCDBins);
+
+  // Every partial histogram accumulates the same share of each chunk of faces and they are added together in
+  // order at the end, so the result does not depend on how the threads are scheduled. The first partial is the
+  // GBCD array itself. When the GBCD resolution is too fine for one partial per thread, every thread bins an
+  // equal share of each chunk of faces into buckets, one per owner of a contiguous range of GBCD entries. Each
+  // owner then adds its buckets in thread order, which is face order, and touches no other entries.
+  size_t numThreads = std::max(static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(1));
+  size_t maxPartials = std::max(k_PartialHistogramBytes / (histogramSize * sizeof(double)), static_cast<size_t>(1));
+  bool useBinBuckets = maxPartials < numThreads;
+  size_t numPartials = useBinBuckets ? numThreads : std::min(numThreads, std::max(totalFaces / k_FacesPerPartialChunk, static_cast<size_t>(1)));
+
+  std::vector<std::vector<double>> partialGBCDs(useBinBuckets ? 0 : numPartials - 1, std::vector<double>(histogramSize, 0.0));
+  std::vector<std::vector<double>> partialFaceAreas(numPartials, std::vector<double>(totalPhases, 0.0));
+  size_t entriesPerOwner = (histogramSize + numThreads - 1) / numThreads;
+  std::vector<GBCDBinBuckets> buckets(useBinBuckets ? numPartials : 0, GBCDBinBuckets(numThreads));
+  std::vector<CalculateGBCDImpl> partials;
+  partials.reserve(numPartials);
+  for(size_t p = 0; p < numPartials; p++)
   {
-    faceChunkSize = totalFaces;
+    double* gbcd = (p == 0 || useBinBuckets) ? m_GBCD : partialGBCDs[p - 1].data();
+    partials.emplace_back(m_SurfaceMeshFaceLabelsPtr.lock(), m_SurfaceMeshFaceNormalsPtr.lock(), m_SurfaceMeshFaceAreasPtr.lock(), m_FeatureEulerAnglesPtr.lock(), m_FeaturePhasesPtr.lock(),
+                          m_CrystalStructuresPtr.lock(), m_GbcdDeltasArray, m_GbcdSizesArray, m_GbcdLimitsArray, gbcd, partialFaceAreas[p].data());
+    if(useBinBuckets)
+    {
+      partials[p].setBinBuckets(&buckets[p], entriesPerOwner);
+    }
   }
-  // call the sizeGBCD function with proper chunkSize and numMisoReps to get Bins array set up properly
-  sizeGBCD(faceChunkSize, numMisoReps);
-  int32_t totalGBCDBins = m_GbcdSizes[0] * m_GbcdSizes[1] * m_GbcdSizes[2] * m_GbcdSizes[3] * m_GbcdSizes[4] * 2;
 
   uint64_t millis = QDateTime::currentMSecsSinceEpoch();
   uint64_t currentMillis = millis;
@@ -594,80 +642,89 @@ void FindGBCD::execute()
   uint64_t estimatedTime = 0;
   float timeDiff = 0.0f;
   startMillis = QDateTime::currentMSecsSinceEpoch();
-  int32_t hemisphere = 0;
-
-  // create an array to hold the total face area for each phase and initialize the array to 0.0
-  DoubleArrayType::Pointer totalFaceAreaPtr = DoubleArrayType::CreateArray(totalPhases, std::string("totalFaceArea"), true);
-  totalFaceAreaPtr->initializeWithValue(0.0);
-  double* totalFaceArea = totalFaceAreaPtr->getPointer(0);
 
   QString ss = QObject::tr("Calculating GBCD || 0/%1 Completed").arg(totalFaces);
+  size_t faceChunkSize = useBinBuckets ? k_FacesPerBucketChunk : k_FacesPerPartialChunk * numPartials;
   for(size_t i = 0; i < totalFaces; i = i + faceChunkSize)
   {
     if(getCancel())
     {
       return;
     }
-    if(i + faceChunkSize >= totalFaces)
+    size_t chunkEnd = std::min(i + faceChunkSize, totalFaces);
+    size_t facesPerPartial = (chunkEnd - i + numPartials - 1) / numPartials;
+    auto calculateChunk = [&](const SIMPLRange& range) {
+      for(size_t p = range.min(); p < range.max(); p++)
+      {
+        if(useBinBuckets)
+        {
+          for(auto& bucket : buckets[p])
+          {
+            bucket.clear();
+          }
+        }
+        size_t start = std::min(i + p * facesPerPartial, chunkEnd);
+        partials[p].generate(start, std::min(start + facesPerPartial, chunkEnd));
+      }
+    };
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numPartials);
+    dataAlg.setGrain(1);
+    dataAlg.execute(calculateChunk);
+
+    if(useBinBuckets)
     {
-      faceChunkSize = totalFaces - i;
+      auto accumulateBuckets = [&](const SIMPLRange& range) {
+        for(size_t owner = range.min(); owner < range.max(); owner++)
+        {
+          for(size_t p = 0; p < numPartials; p++)
+          {
+            for(const GBCDBinEntry& binEntry : buckets[p][owner])
+            {
+              m_GBCD[binEntry.entry] += binEntry.area;
+            }
+          }
+        }
+      };
+      ParallelDataAlgorithm accumulateAlg;
+      accumulateAlg.setRange(0, numThreads);
+      accumulateAlg.setGrain(1);
+      accumulateAlg.execute(accumulateBuckets);
     }
-    m_GbcdBinsArray->initializeWithValue(-1);
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-    tbb::parallel_for(tbb::blocked_range<size_t>(i, i + faceChunkSize),
-                      CalculateGBCDImpl(i, numMisoReps, m_SurfaceMeshFaceLabelsPtr.lock(), m_SurfaceMeshFaceNormalsPtr.lock(), m_FeatureEulerAnglesPtr.lock(), m_FeaturePhasesPtr.lock(),
-                                        m_CrystalStructuresPtr.lock(), m_GbcdBinsArray, m_GbcdHemiCheckArray, m_GbcdDeltasArray, m_GbcdSizesArray, m_GbcdLimitsArray),
-                      tbb::auto_partitioner());
-#else
-    CalculateGBCDImpl serial(i, numMisoReps, m_SurfaceMeshFaceLabelsPtr.lock(), m_SurfaceMeshFaceNormalsPtr.lock(), m_FeatureEulerAnglesPtr.lock(), m_FeaturePhasesPtr.lock(),
-                             m_CrystalStructuresPtr.lock(), m_GbcdBinsArray, m_GbcdHemiCheckArray, m_GbcdDeltasArray, m_GbcdSizesArray, m_GbcdLimitsArray);
-    serial.generate(i, i + faceChunkSize);
-#endif
 
     currentMillis = QDateTime::currentMSecsSinceEpoch();
     if(currentMillis - millis > 1000)
     {
-      QString ss = QObject::tr("Calculating GBCD || Triangles %1/%2 Completed").arg(i).arg(totalFaces);
-      timeDiff = ((float)i / (float)(currentMillis - startMillis));
-      estimatedTime = (float)(totalFaces - i) / timeDiff;
+      QString ss = QObject::tr("Calculating GBCD || Triangles %1/%2 Completed").arg(chunkEnd).arg(totalFaces);
+      timeDiff = ((float)chunkEnd / (float)(currentMillis - startMillis));
+      estimatedTime = (float)(totalFaces - chunkEnd) / timeDiff;
       ss = ss + QObject::tr(" || Est. Time Remain: %1").arg(DREAM3D::convertMillisToHrsMinSecs(estimatedTime));
       millis = QDateTime::currentMSecsSinceEpoch();
       notifyStatusMessage(ss);
     }
+  }
 
-    if(getCancel())
-    {
-      return;
-    }
+  if(getCancel())
+  {
+    return;
+  }
 
-    int32_t phase = 0;
-    int32_t feature = 0;
-    double area = 0.0;
-    for(size_t j = 0; j < faceChunkSize; j++)
+  // Add the partial histograms and face areas together
+  std::vector<double> totalFaceArea(totalPhases, 0.0);
+  for(size_t p = 0; p < numPartials; p++)
+  {
+    if(p > 0 && !useBinBuckets)
     {
-      area = m_SurfaceMeshFaceAreas[i + j];
-      feature = m_SurfaceMeshFaceLabels[2 * (i + j)];
-      if(feature < 0)
-      {
-        continue;
-      }
-      phase = m_FeaturePhases[feature];
-      for(size_t k = 0; k < numMisoReps; k++)
+      const std::vector<double>& partialGBCD = partialGBCDs[p - 1];
+      for(size_t j = 0; j < histogramSize; j++)
       {
-        if(m_GbcdBins[(j * numMisoReps) + (k)] >= 0)
-        {
-          hemisphere = 0;
-          if(!m_HemiCheck[(j * numMisoReps) + k])
-          {
-            hemisphere = 1;
-          }
-          size_t gbcdBinIdx = (j * numMisoReps) + k;
-          size_t gbcdIdx = (phase * totalGBCDBins) + (2 * m_GbcdBins[gbcdBinIdx] + hemisphere);
-          m_GBCD[gbcdIdx] += area;
-          totalFaceArea[phase] += area;
-        }
+        m_GBCD[j] += partialGBCD[j];
       }
     }
+    for(size_t phase = 0; phase < totalPhases; phase++)
+    {
+      totalFaceArea[phase] += partialFaceAreas[p][phase];
+    }
   }
 
   ss = QObject::tr("Starting GBCD Normalization");
@@ -687,7 +744,7 @@ void FindGBCD::execute()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void FindGBCD::sizeGBCD(size_t faceChunkSize, size_t numMisoReps)
+void FindGBCD::sizeGBCD()
 {
   m_GbcdDeltasArray = FloatArrayType::CreateArray(5, std::string("GBCDDeltas"), true);
   m_GbcdDeltasArray->initializeWithZeros();
@@ -695,17 +752,10 @@ void FindGBCD::sizeGBCD(size_t faceChunkSize, size_t numMisoReps)
   m_GbcdLimitsArray->initializeWithZeros();
   m_GbcdSizesArray = Int32ArrayType::CreateArray(5, std::string("GBCDSizes"), true);
   m_GbcdSizesArray->initializeWithZeros();
-  std::vector<size_t> cDims(1, numMisoReps);
-  m_GbcdBinsArray = Int32ArrayType::CreateArray(faceChunkSize, cDims, "GBCDBins", true);
-  m_GbcdBinsArray->initializeWithZeros();
-  m_GbcdHemiCheckArray = BoolArrayType::CreateArray(faceChunkSize, cDims, "GBCDHemiCheck", true);
-  m_GbcdHemiCheckArray->initializeWithValue(false);
 
   m_GbcdDeltas = m_GbcdDeltasArray->getPointer(0);
   m_GbcdSizes = m_GbcdSizesArray->getPointer(0);
   m_GbcdLimits = m_GbcdLimitsArray->getPointer(0);
-  m_GbcdBins = m_GbcdBinsArray->getPointer(0);
-  m_HemiCheck = m_GbcdHemiCheckArray->getPointer(0);
 
   // Original Ranges from Dave R.
   // m_GBCDlimits[0] = 0.0f;
@@ -44,6 +44,10 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "FindGBCDMetricBased.h"
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 #include <QtCore/QDir>
 #include <QtCore/QTextStream>
 
@@ -61,19 +65,14 @@
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Math/MatrixMath.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "EbsdLib/LaueOps/LaueOps.h"
 
 #include "OrientationAnalysis/OrientationAnalysisConstants.h"
+#include "OrientationAnalysis/OrientationAnalysisFilters/GBDistributionHelpers/SphericalNormalIndex.h"
 #include "OrientationAnalysis/OrientationAnalysisVersion.h"
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-#include <tbb/blocked_range.h>
-#include <tbb/parallel_for.h>
-#include <tbb/partitioner.h>
-#include "tbb/concurrent_vector.h"
-#endif
-
 using LaueOpsShPtrType = std::shared_ptr<LaueOps>;
 using LaueOpsContainer = std::vector<LaueOpsShPtrType>;
 
@@ -127,11 +126,6 @@ class TrisSelector
   MeshIndexType* m_Triangles;
   int8_t* m_NodeTypes;
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::concurrent_vector<TriAreaAndNormals>* selectedTris;
-#else
-  QVector<TriAreaAndNormals>* selectedTris;
-#endif
   QVector<int8_t>* triIncluded;
   float m_misorResol;
   int32_t m_PhaseOfInterest;
@@ -148,19 +142,11 @@ class TrisSelector
   double* m_FaceAreas;
 
 public:
-  TrisSelector(bool __m_ExcludeTripleLines, MeshIndexType* __m_Triangles, int8_t* __m_NodeTypes,
-
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-               tbb::concurrent_vector<TriAreaAndNormals>* __selectedTris,
-#else
-               QVector<TriAreaAndNormals>* __selectedTris,
-#endif
-               QVector<int8_t>* __triIncluded, float __m_misorResol, int32_t __m_PhaseOfInterest, float (&__gFixedT)[3][3], uint32_t* __m_CrystalStructures, float* __m_Eulers, int32_t* __m_Phases,
-               int32_t* __m_FaceLabels, double* __m_FaceNormals, double* __m_FaceAreas)
+  TrisSelector(bool __m_ExcludeTripleLines, MeshIndexType* __m_Triangles, int8_t* __m_NodeTypes, QVector<int8_t>* __triIncluded, float __m_misorResol, int32_t __m_PhaseOfInterest,
+               float (&__gFixedT)[3][3], uint32_t* __m_CrystalStructures, float* __m_Eulers, int32_t* __m_Phases, int32_t* __m_FaceLabels, double* __m_FaceNormals, double* __m_FaceAreas)
   : m_ExcludeTripleLines(__m_ExcludeTripleLines)
   , m_Triangles(__m_Triangles)
   , m_NodeTypes(__m_NodeTypes)
-  , selectedTris(__selectedTris)
   , triIncluded(__triIncluded)
   , m_misorResol(__m_misorResol)
   , m_PhaseOfInterest(__m_PhaseOfInterest)
@@ -178,7 +164,10 @@ public:
 
   virtual ~TrisSelector() = default;
 
-  void select(size_t start, size_t end) const
+  /**
+   * @brief Appends the triangles in [start, end) that have the fixed misorientation to selectedTris
+   */
+  void select(size_t start, size_t end, std::vector<TriAreaAndNormals>& selectedTris) const
   {
     float g1ea[3] = {0.0f, 0.0f, 0.0f};
     float g2ea[3] = {0.0f, 0.0f, 0.0f};
@@ -289,11 +278,11 @@ public:
 
               if(transpose == 0)
               {
-                (*selectedTris).push_back(TriAreaAndNormals(m_FaceAreas[triIdx], normal_grain1[0], normal_grain1[1], normal_grain1[2], -normal_grain2[0], -normal_grain2[1], -normal_grain2[2]));
+                selectedTris.push_back(TriAreaAndNormals(m_FaceAreas[triIdx], normal_grain1[0], normal_grain1[1], normal_grain1[2], -normal_grain2[0], -normal_grain2[1], -normal_grain2[2]));
               }
               else
               {
-                (*selectedTris).push_back(TriAreaAndNormals(m_FaceAreas[triIdx], -normal_grain2[0], -normal_grain2[1], -normal_grain2[2], normal_grain1[0], normal_grain1[1], normal_grain1[2]));
+                selectedTris.push_back(TriAreaAndNormals(m_FaceAreas[triIdx], -normal_grain2[0], -normal_grain2[1], -normal_grain2[2], normal_grain1[0], normal_grain1[1], normal_grain1[2]));
               }
             }
           }
@@ -301,31 +290,22 @@ public:
       }
     }
   }
-
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  void operator()(const tbb::blocked_range<size_t>& r) const
-  {
-    select(r.begin(), r.end());
-  }
-#endif
 };
 
 /**
  * @brief The ProbeDistrib class implements a threaded algorithm that determines the distribution values
- * for the GBCD
+ * for the GBCD. Only the triangles whose first normal lies in the index cells near a sampling point, or
+ * near its inverse, are tested against that point.
  */
 class ProbeDistrib
 {
   QVector<double>* distribValues = nullptr;
   QVector<double>* errorValues = nullptr;
-  QVector<float> samplPtsX;
-  QVector<float> samplPtsY;
-  QVector<float> samplPtsZ;
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::concurrent_vector<TriAreaAndNormals> selectedTris;
-#else
-  QVector<TriAreaAndNormals> selectedTris;
-#endif
+  const QVector<float>& samplPtsX;
+  const QVector<float>& samplPtsY;
+  const QVector<float>& samplPtsZ;
+  const std::vector<TriAreaAndNormals>& selectedTris;
+  const SphericalNormalIndex& normalIndex;
   float planeResolSq;
   double totalFaceArea;
   int numDistinctGBs;
@@ -333,19 +313,16 @@ class ProbeDistrib
   float (&gFixedT)[3][3];
 
 public:
-  ProbeDistrib(QVector<double>* __distribValues, QVector<double>* __errorValues, QVector<float> __samplPtsX, QVector<float> __samplPtsY, QVector<float> __samplPtsZ,
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-               tbb::concurrent_vector<TriAreaAndNormals> __selectedTris,
-#else
-               QVector<TriAreaAndNormals> __selectedTris,
-#endif
-               float __planeResolSq, double __totalFaceArea, int __numDistinctGBs, double __ballVolume, float (&__gFixedT)[3][3])
+  ProbeDistrib(QVector<double>* __distribValues, QVector<double>* __errorValues, const QVector<float>& __samplPtsX, const QVector<float>& __samplPtsY, const QVector<float>& __samplPtsZ,
+               const std::vector<TriAreaAndNormals>& __selectedTris, const SphericalNormalIndex& __normalIndex, float __planeResolSq, double __totalFaceArea, int __numDistinctGBs,
+               double __ballVolume, float (&__gFixedT)[3][3])
   : distribValues(__distribValues)
   , errorValues(__errorValues)
   , samplPtsX(__samplPtsX)
   , samplPtsY(__samplPtsY)
   , samplPtsZ(__samplPtsZ)
   , selectedTris(__selectedTris)
+  , normalIndex(__normalIndex)
   , planeResolSq(__planeResolSq)
   , totalFaceArea(__totalFaceArea)
   , numDistinctGBs(__numDistinctGBs)
@@ -358,35 +335,39 @@ public:
 
   void probe(size_t start, size_t end) const
   {
+    // A triangle can only be within the plane resolution if its first normal is within sqrt(2) times the
+    // plane resolution of the (inverted) sampling point
+    float searchRadius = sqrtf(2.0f * planeResolSq);
+
     for(size_t ptIdx = start; ptIdx < end; ptIdx++)
     {
       float fixedNormal1[3] = {samplPtsX.at(ptIdx), samplPtsY.at(ptIdx), samplPtsZ.at(ptIdx)};
       float fixedNormal2[3] = {0.0f, 0.0f, 0.0f};
       MatrixMath::Multiply3x3with3x1(gFixedT, fixedNormal1, fixedNormal2);
 
-      for(int triRepresIdx = 0; triRepresIdx < static_cast<int>(selectedTris.size()); triRepresIdx++)
+      for(int inversion = 0; inversion <= 1; inversion++)
       {
-        for(int inversion = 0; inversion <= 1; inversion++)
+        float sign = 1.0f;
+        if(inversion == 1)
         {
-          float sign = 1.0f;
-          if(inversion == 1)
-          {
-            sign = -1.0f;
-          }
+          sign = -1.0f;
+        }
+        float searchCenter[3] = {sign * fixedNormal1[0], sign * fixedNormal1[1], sign * fixedNormal1[2]};
+
+        normalIndex.forEachCandidate(searchCenter, searchRadius, [&](size_t triRepresIdx) {
+          const TriAreaAndNormals& tri = selectedTris[triRepresIdx];
 
-          float theta1 = acosf(sign * (selectedTris[triRepresIdx].normal_grain1_x * fixedNormal1[0] + selectedTris[triRepresIdx].normal_grain1_y * fixedNormal1[1] +
-                                       selectedTris[triRepresIdx].normal_grain1_z * fixedNormal1[2]));
+          float theta1 = acosf(sign * (tri.normal_grain1_x * fixedNormal1[0] + tri.normal_grain1_y * fixedNormal1[1] + tri.normal_grain1_z * fixedNormal1[2]));
 
-          float theta2 = acosf(-sign * (selectedTris[triRepresIdx].normal_grain2_x * fixedNormal2[0] + selectedTris[triRepresIdx].normal_grain2_y * fixedNormal2[1] +
-                                        selectedTris[triRepresIdx].normal_grain2_z * fixedNormal2[2]));
+          float theta2 = acosf(-sign * (tri.normal_grain2_x * fixedNormal2[0] + tri.normal_grain2_y * fixedNormal2[1] + tri.normal_grain2_z * fixedNormal2[2]));
 
           float distSq = 0.5f * (theta1 * theta1 + theta2 * theta2);
 
           if(distSq < planeResolSq)
           {
-            (*distribValues)[ptIdx] += selectedTris[triRepresIdx].area;
+            (*distribValues)[ptIdx] += tri.area;
           }
-        }
+        });
       }
       (*errorValues)[ptIdx] = sqrt((*distribValues)[ptIdx] / totalFaceArea / double(numDistinctGBs)) / ballVolume;
 
@@ -395,12 +376,10 @@ public:
     }
   }
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  void operator()(const tbb::blocked_range<size_t>& r) const
+  void operator()(const SIMPLRange& range) const
   {
-    probe(r.begin(), r.end());
+    probe(range.min(), range.max());
   }
-#endif
 };
 
 } // namespace GBCDMetricBased
@@ -852,16 +831,17 @@ void FindGBCDMetricBased::execute()
 
   size_t numMeshTris = m_SurfaceMeshFaceAreasPtr.lock()->getNumberOfTuples();
 
-// ---------  find triangles (and equivalent crystallographic parameters) with +- the fixed misorientation ---------
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  bool doParallel = true;
-  tbb::concurrent_vector<GBCDMetricBased::TriAreaAndNormals> selectedTris(0);
-#else
-  QVector<GBCDMetricBased::TriAreaAndNormals> selectedTris(0);
-#endif
-
+  // ---------  find triangles (and equivalent crystallographic parameters) with +- the fixed misorientation ---------
+  // Each partition of a chunk of triangles collects its matches in its own buffer. The buffers are appended
+  // in partition order, so the selected triangles are always in the same order
+  std::vector<GBCDMetricBased::TriAreaAndNormals> selectedTris;
   QVector<int8_t> triIncluded(numMeshTris, 0);
 
+  size_t numPartitions = std::max(static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(1));
+  std::vector<std::vector<GBCDMetricBased::TriAreaAndNormals>> partitionTris(numPartitions);
+  GBCDMetricBased::TrisSelector selector(m_ExcludeTripleLines, m_Triangles, m_NodeTypes, &triIncluded, m_misorResol, m_PhaseOfInterest, gFixedT, m_CrystalStructures, m_Eulers, m_Phases,
+                                         m_FaceLabels, m_FaceNormals, m_FaceAreas);
+
   size_t trisChunkSize = 50000;
   if(numMeshTris < trisChunkSize)
   {
@@ -881,22 +861,26 @@ void FindGBCDMetricBased::execute()
       trisChunkSize = numMeshTris - i;
     }
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-    if(doParallel)
-    {
-      tbb::parallel_for(tbb::blocked_range<size_t>(i, i + trisChunkSize),
-                        GBCDMetricBased::TrisSelector(m_ExcludeTripleLines, m_Triangles, m_NodeTypes, &selectedTris, &triIncluded, m_misorResol, m_PhaseOfInterest, gFixedT, m_CrystalStructures,
-                                                      m_Eulers, m_Phases, m_FaceLabels, m_FaceNormals, m_FaceAreas),
-                        tbb::auto_partitioner());
-    }
-    else
-#endif
+    size_t trisPerPartition = (trisChunkSize + numPartitions - 1) / numPartitions;
+    auto selectChunk = [&](const SIMPLRange& range) {
+      for(size_t p = range.min(); p < range.max(); p++)
+      {
+        size_t start = std::min(i + p * trisPerPartition, i + trisChunkSize);
+        selector.select(start, std::min(start + trisPerPartition, i + trisChunkSize), partitionTris[p]);
+      }
+    };
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numPartitions);
+    dataAlg.setGrain(1);
+    dataAlg.execute(selectChunk);
+
+    for(std::vector<GBCDMetricBased::TriAreaAndNormals>& tris : partitionTris)
     {
-      GBCDMetricBased::TrisSelector serial(m_ExcludeTripleLines, m_Triangles, m_NodeTypes, &selectedTris, &triIncluded, m_misorResol, m_PhaseOfInterest, gFixedT, m_CrystalStructures, m_Eulers,
-                                           m_Phases, m_FaceLabels, m_FaceNormals, m_FaceAreas);
-      serial.select(i, i + trisChunkSize);
+      selectedTris.insert(selectedTris.end(), tris.begin(), tris.end());
+      tris.clear();
     }
   }
+  selectedTris.shrink_to_fit();
 
   // ------------------------  find the number of distinct boundaries ------------------------------
   int32_t numDistinctGBs = 0;
@@ -933,6 +917,16 @@ void FindGBCDMetricBased::execute()
   QVector<double> distribValues(samplPtsX.size(), 0.0);
   QVector<double> errorValues(samplPtsX.size(), 0.0);
 
+  // Bin the first normal of every selected triangle so each sampling point only visits nearby triangles
+  std::vector<float> grain1Normals(3 * selectedTris.size(), 0.0f);
+  for(size_t triIdx = 0; triIdx < selectedTris.size(); triIdx++)
+  {
+    grain1Normals[3 * triIdx] = selectedTris[triIdx].normal_grain1_x;
+    grain1Normals[3 * triIdx + 1] = selectedTris[triIdx].normal_grain1_y;
+    grain1Normals[3 * triIdx + 2] = selectedTris[triIdx].normal_grain1_z;
+  }
+  SphericalNormalIndex normalIndex(grain1Normals, sqrtf(2.0f) * m_planeResol);
+
   int32_t pointsChunkSize = 100;
   if(samplPtsX.size() < pointsChunkSize)
   {
@@ -952,19 +946,10 @@ void FindGBCDMetricBased::execute()
       pointsChunkSize = samplPtsX.size() - i;
     }
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-    if(doParallel)
-    {
-      tbb::parallel_for(tbb::blocked_range<size_t>(i, i + pointsChunkSize),
-                        GBCDMetricBased::ProbeDistrib(&distribValues, &errorValues, samplPtsX, samplPtsY, samplPtsZ, selectedTris, m_PlaneResolSq, totalFaceArea, numDistinctGBs, ballVolume, gFixedT),
-                        tbb::auto_partitioner());
-    }
-    else
-#endif
-    {
-      GBCDMetricBased::ProbeDistrib serial(&distribValues, &errorValues, samplPtsX, samplPtsY, samplPtsZ, selectedTris, m_PlaneResolSq, totalFaceArea, numDistinctGBs, ballVolume, gFixedT);
-      serial.probe(i, i + pointsChunkSize);
-    }
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(i, i + pointsChunkSize);
+    dataAlg.execute(GBCDMetricBased::ProbeDistrib(&distribValues, &errorValues, samplPtsX, samplPtsY, samplPtsZ, selectedTris, normalIndex, m_PlaneResolSq, totalFaceArea, numDistinctGBs,
+                                                  ballVolume, gFixedT));
   }
 
   // ------------------------------------------- writing the output --------------------------------
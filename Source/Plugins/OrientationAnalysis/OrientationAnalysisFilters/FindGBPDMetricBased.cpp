@@ -45,6 +45,10 @@
 
 #include "FindGBPDMetricBased.h"
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 #include <QtCore/QDir>
 #include <QtCore/QTextStream>
 
@@ -62,19 +66,14 @@
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Math/MatrixMath.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "EbsdLib/LaueOps/LaueOps.h"
 
 #include "OrientationAnalysis/OrientationAnalysisConstants.h"
+#include "OrientationAnalysis/OrientationAnalysisFilters/GBDistributionHelpers/SphericalNormalIndex.h"
 #include "OrientationAnalysis/OrientationAnalysisVersion.h"
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-#include <tbb/blocked_range.h>
-#include <tbb/parallel_for.h>
-#include <tbb/partitioner.h>
-#include "tbb/concurrent_vector.h"
-#endif
-
 using LaueOpsShPtrType = std::shared_ptr<LaueOps>;
 using LaueOpsContainer = std::vector<LaueOpsShPtrType>;
 
@@ -128,11 +127,6 @@ class TrisSelector
   bool m_ExcludeTripleLines;
   MeshIndexType* m_Triangles = nullptr;
   int8_t* m_NodeTypes = nullptr;
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::concurrent_vector<TriAreaAndNormals>* selectedTris;
-#else
-  QVector<TriAreaAndNormals>* selectedTris;
-#endif
   int32_t m_PhaseOfInterest;
   LaueOpsContainer m_OrientationOps;
   uint32_t cryst;
@@ -144,18 +138,11 @@ class TrisSelector
   double* m_FaceAreas = nullptr;
 
 public:
-  TrisSelector(bool __m_ExcludeTripleLines, MeshIndexType* __m_Triangles, int8_t* __m_NodeTypes,
-
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-               tbb::concurrent_vector<TriAreaAndNormals>* __selectedTris,
-#else
-               QVector<TriAreaAndNormals>* __selectedTris,
-#endif
-               int32_t __m_PhaseOfInterest, uint32_t* __m_CrystalStructures, float* __m_Eulers, int32_t* __m_Phases, int32_t* __m_FaceLabels, double* __m_FaceNormals, double* __m_FaceAreas)
+  TrisSelector(bool __m_ExcludeTripleLines, MeshIndexType* __m_Triangles, int8_t* __m_NodeTypes, int32_t __m_PhaseOfInterest, uint32_t* __m_CrystalStructures, float* __m_Eulers,
+               int32_t* __m_Phases, int32_t* __m_FaceLabels, double* __m_FaceNormals, double* __m_FaceAreas)
   : m_ExcludeTripleLines(__m_ExcludeTripleLines)
   , m_Triangles(__m_Triangles)
   , m_NodeTypes(__m_NodeTypes)
-  , selectedTris(__selectedTris)
   , m_PhaseOfInterest(__m_PhaseOfInterest)
   , m_Eulers(__m_Eulers)
   , m_Phases(__m_Phases)
@@ -170,7 +157,10 @@ public:
 
   virtual ~TrisSelector() = default;
 
-  void select(size_t start, size_t end) const
+  /**
+   * @brief Appends the triangles in [start, end) that belong to the Phase of Interest to selectedTris
+   */
+  void select(size_t start, size_t end, std::vector<TriAreaAndNormals>& selectedTris) const
   {
     float g1ea[3] = {0.0f, 0.0f, 0.0f};
     float g2ea[3] = {0.0f, 0.0f, 0.0f};
@@ -228,21 +218,18 @@ public:
       MatrixMath::Multiply3x3with3x1(g1, normal_lab, normal_grain1);
       MatrixMath::Multiply3x3with3x1(g2, normal_lab, normal_grain2);
 
-      (*selectedTris).push_back(TriAreaAndNormals(m_FaceAreas[triIdx], normal_grain1[0], normal_grain1[1], normal_grain1[2], -normal_grain2[0], -normal_grain2[1], -normal_grain2[2]));
+      selectedTris.push_back(TriAreaAndNormals(m_FaceAreas[triIdx], normal_grain1[0], normal_grain1[1], normal_grain1[2], -normal_grain2[0], -normal_grain2[1], -normal_grain2[2]));
     }
   }
-
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  void operator()(const tbb::blocked_range<size_t>& r) const
-  {
-    select(r.begin(), r.end());
-  }
-#endif
 };
 
 /**
  * @brief The ProbeDistrib class implements a threaded algorithm that determines the distribution values
- * for the GBPD
+ * for the GBPD. Both normals of every selected triangle are held in one index, entry 2 * i for the first
+ * normal of triangle i and entry 2 * i + 1 for the second. Since the angle between a sampling point and a
+ * normal rotated by a symmetry operator equals the angle between the normal and the sampling point rotated
+ * by the inverse operator, each symmetry operator and inversion only visits the index cells around the
+ * inversely rotated sampling point.
  */
 class ProbeDistrib
 {
@@ -251,11 +238,8 @@ class ProbeDistrib
   QVector<float>* samplPtsX;
   QVector<float>* samplPtsY;
   QVector<float>* samplPtsZ;
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::concurrent_vector<TriAreaAndNormals> selectedTris;
-#else
-  QVector<TriAreaAndNormals> selectedTris;
-#endif
+  const std::vector<TriAreaAndNormals>& selectedTris;
+  const SphericalNormalIndex& normalIndex;
   float limitDist;
   double totalFaceArea;
   int numDistinctGBs;
@@ -266,18 +250,15 @@ class ProbeDistrib
 
 public:
   ProbeDistrib(QVector<double>* __distribValues, QVector<double>* __errorValues, QVector<float>* __samplPtsX, QVector<float>* __samplPtsY, QVector<float>* __samplPtsZ,
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-               tbb::concurrent_vector<TriAreaAndNormals> __selectedTris,
-#else
-               QVector<TriAreaAndNormals> __selectedTris,
-#endif
-               float __limitDist, double __totalFaceArea, int __numDistinctGBs, double __ballVolume, int32_t __cryst)
+               const std::vector<TriAreaAndNormals>& __selectedTris, const SphericalNormalIndex& __normalIndex, float __limitDist, double __totalFaceArea, int __numDistinctGBs,
+               double __ballVolume, int32_t __cryst)
   : distribValues(__distribValues)
   , errorValues(__errorValues)
   , samplPtsX(__samplPtsX)
   , samplPtsY(__samplPtsY)
   , samplPtsZ(__samplPtsZ)
   , selectedTris(__selectedTris)
+  , normalIndex(__normalIndex)
   , limitDist(__limitDist)
   , totalFaceArea(__totalFaceArea)
   , numDistinctGBs(__numDistinctGBs)
@@ -298,54 +279,51 @@ public:
 
       float probeNormal[3] = {(*samplPtsX).at(ptIdx), (*samplPtsY).at(ptIdx), (*samplPtsZ).at(ptIdx)};
 
-      for(int triRepresIdx = 0; triRepresIdx < static_cast<int>(selectedTris.size()); triRepresIdx++)
-      {
-        float normal1[3] = {selectedTris[triRepresIdx].normal_grain1_x, selectedTris[triRepresIdx].normal_grain1_y, selectedTris[triRepresIdx].normal_grain1_z};
+      float sym[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+      float symT[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
 
-        float normal2[3] = {selectedTris[triRepresIdx].normal_grain2_x, selectedTris[triRepresIdx].normal_grain2_y, selectedTris[triRepresIdx].normal_grain2_z};
+      for(int j = 0; j < nsym; j++)
+      {
+        m_OrientationOps[cryst]->getMatSymOp(j, sym);
+        MatrixMath::Transpose3x3(sym, symT);
 
-        float sym[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+        float symProbeNormal[3] = {0.0f, 0.0f, 0.0f};
+        MatrixMath::Multiply3x3with3x1(symT, probeNormal, symProbeNormal);
 
-        for(int j = 0; j < nsym; j++)
+        for(int inversion = 0; inversion <= 1; inversion++)
         {
-          m_OrientationOps[cryst]->getMatSymOp(j, sym);
-
-          float sym_normal1[3] = {0.0f, 0.0f, 0.0f};
-          float sym_normal2[3] = {0.0f, 0.0f, 0.0f};
-
-          MatrixMath::Multiply3x3with3x1(sym, normal1, sym_normal1);
-          MatrixMath::Multiply3x3with3x1(sym, normal2, sym_normal2);
-
-          for(int inversion = 0; inversion <= 1; inversion++)
+          float sign = 1.0f;
+          if(inversion == 1)
           {
-            float sign = 1.0f;
-            if(inversion == 1)
+            sign = -1.0f;
+          }
+          float searchCenter[3] = {sign * symProbeNormal[0], sign * symProbeNormal[1], sign * symProbeNormal[2]};
+
+          normalIndex.forEachCandidate(searchCenter, limitDist, [&](size_t entryIdx) {
+            const TriAreaAndNormals& tri = selectedTris[entryIdx / 2];
+            float normal[3] = {tri.normal_grain1_x, tri.normal_grain1_y, tri.normal_grain1_z};
+            if(entryIdx % 2 == 1)
             {
-              sign = -1.0f;
+              normal[0] = tri.normal_grain2_x;
+              normal[1] = tri.normal_grain2_y;
+              normal[2] = tri.normal_grain2_z;
             }
 
-            float gamma1 = acosf(sign * (probeNormal[0] * sym_normal1[0] + probeNormal[1] * sym_normal1[1] + probeNormal[2] * sym_normal1[2]));
+            float sym_normal[3] = {0.0f, 0.0f, 0.0f};
+            MatrixMath::Multiply3x3with3x1(sym, normal, sym_normal);
 
-            float gamma2 = acosf(sign * (probeNormal[0] * sym_normal2[0] + probeNormal[1] * sym_normal2[1] + probeNormal[2] * sym_normal2[2]));
+            float gamma = acosf(sign * (probeNormal[0] * sym_normal[0] + probeNormal[1] * sym_normal[1] + probeNormal[2] * sym_normal[2]));
 
-            if(gamma1 < limitDist)
+            if(gamma < limitDist)
             {
               // Kahan summation algorithm
-              double __y = selectedTris[triRepresIdx].area - __c;
+              double __y = tri.area - __c;
               double __t = (*distribValues)[ptIdx] + __y;
               __c = (__t - (*distribValues)[ptIdx]);
               __c -= __y;
               (*distribValues)[ptIdx] = __t;
             }
-            if(gamma2 < limitDist)
-            {
-              double __y = selectedTris[triRepresIdx].area - __c;
-              double __t = (*distribValues)[ptIdx] + __y;
-              __c = (__t - (*distribValues)[ptIdx]);
-              __c -= __y;
-              (*distribValues)[ptIdx] = __t;
-            }
-          }
+          });
         }
       }
       (*errorValues)[ptIdx] = sqrt((*distribValues)[ptIdx] / totalFaceArea / double(numDistinctGBs)) / ballVolume;
@@ -354,12 +332,10 @@ public:
     }
   }
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  void operator()(const tbb::blocked_range<size_t>& r) const
+  void operator()(const SIMPLRange& range) const
   {
-    probe(r.begin(), r.end());
+    probe(range.min(), range.max());
   }
-#endif
 };
 
 } // namespace GBPDMetricBased
@@ -936,12 +912,13 @@ void FindGBPDMetricBased::execute()
   // ---------  find triangles corresponding to Phase of Interests, and their normals in crystal reference frames ---------
   size_t numMeshTris = m_SurfaceMeshFaceAreasPtr.lock()->getNumberOfTuples();
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  bool doParallel = true;
-  tbb::concurrent_vector<GBPDMetricBased::TriAreaAndNormals> selectedTris(0);
-#else
-  QVector<GBPDMetricBased::TriAreaAndNormals> selectedTris(0);
-#endif
+  // Each partition of a chunk of triangles collects its triangles in its own buffer. The buffers are appended
+  // in partition order, so the selected triangles are always in the same order
+  std::vector<GBPDMetricBased::TriAreaAndNormals> selectedTris;
+
+  size_t numPartitions = std::max(static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(1));
+  std::vector<std::vector<GBPDMetricBased::TriAreaAndNormals>> partitionTris(numPartitions);
+  GBPDMetricBased::TrisSelector selector(m_ExcludeTripleLines, m_Triangles, m_NodeTypes, m_PhaseOfInterest, m_CrystalStructures, m_Eulers, m_Phases, m_FaceLabels, m_FaceNormals, m_FaceAreas);
 
   size_t trisChunkSize = 50000;
   if(numMeshTris < trisChunkSize)
@@ -962,22 +939,26 @@ void FindGBPDMetricBased::execute()
       trisChunkSize = numMeshTris - i;
     }
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-    if(doParallel)
-    {
-      tbb::parallel_for(tbb::blocked_range<size_t>(i, i + trisChunkSize),
-                        GBPDMetricBased::TrisSelector(m_ExcludeTripleLines, m_Triangles, m_NodeTypes, &selectedTris, m_PhaseOfInterest, m_CrystalStructures, m_Eulers, m_Phases, m_FaceLabels,
-                                                      m_FaceNormals, m_FaceAreas),
-                        tbb::auto_partitioner());
-    }
-    else
-#endif
+    size_t trisPerPartition = (trisChunkSize + numPartitions - 1) / numPartitions;
+    auto selectChunk = [&](const SIMPLRange& range) {
+      for(size_t p = range.min(); p < range.max(); p++)
+      {
+        size_t start = std::min(i + p * trisPerPartition, i + trisChunkSize);
+        selector.select(start, std::min(start + trisPerPartition, i + trisChunkSize), partitionTris[p]);
+      }
+    };
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numPartitions);
+    dataAlg.setGrain(1);
+    dataAlg.execute(selectChunk);
+
+    for(std::vector<GBPDMetricBased::TriAreaAndNormals>& tris : partitionTris)
     {
-      GBPDMetricBased::TrisSelector serial(m_ExcludeTripleLines, m_Triangles, m_NodeTypes, &selectedTris, m_PhaseOfInterest, m_CrystalStructures, m_Eulers, m_Phases, m_FaceLabels, m_FaceNormals,
-                                           m_FaceAreas);
-      serial.select(i, i + trisChunkSize);
+      selectedTris.insert(selectedTris.end(), tris.begin(), tris.end());
+      tris.clear();
     }
   }
+  selectedTris.shrink_to_fit();
 
   // ------------------------  find the number of distinct boundaries ------------------------------
   int32_t numDistinctGBs = 0;
@@ -1014,6 +995,19 @@ void FindGBPDMetricBased::execute()
   QVector<double> distribValues(samplPtsX.size(), 0.0);
   QVector<double> errorValues(samplPtsX.size(), 0.0);
 
+  // Bin both normals of every selected triangle so each sampling point only visits nearby normals
+  std::vector<float> grainNormals(6 * selectedTris.size(), 0.0f);
+  for(size_t triIdx = 0; triIdx < selectedTris.size(); triIdx++)
+  {
+    grainNormals[6 * triIdx] = selectedTris[triIdx].normal_grain1_x;
+    grainNormals[6 * triIdx + 1] = selectedTris[triIdx].normal_grain1_y;
+    grainNormals[6 * triIdx + 2] = selectedTris[triIdx].normal_grain1_z;
+    grainNormals[6 * triIdx + 3] = selectedTris[triIdx].normal_grain2_x;
+    grainNormals[6 * triIdx + 4] = selectedTris[triIdx].normal_grain2_y;
+    grainNormals[6 * triIdx + 5] = selectedTris[triIdx].normal_grain2_z;
+  }
+  SphericalNormalIndex normalIndex(grainNormals, m_LimitDist);
+
   int32_t pointsChunkSize = 20;
   if(samplPtsX.size() < pointsChunkSize)
   {
@@ -1033,19 +1027,10 @@ void FindGBPDMetricBased::execute()
       pointsChunkSize = samplPtsX.size() - i;
     }
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-    if(doParallel)
-    {
-      tbb::parallel_for(tbb::blocked_range<size_t>(i, i + pointsChunkSize),
-                        GBPDMetricBased::ProbeDistrib(&distribValues, &errorValues, &samplPtsX, &samplPtsY, &samplPtsZ, selectedTris, m_LimitDist, totalFaceArea, numDistinctGBs, ballVolume, cryst),
-                        tbb::auto_partitioner());
-    }
-    else
-#endif
-    {
-      GBPDMetricBased::ProbeDistrib serial(&distribValues, &errorValues, &samplPtsX, &samplPtsY, &samplPtsZ, selectedTris, m_LimitDist, totalFaceArea, numDistinctGBs, ballVolume, cryst);
-      serial.probe(i, i + pointsChunkSize);
-    }
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(i, i + pointsChunkSize);
+    dataAlg.execute(GBPDMetricBased::ProbeDistrib(&distribValues, &errorValues, &samplPtsX, &samplPtsY, &samplPtsZ, selectedTris, normalIndex, m_LimitDist, totalFaceArea, numDistinctGBs,
+                                                  ballVolume, cryst));
   }
 
   // ------------------------------------------- writing the output --------------------------------
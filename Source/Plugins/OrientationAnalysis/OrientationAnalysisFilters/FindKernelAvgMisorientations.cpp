@@ -35,9 +35,13 @@
 
 #include "FindKernelAvgMisorientations.h"
 
+#include <algorithm>
+#include <array>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/SIMPLRange.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
@@ -48,6 +52,7 @@
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "EbsdLib/Core/EbsdLibConstants.h"
 #include "EbsdLib/Core/Orientation.hpp"
@@ -57,6 +62,154 @@
 #include "OrientationAnalysis/OrientationAnalysisConstants.h"
 #include "OrientationAnalysis/OrientationAnalysisVersion.h"
 
+/**
+ * @brief The FindKernelAvgMisorientationsImpl class computes the kernel average misorientation
+ * for a block of consecutive rows (or planes) of the image. The misorientation of a voxel pair
+ * whose two voxels are both owned by the block is calculated once and added to both voxels.
+ * Pairs that reach outside of the block are calculated by each side, so every voxel is only
+ * written by the block that owns it.
+ */
+class FindKernelAvgMisorientationsImpl
+{
+public:
+  FindKernelAvgMisorientationsImpl(const std::vector<LaueOps::Pointer>& orientationOps, int32_t* featureIds, int32_t* cellPhases, uint32_t* crystalStructures, float* quats, float* kernelAvgMisorientations,
+                                   int32_t* pairCounts, std::array<int64_t, 3> dims, const IntVec3Type& kernelSize, int64_t blockRows)
+  : m_OrientationOps(orientationOps)
+  , m_FeatureIds(featureIds)
+  , m_CellPhases(cellPhases)
+  , m_CrystalStructures(crystalStructures)
+  , m_Quats(quats)
+  , m_KernelAverageMisorientations(kernelAvgMisorientations)
+  , m_PairCounts(pairCounts)
+  , m_Dims(dims)
+  , m_KernelSize(kernelSize)
+  , m_BlockRows(blockRows)
+  {
+  }
+  virtual ~FindKernelAvgMisorientationsImpl() = default;
+
+  void findBlock(int64_t block) const
+  {
+    const int64_t xPoints = m_Dims[0];
+    const int64_t yPoints = m_Dims[1];
+    const int64_t zPoints = m_Dims[2];
+    const int64_t planeStride = xPoints * yPoints;
+
+    // The block owns the voxels of the flattened (plane, row) rows [rowStart, rowEnd)
+    const int64_t rowStart = block * m_BlockRows;
+    const int64_t rowEnd = std::min(rowStart + m_BlockRows, yPoints * zPoints);
+    const int64_t ownedStart = rowStart * xPoints;
+    const int64_t ownedEnd = rowEnd * xPoints;
+
+    for(int64_t flatRow = rowStart; flatRow < rowEnd; flatRow++)
+    {
+      const int64_t plane = flatRow / yPoints;
+      const int64_t row = flatRow % yPoints;
+      for(int64_t col = 0; col < xPoints; col++)
+      {
+        const int64_t point = flatRow * xPoints + col;
+        if(!isValid(point))
+        {
+          continue;
+        }
+        const float* q1Ptr = m_Quats + point * 4;
+        QuatF q1(q1Ptr[0], q1Ptr[1], q1Ptr[2], q1Ptr[3]);
+        const uint32_t phase1 = m_CrystalStructures[m_CellPhases[point]];
+        const LaueOps::Pointer& ops = m_OrientationOps[phase1];
+
+        // The voxel itself is part of its kernel with a misorientation of zero
+        m_PairCounts[point]++;
+
+        for(int32_t j = -m_KernelSize[2]; j < m_KernelSize[2] + 1; j++)
+        {
+          if(plane + j < 0 || plane + j > zPoints - 1)
+          {
+            continue;
+          }
+          for(int32_t k = -m_KernelSize[1]; k < m_KernelSize[1] + 1; k++)
+          {
+            if(row + k < 0 || row + k > yPoints - 1)
+            {
+              continue;
+            }
+            for(int32_t l = -m_KernelSize[0]; l < m_KernelSize[0] + 1; l++)
+            {
+              if(col + l < 0 || col + l > xPoints - 1 || (j == 0 && k == 0 && l == 0))
+              {
+                continue;
+              }
+              const int64_t neighbor = point + j * planeStride + k * xPoints + l;
+              if(m_FeatureIds[point] != m_FeatureIds[neighbor])
+              {
+                continue;
+              }
+
+              // A pair is shared when the neighbor is owned by this block and would compute the
+              // same value from its side of the pair.
+              const bool shared = neighbor >= ownedStart && neighbor < ownedEnd && isValid(neighbor) && m_CrystalStructures[m_CellPhases[neighbor]] == phase1;
+              const bool forward = neighbor > point;
+              if(shared && !forward)
+              {
+                continue; // Already added when the neighbor was visited
+              }
+
+              const float* q2Ptr = m_Quats + neighbor * 4;
+              float misorientation = 0.0f;
+              if(q1Ptr[0] != q2Ptr[0] || q1Ptr[1] != q2Ptr[1] || q1Ptr[2] != q2Ptr[2] || q1Ptr[3] != q2Ptr[3])
+              {
+                QuatF q2(q2Ptr[0], q2Ptr[1], q2Ptr[2], q2Ptr[3]);
+                OrientationF axisAngle = ops->calculateMisorientation(q1, q2);
+                misorientation = static_cast<float>(axisAngle[3] * SIMPLib::Constants::k_180OverPiD);
+              }
+
+              m_KernelAverageMisorientations[point] += misorientation;
+              m_PairCounts[point]++;
+              if(shared)
+              {
+                m_KernelAverageMisorientations[neighbor] += misorientation;
+                m_PairCounts[neighbor]++;
+              }
+            }
+          }
+        }
+      }
+    }
+
+    for(int64_t point = ownedStart; point < ownedEnd; point++)
+    {
+      if(m_PairCounts[point] > 0)
+      {
+        m_KernelAverageMisorientations[point] /= static_cast<float>(m_PairCounts[point]);
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      findBlock(static_cast<int64_t>(block));
+    }
+  }
+
+private:
+  bool isValid(int64_t point) const
+  {
+    return m_FeatureIds[point] > 0 && m_CellPhases[point] > 0;
+  }
+
+  const std::vector<LaueOps::Pointer>& m_OrientationOps;
+  int32_t* m_FeatureIds = nullptr;
+  int32_t* m_CellPhases = nullptr;
+  uint32_t* m_CrystalStructures = nullptr;
+  float* m_Quats = nullptr;
+  float* m_KernelAverageMisorientations = nullptr;
+  int32_t* m_PairCounts = nullptr;
+  std::array<int64_t, 3> m_Dims;
+  IntVec3Type m_KernelSize;
+  int64_t m_BlockRows = 0;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -199,102 +352,36 @@ void FindKernelAvgMisorientations::execute()
 
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(m_FeatureIdsArrayPath.getDataContainerName());
 
-  std::vector<LaueOps::Pointer> m_OrientationOps = LaueOps::GetAllOrientationOps();
-  FloatArrayType::Pointer quatPtr = m_QuatsPtr.lock();
-
-  int32_t numVoxel = 0; // number of voxels in the feature...
-  bool good = false;
-
-  float totalmisorientation = 0.0f;
-
-  uint32_t phase1 = EbsdLib::CrystalStructure::UnknownCrystalStructure;
-  uint32_t phase2 = EbsdLib::CrystalStructure::UnknownCrystalStructure;
+  std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
   SizeVec3Type udims = m->getGeometryAs<ImageGeom>()->getDimensions();
 
   int64_t xPoints = static_cast<int64_t>(udims[0]);
   int64_t yPoints = static_cast<int64_t>(udims[1]);
   int64_t zPoints = static_cast<int64_t>(udims[2]);
-  int64_t point = 0;
-  size_t neighbor = 0;
-  int64_t jStride = 0;
-  int64_t kStride = 0;
-  float* currentQuatPtr = nullptr;
-  for(int64_t col = 0; col < xPoints; col++)
-  {
-    for(int64_t row = 0; row < yPoints; row++)
-    {
-      for(int64_t plane = 0; plane < zPoints; plane++)
-      {
-        point = (plane * xPoints * yPoints) + (row * xPoints) + col;
-        if(m_FeatureIds[point] > 0 && m_CellPhases[point] > 0)
-        {
-          totalmisorientation = 0.0f;
-          numVoxel = 0;
-          currentQuatPtr = quatPtr->getTuplePointer(point);
-          QuatF q1(currentQuatPtr[0], currentQuatPtr[1], currentQuatPtr[2], currentQuatPtr[3]);
+  size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
 
-          phase1 = m_CrystalStructures[m_CellPhases[point]];
-          for(int32_t j = -m_KernelSize[2]; j < m_KernelSize[2] + 1; j++)
-          {
-            jStride = j * xPoints * yPoints;
-            for(int32_t k = -m_KernelSize[1]; k < m_KernelSize[1] + 1; k++)
-            {
-              kStride = k * xPoints;
-              for(int32_t l = -m_KernelSize[0]; l < m_KernelSize[0] + 1; l++)
-              {
-                good = true;
-                neighbor = point + (jStride) + (kStride) + (l);
-                if(plane + j < 0)
-                {
-                  good = false;
-                }
-                else if(plane + j > zPoints - 1)
-                {
-                  good = false;
-                }
-                else if(row + k < 0)
-                {
-                  good = false;
-                }
-                else if(row + k > yPoints - 1)
-                {
-                  good = false;
-                }
-                else if(col + l < 0)
-                {
-                  good = false;
-                }
-                else if(col + l > xPoints - 1)
-                {
-                  good = false;
-                }
-                if(good && m_FeatureIds[point] == m_FeatureIds[neighbor])
-                {
-                  currentQuatPtr = quatPtr->getTuplePointer(neighbor);
-
-                  QuatF q2(currentQuatPtr[0], currentQuatPtr[1], currentQuatPtr[2], currentQuatPtr[3]);
-                  phase2 = m_CrystalStructures[m_CellPhases[neighbor]];
-                  OrientationF axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
-
-                  totalmisorientation = totalmisorientation + (axisAngle[3] * SIMPLib::Constants::k_180OverPiD);
-                  numVoxel++;
-                }
-              }
-            }
-          }
-          m_KernelAverageMisorientations[point] = totalmisorientation / (float)numVoxel;
-          if(numVoxel == 0)
-          {
-            m_KernelAverageMisorientations[point] = 0.0f;
-          }
-        }
-        if(m_FeatureIds[point] == 0 || m_CellPhases[point] == 0)
-        {
-          m_KernelAverageMisorientations[point] = 0.0f;
-        }
-      }
-    }
+  std::fill(m_KernelAverageMisorientations, m_KernelAverageMisorientations + totalPoints, 0.0f);
+  std::vector<int32_t> pairCounts(totalPoints, 0);
+
+  // Work is split into blocks of whole planes for volumes and blocks of rows for a single
+  // slice. The block size only depends on the geometry so the result is the same for any
+  // number of threads.
+  int64_t blockRows = 0;
+  if(zPoints > 1)
+  {
+    blockRows = yPoints * std::min<int64_t>(zPoints, std::max<int64_t>(2 * m_KernelSize[2] + 1, 4));
+  }
+  else
+  {
+    blockRows = std::min<int64_t>(yPoints, std::max<int64_t>(2 * m_KernelSize[1] + 1, 16));
   }
+  int64_t numBlocks = (yPoints * zPoints + blockRows - 1) / blockRows;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.setGrain(1);
+  dataAlg.execute(FindKernelAvgMisorientationsImpl(orientationOps, m_FeatureIds, m_CellPhases, m_CrystalStructures, m_QuatsPtr.lock()->getPointer(0), m_KernelAverageMisorientations, pairCounts.data(),
+                                                   {xPoints, yPoints, zPoints}, m_KernelSize, blockRows));
 }
 
 // -----------------------------------------------------------------------------
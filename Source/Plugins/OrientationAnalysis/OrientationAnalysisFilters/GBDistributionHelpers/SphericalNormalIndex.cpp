@@ -0,0 +1,94 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "SphericalNormalIndex.h"
+
+namespace
+{
+// Upper bound on the number of cells so tiny query radii do not allocate huge offset tables
+constexpr size_t k_MaxCells = 1 << 22;
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SphericalNormalIndex::SphericalNormalIndex(const std::vector<float>& normals, float queryRadius)
+{
+  size_t numNormals = normals.size() / 3;
+
+  // Bands of equal width in z are about as wide as the cells are tall at the equator
+  double cellSize = std::max(static_cast<double>(queryRadius), std::sqrt(4.0 * k_Pi / static_cast<double>(std::max(numNormals, static_cast<size_t>(1)))));
+  if(!(cellSize > 0.0))
+  {
+    cellSize = k_Pi;
+  }
+  m_NumZBands = static_cast<size_t>(std::min(std::ceil(2.0 / cellSize), 2048.0));
+  m_NumAzimuthCells = static_cast<size_t>(std::min(std::ceil(2.0 * k_Pi / cellSize), 4096.0));
+  m_NumZBands = std::max(std::min(m_NumZBands, k_MaxCells / m_NumAzimuthCells), static_cast<size_t>(1));
+  m_AzimuthScale = static_cast<double>(m_NumAzimuthCells) / (2.0 * k_Pi);
+
+  // Counting sort of the entries by cell keeps the entries of each cell in increasing order
+  std::vector<size_t> cells(numNormals, 0);
+  m_CellOffsets.assign(getNumberOfCells() + 1, 0);
+  for(size_t i = 0; i < numNormals; i++)
+  {
+    const float* normal = normals.data() + 3 * i;
+    if(!std::isfinite(normal[0]) || !std::isfinite(normal[1]) || !std::isfinite(normal[2]))
+    {
+      cells[i] = getNumberOfCells();
+      continue;
+    }
+    cells[i] = zBand(normal[2]) * m_NumAzimuthCells + azimuthCell(normal[0], normal[1]);
+    m_CellOffsets[cells[i] + 1]++;
+  }
+  for(size_t c = 0; c < getNumberOfCells(); c++)
+  {
+    m_CellOffsets[c + 1] += m_CellOffsets[c];
+  }
+
+  m_Entries.resize(m_CellOffsets.back());
+  std::vector<size_t> next(m_CellOffsets.begin(), m_CellOffsets.end() - 1);
+  for(size_t i = 0; i < numNormals; i++)
+  {
+    if(cells[i] < getNumberOfCells())
+    {
+      m_Entries[next[cells[i]]++] = i;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t SphericalNormalIndex::getNumberOfCells() const
+{
+  return m_NumZBands * m_NumAzimuthCells;
+}
@@ -0,0 +1,151 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief The SphericalNormalIndex class bins unit vectors into the cells of a Lambert cylindrical equal-area
+ * grid on the sphere: bands of equal width in z and sectors of equal width in azimuth. The vectors within a
+ * given angle of a direction are then found by visiting only the cells that overlap the spherical cap
+ * around that direction instead of every vector.
+ *
+ * The cells that are visited cover the cap with some margin, so callers still have to apply their own
+ * angular test to each candidate.
+ */
+class SphericalNormalIndex
+{
+public:
+  /**
+   * @brief SphericalNormalIndex
+   * @param normals Unit vectors, 3 values per entry
+   * @param queryRadius The angular radius (radians) that the index will mostly be queried with. It sets the
+   * size of the cells, which are never made smaller than the area of the sphere per entry.
+   */
+  SphericalNormalIndex(const std::vector<float>& normals, float queryRadius);
+  ~SphericalNormalIndex() = default;
+
+  /**
+   * @brief Calls func(entryIndex) once for every entry that lies in a cell overlapping the spherical cap of
+   * the given angular radius around center. Entries are visited cell by cell and in increasing order within
+   * a cell. Entries that were not finite when the index was built are never visited.
+   * @param center Center of the cap; it does not have to be normalized
+   * @param radius Angular radius of the cap in radians
+   * @param func Callback taking the index of the entry
+   */
+  template <typename Func>
+  void forEachCandidate(const float center[3], float radius, Func&& func) const
+  {
+    float length = std::sqrt(center[0] * center[0] + center[1] * center[1] + center[2] * center[2]);
+    if(m_Entries.empty() || !(length > 0.0f))
+    {
+      return;
+    }
+    double r = static_cast<double>(radius) + k_Margin;
+    double theta = std::acos(std::min(std::max(static_cast<double>(center[2] / length), -1.0), 1.0));
+
+    size_t firstBand = zBand(std::cos(std::min(theta + r, k_Pi)));
+    size_t lastBand = zBand(std::cos(std::max(theta - r, 0.0)));
+
+    // The azimuth range of a cap that contains neither pole is at most asin(sin(r) / sin(theta)) either side
+    // of the azimuth of its center
+    ptrdiff_t numAzimuthCells = static_cast<ptrdiff_t>(m_NumAzimuthCells);
+    ptrdiff_t firstSector = 0;
+    ptrdiff_t lastSector = numAzimuthCells - 1;
+    if(theta - r > 0.0 && theta + r < k_Pi)
+    {
+      double ratio = std::sin(r) / std::sin(theta);
+      if(ratio < 1.0)
+      {
+        double halfWidth = std::asin(ratio);
+        double phi = std::atan2(static_cast<double>(center[1]), static_cast<double>(center[0]));
+        ptrdiff_t first = static_cast<ptrdiff_t>(std::floor((phi - halfWidth + k_Pi) * m_AzimuthScale));
+        ptrdiff_t last = static_cast<ptrdiff_t>(std::floor((phi + halfWidth + k_Pi) * m_AzimuthScale));
+        if(last - first + 1 < numAzimuthCells)
+        {
+          firstSector = first;
+          lastSector = last;
+        }
+      }
+    }
+
+    for(size_t band = firstBand; band <= lastBand; band++)
+    {
+      size_t bandOffset = band * m_NumAzimuthCells;
+      for(ptrdiff_t sector = firstSector; sector <= lastSector; sector++)
+      {
+        size_t cell = bandOffset + static_cast<size_t>((sector % numAzimuthCells + numAzimuthCells) % numAzimuthCells);
+        for(size_t e = m_CellOffsets[cell]; e < m_CellOffsets[cell + 1]; e++)
+        {
+          func(m_Entries[e]);
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Returns the number of cells in the grid
+   */
+  size_t getNumberOfCells() const;
+
+private:
+  static constexpr double k_Pi = 3.14159265358979323846;
+  // Extra angle added to every query so rounding in the binning can never drop an entry
+  static constexpr double k_Margin = 1.0E-3;
+
+  size_t m_NumZBands = 1;
+  size_t m_NumAzimuthCells = 1;
+  double m_AzimuthScale = 0.0;
+  std::vector<size_t> m_CellOffsets;
+  std::vector<size_t> m_Entries;
+
+  size_t zBand(double z) const
+  {
+    double band = std::floor((z + 1.0) * 0.5 * static_cast<double>(m_NumZBands));
+    return static_cast<size_t>(std::min(std::max(band, 0.0), static_cast<double>(m_NumZBands - 1)));
+  }
+
+  size_t azimuthCell(double x, double y) const
+  {
+    double sector = std::floor((std::atan2(y, x) + k_Pi) * m_AzimuthScale);
+    return static_cast<size_t>(std::min(std::max(sector, 0.0), static_cast<double>(m_NumAzimuthCells - 1)));
+  }
+
+public:
+  SphericalNormalIndex(const SphericalNormalIndex&) = delete;            // Copy Constructor Not Implemented
+  SphericalNormalIndex(SphericalNormalIndex&&) = delete;                 // Move Constructor Not Implemented
+  SphericalNormalIndex& operator=(const SphericalNormalIndex&) = delete; // Copy Assignment Not Implemented
+  SphericalNormalIndex& operator=(SphericalNormalIndex&&) = delete;      // Move Assignment Not Implemented
+};
@@ -31,6 +31,9 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ImportEbsdMontage.h"
 
+#include <set>
+#include <vector>
+
 #include <QtCore/QFileInfo>
 #include <QtCore/QTextStream>
 
@@ -43,15 +46,18 @@
 #include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatVec2FilterParameter.h"
 #include "SIMPLib/FilterParameters/IntVec2FilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
+#include "SIMPLib/FilterParameters/OutputPathFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Montages/GridMontage.h"
 #include "SIMPLib/Utilities/FilePathGenerator.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "OrientationAnalysis/FilterParameters/EbsdMontageImportFilterParameter.h"
 #include "OrientationAnalysis/OrientationAnalysisConstants.h"
@@ -118,6 +124,13 @@ void ImportEbsdMontage::setupFilterParameters()
     parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Generate IPF Color Map", GenerateIPFColorMap, FilterParameter::Category::Parameter, ImportEbsdMontage, linkedProps));
     parameters.push_back(SIMPL_NEW_STRING_FP("IPF Colors", CellIPFColorsArrayName, FilterParameter::Category::CreatedArray, ImportEbsdMontage));
   }
+
+  {
+    std::vector<QString> linkedProps = {"ParseCacheDirectory", "VerifyParseCacheContents"};
+    parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Parse Cache", UseParseCache, FilterParameter::Category::Parameter, ImportEbsdMontage, linkedProps));
+    parameters.push_back(SIMPL_NEW_OUTPUT_PATH_FP("Parse Cache Directory", ParseCacheDirectory, FilterParameter::Category::Parameter, ImportEbsdMontage));
+    parameters.push_back(SIMPL_NEW_BOOL_FP("Verify Parse Cache Contents", VerifyParseCacheContents, FilterParameter::Category::Parameter, ImportEbsdMontage));
+  }
   setFilterParameters(parameters);
 }
 
@@ -125,18 +138,11 @@ void ImportEbsdMontage::setupFilterParameters()
 //
 // -----------------------------------------------------------------------------
 template <class EbsdReaderClass>
-void readEbsdFile(ImportEbsdMontage* filter, const QString& fileName, std::map<QString, AbstractFilter::Pointer>& prevFilterCache, std::map<QString, AbstractFilter::Pointer>& newFilterCache)
+AbstractFilter::Pointer prepareEbsdReader(ImportEbsdMontage* filter, const QString& fileName, std::map<QString, AbstractFilter::Pointer>& prevFilterCache,
+                                          std::map<QString, AbstractFilter::Pointer>& newFilterCache)
 {
   QFileInfo fi(fileName);
   QString fname = fi.completeBaseName();
-  if(filter->getDataContainerArray()->doesDataContainerExist(fname))
-  {
-    QString msg = QString("Error: DataContainer '%1' already exists in the DataContainerArray.").arg(fname);
-    filter->setErrorCondition(-74000, msg);
-    return;
-  }
-
-  DataContainerArray::Pointer dca = DataContainerArray::New();
 
   typename EbsdReaderClass::Pointer reader = EbsdReaderClass::NullPointer();
   if(prevFilterCache.find(fileName) != prevFilterCache.end())
@@ -150,27 +156,51 @@ void readEbsdFile(ImportEbsdMontage* filter, const QString& fileName, std::map<Q
     reader->setDataContainerName(DataArrayPath(fname));
   }
   newFilterCache[fileName] = reader;
-  reader->setDataContainerArray(dca);
+  reader->setDataContainerArray(DataContainerArray::New());
   reader->setCellEnsembleAttributeMatrixName(filter->getCellEnsembleAttributeMatrixName());
   reader->setCellAttributeMatrixName(filter->getCellAttributeMatrixName());
-  if(filter->getInPreflight())
+  reader->setUseParseCache(filter->getUseParseCache());
+  reader->setParseCacheDirectory(filter->getParseCacheDirectory());
+  reader->setVerifyParseCacheContents(filter->getVerifyParseCacheContents());
+  return reader;
+}
+
+/**
+ * @brief The ReadEbsdTilesImpl class runs the reader filters of a range of tiles. Each reader owns its own
+ * DataContainerArray so the tiles can be read concurrently.
+ */
+class ReadEbsdTilesImpl
+{
+public:
+  ReadEbsdTilesImpl(ImportEbsdMontage* filter, const std::vector<AbstractFilter::Pointer>& readers)
+  : m_Filter(filter)
+  , m_Readers(readers)
   {
-    reader->preflight();
   }
-  else
-  {
-    reader->execute();
-  }
-  if(reader->getErrorCode() < 0)
+
+  void operator()(const SIMPLRange& range) const
   {
-    QString msg = QString("Sub filter (%1) caused an error.").arg(reader->getHumanLabel());
-    filter->setErrorCondition(reader->getErrorCode(), msg);
-    return;
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      if(m_Filter->getCancel())
+      {
+        return;
+      }
+      if(m_Filter->getInPreflight())
+      {
+        m_Readers[i]->preflight();
+      }
+      else
+      {
+        m_Readers[i]->execute();
+      }
+    }
   }
 
-  DataContainer::Pointer dc = dca->getDataContainer(fname);
-  filter->getDataContainerArray()->addOrReplaceDataContainer(dc);
-}
+private:
+  ImportEbsdMontage* m_Filter;
+  const std::vector<AbstractFilter::Pointer>& m_Readers;
+};
 
 // -----------------------------------------------------------------------------
 //
@@ -237,13 +267,15 @@ void ImportEbsdMontage::dataCheck()
   size_t cols = static_cast<size_t>(m_InputFileListInfo.ColEnd - m_InputFileListInfo.ColStart);
   GridMontage::Pointer gridMontage = GridMontage::New(getMontageName(), rows, cols);
 
-  // Read all the files, caching the pertainent information....
+  // Set up a reader for every tile first, then read the tiles concurrently. Each tile is read into its own
+  // DataContainerArray and only moved into ours once every reader has finished.
+  std::vector<AbstractFilter::Pointer> readers;
+  std::vector<QString> tileNames;
+  std::set<QString> usedNames;
   for(const FilePathGenerator::TileRCIndexRow2D& tileRow2D : tileLayout2d)
   {
-    globalTileOrigin[0] = 0.0; // Reset the X Coord back to Zero for each row.
     for(const FilePathGenerator::TileRCIndex2D& tile2D : tileRow2D)
     {
-      tilesRead++;
       QFileInfo fi(tile2D.FileName);
       QString fname = fi.completeBaseName();
       if(!fi.exists())
@@ -252,28 +284,61 @@ void ImportEbsdMontage::dataCheck()
         setErrorCondition(-56500, msg);
         continue;
       }
-      if(getInPreflight())
-      {
-        QString msg = QString("Caching EBSD Header: [%1/%2] %3").arg(tilesRead).arg(totalTiles).arg(tile2D.FileName);
-        notifyStatusMessage(msg);
-      }
-      else
+      if(getDataContainerArray()->doesDataContainerExist(fname) || usedNames.find(fname) != usedNames.end())
       {
-        QString msg = QString("Read EBSD File: [%1/%2] %3").arg(tilesRead).arg(totalTiles).arg(tile2D.FileName);
-        notifyStatusMessage(msg);
+        QString msg = QString("Error: DataContainer '%1' already exists in the DataContainerArray.").arg(fname);
+        setErrorCondition(-74000, msg);
+        continue;
       }
-      GridTileIndex gridIndex = gridMontage->getTileIndex(tile2D.data[0], tile2D.data[1]);
+      usedNames.insert(fname);
 
+      AbstractFilter::Pointer reader;
       if(m_InputFileListInfo.FileExtension == S2Q(EbsdLib::Ang::FileExt))
       {
-        readEbsdFile<ReadAngData>(this, tile2D.FileName, m_FilterCache, newFilterCache);
+        reader = prepareEbsdReader<ReadAngData>(this, tile2D.FileName, m_FilterCache, newFilterCache);
       }
       if(m_InputFileListInfo.FileExtension == S2Q(EbsdLib::Ctf::FileExt))
       {
-        readEbsdFile<ReadCtfData>(this, tile2D.FileName, m_FilterCache, newFilterCache);
+        reader = prepareEbsdReader<ReadCtfData>(this, tile2D.FileName, m_FilterCache, newFilterCache);
+      }
+      if(nullptr != reader)
+      {
+        readers.push_back(reader);
+        tileNames.push_back(fname);
       }
     }
   }
+
+  if(getInPreflight())
+  {
+    notifyStatusMessage(QString("Caching EBSD Headers: %1 tiles").arg(totalTiles));
+  }
+  else
+  {
+    notifyStatusMessage(QString("Reading EBSD Files: %1 tiles").arg(totalTiles));
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, readers.size());
+  dataAlg.setGrain(1);
+  dataAlg.execute(ReadEbsdTilesImpl(this, readers));
+  if(getCancel())
+  {
+    return;
+  }
+
+  for(size_t i = 0; i < readers.size(); i++)
+  {
+    if(readers[i]->getErrorCode() < 0)
+    {
+      QString msg = QString("Sub filter (%1) caused an error.").arg(readers[i]->getHumanLabel());
+      setErrorCondition(readers[i]->getErrorCode(), msg);
+      continue;
+    }
+    tilesRead++;
+    DataContainer::Pointer dc = readers[i]->getDataContainerArray()->getDataContainer(tileNames[i]);
+    getDataContainerArray()->addOrReplaceDataContainer(dc);
+  }
   // If anything went wrong bail out now.....
   if(getErrorCode() < 0)
   {
@@ -690,3 +755,39 @@ IntVec2Type ImportEbsdMontage::getScanOverlapPixel() const
 {
   return m_ScanOverlapPixel;
 }
+
+// -----------------------------------------------------------------------------
+void ImportEbsdMontage::setUseParseCache(bool value)
+{
+  m_UseParseCache = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ImportEbsdMontage::getUseParseCache() const
+{
+  return m_UseParseCache;
+}
+
+// -----------------------------------------------------------------------------
+void ImportEbsdMontage::setParseCacheDirectory(const QString& value)
+{
+  m_ParseCacheDirectory = value;
+}
+
+// -----------------------------------------------------------------------------
+QString ImportEbsdMontage::getParseCacheDirectory() const
+{
+  return m_ParseCacheDirectory;
+}
+
+// -----------------------------------------------------------------------------
+void ImportEbsdMontage::setVerifyParseCacheContents(bool value)
+{
+  m_VerifyParseCacheContents = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ImportEbsdMontage::getVerifyParseCacheContents() const
+{
+  return m_VerifyParseCacheContents;
+}
@@ -69,6 +69,9 @@ class OrientationAnalysis_EXPORT ImportEbsdMontage : public AbstractFilter
   PYB11_PROPERTY(QString CellIPFColorsArrayName READ getCellIPFColorsArrayName WRITE setCellIPFColorsArrayName)
   PYB11_PROPERTY(int32_t DefineScanOverlap READ getDefineScanOverlap WRITE setDefineScanOverlap)
   PYB11_PROPERTY(FloatVec2Type ScanOverlapPercent READ getScanOverlapPercent WRITE setScanOverlapPercent)
+  PYB11_PROPERTY(bool UseParseCache READ getUseParseCache WRITE setUseParseCache)
+  PYB11_PROPERTY(QString ParseCacheDirectory READ getParseCacheDirectory WRITE setParseCacheDirectory)
+  PYB11_PROPERTY(bool VerifyParseCacheContents READ getVerifyParseCacheContents WRITE setVerifyParseCacheContents)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -220,6 +223,39 @@ public:
   IntVec2Type getScanOverlapPixel() const;
   Q_PROPERTY(IntVec2Type ScanOverlapPixel READ getScanOverlapPixel WRITE setScanOverlapPixel)
 
+  /**
+   * @brief Setter property for UseParseCache
+   */
+  void setUseParseCache(bool value);
+  /**
+   * @brief Getter property for UseParseCache
+   * @return Value of UseParseCache
+   */
+  bool getUseParseCache() const;
+  Q_PROPERTY(bool UseParseCache READ getUseParseCache WRITE setUseParseCache)
+
+  /**
+   * @brief Setter property for ParseCacheDirectory
+   */
+  void setParseCacheDirectory(const QString& value);
+  /**
+   * @brief Getter property for ParseCacheDirectory
+   * @return Value of ParseCacheDirectory
+   */
+  QString getParseCacheDirectory() const;
+  Q_PROPERTY(QString ParseCacheDirectory READ getParseCacheDirectory WRITE setParseCacheDirectory)
+
+  /**
+   * @brief Setter property for VerifyParseCacheContents
+   */
+  void setVerifyParseCacheContents(bool value);
+  /**
+   * @brief Getter property for VerifyParseCacheContents
+   * @return Value of VerifyParseCacheContents
+   */
+  bool getVerifyParseCacheContents() const;
+  Q_PROPERTY(bool VerifyParseCacheContents READ getVerifyParseCacheContents WRITE setVerifyParseCacheContents)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -301,6 +337,9 @@ private:
   OverlapType m_DefineScanOverlap = OverlapType::None;
   FloatVec2Type m_ScanOverlapPercent = {0.0f, 0.0f};
   IntVec2Type m_ScanOverlapPixel = {0, 0};
+  bool m_UseParseCache = false;
+  QString m_ParseCacheDirectory = {""};
+  bool m_VerifyParseCacheContents = false;
 
   std::map<QString, AbstractFilter::Pointer> m_FilterCache;
   FloatVec3Type m_ReferenceDir = {0.0f, 0.0f, 1.0f};
@@ -54,6 +54,7 @@
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 
+#include "OrientationAnalysis/OrientationAnalysisFilters/EbsdHelpers/EbsdArrayTransfer.hpp"
 #include "OrientationAnalysis/OrientationAnalysisVersion.h"
 
 enum createdPathID : RenameDataPath::DataID_t
@@ -626,12 +627,18 @@ template <typename T, class Reader>
 void copyPointerData(Reader* reader, const std::string& name, const IDataArray::Pointer& dataArray, size_t offset, size_t totalPoints, AttributeMatrix::Pointer& ebsdAttrMat)
 {
   using DataArrayType = DataArray<T>;
-  // Copy Array from Reader into DataArray<>
-  T* ptr = reinterpret_cast<T*>(reader->getPointerByName(name));
   typename DataArrayType::Pointer fArray = std::dynamic_pointer_cast<DataArrayType>(dataArray);
-  typename DataArrayType::Pointer freshArray = DataArrayType::WrapPointer(ptr, totalPoints, fArray->getComponentDimensions(), fArray->getName(), true);
-  reader->releaseOwnership(name);
-  ebsdAttrMat->insertOrAssign(freshArray);
+  size_t numTuples = fArray->getNumberOfTuples();
+  if(numTuples < offset + totalPoints || (offset == 0 && numTuples == totalPoints))
+  {
+    // The array holds just this scan, so take over the reader's buffer instead of copying it
+    ebsdAttrMat->insertOrAssign(EbsdArrayTransfer::AdoptReaderArray<T>(reader, name, totalPoints, fArray->getComponentDimensions(), fArray->getName()));
+    return;
+  }
+  // Several scans are stacked into the array; copy this one into its slot
+  T* ptr = reinterpret_cast<T*>(reader->getPointerByName(name));
+  ::memcpy(fArray->getTuplePointer(offset), ptr, sizeof(T) * totalPoints * fArray->getNumberOfComponents());
+  ebsdAttrMat->insertOrAssign(fArray);
 }
 
 // -----------------------------------------------------------------------------
@@ -683,14 +690,7 @@ void ImportH5EspritData::copyRawEbsdData(EbsdReader* ebsdReader, std::vector<siz
     auto f3 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::H5Esprit::phi2));
     cDims[0] = 3;
     fArray = std::dynamic_pointer_cast<FloatArrayType>(ebsdArrayMap.value(SIMPL::CellData::EulerAngles));
-    float* cellEulerAngles = fArray->getTuplePointer(offset);
-
-    for(size_t i = 0; i < totalPoints; i++)
-    {
-      cellEulerAngles[3 * i] = f1[i] * degToRad;
-      cellEulerAngles[3 * i + 1] = f2[i] * degToRad;
-      cellEulerAngles[3 * i + 2] = f3[i] * degToRad;
-    }
+    EbsdArrayTransfer::InterleaveEulers(f1, f2, f3, fArray->getTuplePointer(offset), nullptr, nullptr, degToRad, totalPoints);
     ebsdAttrMat->insertOrAssign(fArray);
   }
   else
@@ -699,11 +699,12 @@ void ImportH5EspritData::copyRawEbsdData(EbsdReader* ebsdReader, std::vector<siz
     auto f1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::H5Esprit::phi1));
     auto f2 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::H5Esprit::PHI));
     auto f3 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::H5Esprit::phi2));
+    // The columns are handed over to the DataArrays below, so they are converted in place
     for(size_t i = 0; i < totalPoints; i++)
     {
-      f1[3 * i] = f1[i] * degToRad;
-      f2[3 * i + 1] = f2[i] * degToRad;
-      f3[3 * i + 2] = f3[i] * degToRad;
+      f1[i] = f1[i] * degToRad;
+      f2[i] = f2[i] * degToRad;
+      f3[i] = f3[i] * degToRad;
     }
 
     copyPointerData<EbsdLib::H5Esprit::phi1_t, H5EspritReader>(reader, EbsdLib::H5Esprit::phi1, ebsdArrayMap.value(S2Q(EbsdLib::H5Esprit::phi1)), offset, totalPoints, ebsdAttrMat);
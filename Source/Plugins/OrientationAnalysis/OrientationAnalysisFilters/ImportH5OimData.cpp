@@ -62,6 +62,7 @@
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 #include "OrientationAnalysis/FilterParameters/OEMEbsdScanSelectionFilterParameter.h"
+#include "OrientationAnalysis/OrientationAnalysisFilters/EbsdHelpers/EbsdArrayTransfer.hpp"
 #include "OrientationAnalysis/OrientationAnalysisVersion.h"
 
 enum createdPathID : RenameDataPath::DataID_t
@@ -521,15 +522,9 @@ void ImportH5OimData::copyRawEbsdData(EbsdReader* ebsdReader, std::vector<size_t
 
   size_t offset = index * totalPoints;
 
-  // Adjust the values of the 'phase' data to correct for invalid values
+  // Copy the phases of this scan into place; invalid values are corrected in the pass that condenses the Euler angles so the
+  // reader's buffer is left untouched
   phasePtr = reinterpret_cast<int32_t*>(reader->getPointerByName(EbsdLib::Ang::PhaseData));
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    if(phasePtr[i] < 1)
-    {
-      phasePtr[i] = 1;
-    }
-  }
   iArray = std::dynamic_pointer_cast<Int32ArrayType>(m_EbsdArrayMap.value(SIMPL::CellData::Phases));
   ::memcpy(iArray->getPointer(offset), phasePtr, sizeof(int32_t) * totalPoints);
   ebsdAttrMat->insertOrAssign(iArray);
@@ -541,14 +536,7 @@ void ImportH5OimData::copyRawEbsdData(EbsdReader* ebsdReader, std::vector<size_t
     f3 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi2));
     cDims[0] = 3;
     fArray = std::dynamic_pointer_cast<FloatArrayType>(m_EbsdArrayMap.value(SIMPL::CellData::EulerAngles));
-    float* cellEulerAngles = fArray->getTuplePointer(offset);
-
-    for(size_t i = 0; i < totalPoints; i++)
-    {
-      cellEulerAngles[3 * i] = f1[i];
-      cellEulerAngles[3 * i + 1] = f2[i];
-      cellEulerAngles[3 * i + 2] = f3[i];
-    }
+    EbsdArrayTransfer::InterleaveEulers(f1, f2, f3, fArray->getTuplePointer(offset), iArray->getPointer(offset), nullptr, 1.0, totalPoints);
     ebsdAttrMat->insertOrAssign(fArray);
   }
 
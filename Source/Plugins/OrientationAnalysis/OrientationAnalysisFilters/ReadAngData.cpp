@@ -43,9 +43,12 @@
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
+#include "SIMPLib/FilterParameters/OutputPathFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
@@ -54,6 +57,8 @@
 #include "EbsdLib/IO/TSL/AngFields.h"
 
 #include "OrientationAnalysis/OrientationAnalysisConstants.h"
+#include "OrientationAnalysis/OrientationAnalysisFilters/EbsdHelpers/EbsdArrayTransfer.hpp"
+#include "OrientationAnalysis/OrientationAnalysisFilters/EbsdHelpers/EbsdParseCache.h"
 #include "OrientationAnalysis/OrientationAnalysisVersion.h"
 
 enum createdPathID : RenameDataPath::DataID_t
@@ -155,6 +160,10 @@ void ReadAngData::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
   parameters.push_back(SIMPL_NEW_INPUT_FILE_FP("Input File", InputFile, FilterParameter::Category::Parameter, ReadAngData, "*.ang"));
+  std::vector<QString> linkedProps = {"ParseCacheDirectory", "VerifyParseCacheContents"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Parse Cache", UseParseCache, FilterParameter::Category::Parameter, ReadAngData, linkedProps));
+  parameters.push_back(SIMPL_NEW_OUTPUT_PATH_FP("Parse Cache Directory", ParseCacheDirectory, FilterParameter::Category::Parameter, ReadAngData));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Verify Parse Cache Contents", VerifyParseCacheContents, FilterParameter::Category::Parameter, ReadAngData));
   parameters.push_back(SIMPL_NEW_DC_CREATION_FP("Data Container", DataContainerName, FilterParameter::Category::CreatedArray, ReadAngData));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_AM_WITH_LINKED_DC_FP("Cell Attribute Matrix", CellAttributeMatrixName, DataContainerName, FilterParameter::Category::CreatedArray, ReadAngData));
@@ -173,6 +182,9 @@ void ReadAngData::readFilterParameters(AbstractFilterParametersReader* reader, i
   setCellAttributeMatrixName(reader->readString("CellAttributeMatrixName", getCellAttributeMatrixName()));
   setCellEnsembleAttributeMatrixName(reader->readString("CellEnsembleAttributeMatrixName", getCellEnsembleAttributeMatrixName()));
   setInputFile(reader->readString("InputFile", getInputFile()));
+  setUseParseCache(reader->readValue("UseParseCache", getUseParseCache()));
+  setParseCacheDirectory(reader->readString("ParseCacheDirectory", getParseCacheDirectory()));
+  setVerifyParseCacheContents(reader->readValue("VerifyParseCacheContents", getVerifyParseCacheContents()));
   reader->closeFilterGroup();
 }
 
@@ -220,6 +232,13 @@ void ReadAngData::dataCheck()
     return;
   }
 
+  if(m_UseParseCache && m_ParseCacheDirectory.isEmpty())
+  {
+    QString ss = QObject::tr("The parse cache directory must be set when the parse cache is used");
+    setErrorCondition(-389, ss);
+    return;
+  }
+
   // Reading the header worked, now start setting up our DataContainer
   DataContainer::Pointer m = getDataContainerArray()->createNonPrereqDataContainer(this, getDataContainerName(), DataContainerID);
   if(getErrorCode() < 0)
@@ -512,14 +531,6 @@ int32_t ReadAngData::loadMaterialInfo(AngReader* reader)
 // -----------------------------------------------------------------------------
 void ReadAngData::copyRawEbsdData(AngReader* reader, std::vector<size_t>& tDims, std::vector<size_t>& cDims)
 {
-  float* f1 = nullptr;
-  float* f2 = nullptr;
-  float* f3 = nullptr;
-  int* phasePtr = nullptr;
-
-  FloatArrayType::Pointer fArray = FloatArrayType::NullPointer();
-  Int32ArrayType::Pointer iArray = Int32ArrayType::NullPointer();
-
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
   AttributeMatrix::Pointer ebsdAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
 
@@ -532,81 +543,28 @@ void ReadAngData::copyRawEbsdData(AngReader* reader, std::vector<size_t>& tDims,
   tDims[2] = m->getGeometryAs<ImageGeom>()->getZPoints();
   ebsdAttrMat->resizeAttributeArrays(tDims);
 
-  // Adjust the values of the 'phase' data to correct for invalid values
-  {
-    phasePtr = reinterpret_cast<int32_t*>(reader->getPointerByName(EbsdLib::Ang::PhaseData));
-    for(size_t i = 0; i < totalPoints; i++)
-    {
-      if(phasePtr[i] < 1)
-      {
-        phasePtr[i] = 1;
-      }
-    }
-    iArray = Int32ArrayType::CreateArray(tDims, cDims, SIMPL::CellData::Phases, true);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    ebsdAttrMat->insertOrAssign(iArray);
-  }
+  // The scalar columns are handed over from the reader to the DataArrays instead of being copied
+  Int32ArrayType::Pointer iArray = EbsdArrayTransfer::AdoptReaderArray<int32_t>(reader, EbsdLib::Ang::PhaseData, totalPoints, cDims, SIMPL::CellData::Phases);
+  ebsdAttrMat->insertOrAssign(iArray);
 
-  // Condense the Euler Angles from 3 separate arrays into a single 1x3 array
+  // Condense the Euler Angles from 3 separate arrays into a single 1x3 array and correct invalid phase values in the same pass
   {
-    f1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi1));
-    f2 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi));
-    f3 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi2));
+    float* f1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi1));
+    float* f2 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi));
+    float* f3 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi2));
     cDims[0] = 3;
-    fArray = FloatArrayType::CreateArray(tDims, cDims, SIMPL::CellData::EulerAngles, true);
-    float* cellEulerAngles = fArray->getPointer(0);
-
-    for(size_t i = 0; i < totalPoints; i++)
-    {
-      cellEulerAngles[3 * i] = f1[i];
-      cellEulerAngles[3 * i + 1] = f2[i];
-      cellEulerAngles[3 * i + 2] = f3[i];
-    }
+    FloatArrayType::Pointer fArray = FloatArrayType::CreateArray(tDims, cDims, SIMPL::CellData::EulerAngles, true);
+    EbsdArrayTransfer::InterleaveEulers(f1, f2, f3, fArray->getPointer(0), iArray->getPointer(0), nullptr, 1.0, totalPoints);
     ebsdAttrMat->insertOrAssign(fArray);
   }
 
   cDims[0] = 1;
-  {
-    f1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::ImageQuality));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, S2Q(EbsdLib::Ang::ImageQuality), true);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->insertOrAssign(fArray);
-  }
-
-  {
-    f1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::ConfidenceIndex));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, S2Q(EbsdLib::Ang::ConfidenceIndex), true);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->insertOrAssign(fArray);
-  }
-
-  {
-    f1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::SEMSignal));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, S2Q(EbsdLib::Ang::SEMSignal), true);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->insertOrAssign(fArray);
-  }
-
-  {
-    f1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Fit));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, S2Q(EbsdLib::Ang::Fit), true);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->insertOrAssign(fArray);
-  }
-
-  {
-    f1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::XPosition));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, S2Q(EbsdLib::Ang::XPosition), true);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->insertOrAssign(fArray);
-  }
-
-  {
-    f1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::YPosition));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, S2Q(EbsdLib::Ang::YPosition), true);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->insertOrAssign(fArray);
-  }
+  ebsdAttrMat->insertOrAssign(EbsdArrayTransfer::AdoptReaderArray<float>(reader, EbsdLib::Ang::ImageQuality, totalPoints, cDims, S2Q(EbsdLib::Ang::ImageQuality)));
+  ebsdAttrMat->insertOrAssign(EbsdArrayTransfer::AdoptReaderArray<float>(reader, EbsdLib::Ang::ConfidenceIndex, totalPoints, cDims, S2Q(EbsdLib::Ang::ConfidenceIndex)));
+  ebsdAttrMat->insertOrAssign(EbsdArrayTransfer::AdoptReaderArray<float>(reader, EbsdLib::Ang::SEMSignal, totalPoints, cDims, S2Q(EbsdLib::Ang::SEMSignal)));
+  ebsdAttrMat->insertOrAssign(EbsdArrayTransfer::AdoptReaderArray<float>(reader, EbsdLib::Ang::Fit, totalPoints, cDims, S2Q(EbsdLib::Ang::Fit)));
+  ebsdAttrMat->insertOrAssign(EbsdArrayTransfer::AdoptReaderArray<float>(reader, EbsdLib::Ang::XPosition, totalPoints, cDims, S2Q(EbsdLib::Ang::XPosition)));
+  ebsdAttrMat->insertOrAssign(EbsdArrayTransfer::AdoptReaderArray<float>(reader, EbsdLib::Ang::YPosition, totalPoints, cDims, S2Q(EbsdLib::Ang::YPosition)));
 }
 
 // -----------------------------------------------------------------------------
@@ -627,6 +585,20 @@ void ReadAngData::execute()
   AttributeMatrix::Pointer ebsdAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
   ebsdAttrMat->setType(AttributeMatrix::Type::Cell);
 
+  // A valid parse cache file replaces the parsing of the data columns. The header still comes from the .ang file.
+  EbsdParseCache parseCache(m_ParseCacheDirectory, m_InputFile, "ang");
+  parseCache.setVerifyContents(m_VerifyParseCacheContents);
+  if(m_UseParseCache && parseCache.load(ebsdAttrMat.get()))
+  {
+    readDataFile(reader.get(), m.get(), tDims, ANG_HEADER_ONLY);
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+    loadMaterialInfo(reader.get());
+    return;
+  }
+
   readDataFile(reader.get(), m.get(), tDims, ANG_FULL_FILE);
   if(getErrorCode() < 0)
   {
@@ -634,6 +606,12 @@ void ReadAngData::execute()
   }
   copyRawEbsdData(reader.get(), tDims, cDims);
 
+  if(m_UseParseCache && !parseCache.store(ebsdAttrMat.get()))
+  {
+    QString ss = QObject::tr("The parse cache file '%1' could not be written").arg(parseCache.getCacheFilePath());
+    setWarningCondition(-390, ss);
+  }
+
   // Set the file name and time stamp into the cache, if we are reading from the file and after all the reading has been done
   {
     QFileInfo newFi(m_InputFile);
@@ -820,6 +798,42 @@ QString ReadAngData::getInputFile() const
   return m_InputFile;
 }
 
+// -----------------------------------------------------------------------------
+void ReadAngData::setUseParseCache(bool value)
+{
+  m_UseParseCache = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ReadAngData::getUseParseCache() const
+{
+  return m_UseParseCache;
+}
+
+// -----------------------------------------------------------------------------
+void ReadAngData::setParseCacheDirectory(const QString& value)
+{
+  m_ParseCacheDirectory = value;
+}
+
+// -----------------------------------------------------------------------------
+QString ReadAngData::getParseCacheDirectory() const
+{
+  return m_ParseCacheDirectory;
+}
+
+// -----------------------------------------------------------------------------
+void ReadAngData::setVerifyParseCacheContents(bool value)
+{
+  m_VerifyParseCacheContents = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ReadAngData::getVerifyParseCacheContents() const
+{
+  return m_VerifyParseCacheContents;
+}
+
 // -----------------------------------------------------------------------------
 void ReadAngData::setRefFrameZDir(uint32_t value)
 {
@@ -48,13 +48,17 @@
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
+#include "SIMPLib/FilterParameters/OutputPathFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 
 #include "OrientationAnalysis/OrientationAnalysisConstants.h"
+#include "OrientationAnalysis/OrientationAnalysisFilters/EbsdHelpers/EbsdArrayTransfer.hpp"
+#include "OrientationAnalysis/OrientationAnalysisFilters/EbsdHelpers/EbsdParseCache.h"
 #include "OrientationAnalysis/OrientationAnalysisFilters/ChangeAngleRepresentation.h"
 #include "OrientationAnalysis/OrientationAnalysisVersion.h"
 
@@ -159,6 +163,10 @@ void ReadCtfData::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_INPUT_FILE_FP("Input File", InputFile, FilterParameter::Category::Parameter, ReadCtfData, "*.ctf"));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Convert Eulers to Radians", DegreesToRadians, FilterParameter::Category::Parameter, ReadCtfData));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Convert Hexagonal X-Axis to Edax Standard", EdaxHexagonalAlignment, FilterParameter::Category::Parameter, ReadCtfData));
+  std::vector<QString> linkedProps = {"ParseCacheDirectory", "VerifyParseCacheContents"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Parse Cache", UseParseCache, FilterParameter::Category::Parameter, ReadCtfData, linkedProps));
+  parameters.push_back(SIMPL_NEW_OUTPUT_PATH_FP("Parse Cache Directory", ParseCacheDirectory, FilterParameter::Category::Parameter, ReadCtfData));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Verify Parse Cache Contents", VerifyParseCacheContents, FilterParameter::Category::Parameter, ReadCtfData));
   parameters.push_back(SIMPL_NEW_DC_CREATION_FP("Data Container", DataContainerName, FilterParameter::Category::CreatedArray, ReadCtfData));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_AM_WITH_LINKED_DC_FP("Cell Attribute Matrix", CellAttributeMatrixName, DataContainerName, FilterParameter::Category::CreatedArray, ReadCtfData));
@@ -179,6 +187,9 @@ void ReadCtfData::readFilterParameters(AbstractFilterParametersReader* reader, i
   setCellAttributeMatrixName(reader->readString("CellAttributeMatrixName", getCellAttributeMatrixName()));
   setCellEnsembleAttributeMatrixName(reader->readString("CellEnsembleAttributeMatrixName", getCellEnsembleAttributeMatrixName()));
   setInputFile(reader->readString("InputFile", getInputFile()));
+  setUseParseCache(reader->readValue("UseParseCache", getUseParseCache()));
+  setParseCacheDirectory(reader->readString("ParseCacheDirectory", getParseCacheDirectory()));
+  setVerifyParseCacheContents(reader->readValue("VerifyParseCacheContents", getVerifyParseCacheContents()));
   reader->closeFilterGroup();
 }
 
@@ -238,6 +249,13 @@ void ReadCtfData::dataCheck()
     setErrorCondition(-1, ss);
   }
 
+  if(m_UseParseCache && m_ParseCacheDirectory.isEmpty())
+  {
+    QString ss = QObject::tr("The parse cache directory must be set when the parse cache is used");
+    setErrorCondition(-389, ss);
+    return;
+  }
+
   if(!m_InputFile.isEmpty()) // User set a filename, so lets check it
   {
     std::vector<size_t> tDims(3, 0);
@@ -495,14 +513,6 @@ int32_t ReadCtfData::loadMaterialInfo(CtfReader* reader)
 // -----------------------------------------------------------------------------
 void ReadCtfData::copyRawEbsdData(CtfReader* reader, std::vector<size_t>& tDims, std::vector<size_t>& cDims)
 {
-  float* f1 = nullptr;
-  float* f2 = nullptr;
-  float* f3 = nullptr;
-  int* phasePtr = nullptr;
-
-  FloatArrayType::Pointer fArray = FloatArrayType::NullPointer();
-  Int32ArrayType::Pointer iArray = Int32ArrayType::NullPointer();
-
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
   AttributeMatrix::Pointer ebsdAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
 
@@ -514,6 +524,11 @@ void ReadCtfData::copyRawEbsdData(CtfReader* reader, std::vector<size_t>& tDims,
   tDims[1] = m->getGeometryAs<ImageGeom>()->getYPoints();
   tDims[2] = m->getGeometryAs<ImageGeom>()->getZPoints();
   ebsdAttrMat->resizeAttributeArrays(tDims);
+
+  // The scalar columns are handed over from the reader to the DataArrays instead of being copied
+  std::vector<size_t> compDims(1, 1);
+  Int32ArrayType::Pointer iArray = EbsdArrayTransfer::AdoptReaderArray<int32_t>(reader, EbsdLib::Ctf::Phase, totalPoints, compDims, SIMPL::CellData::Phases);
+  ebsdAttrMat->insertOrAssign(iArray);
   {
     /* Take from H5CtfVolumeReader.cpp
      * For HKL OIM Files if there is a single phase then the value of the phase
@@ -522,99 +537,28 @@ void ReadCtfData::copyRawEbsdData(CtfReader* reader, std::vector<size_t>& tDims,
      * then those points are assigned a phase of zero.  Since those points can be identified
      * by other methods, the phase of these points should be changed to one since in the rest
      * of the reconstruction code we follow the convention that the lowest value is One (1)
-     * even if there is only a single phase. The next if statement converts all zeros to ones
-     * if there is a single phase in the OIM data.
+     * even if there is only a single phase. The phase values are corrected in the same
+     * pass that condenses the Euler angles below.
      */
-    phasePtr = reinterpret_cast<int32_t*>(reader->getPointerByName(EbsdLib::Ctf::Phase));
-    for(size_t i = 0; i < totalPoints; i++)
-    {
-      if(phasePtr[i] < 1)
-      {
-        phasePtr[i] = 1;
-      }
-    }
-    iArray = Int32ArrayType::CreateArray(totalPoints, SIMPL::CellData::Phases, true);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    ebsdAttrMat->insertOrAssign(iArray);
-  }
-  {
-    //  radianconversion = M_PI / 180.0;
-    f1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler1));
-    f2 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler2));
-    f3 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler3));
+    float* f1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler1));
+    float* f2 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler2));
+    float* f3 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler3));
     std::vector<size_t> dims(1, 3);
-    fArray = FloatArrayType::CreateArray(totalPoints, dims, SIMPL::CellData::EulerAngles, true);
-    float* cellEulerAngles = fArray->getPointer(0);
-    int32_t* cellPhases = iArray->getPointer(0);
-
-    for(size_t i = 0; i < totalPoints; i++)
-    {
-      cellEulerAngles[3 * i] = f1[i];
-      cellEulerAngles[3 * i + 1] = f2[i];
-      cellEulerAngles[3 * i + 2] = f3[i];
-      if(m_CrystalStructures[cellPhases[i]] == EbsdLib::CrystalStructure::Hexagonal_High && m_EdaxHexagonalAlignment)
-      {
-        cellEulerAngles[3 * i + 2] = cellEulerAngles[3 * i + 2] + (30.0); // See the documentation for this correction factor
-      }
-      // Now convert to radians if requested by the user
-      if(m_DegreesToRadians)
-      {
-        cellEulerAngles[3 * i] = cellEulerAngles[3 * i] * SIMPLib::Constants::k_PiOver180D;
-        cellEulerAngles[3 * i + 1] = cellEulerAngles[3 * i + 1] * SIMPLib::Constants::k_PiOver180D;
-        cellEulerAngles[3 * i + 2] = cellEulerAngles[3 * i + 2] * SIMPLib::Constants::k_PiOver180D;
-      }
-    }
+    FloatArrayType::Pointer fArray = FloatArrayType::CreateArray(totalPoints, dims, SIMPL::CellData::EulerAngles, true);
+    // See the documentation for the hexagonal correction factor
+    const uint32_t* crystalStructures = m_EdaxHexagonalAlignment ? m_CrystalStructures : nullptr;
+    double scale = m_DegreesToRadians ? SIMPLib::Constants::k_PiOver180D : 1.0;
+    EbsdArrayTransfer::InterleaveEulers(f1, f2, f3, fArray->getPointer(0), iArray->getPointer(0), crystalStructures, scale, totalPoints);
     ebsdAttrMat->insertOrAssign(fArray);
   }
 
-  {
-    phasePtr = reinterpret_cast<int32_t*>(reader->getPointerByName(EbsdLib::Ctf::Bands));
-    iArray = Int32ArrayType::CreateArray(totalPoints, EbsdLib::Ctf::Bands, true);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    ebsdAttrMat->insertOrAssign(iArray);
-  }
-
-  {
-    phasePtr = reinterpret_cast<int32_t*>(reader->getPointerByName(EbsdLib::Ctf::Error));
-    iArray = Int32ArrayType::CreateArray(totalPoints, EbsdLib::Ctf::Error, true);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    ebsdAttrMat->insertOrAssign(iArray);
-  }
-
-  {
-    f1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::MAD));
-    fArray = FloatArrayType::CreateArray(totalPoints, EbsdLib::Ctf::MAD, true);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->insertOrAssign(fArray);
-  }
-
-  {
-    phasePtr = reinterpret_cast<int32_t*>(reader->getPointerByName(EbsdLib::Ctf::BC));
-    iArray = Int32ArrayType::CreateArray(totalPoints, EbsdLib::Ctf::BC, true);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    ebsdAttrMat->insertOrAssign(iArray);
-  }
-
-  {
-    phasePtr = reinterpret_cast<int32_t*>(reader->getPointerByName(EbsdLib::Ctf::BS));
-    iArray = Int32ArrayType::CreateArray(totalPoints, EbsdLib::Ctf::BS, true);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    ebsdAttrMat->insertOrAssign(iArray);
-  }
-
-  {
-    f1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::X));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, S2Q(EbsdLib::Ctf::X), true);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->insertOrAssign(fArray);
-  }
-
-  {
-    f1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Y));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, S2Q(EbsdLib::Ctf::Y), true);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->insertOrAssign(fArray);
-  }
+  ebsdAttrMat->insertOrAssign(EbsdArrayTransfer::AdoptReaderArray<int32_t>(reader, EbsdLib::Ctf::Bands, totalPoints, compDims, S2Q(EbsdLib::Ctf::Bands)));
+  ebsdAttrMat->insertOrAssign(EbsdArrayTransfer::AdoptReaderArray<int32_t>(reader, EbsdLib::Ctf::Error, totalPoints, compDims, S2Q(EbsdLib::Ctf::Error)));
+  ebsdAttrMat->insertOrAssign(EbsdArrayTransfer::AdoptReaderArray<float>(reader, EbsdLib::Ctf::MAD, totalPoints, compDims, S2Q(EbsdLib::Ctf::MAD)));
+  ebsdAttrMat->insertOrAssign(EbsdArrayTransfer::AdoptReaderArray<int32_t>(reader, EbsdLib::Ctf::BC, totalPoints, compDims, S2Q(EbsdLib::Ctf::BC)));
+  ebsdAttrMat->insertOrAssign(EbsdArrayTransfer::AdoptReaderArray<int32_t>(reader, EbsdLib::Ctf::BS, totalPoints, compDims, S2Q(EbsdLib::Ctf::BS)));
+  ebsdAttrMat->insertOrAssign(EbsdArrayTransfer::AdoptReaderArray<float>(reader, EbsdLib::Ctf::X, totalPoints, cDims, S2Q(EbsdLib::Ctf::X)));
+  ebsdAttrMat->insertOrAssign(EbsdArrayTransfer::AdoptReaderArray<float>(reader, EbsdLib::Ctf::Y, totalPoints, cDims, S2Q(EbsdLib::Ctf::Y)));
 }
 
 // -----------------------------------------------------------------------------
@@ -635,6 +579,22 @@ void ReadCtfData::execute()
   AttributeMatrix::Pointer ebsdAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
   ebsdAttrMat->setType(AttributeMatrix::Type::Cell);
 
+  // A valid parse cache file replaces the parsing of the data columns. The header still comes from the .ctf file.
+  // The Euler angles are stored after the conversions so both options are part of the cache key.
+  QString cacheVariant = QString("ctf:%1:%2").arg(static_cast<int>(m_DegreesToRadians)).arg(static_cast<int>(m_EdaxHexagonalAlignment));
+  EbsdParseCache parseCache(m_ParseCacheDirectory, m_InputFile, cacheVariant);
+  parseCache.setVerifyContents(m_VerifyParseCacheContents);
+  if(m_UseParseCache && parseCache.load(ebsdAttrMat.get()))
+  {
+    readDataFile(reader.get(), m.get(), tDims, CTF_HEADER_ONLY);
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+    loadMaterialInfo(reader.get());
+    return;
+  }
+
   readDataFile(reader.get(), m.get(), tDims, CTF_FULL_FILE);
   if(getErrorCode() < 0)
   {
@@ -643,6 +603,12 @@ void ReadCtfData::execute()
 
   copyRawEbsdData(reader.get(), tDims, cDims);
 
+  if(m_UseParseCache && !parseCache.store(ebsdAttrMat.get()))
+  {
+    QString ss = QObject::tr("The parse cache file '%1' could not be written").arg(parseCache.getCacheFilePath());
+    setWarningCondition(-390, ss);
+  }
+
   // Set the file name and time stamp into the cache, if we are reading from the file and after all the reading has been done
   {
     QFileInfo newFi(m_InputFile);
@@ -865,6 +831,42 @@ QString ReadCtfData::getInputFile() const
   return m_InputFile;
 }
 
+// -----------------------------------------------------------------------------
+void ReadCtfData::setUseParseCache(bool value)
+{
+  m_UseParseCache = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ReadCtfData::getUseParseCache() const
+{
+  return m_UseParseCache;
+}
+
+// -----------------------------------------------------------------------------
+void ReadCtfData::setParseCacheDirectory(const QString& value)
+{
+  m_ParseCacheDirectory = value;
+}
+
+// -----------------------------------------------------------------------------
+QString ReadCtfData::getParseCacheDirectory() const
+{
+  return m_ParseCacheDirectory;
+}
+
+// -----------------------------------------------------------------------------
+void ReadCtfData::setVerifyParseCacheContents(bool value)
+{
+  m_VerifyParseCacheContents = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ReadCtfData::getVerifyParseCacheContents() const
+{
+  return m_VerifyParseCacheContents;
+}
+
 // -----------------------------------------------------------------------------
 void ReadCtfData::setRefFrameZDir(uint32_t value)
 {
@@ -86,6 +86,9 @@ class OrientationAnalysis_EXPORT ReadCtfData : public AbstractFilter
   PYB11_PROPERTY(QString CellEnsembleAttributeMatrixName READ getCellEnsembleAttributeMatrixName WRITE setCellEnsembleAttributeMatrixName)
   PYB11_PROPERTY(QString CellAttributeMatrixName READ getCellAttributeMatrixName WRITE setCellAttributeMatrixName)
   PYB11_PROPERTY(QString InputFile READ getInputFile WRITE setInputFile)
+  PYB11_PROPERTY(bool UseParseCache READ getUseParseCache WRITE setUseParseCache)
+  PYB11_PROPERTY(QString ParseCacheDirectory READ getParseCacheDirectory WRITE setParseCacheDirectory)
+  PYB11_PROPERTY(bool VerifyParseCacheContents READ getVerifyParseCacheContents WRITE setVerifyParseCacheContents)
   PYB11_PROPERTY(bool DegreesToRadians READ getDegreesToRadians WRITE setDegreesToRadians)
   PYB11_PROPERTY(bool EdaxHexagonalAlignment READ getEdaxHexagonalAlignment WRITE setEdaxHexagonalAlignment)
   PYB11_END_BINDINGS()
@@ -220,6 +223,39 @@ public:
   QString getInputFile() const;
   Q_PROPERTY(QString InputFile READ getInputFile WRITE setInputFile)
 
+  /**
+   * @brief Setter property for UseParseCache
+   */
+  void setUseParseCache(bool value);
+  /**
+   * @brief Getter property for UseParseCache
+   * @return Value of UseParseCache
+   */
+  bool getUseParseCache() const;
+  Q_PROPERTY(bool UseParseCache READ getUseParseCache WRITE setUseParseCache)
+
+  /**
+   * @brief Setter property for ParseCacheDirectory
+   */
+  void setParseCacheDirectory(const QString& value);
+  /**
+   * @brief Getter property for ParseCacheDirectory
+   * @return Value of ParseCacheDirectory
+   */
+  QString getParseCacheDirectory() const;
+  Q_PROPERTY(QString ParseCacheDirectory READ getParseCacheDirectory WRITE setParseCacheDirectory)
+
+  /**
+   * @brief Setter property for VerifyParseCacheContents
+   */
+  void setVerifyParseCacheContents(bool value);
+  /**
+   * @brief Getter property for VerifyParseCacheContents
+   * @return Value of VerifyParseCacheContents
+   */
+  bool getVerifyParseCacheContents() const;
+  Q_PROPERTY(bool VerifyParseCacheContents READ getVerifyParseCacheContents WRITE setVerifyParseCacheContents)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -394,6 +430,9 @@ private:
   QString m_PhaseNameArrayName = {""};
   QString m_MaterialNameArrayName = {SIMPL::EnsembleData::MaterialName};
   QString m_InputFile = {""};
+  bool m_UseParseCache = {false};
+  QString m_ParseCacheDirectory = {""};
+  bool m_VerifyParseCacheContents = {false};
   uint32_t m_RefFrameZDir = {SIMPL::RefFrameZDir::UnknownRefFrameZDirection};
   EbsdLib::OEM m_Manufacturer = {EbsdLib::OEM::Unknown};
 
@@ -0,0 +1,306 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cstring>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QDebug>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "OrientationAnalysis/OrientationAnalysisFilters/EbsdHelpers/EbsdParseCache.h"
+#include "OrientationAnalysisTestFileLocations.h"
+
+/**
+ * @brief The EbsdParseCacheTest class stores the arrays of an attribute matrix in a parse cache file and checks
+ * that they load back unchanged, and that cache files that no longer match the input file or that were damaged
+ * are rejected without touching the attribute matrix.
+ */
+class EbsdParseCacheTest
+{
+  const size_t k_NumTuples = 12;
+  const QString k_EulersName = {"EulerAngles"};
+  const QString k_PhasesName = {"Phases"};
+
+  // Offset of CacheFileHeader::arrayCount inside the cache file: the 8 byte magic and the 4 byte version
+  const qint64 k_ArrayCountOffset = 12;
+
+public:
+  EbsdParseCacheTest() = default;
+  ~EbsdParseCacheTest() = default;
+  EbsdParseCacheTest(const EbsdParseCacheTest&) = delete;            // Copy Constructor Not Implemented
+  EbsdParseCacheTest(EbsdParseCacheTest&&) = delete;                 // Move Constructor Not Implemented
+  EbsdParseCacheTest& operator=(const EbsdParseCacheTest&) = delete; // Copy Assignment Not Implemented
+  EbsdParseCacheTest& operator=(EbsdParseCacheTest&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Returns the name of the class for EbsdParseCacheTest
+   */
+  QString getNameOfClass() const
+  {
+    return QString("EbsdParseCacheTest");
+  }
+
+  /**
+   * @brief Returns the name of the class for EbsdParseCacheTest
+   */
+  QString ClassName()
+  {
+    return QString("EbsdParseCacheTest");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::EbsdParseCacheTest::InputFile);
+    QDir(UnitTest::EbsdParseCacheTest::CacheDir).removeRecursively();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void writeInputFile(const QByteArray& contents)
+  {
+    QFile file(UnitTest::EbsdParseCacheTest::InputFile);
+    bool opened = file.open(QIODevice::WriteOnly | QIODevice::Truncate);
+    DREAM3D_REQUIRE_EQUAL(opened, true)
+    DREAM3D_REQUIRE_EQUAL(file.write(contents), contents.size())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AttributeMatrix::Pointer createParsedData()
+  {
+    std::vector<size_t> tDims = {k_NumTuples};
+    AttributeMatrix::Pointer attrMat = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+
+    std::vector<size_t> cDims = {3};
+    FloatArrayType::Pointer eulers = FloatArrayType::CreateArray(k_NumTuples, cDims, k_EulersName, true);
+    Int32ArrayType::Pointer phases = Int32ArrayType::CreateArray(k_NumTuples, k_PhasesName, true);
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      eulers->setComponent(i, 0, 0.25f * static_cast<float>(i));
+      eulers->setComponent(i, 1, 0.5f + static_cast<float>(i));
+      eulers->setComponent(i, 2, -0.125f * static_cast<float>(i));
+      phases->setValue(i, static_cast<int32_t>(i % 3) + 1);
+    }
+    attrMat->insertOrAssign(eulers);
+    attrMat->insertOrAssign(phases);
+    return attrMat;
+  }
+
+  // -----------------------------------------------------------------------------
+  // An attribute matrix as the reader creates it before the data columns are filled
+  // -----------------------------------------------------------------------------
+  AttributeMatrix::Pointer createEmptyData()
+  {
+    std::vector<size_t> tDims = {k_NumTuples};
+    return AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void requireSameData(AttributeMatrix* expected, AttributeMatrix* loaded)
+  {
+    DREAM3D_REQUIRE_EQUAL(loaded->getNumAttributeArrays(), expected->getNumAttributeArrays())
+
+    FloatArrayType::Pointer expectedEulers = std::dynamic_pointer_cast<FloatArrayType>(expected->getAttributeArray(k_EulersName));
+    FloatArrayType::Pointer loadedEulers = std::dynamic_pointer_cast<FloatArrayType>(loaded->getAttributeArray(k_EulersName));
+    DREAM3D_REQUIRE_VALID_POINTER(loadedEulers.get())
+    DREAM3D_REQUIRE_EQUAL(loadedEulers->getNumberOfComponents(), 3)
+    DREAM3D_REQUIRE_EQUAL(loadedEulers->getSize(), expectedEulers->getSize())
+    DREAM3D_REQUIRE(std::memcmp(loadedEulers->getPointer(0), expectedEulers->getPointer(0), expectedEulers->getSize() * sizeof(float)) == 0)
+
+    Int32ArrayType::Pointer expectedPhases = std::dynamic_pointer_cast<Int32ArrayType>(expected->getAttributeArray(k_PhasesName));
+    Int32ArrayType::Pointer loadedPhases = std::dynamic_pointer_cast<Int32ArrayType>(loaded->getAttributeArray(k_PhasesName));
+    DREAM3D_REQUIRE_VALID_POINTER(loadedPhases.get())
+    DREAM3D_REQUIRE_EQUAL(loadedPhases->getSize(), expectedPhases->getSize())
+    DREAM3D_REQUIRE(std::memcmp(loadedPhases->getPointer(0), expectedPhases->getPointer(0), expectedPhases->getSize() * sizeof(int32_t)) == 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestRoundTrip()
+  {
+    writeInputFile("# Header\n1 2 3\n4 5 6\n");
+    AttributeMatrix::Pointer parsed = createParsedData();
+
+    {
+      EbsdParseCache cache(UnitTest::EbsdParseCacheTest::CacheDir, UnitTest::EbsdParseCacheTest::InputFile, "ang");
+      DREAM3D_REQUIRE_EQUAL(cache.store(parsed.get()), true)
+      DREAM3D_REQUIRE_EQUAL(QFileInfo::exists(cache.getCacheFilePath()), true)
+    }
+
+    // A new instance reads the cache file back, as a later import would
+    EbsdParseCache cache(UnitTest::EbsdParseCacheTest::CacheDir, UnitTest::EbsdParseCacheTest::InputFile, "ang");
+    AttributeMatrix::Pointer loaded = createEmptyData();
+    DREAM3D_REQUIRE_EQUAL(cache.load(loaded.get()), true)
+    requireSameData(parsed.get(), loaded.get());
+
+    // A different variant of the same file is a different cache file
+    EbsdParseCache otherVariant(UnitTest::EbsdParseCacheTest::CacheDir, UnitTest::EbsdParseCacheTest::InputFile, "ctf:1:0");
+    AttributeMatrix::Pointer notLoaded = createEmptyData();
+    DREAM3D_REQUIRE_EQUAL(otherVariant.load(notLoaded.get()), false)
+    DREAM3D_REQUIRE_EQUAL(notLoaded->getNumAttributeArrays(), 0)
+
+    // The cache was written for a different number of cells
+    std::vector<size_t> tDims = {k_NumTuples + 1};
+    AttributeMatrix::Pointer wrongSize = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    DREAM3D_REQUIRE_EQUAL(cache.load(wrongSize.get()), false)
+    DREAM3D_REQUIRE_EQUAL(wrongSize->getNumAttributeArrays(), 0)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestStaleCache()
+  {
+    writeInputFile("# Header\n1 2 3\n4 5 6\n");
+    AttributeMatrix::Pointer parsed = createParsedData();
+    {
+      EbsdParseCache cache(UnitTest::EbsdParseCacheTest::CacheDir, UnitTest::EbsdParseCacheTest::InputFile, "ang");
+      cache.setVerifyContents(true);
+      DREAM3D_REQUIRE_EQUAL(cache.store(parsed.get()), true)
+    }
+    QDateTime modified = QFileInfo(UnitTest::EbsdParseCacheTest::InputFile).lastModified();
+
+    // Same size and the time stamp put back: only the hash of the contents can tell the files apart
+    writeInputFile("# Header\n1 2 3\n4 5 7\n");
+    {
+      QFile file(UnitTest::EbsdParseCacheTest::InputFile);
+      DREAM3D_REQUIRE_EQUAL(file.open(QIODevice::ReadWrite), true)
+      DREAM3D_REQUIRE_EQUAL(file.setFileTime(modified, QFileDevice::FileModificationTime), true)
+    }
+    {
+      EbsdParseCache cache(UnitTest::EbsdParseCacheTest::CacheDir, UnitTest::EbsdParseCacheTest::InputFile, "ang");
+      AttributeMatrix::Pointer loaded = createEmptyData();
+      DREAM3D_REQUIRE_EQUAL(cache.load(loaded.get()), true)
+
+      cache.setVerifyContents(true);
+      AttributeMatrix::Pointer verified = createEmptyData();
+      DREAM3D_REQUIRE_EQUAL(cache.load(verified.get()), false)
+      DREAM3D_REQUIRE_EQUAL(verified->getNumAttributeArrays(), 0)
+    }
+
+    // A different size is caught without hashing
+    writeInputFile("# Header\n1 2 3\n4 5 6\n7 8 9\n");
+    {
+      EbsdParseCache cache(UnitTest::EbsdParseCacheTest::CacheDir, UnitTest::EbsdParseCacheTest::InputFile, "ang");
+      AttributeMatrix::Pointer loaded = createEmptyData();
+      DREAM3D_REQUIRE_EQUAL(cache.load(loaded.get()), false)
+      DREAM3D_REQUIRE_EQUAL(loaded->getNumAttributeArrays(), 0)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestCorruptCache()
+  {
+    writeInputFile("# Header\n1 2 3\n4 5 6\n");
+    AttributeMatrix::Pointer parsed = createParsedData();
+    EbsdParseCache cache(UnitTest::EbsdParseCacheTest::CacheDir, UnitTest::EbsdParseCacheTest::InputFile, "ang");
+    DREAM3D_REQUIRE_EQUAL(cache.store(parsed.get()), true)
+
+    // An array count that could never fit in the cache file
+    {
+      QFile cacheFile(cache.getCacheFilePath());
+      DREAM3D_REQUIRE_EQUAL(cacheFile.open(QIODevice::ReadWrite), true)
+      DREAM3D_REQUIRE_EQUAL(cacheFile.seek(k_ArrayCountOffset), true)
+      const uint32_t arrayCount = 0xFFFFFFFF;
+      DREAM3D_REQUIRE_EQUAL(cacheFile.write(reinterpret_cast<const char*>(&arrayCount), sizeof(arrayCount)), static_cast<qint64>(sizeof(arrayCount)))
+    }
+    {
+      AttributeMatrix::Pointer loaded = createEmptyData();
+      DREAM3D_REQUIRE_EQUAL(cache.load(loaded.get()), false)
+      DREAM3D_REQUIRE_EQUAL(loaded->getNumAttributeArrays(), 0)
+    }
+
+    // The last block of values is cut off
+    DREAM3D_REQUIRE_EQUAL(cache.store(parsed.get()), true)
+    {
+      QFile cacheFile(cache.getCacheFilePath());
+      DREAM3D_REQUIRE_EQUAL(cacheFile.resize(cacheFile.size() - 4), true)
+    }
+    {
+      AttributeMatrix::Pointer loaded = createEmptyData();
+      DREAM3D_REQUIRE_EQUAL(cache.load(loaded.get()), false)
+      DREAM3D_REQUIRE_EQUAL(loaded->getNumAttributeArrays(), 0)
+    }
+
+    // Nothing but part of the header is left
+    {
+      QFile cacheFile(cache.getCacheFilePath());
+      DREAM3D_REQUIRE_EQUAL(cacheFile.resize(k_ArrayCountOffset), true)
+    }
+    {
+      AttributeMatrix::Pointer loaded = createEmptyData();
+      DREAM3D_REQUIRE_EQUAL(cache.load(loaded.get()), false)
+      DREAM3D_REQUIRE_EQUAL(loaded->getNumAttributeArrays(), 0)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  /**
+   * @brief
+   */
+  void operator()()
+  {
+    std::cout << "#-- EbsdParseCacheTest Starting " << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestRoundTrip())
+    DREAM3D_REGISTER_TEST(TestStaleCache())
+    DREAM3D_REGISTER_TEST(TestCorruptCache())
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+};
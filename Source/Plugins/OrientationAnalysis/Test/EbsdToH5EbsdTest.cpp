@@ -0,0 +1,298 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <QtCore/QDebug>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+
+#include "H5Support/H5Lite.h"
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/H5Utilities.h"
+
+#include "EbsdLib/Core/EbsdLibConstants.h"
+#include "EbsdLib/IO/TSL/AngConstants.h"
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "OrientationAnalysis/OrientationAnalysisFilters/EbsdToH5Ebsd.h"
+#include "OrientationAnalysisTestFileLocations.h"
+
+/**
+ * @brief The EbsdToH5EbsdTest class converts a stack of small generated .ang files into an .h5ebsd file. With more
+ * than one file the slices are parsed ahead of the writer on worker threads, so the test checks that every slice
+ * still lands at its own Z index and that a file that fails to parse is reported as an error of the filter.
+ */
+class EbsdToH5EbsdTest
+{
+  const int k_NumSlices = 6;
+  const int k_NumCols = 3;
+  const int k_NumRows = 2;
+  const QString k_FilePrefix = {"Slice_"};
+
+public:
+  EbsdToH5EbsdTest() = default;
+  ~EbsdToH5EbsdTest() = default;
+  EbsdToH5EbsdTest(const EbsdToH5EbsdTest&) = delete;            // Copy Constructor Not Implemented
+  EbsdToH5EbsdTest(EbsdToH5EbsdTest&&) = delete;                 // Move Constructor Not Implemented
+  EbsdToH5EbsdTest& operator=(const EbsdToH5EbsdTest&) = delete; // Copy Assignment Not Implemented
+  EbsdToH5EbsdTest& operator=(EbsdToH5EbsdTest&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Returns the name of the class for EbsdToH5EbsdTest
+   */
+  QString getNameOfClass() const
+  {
+    return QString("EbsdToH5EbsdTest");
+  }
+
+  /**
+   * @brief Returns the name of the class for EbsdToH5EbsdTest
+   */
+  QString ClassName()
+  {
+    return QString("EbsdToH5EbsdTest");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QDir(UnitTest::EbsdToH5EbsdTest::InputDir).removeRecursively();
+    QFile::remove(UnitTest::EbsdToH5EbsdTest::OutputFile);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFilterAvailability()
+  {
+    // Now instantiate the EbsdToH5Ebsd Filter from the FilterManager
+    QString filtName = "EbsdToH5Ebsd";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    if(nullptr == filterFactory.get())
+    {
+      std::stringstream ss;
+      ss << "The EbsdToH5EbsdTest Requires the use of the " << filtName.toStdString() << " filter which is found in the OrientationAnalysis Plugin";
+      DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The Phi1 angle of every point encodes the slice it was written from
+  // -----------------------------------------------------------------------------
+  float phi1ForSlice(int slice, int point) const
+  {
+    return 0.1f * static_cast<float>(slice) + 0.01f * static_cast<float>(point);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString sliceFilePath(int slice) const
+  {
+    return UnitTest::EbsdToH5EbsdTest::InputDir + "/" + k_FilePrefix + QString::number(slice) + ".ang";
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void writeAngFile(int slice, bool malformed)
+  {
+    QFile file(sliceFilePath(slice));
+    bool opened = file.open(QIODevice::WriteOnly | QIODevice::Text);
+    DREAM3D_REQUIRE_EQUAL(opened, true)
+
+    QTextStream out(&file);
+    out << "# TEM_PIXperUM          1.000000\n";
+    out << "# x-star                0.500000\n";
+    out << "# y-star                0.500000\n";
+    out << "# z-star                0.500000\n";
+    out << "# WorkingDistance       15.000000\n";
+    out << "#\n";
+    out << "# Phase 1\n";
+    out << "# MaterialName  \tNickel\n";
+    out << "# Formula     \tNi\n";
+    out << "# Info \t\t\n";
+    out << "# Symmetry              43\n";
+    out << "# LatticeConstants      3.560 3.560 3.560  90.000  90.000  90.000\n";
+    out << "# NumberFamilies        0\n";
+    out << "#\n";
+    if(malformed)
+    {
+      // Neither a grid type nor any columns, the reader has to reject the file
+      out << "# XSTEP: 1.000000\n";
+      out << "# YSTEP: 1.000000\n";
+      out << "# NCOLS_ODD: 0\n";
+      out << "# NCOLS_EVEN: 0\n";
+      out << "# NROWS: 0\n";
+      out << "#\n";
+      return;
+    }
+    out << "# GRID: SqrGrid\n";
+    out << "# XSTEP: 1.000000\n";
+    out << "# YSTEP: 1.000000\n";
+    out << "# NCOLS_ODD: " << k_NumCols << "\n";
+    out << "# NCOLS_EVEN: " << k_NumCols << "\n";
+    out << "# NROWS: " << k_NumRows << "\n";
+    out << "#\n";
+    out << "# OPERATOR: \t\n";
+    out << "# SAMPLEID: \t\n";
+    out << "# SCANID: \t\n";
+    out << "#\n";
+    int point = 0;
+    for(int y = 0; y < k_NumRows; y++)
+    {
+      for(int x = 0; x < k_NumCols; x++)
+      {
+        out << "  " << QString::number(phi1ForSlice(slice, point), 'f', 5) << " 0.50000 0.25000 " << QString::number(x, 'f', 5) << " " << QString::number(y, 'f', 5)
+            << " 100.0 0.900 1 0 1.000\n";
+        point++;
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void writeAngFiles(int malformedSlice)
+  {
+    QDir dir;
+    dir.mkpath(UnitTest::EbsdToH5EbsdTest::InputDir);
+    for(int slice = 0; slice < k_NumSlices; slice++)
+    {
+      writeAngFile(slice, slice == malformedSlice);
+    }
+    QFile::remove(UnitTest::EbsdToH5EbsdTest::OutputFile);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  EbsdToH5Ebsd::Pointer createFilter()
+  {
+    EbsdToH5Ebsd::Pointer filter = EbsdToH5Ebsd::New();
+    filter->setOutputFile(UnitTest::EbsdToH5EbsdTest::OutputFile);
+    filter->setInputPath(UnitTest::EbsdToH5EbsdTest::InputDir);
+    filter->setFilePrefix(k_FilePrefix);
+    filter->setFileSuffix("");
+    filter->setFileExtension("ang");
+    filter->setPaddingDigits(0);
+    filter->setZStartIndex(0);
+    filter->setZEndIndex(k_NumSlices - 1);
+    filter->setZResolution(1.0f);
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestSliceOrdering()
+  {
+    writeAngFiles(-1);
+
+    EbsdToH5Ebsd::Pointer filter = createFilter();
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    hid_t fileId = H5Utilities::openFile(UnitTest::EbsdToH5EbsdTest::OutputFile.toStdString(), true);
+    DREAM3D_REQUIRED(fileId, >, 0)
+    H5ScopedFileSentinel sentinel(fileId, false);
+
+    int64_t zStart = -1;
+    int64_t zEnd = -1;
+    herr_t err = H5Lite::readScalarDataset(fileId, EbsdLib::H5Ebsd::ZStartIndex, zStart);
+    DREAM3D_REQUIRED(err, >=, 0)
+    err = H5Lite::readScalarDataset(fileId, EbsdLib::H5Ebsd::ZEndIndex, zEnd);
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRE_EQUAL(zStart, 0)
+    DREAM3D_REQUIRE_EQUAL(zEnd, k_NumSlices - 1)
+
+    for(int slice = 0; slice < k_NumSlices; slice++)
+    {
+      std::string dataPath = std::to_string(slice) + "/" + EbsdLib::H5Ebsd::Data + "/" + EbsdLib::Ang::Phi1;
+      std::vector<float> phi1;
+      err = H5Lite::readVectorDataset(fileId, dataPath, phi1);
+      DREAM3D_REQUIRED(err, >=, 0)
+      DREAM3D_REQUIRE_EQUAL(phi1.size(), static_cast<size_t>(k_NumCols * k_NumRows))
+      for(size_t point = 0; point < phi1.size(); point++)
+      {
+        DREAM3D_REQUIRE(std::fabs(phi1[point] - phi1ForSlice(slice, static_cast<int>(point))) < 1.0E-4f)
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestMalformedSlice()
+  {
+    // A file in the middle of the stack, so it is parsed on a worker while other slices are in flight
+    writeAngFiles(k_NumSlices / 2);
+
+    EbsdToH5Ebsd::Pointer filter = createFilter();
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), <, 0)
+
+    return EXIT_SUCCESS;
+  }
+
+  /**
+   * @brief
+   */
+  void operator()()
+  {
+    std::cout << "#-- EbsdToH5EbsdTest Starting " << std::endl;
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestFilterAvailability());
+
+    DREAM3D_REGISTER_TEST(TestSliceOrdering())
+    DREAM3D_REGISTER_TEST(TestMalformedSlice())
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+};
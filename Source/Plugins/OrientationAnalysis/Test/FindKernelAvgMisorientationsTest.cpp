@@ -0,0 +1,215 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
+#include "UnitTestSupport.hpp"
+
+#include "EbsdLib/Core/EbsdLibConstants.h"
+
+#include "OrientationAnalysis/OrientationAnalysisFilters/FindKernelAvgMisorientations.h"
+#include "OrientationAnalysisTestFileLocations.h"
+
+class FindKernelAvgMisorientationsTest
+{
+private:
+  const QString k_DataContainerName = QString("DataContainer");
+  const QString k_CellAttributeMatrixName = QString("CellData");
+  const QString k_EnsembleAttributeMatrixName = QString("CellEnsembleData");
+
+public:
+  FindKernelAvgMisorientationsTest() = default;
+  virtual ~FindKernelAvgMisorientationsTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Creates a single cubic phase image. Every cell is rotated about [001] by its angle in degrees, so the
+  // misorientation of two cells is the difference of their angles as long as it stays below 45 degrees.
+  // Cells of Feature 0 are bad cells of phase 0
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createDataContainerArray(std::vector<size_t> tDims, const std::vector<int32_t>& features, const std::vector<float>& angles)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer m = DataContainer::New(k_DataContainerName);
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    geom->setDimensions(tDims.data());
+    m->setGeometry(geom);
+    dca->addOrReplaceDataContainer(m);
+
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tDims, k_CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+    m->addOrReplaceAttributeMatrix(cellAttrMat);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(tDims, {1}, SIMPL::CellData::FeatureIds, true);
+    Int32ArrayType::Pointer phases = Int32ArrayType::CreateArray(tDims, {1}, SIMPL::CellData::Phases, true);
+    FloatArrayType::Pointer quats = FloatArrayType::CreateArray(tDims, {4}, SIMPL::CellData::Quats, true);
+    DREAM3D_REQUIRE_EQUAL(featureIds->getNumberOfTuples(), features.size());
+    for(size_t i = 0; i < features.size(); i++)
+    {
+      featureIds->setValue(i, features[i]);
+      phases->setValue(i, features[i] == 0 ? 0 : 1);
+      float halfAngle = angles[i] * static_cast<float>(SIMPLib::Constants::k_PiOver180D) * 0.5f;
+      quats->setComponent(i, 0, 0.0f);
+      quats->setComponent(i, 1, 0.0f);
+      quats->setComponent(i, 2, std::sin(halfAngle));
+      quats->setComponent(i, 3, std::cos(halfAngle));
+    }
+    cellAttrMat->insertOrAssign(featureIds);
+    cellAttrMat->insertOrAssign(phases);
+    cellAttrMat->insertOrAssign(quats);
+
+    AttributeMatrix::Pointer ensembleAttrMat = AttributeMatrix::New({2}, k_EnsembleAttributeMatrixName, AttributeMatrix::Type::CellEnsemble);
+    m->addOrReplaceAttributeMatrix(ensembleAttrMat);
+    UInt32ArrayType::Pointer crystalStructures = UInt32ArrayType::CreateArray(2, SIMPL::EnsembleData::CrystalStructures, true);
+    crystalStructures->setValue(0, EbsdLib::CrystalStructure::UnknownCrystalStructure);
+    crystalStructures->setValue(1, EbsdLib::CrystalStructure::Cubic_High);
+    ensembleAttrMat->insertOrAssign(crystalStructures);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer runFilter(const DataContainerArray::Pointer& dca, const IntVec3Type& kernelSize)
+  {
+    FindKernelAvgMisorientations::Pointer filter = FindKernelAvgMisorientations::New();
+    filter->setDataContainerArray(dca);
+    filter->setKernelSize(kernelSize);
+    filter->setFeatureIdsArrayPath({k_DataContainerName, k_CellAttributeMatrixName, SIMPL::CellData::FeatureIds});
+    filter->setCellPhasesArrayPath({k_DataContainerName, k_CellAttributeMatrixName, SIMPL::CellData::Phases});
+    filter->setQuatsArrayPath({k_DataContainerName, k_CellAttributeMatrixName, SIMPL::CellData::Quats});
+    filter->setCrystalStructuresArrayPath({k_DataContainerName, k_EnsembleAttributeMatrixName, SIMPL::EnsembleData::CrystalStructures});
+    filter->setKernelAverageMisorientationsArrayName(SIMPL::CellData::KernelAverageMisorientations);
+    filter->execute();
+    int32_t err = filter->getErrorCode();
+    DREAM3D_REQUIRED(err, ==, 0)
+
+    FloatArrayType::Pointer kam = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, {k_DataContainerName, k_CellAttributeMatrixName, SIMPL::CellData::KernelAverageMisorientations}, {1});
+    DREAM3D_REQUIRE_VALID_POINTER(kam.get())
+    return kam;
+  }
+
+  // -----------------------------------------------------------------------------
+  // A 4x3 slice with a 3x3 kernel. The average of each cell is taken over the cells of its own Feature inside
+  // the kernel, the cell itself included
+  // -----------------------------------------------------------------------------
+  void TestKnownSlice()
+  {
+    // clang-format off
+    std::vector<int32_t> features = {
+        1, 1, 1, 2,
+        1, 1, 1, 2,
+        1, 0, 1, 2,
+    };
+    std::vector<float> angles = {
+         0.0f,  5.0f, 10.0f, 30.0f,
+         5.0f, 10.0f, 20.0f, 35.0f,
+        10.0f,  0.0f, 15.0f, 40.0f,
+    };
+    // For example the cell at (1, 1) has 8 cells of Feature 1 in its kernel with misorientations of
+    // 10, 5, 0, 5, 0, 10, 0 and 5 degrees, so its average is 35 / 8
+    std::vector<float> expected = {
+        20.0f / 4.0f, 30.0f / 6.0f, 15.0f / 4.0f, 5.0f / 2.0f,
+        15.0f / 5.0f, 35.0f / 8.0f, 40.0f / 5.0f, 10.0f / 3.0f,
+         5.0f / 3.0f,  0.0f,        10.0f / 3.0f,  5.0f / 2.0f,
+    };
+    // clang-format on
+
+    DataContainerArray::Pointer dca = createDataContainerArray({4, 3, 1}, features, angles);
+    FloatArrayType::Pointer kam = runFilter(dca, IntVec3Type(1, 1, 1));
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+      DREAM3D_REQUIRED(std::fabs(kam->getValue(i) - expected[i]), <, 0.05f)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // A 6x5x9 volume with a 3x5x3 kernel. The filter splits it into blocks of four planes, so many kernels reach
+  // into the next block. The expected values are found by summing the angle differences over every kernel
+  // -----------------------------------------------------------------------------
+  void TestVolumeAcrossBlocks()
+  {
+    const int64_t dims[3] = {6, 5, 9};
+    const int64_t kernel[3] = {1, 2, 1};
+    const size_t totalPoints = static_cast<size_t>(dims[0] * dims[1] * dims[2]);
+
+    std::vector<int32_t> features(totalPoints, 0);
+    std::vector<float> angles(totalPoints, 0.0f);
+    uint32_t noise = 88172645u;
+    for(int64_t z = 0; z < dims[2]; z++)
+    {
+      for(int64_t y = 0; y < dims[1]; y++)
+      {
+        for(int64_t x = 0; x < dims[0]; x++)
+        {
+          size_t index = static_cast<size_t>((z * dims[1] + y) * dims[0] + x);
+          noise = noise * 1664525u + 1013904223u;
+          features[index] = static_cast<int32_t>((z / 3) * 4 + (y / 3) * 2 + (x / 3) + 1);
+          if((noise >> 28) == 0)
+          {
+            features[index] = 0;
+          }
+          angles[index] = static_cast<float>((noise >> 8) % 81) * 0.5f;
+        }
+      }
+    }
+
+    DataContainerArray::Pointer dca = createDataContainerArray({6, 5, 9}, features, angles);
+    FloatArrayType::Pointer kam = runFilter(dca, IntVec3Type(kernel[0], kernel[1], kernel[2]));
+
+    for(int64_t z = 0; z < dims[2]; z++)
+    {
+      for(int64_t y = 0; y < dims[1]; y++)
+      {
+        for(int64_t x = 0; x < dims[0]; x++)
+        {
+          size_t index = static_cast<size_t>((z * dims[1] + y) * dims[0] + x);
+          float expected = 0.0f;
+          if(features[index] > 0)
+          {
+            float sum = 0.0f;
+            int32_t count = 0;
+            for(int64_t k = std::max<int64_t>(z - kernel[2], 0); k <= std::min<int64_t>(z + kernel[2], dims[2] - 1); k++)
+            {
+              for(int64_t j = std::max<int64_t>(y - kernel[1], 0); j <= std::min<int64_t>(y + kernel[1], dims[1] - 1); j++)
+              {
+                for(int64_t i = std::max<int64_t>(x - kernel[0], 0); i <= std::min<int64_t>(x + kernel[0], dims[0] - 1); i++)
+                {
+                  size_t neighbor = static_cast<size_t>((k * dims[1] + j) * dims[0] + i);
+                  if(features[neighbor] == features[index])
+                  {
+                    sum += std::fabs(angles[neighbor] - angles[index]);
+                    count++;
+                  }
+                }
+              }
+            }
+            expected = sum / static_cast<float>(count);
+          }
+          DREAM3D_REQUIRED(std::fabs(kam->getValue(index) - expected), <, 0.05f)
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "      Starting Unit Test FindKernelAvgMisorientationsTest     " << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestKnownSlice());
+    DREAM3D_REGISTER_TEST(TestVolumeAcrossBlocks());
+  }
+
+private:
+  FindKernelAvgMisorientationsTest(const FindKernelAvgMisorientationsTest&); // Copy Constructor Not Implemented
+  void operator=(const FindKernelAvgMisorientationsTest&);                   // Move assignment Not Implemented
+};
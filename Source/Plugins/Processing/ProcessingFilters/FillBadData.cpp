@@ -34,6 +34,10 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "FillBadData.h"
 
+#include <algorithm>
+#include <numeric>
+#include <thread>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -47,10 +51,495 @@
 #include "SIMPLib/FilterParameters/MultiDataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "Processing/ProcessingConstants.h"
 #include "Processing/ProcessingVersion.h"
 
+/**
+ * @brief The FillBadDataSlab struct describes a contiguous range of grid lines (rows of constant y and z index)
+ * in which the defect regions are labeled independently of the rest of the volume
+ */
+struct FillBadDataSlab
+{
+  int64_t beginLine = 0;
+  int64_t endLine = 0;
+  int64_t labelOffset = 0;
+  std::vector<int64_t> regionSizes;
+  std::vector<std::pair<int64_t, int64_t>> seams;
+  std::vector<int64_t> frontier;
+};
+
+/**
+ * @brief The FillBadDataLabelSlabsImpl class labels the connected regions of zero valued Feature Ids inside each
+ * slab and records the number of cells in each region
+ */
+class FillBadDataLabelSlabsImpl
+{
+public:
+  FillBadDataLabelSlabsImpl(const int64_t* dims, const int32_t* featureIds, int32_t* regionIds, std::vector<FillBadDataSlab>& slabs)
+  : m_Dims(dims)
+  , m_FeatureIds(featureIds)
+  , m_RegionIds(regionIds)
+  , m_Slabs(slabs)
+  {
+  }
+
+  void labelSlab(FillBadDataSlab& slab) const
+  {
+    const int64_t dimX = m_Dims[0];
+    const int64_t dimY = m_Dims[1];
+    const int64_t dimXY = m_Dims[0] * m_Dims[1];
+    const int64_t end = slab.endLine * dimX;
+
+    std::vector<int64_t> currentvlist;
+    int64_t neighbors[6] = {0, 0, 0, 0, 0, 0};
+    int32_t label = 0;
+    for(int64_t i = slab.beginLine * dimX; i < end; i++)
+    {
+      if(m_FeatureIds[i] != 0 || m_RegionIds[i] != 0)
+      {
+        continue;
+      }
+      label++;
+      m_RegionIds[i] = label;
+      currentvlist.push_back(i);
+      int64_t regionSize = 0;
+      while(!currentvlist.empty())
+      {
+        int64_t index = currentvlist.back();
+        currentvlist.pop_back();
+        regionSize++;
+        int64_t column = index % dimX;
+        int64_t line = index / dimX;
+        int64_t row = line % dimY;
+
+        int32_t numNeighbors = 0;
+        if(line - dimY >= slab.beginLine)
+        {
+          neighbors[numNeighbors++] = index - dimXY;
+        }
+        if(row > 0 && line - 1 >= slab.beginLine)
+        {
+          neighbors[numNeighbors++] = index - dimX;
+        }
+        if(column > 0)
+        {
+          neighbors[numNeighbors++] = index - 1;
+        }
+        if(column < dimX - 1)
+        {
+          neighbors[numNeighbors++] = index + 1;
+        }
+        if(row < dimY - 1 && line + 1 < slab.endLine)
+        {
+          neighbors[numNeighbors++] = index + dimX;
+        }
+        if(line + dimY < slab.endLine)
+        {
+          neighbors[numNeighbors++] = index + dimXY;
+        }
+
+        for(int32_t j = 0; j < numNeighbors; j++)
+        {
+          int64_t neighbor = neighbors[j];
+          if(m_FeatureIds[neighbor] == 0 && m_RegionIds[neighbor] == 0)
+          {
+            m_RegionIds[neighbor] = label;
+            currentvlist.push_back(neighbor);
+          }
+        }
+      }
+      slab.regionSizes.push_back(regionSize);
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      labelSlab(m_Slabs[i]);
+    }
+  }
+
+private:
+  const int64_t* m_Dims = nullptr;
+  const int32_t* m_FeatureIds = nullptr;
+  int32_t* m_RegionIds = nullptr;
+  std::vector<FillBadDataSlab>& m_Slabs;
+};
+
+/**
+ * @brief The FillBadDataFindSeamsImpl class collects the pairs of provisional region labels that touch across the
+ * upper boundary of each slab
+ */
+class FillBadDataFindSeamsImpl
+{
+public:
+  FillBadDataFindSeamsImpl(const int64_t* dims, int64_t linesPerSlab, const int32_t* regionIds, std::vector<FillBadDataSlab>& slabs)
+  : m_Dims(dims)
+  , m_LinesPerSlab(linesPerSlab)
+  , m_RegionIds(regionIds)
+  , m_Slabs(slabs)
+  {
+  }
+
+  int64_t provisionalLabel(int64_t point) const
+  {
+    const FillBadDataSlab& slab = m_Slabs[(point / m_Dims[0]) / m_LinesPerSlab];
+    return slab.labelOffset + m_RegionIds[point] - 1;
+  }
+
+  void addSeam(FillBadDataSlab& slab, int64_t point, int64_t neighbor) const
+  {
+    if(m_RegionIds[neighbor] == 0)
+    {
+      return;
+    }
+    std::pair<int64_t, int64_t> seam(provisionalLabel(point), provisionalLabel(neighbor));
+    if(slab.seams.empty() || slab.seams.back() != seam)
+    {
+      slab.seams.push_back(seam);
+    }
+  }
+
+  void findSeams(FillBadDataSlab& slab) const
+  {
+    const int64_t dimX = m_Dims[0];
+    const int64_t dimY = m_Dims[1];
+    const int64_t dimXY = m_Dims[0] * m_Dims[1];
+    const int64_t numLines = m_Dims[1] * m_Dims[2];
+    if(slab.endLine >= numLines)
+    {
+      return;
+    }
+
+    // Only the last plane worth of lines can have forward neighbors outside of the slab
+    for(int64_t line = std::max(slab.beginLine, slab.endLine - dimY); line < slab.endLine; line++)
+    {
+      bool lastLine = (line == slab.endLine - 1) && (line % dimY) < (dimY - 1);
+      bool hasPlaneAbove = line + dimY < numLines;
+      for(int64_t column = 0; column < dimX; column++)
+      {
+        int64_t point = line * dimX + column;
+        if(m_RegionIds[point] == 0)
+        {
+          continue;
+        }
+        if(hasPlaneAbove)
+        {
+          addSeam(slab, point, point + dimXY);
+        }
+        if(lastLine)
+        {
+          addSeam(slab, point, point + dimX);
+        }
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      findSeams(m_Slabs[i]);
+    }
+  }
+
+private:
+  const int64_t* m_Dims = nullptr;
+  int64_t m_LinesPerSlab = 1;
+  const int32_t* m_RegionIds = nullptr;
+  std::vector<FillBadDataSlab>& m_Slabs;
+};
+
+/**
+ * @brief The FillBadDataClassifyImpl class marks the cells of each defect region as either a defect that is kept
+ * (Feature Id 0) or a small region that will be filled (Feature Id -1). The cells from which the fill starts, i.e.,
+ * the fill candidates that touch a Feature, are collected per slab.
+ */
+class FillBadDataClassifyImpl
+{
+public:
+  FillBadDataClassifyImpl(const int64_t* dims, int32_t* featureIds, int32_t* cellPhases, int32_t newPhase, const int32_t* regionIds, const std::vector<uint8_t>& keepRegion,
+                          std::vector<FillBadDataSlab>& slabs)
+  : m_Dims(dims)
+  , m_FeatureIds(featureIds)
+  , m_CellPhases(cellPhases)
+  , m_NewPhase(newPhase)
+  , m_RegionIds(regionIds)
+  , m_KeepRegion(keepRegion)
+  , m_Slabs(slabs)
+  {
+  }
+
+  void classify(FillBadDataSlab& slab) const
+  {
+    const int64_t end = slab.endLine * m_Dims[0];
+    for(int64_t i = slab.beginLine * m_Dims[0]; i < end; i++)
+    {
+      if(m_RegionIds[i] == 0)
+      {
+        continue;
+      }
+      if(m_KeepRegion[slab.labelOffset + m_RegionIds[i] - 1] != 0)
+      {
+        if(nullptr != m_CellPhases)
+        {
+          m_CellPhases[i] = m_NewPhase;
+        }
+      }
+      else
+      {
+        m_FeatureIds[i] = -1;
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      classify(m_Slabs[i]);
+    }
+  }
+
+private:
+  const int64_t* m_Dims = nullptr;
+  int32_t* m_FeatureIds = nullptr;
+  int32_t* m_CellPhases = nullptr;
+  int32_t m_NewPhase = 0;
+  const int32_t* m_RegionIds = nullptr;
+  const std::vector<uint8_t>& m_KeepRegion;
+  std::vector<FillBadDataSlab>& m_Slabs;
+};
+
+/**
+ * @brief FillBadDataFaceNeighbors Collects the face neighbors of a cell in the order -z, -y, -x, +x, +y, +z
+ * @return Number of neighbors inside of the grid
+ */
+inline int32_t FillBadDataFaceNeighbors(const int64_t* dims, int64_t index, int64_t neighbors[6])
+{
+  const int64_t dimXY = dims[0] * dims[1];
+  const int64_t column = index % dims[0];
+  const int64_t row = (index / dims[0]) % dims[1];
+  const int64_t plane = index / dimXY;
+  int32_t numNeighbors = 0;
+  if(plane > 0)
+  {
+    neighbors[numNeighbors++] = index - dimXY;
+  }
+  if(row > 0)
+  {
+    neighbors[numNeighbors++] = index - dims[0];
+  }
+  if(column > 0)
+  {
+    neighbors[numNeighbors++] = index - 1;
+  }
+  if(column < dims[0] - 1)
+  {
+    neighbors[numNeighbors++] = index + 1;
+  }
+  if(row < dims[1] - 1)
+  {
+    neighbors[numNeighbors++] = index + dims[0];
+  }
+  if(plane < dims[2] - 1)
+  {
+    neighbors[numNeighbors++] = index + dimXY;
+  }
+  return numNeighbors;
+}
+
+/**
+ * @brief The FillBadDataInitialFrontierImpl class collects, per slab, the cells that are to be filled and that
+ * already touch a Feature
+ */
+class FillBadDataInitialFrontierImpl
+{
+public:
+  FillBadDataInitialFrontierImpl(const int64_t* dims, const int32_t* featureIds, std::vector<FillBadDataSlab>& slabs)
+  : m_Dims(dims)
+  , m_FeatureIds(featureIds)
+  , m_Slabs(slabs)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    int64_t neighbors[6] = {0, 0, 0, 0, 0, 0};
+    for(size_t s = range.min(); s < range.max(); s++)
+    {
+      FillBadDataSlab& slab = m_Slabs[s];
+      const int64_t end = slab.endLine * m_Dims[0];
+      for(int64_t i = slab.beginLine * m_Dims[0]; i < end; i++)
+      {
+        if(m_FeatureIds[i] >= 0)
+        {
+          continue;
+        }
+        int32_t numNeighbors = FillBadDataFaceNeighbors(m_Dims, i, neighbors);
+        for(int32_t j = 0; j < numNeighbors; j++)
+        {
+          if(m_FeatureIds[neighbors[j]] > 0)
+          {
+            slab.frontier.push_back(i);
+            break;
+          }
+        }
+      }
+    }
+  }
+
+private:
+  const int64_t* m_Dims = nullptr;
+  const int32_t* m_FeatureIds = nullptr;
+  std::vector<FillBadDataSlab>& m_Slabs;
+};
+
+/**
+ * @brief The FillBadDataVoteImpl class picks, for each frontier cell, the neighboring cell of the Feature that
+ * occurs most often among its face neighbors. Ties go to the Feature that reached the count first in the neighbor
+ * order, exactly as the serial majority vote did.
+ */
+class FillBadDataVoteImpl
+{
+public:
+  FillBadDataVoteImpl(const int64_t* dims, const int32_t* featureIds, const std::vector<int64_t>& frontier, std::vector<int64_t>& sources)
+  : m_Dims(dims)
+  , m_FeatureIds(featureIds)
+  , m_Frontier(frontier)
+  , m_Sources(sources)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    int64_t neighbors[6] = {0, 0, 0, 0, 0, 0};
+    int32_t features[6] = {0, 0, 0, 0, 0, 0};
+    int32_t counts[6] = {0, 0, 0, 0, 0, 0};
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      int64_t index = m_Frontier[i];
+      int32_t numNeighbors = FillBadDataFaceNeighbors(m_Dims, index, neighbors);
+      int32_t numFeatures = 0;
+      int32_t most = 0;
+      int64_t source = -1;
+      for(int32_t j = 0; j < numNeighbors; j++)
+      {
+        int32_t feature = m_FeatureIds[neighbors[j]];
+        if(feature <= 0)
+        {
+          continue;
+        }
+        int32_t k = 0;
+        while(k < numFeatures && features[k] != feature)
+        {
+          k++;
+        }
+        if(k == numFeatures)
+        {
+          features[numFeatures] = feature;
+          counts[numFeatures++] = 0;
+        }
+        counts[k]++;
+        if(counts[k] > most)
+        {
+          most = counts[k];
+          source = neighbors[j];
+        }
+      }
+      m_Sources[i] = source;
+    }
+  }
+
+private:
+  const int64_t* m_Dims = nullptr;
+  const int32_t* m_FeatureIds = nullptr;
+  const std::vector<int64_t>& m_Frontier;
+  std::vector<int64_t>& m_Sources;
+};
+
+/**
+ * @brief The FillBadDataCopyImpl class copies every cell array from the voted neighbor into each frontier cell.
+ * The sources all belong to Features, so they are never written during the same pass.
+ */
+class FillBadDataCopyImpl
+{
+public:
+  FillBadDataCopyImpl(const std::vector<IDataArray::Pointer>& cellArrays, const std::vector<int64_t>& frontier, const std::vector<int64_t>& sources)
+  : m_CellArrays(cellArrays)
+  , m_Frontier(frontier)
+  , m_Sources(sources)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(const auto& cellArray : m_CellArrays)
+    {
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        if(m_Sources[i] >= 0)
+        {
+          cellArray->copyTuple(static_cast<size_t>(m_Sources[i]), static_cast<size_t>(m_Frontier[i]));
+        }
+      }
+    }
+  }
+
+private:
+  const std::vector<IDataArray::Pointer>& m_CellArrays;
+  const std::vector<int64_t>& m_Frontier;
+  const std::vector<int64_t>& m_Sources;
+};
+
+/**
+ * @brief The FillBadDataAdvanceImpl class collects the unfilled cells that border the cells filled in the last pass.
+ * Those are the only cells whose majority vote can have changed.
+ */
+class FillBadDataAdvanceImpl
+{
+public:
+  FillBadDataAdvanceImpl(const int64_t* dims, const int32_t* featureIds, const std::vector<int64_t>& frontier, size_t cellsPerChunk, std::vector<std::vector<int64_t>>& nextFrontiers)
+  : m_Dims(dims)
+  , m_FeatureIds(featureIds)
+  , m_Frontier(frontier)
+  , m_CellsPerChunk(cellsPerChunk)
+  , m_NextFrontiers(nextFrontiers)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    int64_t neighbors[6] = {0, 0, 0, 0, 0, 0};
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      std::vector<int64_t>& nextFrontier = m_NextFrontiers[chunk];
+      const size_t end = std::min((chunk + 1) * m_CellsPerChunk, m_Frontier.size());
+      for(size_t i = chunk * m_CellsPerChunk; i < end; i++)
+      {
+        int32_t numNeighbors = FillBadDataFaceNeighbors(m_Dims, m_Frontier[i], neighbors);
+        for(int32_t j = 0; j < numNeighbors; j++)
+        {
+          if(m_FeatureIds[neighbors[j]] < 0)
+          {
+            nextFrontier.push_back(neighbors[j]);
+          }
+        }
+      }
+    }
+  }
+
+private:
+  const int64_t* m_Dims = nullptr;
+  const int32_t* m_FeatureIds = nullptr;
+  const std::vector<int64_t>& m_Frontier;
+  size_t m_CellsPerChunk = 1;
+  std::vector<std::vector<int64_t>>& m_NextFrontiers;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -92,8 +581,6 @@ void FillBadData::setupFilterParameters()
 // -----------------------------------------------------------------------------
 void FillBadData::initialize()
 {
-  m_AlreadyChecked = nullptr;
-  m_Neighbors = nullptr;
 }
 
 // -----------------------------------------------------------------------------
@@ -150,14 +637,6 @@ void FillBadData::execute()
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(m_FeatureIdsArrayPath.getDataContainerName());
   size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
 
-  Int32ArrayType::Pointer neighborsPtr = Int32ArrayType::CreateArray(totalPoints, std::string("_INTERNAL_USE_ONLY_Neighbors"), true);
-  m_Neighbors = neighborsPtr->getPointer(0);
-  neighborsPtr->initializeWithValue(-1);
-
-  BoolArrayType::Pointer alreadCheckedPtr = BoolArrayType::CreateArray(totalPoints, std::string("_INTERNAL_USE_ONLY_AlreadyChecked"), true);
-  m_AlreadyChecked = alreadCheckedPtr->getPointer(0);
-  alreadCheckedPtr->initializeWithZeros();
-
   SizeVec3Type udims = m->getGeometryAs<ImageGeom>()->getDimensions();
 
   int64_t dims[3] = {
@@ -166,242 +645,160 @@ void FillBadData::execute()
       static_cast<int64_t>(udims[2]),
   };
 
-  size_t count = 1;
-  int32_t good = 1;
-  int64_t neighbor;
-  int64_t index = 0;
-  float x = 0.0f, y = 0.0f, z = 0.0f;
-  int64_t column = 0, row = 0, plane = 0;
-  int64_t neighpoint = 0;
-  int32_t featurename = 0, feature = 0;
-  size_t numfeatures = 0;
-  size_t maxPhase = 0;
-
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    featurename = m_FeatureIds[i];
-    if(featurename > numfeatures)
-    {
-      numfeatures = featurename;
-    }
+  int32_t maxPhase = 0;
+  if(m_StoreAsNewPhase && totalPoints > 0)
+  {
+    maxPhase = std::max(*std::max_element(m_CellPhases, m_CellPhases + totalPoints), 0);
   }
 
-  if(m_StoreAsNewPhase)
+  // Split the volume into slabs of whole grid lines, preferring whole planes so that each seam is a single plane
+  const int64_t numLines = dims[1] * dims[2];
+  const int64_t numThreads = std::max(static_cast<int64_t>(std::thread::hardware_concurrency()), static_cast<int64_t>(1));
+  int64_t linesPerSlab = std::max((numLines + 2 * numThreads - 1) / (2 * numThreads), static_cast<int64_t>(1));
+  if(linesPerSlab > dims[1])
   {
-    for(size_t i = 0; i < totalPoints; i++)
-    {
-      if(m_CellPhases[i] > maxPhase)
-      {
-        maxPhase = m_CellPhases[i];
-      }
-    }
+    linesPerSlab = ((linesPerSlab + dims[1] - 1) / dims[1]) * dims[1];
+  }
+  const int64_t numSlabs = (numLines + linesPerSlab - 1) / linesPerSlab;
+
+  std::vector<FillBadDataSlab> slabs(static_cast<size_t>(numSlabs));
+  for(int64_t i = 0; i < numSlabs; i++)
+  {
+    slabs[i].beginLine = i * linesPerSlab;
+    slabs[i].endLine = std::min((i + 1) * linesPerSlab, numLines);
   }
 
-  int64_t neighpoints[6] = {0, 0, 0, 0, 0, 0};
-  neighpoints[0] = -dims[0] * dims[1];
-  neighpoints[1] = -dims[0];
-  neighpoints[2] = -1;
-  neighpoints[3] = 1;
-  neighpoints[4] = dims[0];
-  neighpoints[5] = dims[0] * dims[1];
-  std::vector<int64_t> currentvlist;
+  // Label the connected regions of bad cells in each slab, then merge the regions across the slab boundaries
+  notifyStatusMessage("Identifying Defect Regions");
+  Int32ArrayType::Pointer regionIdsPtr = Int32ArrayType::CreateArray(totalPoints, std::string("_INTERNAL_USE_ONLY_RegionIds"), true);
+  regionIdsPtr->initializeWithZeros();
+  int32_t* regionIds = regionIdsPtr->getPointer(0);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, static_cast<size_t>(numSlabs));
+    dataAlg.setGrain(1);
+    dataAlg.execute(FillBadDataLabelSlabsImpl(dims, m_FeatureIds, regionIds, slabs));
+  }
 
-  for(size_t iter = 0; iter < totalPoints; iter++)
+  int64_t numProvisional = 0;
+  for(auto& slab : slabs)
   {
-    m_AlreadyChecked[iter] = false;
-    if(m_FeatureIds[iter] != 0)
-    {
-      m_AlreadyChecked[iter] = true;
-    }
+    slab.labelOffset = numProvisional;
+    numProvisional += static_cast<int64_t>(slab.regionSizes.size());
+  }
+
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, static_cast<size_t>(numSlabs));
+    dataAlg.setGrain(1);
+    dataAlg.execute(FillBadDataFindSeamsImpl(dims, linesPerSlab, regionIds, slabs));
   }
 
-  for(size_t i = 0; i < totalPoints; i++)
+  if(getCancel())
   {
-    if(!m_AlreadyChecked[i] && m_FeatureIds[i] == 0)
+    return;
+  }
+
+  std::vector<int64_t> parents(static_cast<size_t>(numProvisional));
+  std::iota(parents.begin(), parents.end(), 0);
+  auto findRoot = [&parents](int64_t label) {
+    while(parents[label] != label)
     {
-      currentvlist.push_back(static_cast<int64_t>(i));
-      count = 0;
-      while(count < currentvlist.size())
-      {
-        index = currentvlist[count];
-        column = index % dims[0];
-        row = (index / dims[0]) % dims[1];
-        plane = index / (dims[0] * dims[1]);
-        for(int32_t j = 0; j < 6; j++)
-        {
-          good = 1;
-          neighbor = index + neighpoints[j];
-          if(j == 0 && plane == 0)
-          {
-            good = 0;
-          }
-          if(j == 5 && plane == (dims[2] - 1))
-          {
-            good = 0;
-          }
-          if(j == 1 && row == 0)
-          {
-            good = 0;
-          }
-          if(j == 4 && row == (dims[1] - 1))
-          {
-            good = 0;
-          }
-          if(j == 2 && column == 0)
-          {
-            good = 0;
-          }
-          if(j == 3 && column == (dims[0] - 1))
-          {
-            good = 0;
-          }
-          if(good == 1 && m_FeatureIds[neighbor] == 0 && !m_AlreadyChecked[neighbor])
-          {
-            currentvlist.push_back(neighbor);
-            m_AlreadyChecked[neighbor] = true;
-          }
-        }
-        count++;
-      }
-      if((int32_t)currentvlist.size() >= m_MinAllowedDefectSize)
-      {
-        for(size_t k = 0; k < currentvlist.size(); k++)
-        {
-          m_FeatureIds[currentvlist[k]] = 0;
-          if(m_StoreAsNewPhase)
-          {
-            m_CellPhases[currentvlist[k]] = maxPhase + 1;
-          }
-        }
-      }
-      if((int32_t)currentvlist.size() < m_MinAllowedDefectSize)
+      parents[label] = parents[parents[label]];
+      label = parents[label];
+    }
+    return label;
+  };
+  for(const auto& slab : slabs)
+  {
+    for(const auto& seam : slab.seams)
+    {
+      int64_t root1 = findRoot(seam.first);
+      int64_t root2 = findRoot(seam.second);
+      if(root1 != root2)
       {
-        for(std::vector<int64_t>::size_type k = 0; k < currentvlist.size(); k++)
-        {
-          m_FeatureIds[currentvlist[k]] = -1;
-        }
+        parents[std::max(root1, root2)] = std::min(root1, root2);
       }
-      currentvlist.clear();
     }
   }
 
-  int32_t current = 0;
-  int32_t most = 0;
-  std::vector<int32_t> n(numfeatures + 1, 0);
-
-  while(count != 0)
+  std::vector<int64_t> regionSizes(static_cast<size_t>(numProvisional), 0);
+  for(const auto& slab : slabs)
   {
-    count = 0;
-    for(size_t i = 0; i < totalPoints; i++)
+    for(size_t i = 0; i < slab.regionSizes.size(); i++)
     {
-      featurename = m_FeatureIds[i];
-      if(featurename < 0)
-      {
-        count++;
-        current = 0;
-        most = 0;
-        x = static_cast<float>(i % dims[0]);
-        y = static_cast<float>((i / dims[0]) % dims[1]);
-        z = static_cast<float>(i / (dims[0] * dims[1]));
-        for(int32_t j = 0; j < 6; j++)
-        {
-          good = 1;
-          neighpoint = static_cast<int64_t>(i + neighpoints[j]);
-          if(j == 0 && z == 0)
-          {
-            good = 0;
-          }
-          if(j == 5 && z == (dims[2] - 1))
-          {
-            good = 0;
-          }
-          if(j == 1 && y == 0)
-          {
-            good = 0;
-          }
-          if(j == 4 && y == (dims[1] - 1))
-          {
-            good = 0;
-          }
-          if(j == 2 && x == 0)
-          {
-            good = 0;
-          }
-          if(j == 3 && x == (dims[0] - 1))
-          {
-            good = 0;
-          }
-          if(good == 1)
-          {
-            feature = m_FeatureIds[neighpoint];
-            if(feature > 0)
-            {
-              n[feature]++;
-              current = n[feature];
-              if(current > most)
-              {
-                most = current;
-                m_Neighbors[i] = neighpoint;
-              }
-            }
-          }
-        }
-        for(int32_t l = 0; l < 6; l++)
-        {
-          good = 1;
-          neighpoint = i + neighpoints[l];
-          if(l == 0 && z == 0)
-          {
-            good = 0;
-          }
-          if(l == 5 && z == (dims[2] - 1))
-          {
-            good = 0;
-          }
-          if(l == 1 && y == 0)
-          {
-            good = 0;
-          }
-          if(l == 4 && y == (dims[1] - 1))
-          {
-            good = 0;
-          }
-          if(l == 2 && x == 0)
-          {
-            good = 0;
-          }
-          if(l == 3 && x == (dims[0] - 1))
-          {
-            good = 0;
-          }
-          if(good == 1)
-          {
-            feature = m_FeatureIds[neighpoint];
-            if(feature > 0)
-            {
-              n[feature] = 0;
-            }
-          }
-        }
-      }
+      regionSizes[findRoot(slab.labelOffset + static_cast<int64_t>(i))] += slab.regionSizes[i];
     }
+  }
+  std::vector<uint8_t> keepRegion(static_cast<size_t>(numProvisional), 0);
+  for(int64_t i = 0; i < numProvisional; i++)
+  {
+    keepRegion[i] = regionSizes[findRoot(i)] >= static_cast<int64_t>(m_MinAllowedDefectSize) ? 1 : 0;
+  }
 
-    QString attrMatName = m_FeatureIdsArrayPath.getAttributeMatrixName();
-    QList<QString> voxelArrayNames = m->getAttributeMatrix(attrMatName)->getAttributeArrayNames();
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, static_cast<size_t>(numSlabs));
+    dataAlg.setGrain(1);
+    dataAlg.execute(FillBadDataClassifyImpl(dims, m_FeatureIds, m_StoreAsNewPhase ? m_CellPhases : nullptr, maxPhase + 1, regionIds, keepRegion, slabs));
+    dataAlg.execute(FillBadDataInitialFrontierImpl(dims, m_FeatureIds, slabs));
+  }
+  regionIdsPtr = Int32ArrayType::NullPointer();
 
-    for(size_t j = 0; j < totalPoints; j++)
+  std::vector<int64_t> frontier;
+  for(auto& slab : slabs)
+  {
+    frontier.insert(frontier.end(), slab.frontier.begin(), slab.frontier.end());
+    std::vector<int64_t>().swap(slab.frontier);
+  }
+
+  QString attrMatName = m_FeatureIdsArrayPath.getAttributeMatrixName();
+  QList<QString> voxelArrayNames = m->getAttributeMatrix(attrMatName)->getAttributeArrayNames();
+  std::vector<IDataArray::Pointer> cellArrays;
+  for(const auto& arrayName : voxelArrayNames)
+  {
+    cellArrays.push_back(m->getAttributeMatrix(attrMatName)->getAttributeArray(arrayName));
+  }
+
+  // Grow the Features into the small defects one layer at a time. Each pass only visits the cells on the
+  // advancing boundary; all votes of a pass are cast before any cell is filled so the result does not depend
+  // on the order in which the cells are processed.
+  const size_t cellsPerChunk = 4096;
+  std::vector<int64_t> sources;
+  std::vector<std::vector<int64_t>> nextFrontiers;
+  size_t pass = 0;
+  while(!frontier.empty())
+  {
+    if(getCancel())
     {
-      featurename = m_FeatureIds[j];
-      neighbor = m_Neighbors[j];
-      if(featurename < 0 && neighbor != -1 && m_FeatureIds[neighbor] > 0)
-      {
-        for(const auto& arrayName : voxelArrayNames)
-        {
-          IDataArray::Pointer p = m->getAttributeMatrix(attrMatName)->getAttributeArray(arrayName);
-          p->copyTuple(neighbor, j);
-        }
-      }
+      return;
+    }
+    pass++;
+    notifyStatusMessage(QObject::tr("Filling Defects || Pass %1 || %2 Cells").arg(pass).arg(frontier.size()));
+
+    sources.assign(frontier.size(), -1);
+    ParallelDataAlgorithm voteAlg;
+    voteAlg.setRange(0, frontier.size());
+    voteAlg.execute(FillBadDataVoteImpl(dims, m_FeatureIds, frontier, sources));
+
+    ParallelDataAlgorithm copyAlg;
+    copyAlg.setRange(0, frontier.size());
+    copyAlg.execute(FillBadDataCopyImpl(cellArrays, frontier, sources));
+
+    const size_t numChunks = (frontier.size() + cellsPerChunk - 1) / cellsPerChunk;
+    nextFrontiers.assign(numChunks, std::vector<int64_t>());
+    ParallelDataAlgorithm advanceAlg;
+    advanceAlg.setRange(0, numChunks);
+    advanceAlg.setGrain(1);
+    advanceAlg.execute(FillBadDataAdvanceImpl(dims, m_FeatureIds, frontier, cellsPerChunk, nextFrontiers));
+
+    frontier.clear();
+    for(const auto& nextFrontier : nextFrontiers)
+    {
+      frontier.insert(frontier.end(), nextFrontier.begin(), nextFrontier.end());
     }
+    std::sort(frontier.begin(), frontier.end());
+    frontier.erase(std::unique(frontier.begin(), frontier.end()), frontier.end());
   }
 }
 
@@ -226,9 +226,6 @@ private:
   DataArrayPath m_CellPhasesArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::Phases};
   std::vector<DataArrayPath> m_IgnoredDataArrayPaths = {};
 
-  bool* m_AlreadyChecked;
-  int32_t* m_Neighbors;
-
 public:
   FillBadData(const FillBadData&) = delete;            // Copy Constructor Not Implemented
   FillBadData(FillBadData&&) = delete;                 // Move Constructor Not Implemented
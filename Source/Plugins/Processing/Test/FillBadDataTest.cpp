@@ -0,0 +1,313 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, Data, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <QtCore/QDebug>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "UnitTestSupport.hpp"
+
+#include "ProcessingTestFileLocations.h"
+
+namespace FillBadDataTestConsts
+{
+const QString k_DataContainerName("FillBadDataContainer");
+const QString k_CellAttributeMatrixName("CellData");
+const QString k_ConfidenceArrayName("Confidence");
+} // namespace FillBadDataTestConsts
+
+class FillBadDataTest
+{
+
+public:
+  FillBadDataTest() = default;
+  ~FillBadDataTest() = default;
+  FillBadDataTest(const FillBadDataTest&) = delete;            // Copy Constructor Not Implemented
+  FillBadDataTest(FillBadDataTest&&) = delete;                 // Move Constructor Not Implemented
+  FillBadDataTest& operator=(const FillBadDataTest&) = delete; // Copy Assignment Not Implemented
+  FillBadDataTest& operator=(FillBadDataTest&&) = delete;      // Move Assignment Not Implemented
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFilterAvailability()
+  {
+    // Now instantiate the FillBadData Filter from the FilterManager
+    QString filtName = "FillBadData";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    if(nullptr == filterFactory.get())
+    {
+      std::stringstream ss;
+      ss << "The FillBadDataTest Requires the use of the " << filtName.toStdString() << " filter which is found in the Processing Plugin";
+      DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Creates an image with the given Feature Ids. Odd Features are phase 1, even Features phase 2 and bad cells
+  // phase 0. The confidence of each cell is its index, so it shows which cell every filled cell was copied from
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer initializeDataContainerArray(std::vector<size_t> tDims, const std::vector<int32_t>& features)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+
+    DataContainer::Pointer m = DataContainer::New(FillBadDataTestConsts::k_DataContainerName);
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    geom->setDimensions(tDims.data());
+    m->setGeometry(geom);
+    dca->addOrReplaceDataContainer(m);
+
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tDims, FillBadDataTestConsts::k_CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+    m->addOrReplaceAttributeMatrix(cellAttrMat);
+
+    std::vector<size_t> cDims(1, 1);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(tDims, cDims, SIMPL::CellData::FeatureIds, true);
+    Int32ArrayType::Pointer phases = Int32ArrayType::CreateArray(tDims, cDims, SIMPL::CellData::Phases, true);
+    FloatArrayType::Pointer confidence = FloatArrayType::CreateArray(tDims, cDims, FillBadDataTestConsts::k_ConfidenceArrayName, true);
+    DREAM3D_REQUIRE_EQUAL(featureIds->getNumberOfTuples(), features.size());
+    for(size_t i = 0; i < features.size(); i++)
+    {
+      featureIds->setValue(i, features[i]);
+      phases->setValue(i, features[i] == 0 ? 0 : 2 - features[i] % 2);
+      confidence->setValue(i, static_cast<float>(i));
+    }
+    cellAttrMat->insertOrAssign(featureIds);
+    cellAttrMat->insertOrAssign(phases);
+    cellAttrMat->insertOrAssign(confidence);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void runFillBadData(const DataContainerArray::Pointer& dca, int minAllowedDefectSize)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName("FillBadData");
+    DREAM3D_REQUIRE_VALID_POINTER(filterFactory.get());
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    var.setValue(DataArrayPath(FillBadDataTestConsts::k_DataContainerName, FillBadDataTestConsts::k_CellAttributeMatrixName, SIMPL::CellData::FeatureIds));
+    DREAM3D_REQUIRE(filter->setProperty("FeatureIdsArrayPath", var));
+    var.setValue(DataArrayPath(FillBadDataTestConsts::k_DataContainerName, FillBadDataTestConsts::k_CellAttributeMatrixName, SIMPL::CellData::Phases));
+    DREAM3D_REQUIRE(filter->setProperty("CellPhasesArrayPath", var));
+    var.setValue(minAllowedDefectSize);
+    DREAM3D_REQUIRE(filter->setProperty("MinAllowedDefectSize", var));
+    var.setValue(true);
+    DREAM3D_REQUIRE(filter->setProperty("StoreAsNewPhase", var));
+
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  typename DataArray<T>::Pointer getCellArray(const DataContainerArray::Pointer& dca, const QString& arrayName)
+  {
+    AttributeMatrix::Pointer cellAttrMat = dca->getAttributeMatrix(DataArrayPath(FillBadDataTestConsts::k_DataContainerName, FillBadDataTestConsts::k_CellAttributeMatrixName, ""));
+    DREAM3D_REQUIRE_VALID_POINTER(cellAttrMat.get());
+    typename DataArray<T>::Pointer array = cellAttrMat->getAttributeArrayAs<DataArray<T>>(arrayName);
+    DREAM3D_REQUIRE_VALID_POINTER(array.get());
+    return array;
+  }
+
+  // -----------------------------------------------------------------------------
+  // A 9x7 image with a 3x3 block of bad cells that takes two passes to fill, a single bad cell whose neighbors tie
+  // two to two, and a group of 10 bad cells in the lower right that is kept as a defect
+  // -----------------------------------------------------------------------------
+  int TestKnownPattern()
+  {
+    // clang-format off
+    std::vector<int32_t> features = {
+        1, 1, 1, 1, 1, 2, 2, 2, 2,
+        1, 0, 0, 0, 1, 1, 2, 2, 2,
+        1, 0, 0, 0, 1, 1, 0, 1, 2,
+        1, 0, 0, 0, 1, 3, 2, 2, 2,
+        3, 3, 3, 3, 3, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 0, 0, 4, 4,
+    };
+
+    // The block fills from its edges inwards and its center takes the value of its +x neighbor, which was
+    // filled from Feature 1 in the first pass. The tied cell at (6, 2) goes to Feature 1, which reached two
+    // votes first in the -z, -y, -x, +x, +y, +z neighbor order
+    std::vector<int32_t> expectedFeatures = {
+        1, 1, 1, 1, 1, 2, 2, 2, 2,
+        1, 1, 1, 1, 1, 1, 2, 2, 2,
+        1, 1, 1, 1, 1, 1, 1, 1, 2,
+        1, 1, 3, 1, 1, 3, 2, 2, 2,
+        3, 3, 3, 3, 3, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 0, 0, 4, 4,
+    };
+
+    // The kept defect is given the new phase 3
+    std::vector<int32_t> expectedPhases = {
+        1, 1, 1, 1, 1, 2, 2, 2, 2,
+        1, 1, 1, 1, 1, 1, 2, 2, 2,
+        1, 1, 1, 1, 1, 1, 1, 1, 2,
+        1, 1, 1, 1, 1, 1, 2, 2, 2,
+        1, 1, 1, 1, 1, 3, 3, 3, 3,
+        1, 1, 1, 1, 1, 3, 3, 3, 3,
+        1, 1, 1, 1, 1, 3, 3, 2, 2,
+    };
+
+    // Index of the cell whose values each cell ends up with
+    std::vector<float> expectedConfidence = {
+         0,  1,  2,  3,  4,  5,  6,  7,  8,
+         9,  9,  2, 13, 13, 14, 15, 16, 17,
+        18, 18, 22, 22, 22, 23, 25, 25, 26,
+        27, 27, 38, 31, 31, 32, 33, 34, 35,
+        36, 37, 38, 39, 40, 41, 42, 43, 44,
+        45, 46, 47, 48, 49, 50, 51, 52, 53,
+        54, 55, 56, 57, 58, 59, 60, 61, 62,
+    };
+    // clang-format on
+
+    for(int run = 0; run < 2; run++)
+    {
+      DataContainerArray::Pointer dca = initializeDataContainerArray({9, 7, 1}, features);
+      runFillBadData(dca, 10);
+
+      Int32ArrayType::Pointer featureIds = getCellArray<int32_t>(dca, SIMPL::CellData::FeatureIds);
+      Int32ArrayType::Pointer phases = getCellArray<int32_t>(dca, SIMPL::CellData::Phases);
+      FloatArrayType::Pointer confidence = getCellArray<float>(dca, FillBadDataTestConsts::k_ConfidenceArrayName);
+      for(size_t i = 0; i < features.size(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(featureIds->getValue(i), expectedFeatures[i]);
+        DREAM3D_REQUIRE_EQUAL(phases->getValue(i), expectedPhases[i]);
+        DREAM3D_REQUIRE_EQUAL(confidence->getValue(i), expectedConfidence[i]);
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // A 40x40x40 volume of 8x8x8 Features with scattered bad cells and a few larger voids. The labeling splits it into
+  // slabs, so defect regions cross slab boundaries whenever the filter labels them on more than one thread.
+  // Every run has to give exactly the same cells
+  // -----------------------------------------------------------------------------
+  int TestRepeatedRuns()
+  {
+    const size_t dim = 40;
+    std::vector<int32_t> features(dim * dim * dim);
+    uint32_t noise = 2463534242u;
+    for(size_t z = 0; z < dim; z++)
+    {
+      for(size_t y = 0; y < dim; y++)
+      {
+        for(size_t x = 0; x < dim; x++)
+        {
+          size_t index = (z * dim + y) * dim + x;
+          features[index] = static_cast<int32_t>(((z / 8) * 5 + (y / 8)) * 5 + (x / 8) + 1);
+
+          noise = noise * 1664525u + 1013904223u;
+          if((noise >> 24) < 40)
+          {
+            features[index] = 0;
+          }
+          // Voids of 4x4x4 cells centered on the Feature corners are kept as defects
+          if((x + 2) % 8 < 4 && (y + 2) % 8 < 4 && (z + 2) % 8 < 4 && x > 4 && y > 4 && z > 4)
+          {
+            features[index] = 0;
+          }
+        }
+      }
+    }
+
+    std::vector<int32_t> firstFeatures;
+    std::vector<int32_t> firstPhases;
+    std::vector<float> firstConfidence;
+    for(int run = 0; run < 3; run++)
+    {
+      DataContainerArray::Pointer dca = initializeDataContainerArray({dim, dim, dim}, features);
+      runFillBadData(dca, 32);
+
+      Int32ArrayType::Pointer featureIds = getCellArray<int32_t>(dca, SIMPL::CellData::FeatureIds);
+      Int32ArrayType::Pointer phases = getCellArray<int32_t>(dca, SIMPL::CellData::Phases);
+      FloatArrayType::Pointer confidence = getCellArray<float>(dca, FillBadDataTestConsts::k_ConfidenceArrayName);
+      if(run == 0)
+      {
+        firstFeatures.assign(featureIds->getPointer(0), featureIds->getPointer(0) + featureIds->getNumberOfTuples());
+        firstPhases.assign(phases->getPointer(0), phases->getPointer(0) + phases->getNumberOfTuples());
+        firstConfidence.assign(confidence->getPointer(0), confidence->getPointer(0) + confidence->getNumberOfTuples());
+
+        // Every small defect is reachable from a Feature, and only the voids keep a Feature Id of 0
+        for(size_t i = 0; i < firstFeatures.size(); i++)
+        {
+          DREAM3D_REQUIRED(firstFeatures[i], >=, 0);
+          DREAM3D_REQUIRE_EQUAL(firstFeatures[i] == 0, firstPhases[i] == 3);
+        }
+        continue;
+      }
+      for(size_t i = 0; i < firstFeatures.size(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(featureIds->getValue(i), firstFeatures[i]);
+        DREAM3D_REQUIRE_EQUAL(phases->getValue(i), firstPhases[i]);
+        DREAM3D_REQUIRE_EQUAL(confidence->getValue(i), firstConfidence[i]);
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### FillBadDataTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestFilterAvailability());
+
+    DREAM3D_REGISTER_TEST(TestKnownPattern());
+    DREAM3D_REGISTER_TEST(TestRepeatedRuns());
+  }
+};
@@ -43,6 +43,7 @@
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
@@ -52,9 +53,21 @@
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 
+#include "EbsdLib/LaueOps/CubicLowOps.h"
+#include "EbsdLib/LaueOps/CubicOps.h"
+#include "EbsdLib/LaueOps/HexagonalLowOps.h"
+#include "EbsdLib/LaueOps/HexagonalOps.h"
 #include "EbsdLib/LaueOps/LaueOps.h"
+#include "EbsdLib/LaueOps/MonoclinicOps.h"
+#include "EbsdLib/LaueOps/OrthoRhombicOps.h"
+#include "EbsdLib/LaueOps/TetragonalLowOps.h"
+#include "EbsdLib/LaueOps/TetragonalOps.h"
+#include "EbsdLib/LaueOps/TriclinicOps.h"
+#include "EbsdLib/LaueOps/TrigonalLowOps.h"
+#include "EbsdLib/LaueOps/TrigonalOps.h"
 
 #include "Reconstruction/ReconstructionConstants.h"
+#include "Reconstruction/ReconstructionFilters/Utils/SegmentFeaturesKernels.hpp"
 #include "Reconstruction/ReconstructionVersion.h"
 
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
@@ -89,6 +102,7 @@ void EBSDSegmentFeatures::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Misorientation Tolerance (Degrees)", MisorientationTolerance, FilterParameter::Category::Parameter, EBSDSegmentFeatures));
   std::vector<QString> linkedProps = {"GoodVoxelsArrayPath"};
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Mask Array", UseGoodVoxels, FilterParameter::Category::Parameter, EBSDSegmentFeatures, linkedProps));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Use Parallel Segmentation", UseParallelSegmentation, FilterParameter::Category::Parameter, EBSDSegmentFeatures));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Float, 4, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
@@ -131,6 +145,7 @@ void EBSDSegmentFeatures::readFilterParameters(AbstractFilterParametersReader* r
   setCellPhasesArrayPath(reader->readDataArrayPath("CellPhasesArrayPath", getCellPhasesArrayPath()));
   setGoodVoxelsArrayPath(reader->readDataArrayPath("GoodVoxelsArrayPath", getGoodVoxelsArrayPath()));
   setUseGoodVoxels(reader->readValue("UseGoodVoxels", getUseGoodVoxels()));
+  setUseParallelSegmentation(reader->readValue("UseParallelSegmentation", getUseParallelSegmentation()));
   setMisorientationTolerance(reader->readValue("MisorientationTolerance", getMisorientationTolerance()));
   reader->closeFilterGroup();
 }
@@ -332,38 +347,155 @@ int64_t EBSDSegmentFeatures::getSeed(int32_t gnum, int64_t nextSeed)
 // -----------------------------------------------------------------------------
 bool EBSDSegmentFeatures::determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum)
 {
-  bool group = false;
-
-  // Get the phases for each voxel
-  int32_t phase1 = m_CrystalStructures[m_CellPhases[referencepoint]];
-  int32_t phase2 = m_CrystalStructures[m_CellPhases[neighborpoint]];
-  // If either of the phases is 999 then we bail out now.
-  if(phase1 >= m_OrientationOps.size() || phase2 >= m_OrientationOps.size())
+  if(m_FeatureIds[neighborpoint] == 0 && isGroupCandidate(neighborpoint) && compareNeighbors(referencepoint, neighborpoint))
   {
-    return group;
+    m_FeatureIds[neighborpoint] = gnum;
+    return true;
   }
-  float* currentQuatPtr = nullptr;
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t* EBSDSegmentFeatures::getSegmentationFeatureIds()
+{
+  return m_FeatureIds;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool EBSDSegmentFeatures::isSeedCandidate(int64_t point) const
+{
+  return (!m_UseGoodVoxels || m_GoodVoxels[point]) && m_CellPhases[point] > 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool EBSDSegmentFeatures::isGroupCandidate(int64_t point) const
+{
+  return !m_UseGoodVoxels || m_GoodVoxels[point];
+}
 
-  if(m_FeatureIds[neighborpoint] == 0 && (!m_UseGoodVoxels || m_GoodVoxels[neighborpoint]))
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool EBSDSegmentFeatures::compareNeighbors(int64_t referencepoint, int64_t neighborpoint) const
+{
+  if(m_CellPhases[referencepoint] != m_CellPhases[neighborpoint])
   {
-    float w = std::numeric_limits<float>::max();
-    currentQuatPtr = m_Quats + referencepoint * 4;
-    QuatF q1(currentQuatPtr[0], currentQuatPtr[1], currentQuatPtr[2], currentQuatPtr[3]);
-    currentQuatPtr = m_Quats + neighborpoint * 4;
-    QuatF q2(currentQuatPtr[0], currentQuatPtr[1], currentQuatPtr[2], currentQuatPtr[3]);
+    return false;
+  }
+  // If the crystal structure is unknown (999) then we bail out now.
+  uint32_t phase1 = m_CrystalStructures[m_CellPhases[referencepoint]];
+  if(phase1 >= m_OrientationOps.size())
+  {
+    return false;
+  }
+
+  const float* currentQuatPtr = m_Quats + referencepoint * 4;
+  QuatF q1(currentQuatPtr[0], currentQuatPtr[1], currentQuatPtr[2], currentQuatPtr[3]);
+  currentQuatPtr = m_Quats + neighborpoint * 4;
+  QuatF q2(currentQuatPtr[0], currentQuatPtr[1], currentQuatPtr[2], currentQuatPtr[3]);
+
+  OrientationF axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
+  return axisAngle[3] < m_MisoTolerance;
+}
 
-    if(m_CellPhases[referencepoint] == m_CellPhases[neighborpoint])
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EBSDSegmentFeatures::segmentParallel(const int64_t dims[3], int32_t* featureIds)
+{
+  const bool* goodVoxels = m_UseGoodVoxels ? m_GoodVoxels : nullptr;
+  const size_t numEnsembles = m_CrystalStructuresPtr.lock()->getNumberOfTuples();
+
+  // Resolve the symmetry operators of each phase once. Phases with an unknown crystal structure never group.
+  std::vector<const LaueOps*> phaseOps(numEnsembles, nullptr);
+  std::vector<uint8_t> validPhases(numEnsembles, 0);
+  uint32_t crystalStructure = EbsdLib::CrystalStructure::UnknownCrystalStructure;
+  bool uniformCrystalStructure = true;
+  for(size_t i = 0; i < numEnsembles; i++)
+  {
+    if(m_CrystalStructures[i] >= m_OrientationOps.size())
     {
-      OrientationF axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
-      w = axisAngle[3];
+      continue;
     }
-    if(w < m_MisoTolerance)
+    phaseOps[i] = m_OrientationOps[m_CrystalStructures[i]].get();
+    validPhases[i] = 1;
+    if(crystalStructure != EbsdLib::CrystalStructure::UnknownCrystalStructure && crystalStructure != m_CrystalStructures[i])
     {
-      group = true;
-      m_FeatureIds[neighborpoint] = gnum;
+      uniformCrystalStructure = false;
     }
+    crystalStructure = m_CrystalStructures[i];
+  }
+
+  if(!uniformCrystalStructure)
+  {
+    crystalStructure = EbsdLib::CrystalStructure::UnknownCrystalStructure;
+  }
+
+  size_t numFeatures = 0;
+  switch(crystalStructure)
+  {
+  case EbsdLib::CrystalStructure::Hexagonal_High:
+    numFeatures = SegmentFeaturesKernels::SegmentVolume(
+        this, dims, featureIds, SegmentFeaturesKernels::MisorientationPredicate<HexagonalOps>(m_Quats, m_CellPhases, goodVoxels, validPhases, m_MisoTolerance));
+    break;
+  case EbsdLib::CrystalStructure::Cubic_High:
+    numFeatures =
+        SegmentFeaturesKernels::SegmentVolume(this, dims, featureIds, SegmentFeaturesKernels::MisorientationPredicate<CubicOps>(m_Quats, m_CellPhases, goodVoxels, validPhases, m_MisoTolerance));
+    break;
+  case EbsdLib::CrystalStructure::Hexagonal_Low:
+    numFeatures = SegmentFeaturesKernels::SegmentVolume(
+        this, dims, featureIds, SegmentFeaturesKernels::MisorientationPredicate<HexagonalLowOps>(m_Quats, m_CellPhases, goodVoxels, validPhases, m_MisoTolerance));
+    break;
+  case EbsdLib::CrystalStructure::Cubic_Low:
+    numFeatures =
+        SegmentFeaturesKernels::SegmentVolume(this, dims, featureIds, SegmentFeaturesKernels::MisorientationPredicate<CubicLowOps>(m_Quats, m_CellPhases, goodVoxels, validPhases, m_MisoTolerance));
+    break;
+  case EbsdLib::CrystalStructure::Triclinic:
+    numFeatures =
+        SegmentFeaturesKernels::SegmentVolume(this, dims, featureIds, SegmentFeaturesKernels::MisorientationPredicate<TriclinicOps>(m_Quats, m_CellPhases, goodVoxels, validPhases, m_MisoTolerance));
+    break;
+  case EbsdLib::CrystalStructure::Monoclinic:
+    numFeatures = SegmentFeaturesKernels::SegmentVolume(
+        this, dims, featureIds, SegmentFeaturesKernels::MisorientationPredicate<MonoclinicOps>(m_Quats, m_CellPhases, goodVoxels, validPhases, m_MisoTolerance));
+    break;
+  case EbsdLib::CrystalStructure::OrthoRhombic:
+    numFeatures = SegmentFeaturesKernels::SegmentVolume(
+        this, dims, featureIds, SegmentFeaturesKernels::MisorientationPredicate<OrthoRhombicOps>(m_Quats, m_CellPhases, goodVoxels, validPhases, m_MisoTolerance));
+    break;
+  case EbsdLib::CrystalStructure::Tetragonal_Low:
+    numFeatures = SegmentFeaturesKernels::SegmentVolume(
+        this, dims, featureIds, SegmentFeaturesKernels::MisorientationPredicate<TetragonalLowOps>(m_Quats, m_CellPhases, goodVoxels, validPhases, m_MisoTolerance));
+    break;
+  case EbsdLib::CrystalStructure::Tetragonal_High:
+    numFeatures = SegmentFeaturesKernels::SegmentVolume(
+        this, dims, featureIds, SegmentFeaturesKernels::MisorientationPredicate<TetragonalOps>(m_Quats, m_CellPhases, goodVoxels, validPhases, m_MisoTolerance));
+    break;
+  case EbsdLib::CrystalStructure::Trigonal_Low:
+    numFeatures = SegmentFeaturesKernels::SegmentVolume(
+        this, dims, featureIds, SegmentFeaturesKernels::MisorientationPredicate<TrigonalLowOps>(m_Quats, m_CellPhases, goodVoxels, validPhases, m_MisoTolerance));
+    break;
+  case EbsdLib::CrystalStructure::Trigonal_High:
+    numFeatures =
+        SegmentFeaturesKernels::SegmentVolume(this, dims, featureIds, SegmentFeaturesKernels::MisorientationPredicate<TrigonalOps>(m_Quats, m_CellPhases, goodVoxels, validPhases, m_MisoTolerance));
+    break;
+  default:
+    // Mixed crystal structures fall back to looking up the symmetry operators of each phase
+    numFeatures = SegmentFeaturesKernels::SegmentVolume(this, dims, featureIds,
+                                                        SegmentFeaturesKernels::MultiPhaseMisorientationPredicate(m_Quats, m_CellPhases, goodVoxels, phaseOps, m_MisoTolerance));
+    break;
+  }
+
+  if(getCancel())
+  {
+    return;
   }
-  return group;
+  resizeSegmentedFeatures(numFeatures + 1);
 }
 
 // -----------------------------------------------------------------------------
@@ -112,7 +112,7 @@ public:
    * @brief Getter property for CellFeatureAttributeMatrixName
    * @return Value of CellFeatureAttributeMatrixName
    */
-  QString getCellFeatureAttributeMatrixName() const;
+  QString getCellFeatureAttributeMatrixName() const override;
   Q_PROPERTY(QString CellFeatureAttributeMatrixName READ getCellFeatureAttributeMatrixName WRITE setCellFeatureAttributeMatrixName)
 
   /**
@@ -295,6 +295,31 @@ protected:
    */
   bool determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum) override;
 
+  /**
+   * @brief getSegmentationFeatureIds Reimplemented from @see SegmentFeatures class
+   */
+  int32_t* getSegmentationFeatureIds() override;
+
+  /**
+   * @brief isSeedCandidate Reimplemented from @see SegmentFeatures class
+   */
+  bool isSeedCandidate(int64_t point) const override;
+
+  /**
+   * @brief isGroupCandidate Reimplemented from @see SegmentFeatures class
+   */
+  bool isGroupCandidate(int64_t point) const override;
+
+  /**
+   * @brief compareNeighbors Reimplemented from @see SegmentFeatures class
+   */
+  bool compareNeighbors(int64_t referencepoint, int64_t neighborpoint) const override;
+
+  /**
+   * @brief segmentParallel Reimplemented from @see SegmentFeatures class
+   */
+  void segmentParallel(const int64_t dims[3], int32_t* featureIds) override;
+
 private:
   std::weak_ptr<DataArray<float>> m_QuatsPtr;
   float* m_Quats = nullptr;
@@ -345,7 +370,7 @@ private:
   /**
    * @brief updateFeatureInstancePointers Updates raw Feature pointers
    */
-  void updateFeatureInstancePointers();
+  void updateFeatureInstancePointers() override;
 
 public:
   EBSDSegmentFeatures(const EBSDSegmentFeatures&) = delete;            // Copy Constructor Not Implemented
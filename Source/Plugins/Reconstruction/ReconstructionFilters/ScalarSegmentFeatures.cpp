@@ -42,6 +42,7 @@
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
@@ -51,6 +52,7 @@
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 #include "Reconstruction/ReconstructionConstants.h"
+#include "Reconstruction/ReconstructionFilters/Utils/SegmentFeaturesKernels.hpp"
 #include "Reconstruction/ReconstructionVersion.h"
 
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
@@ -72,7 +74,7 @@ class CompareFunctor
 public:
   virtual ~CompareFunctor() = default;
 
-  virtual bool operator()(int64_t index, int64_t neighIndex, int32_t gnum) // call using () operator
+  virtual bool operator()(int64_t index, int64_t neighIndex) const // call using () operator
   {
     return false;
   }
@@ -84,15 +86,14 @@ public:
 class TSpecificCompareFunctorBool : public CompareFunctor
 {
 public:
-  TSpecificCompareFunctorBool(void* data, int64_t length, bool tolerance, int32_t* featureIds)
+  TSpecificCompareFunctorBool(void* data, int64_t length, bool tolerance)
   : m_Length(length)
-  , m_FeatureIds(featureIds)
   {
     m_Data = reinterpret_cast<bool*>(data);
   }
   virtual ~TSpecificCompareFunctorBool() = default;
 
-  bool operator()(int64_t referencepoint, int64_t neighborpoint, int32_t gnum) override
+  bool operator()(int64_t referencepoint, int64_t neighborpoint) const override
   {
     // Sanity check the indices that are being passed in.
     if(referencepoint >= m_Length || neighborpoint >= m_Length)
@@ -100,21 +101,15 @@ public:
       return false;
     }
 
-    if(m_Data[neighborpoint] == m_Data[referencepoint])
-    {
-      m_FeatureIds[neighborpoint] = gnum;
-      return true;
-    }
-    return false;
+    return m_Data[neighborpoint] == m_Data[referencepoint];
   }
 
 protected:
   TSpecificCompareFunctorBool() = default;
 
 private:
-  bool* m_Data = nullptr;          // The data that is being compared
-  int64_t m_Length = 0;            // Length of the Data Array
-  int32_t* m_FeatureIds = nullptr; // The Feature Ids
+  bool* m_Data = nullptr; // The data that is being compared
+  int64_t m_Length = 0;   // Length of the Data Array
 };
 
 /**
@@ -124,16 +119,15 @@ template <class T>
 class TSpecificCompareFunctor : public CompareFunctor
 {
 public:
-  TSpecificCompareFunctor(void* data, int64_t length, T tolerance, int32_t* featureIds)
+  TSpecificCompareFunctor(void* data, int64_t length, T tolerance)
   : m_Length(length)
   , m_Tolerance(tolerance)
-  , m_FeatureIds(featureIds)
   {
     m_Data = reinterpret_cast<T*>(data);
   }
   virtual ~TSpecificCompareFunctor() = default;
 
-  bool operator()(int64_t referencepoint, int64_t neighborpoint, int32_t gnum) override
+  bool operator()(int64_t referencepoint, int64_t neighborpoint) const override
   {
     // Sanity check the indices that are being passed in.
     if(referencepoint >= m_Length || neighborpoint >= m_Length)
@@ -143,21 +137,9 @@ public:
 
     if(m_Data[referencepoint] >= m_Data[neighborpoint])
     {
-      if((m_Data[referencepoint] - m_Data[neighborpoint]) <= m_Tolerance)
-      {
-        m_FeatureIds[neighborpoint] = gnum;
-        return true;
-      }
-    }
-    else
-    {
-      if((m_Data[neighborpoint] - m_Data[referencepoint]) <= m_Tolerance)
-      {
-        m_FeatureIds[neighborpoint] = gnum;
-        return true;
-      }
+      return (m_Data[referencepoint] - m_Data[neighborpoint]) <= m_Tolerance;
     }
-    return false;
+    return (m_Data[neighborpoint] - m_Data[referencepoint]) <= m_Tolerance;
   }
 
 protected:
@@ -167,9 +149,19 @@ private:
   T* m_Data = nullptr;               // The data that is being compared
   int64_t m_Length = 0;              // Length of the Data Array
   T m_Tolerance = static_cast<T>(0); // The tolerance of the comparison
-  int32_t* m_FeatureIds = nullptr;   // The Feature Ids
 };
 
+/**
+ * @brief SegmentScalarVolume Runs the parallel labeling engine with a scalar predicate of the concrete data type
+ * so that the comparison inlines into the burn loop
+ */
+template <typename T>
+size_t SegmentScalarVolume(AbstractFilter* filter, const int64_t dims[3], int32_t* featureIds, void* data, const bool* goodVoxels, float tolerance)
+{
+  SegmentFeaturesKernels::ScalarPredicate<T> predicate(reinterpret_cast<T*>(data), goodVoxels, static_cast<T>(tolerance));
+  return SegmentFeaturesKernels::SegmentVolume(filter, dims, featureIds, predicate);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -190,6 +182,7 @@ void ScalarSegmentFeatures::setupFilterParameters()
   std::vector<QString> linkedProps = {"GoodVoxelsArrayPath"};
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Scalar Tolerance", ScalarTolerance, FilterParameter::Category::Parameter, ScalarSegmentFeatures));
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Mask Array", UseGoodVoxels, FilterParameter::Category::Parameter, ScalarSegmentFeatures, linkedProps));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Use Parallel Segmentation", UseParallelSegmentation, FilterParameter::Category::Parameter, ScalarSegmentFeatures));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, 1, AttributeMatrix::Type::Cell, IGeometry::Type::Any);
@@ -223,6 +216,7 @@ void ScalarSegmentFeatures::readFilterParameters(AbstractFilterParametersReader*
   setFeatureIdsArrayName(reader->readString("FeatureIdsArrayName", getFeatureIdsArrayName()));
   setGoodVoxelsArrayPath(reader->readDataArrayPath("GoodVoxelsArrayPath", getGoodVoxelsArrayPath()));
   setUseGoodVoxels(reader->readValue("UseGoodVoxels", getUseGoodVoxels()));
+  setUseParallelSegmentation(reader->readValue("UseParallelSegmentation", getUseParallelSegmentation()));
   setScalarArrayPath(reader->readDataArrayPath("ScalarArrayPath", getScalarArrayPath()));
   setScalarTolerance(reader->readValue("ScalarTolerance", getScalarTolerance()));
   reader->closeFilterGroup();
@@ -414,16 +408,120 @@ int64_t ScalarSegmentFeatures::getSeed(int32_t gnum, int64_t nextSeed)
 // -----------------------------------------------------------------------------
 bool ScalarSegmentFeatures::determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum)
 {
-  if(m_FeatureIds[neighborpoint] == 0 && (!m_UseGoodVoxels || m_GoodVoxels[neighborpoint]))
+  if(m_FeatureIds[neighborpoint] == 0 && isGroupCandidate(neighborpoint) && compareNeighbors(referencepoint, neighborpoint))
   {
-    CompareFunctor* func = m_Compare.get();
-    return (*func)((size_t)(referencepoint), (size_t)(neighborpoint), gnum);
-    //     | Functor  ||calling the operator() method of the CompareFunctor Class |
+    m_FeatureIds[neighborpoint] = gnum;
+    return true;
   }
 
   return false;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t* ScalarSegmentFeatures::getSegmentationFeatureIds()
+{
+  return m_FeatureIds;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ScalarSegmentFeatures::isSeedCandidate(int64_t point) const
+{
+  return !m_UseGoodVoxels || m_GoodVoxels[point];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ScalarSegmentFeatures::isGroupCandidate(int64_t point) const
+{
+  return !m_UseGoodVoxels || m_GoodVoxels[point];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ScalarSegmentFeatures::compareNeighbors(int64_t referencepoint, int64_t neighborpoint) const
+{
+  const CompareFunctor* func = m_Compare.get();
+  return (*func)(referencepoint, neighborpoint);
+  //     | Functor  ||calling the operator() method of the CompareFunctor Class |
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ScalarSegmentFeatures::segmentParallel(const int64_t dims[3], int32_t* featureIds)
+{
+  if(m_InputDataPtr.lock()->getNumberOfComponents() != 1)
+  {
+    SegmentFeatures::segmentParallel(dims, featureIds);
+    return;
+  }
+
+  const bool* goodVoxels = m_UseGoodVoxels ? m_GoodVoxels : nullptr;
+  QString dType = m_InputDataPtr.lock()->getTypeAsString();
+  size_t numFeatures = 0;
+  if(dType.compare("int8_t") == 0)
+  {
+    numFeatures = SegmentScalarVolume<int8_t>(this, dims, featureIds, m_InputData, goodVoxels, m_ScalarTolerance);
+  }
+  else if(dType.compare("uint8_t") == 0)
+  {
+    numFeatures = SegmentScalarVolume<uint8_t>(this, dims, featureIds, m_InputData, goodVoxels, m_ScalarTolerance);
+  }
+  else if(dType.compare("bool") == 0)
+  {
+    numFeatures = SegmentScalarVolume<bool>(this, dims, featureIds, m_InputData, goodVoxels, m_ScalarTolerance);
+  }
+  else if(dType.compare("int16_t") == 0)
+  {
+    numFeatures = SegmentScalarVolume<int16_t>(this, dims, featureIds, m_InputData, goodVoxels, m_ScalarTolerance);
+  }
+  else if(dType.compare("uint16_t") == 0)
+  {
+    numFeatures = SegmentScalarVolume<uint16_t>(this, dims, featureIds, m_InputData, goodVoxels, m_ScalarTolerance);
+  }
+  else if(dType.compare("int32_t") == 0)
+  {
+    numFeatures = SegmentScalarVolume<int32_t>(this, dims, featureIds, m_InputData, goodVoxels, m_ScalarTolerance);
+  }
+  else if(dType.compare("uint32_t") == 0)
+  {
+    numFeatures = SegmentScalarVolume<uint32_t>(this, dims, featureIds, m_InputData, goodVoxels, m_ScalarTolerance);
+  }
+  else if(dType.compare("int64_t") == 0)
+  {
+    numFeatures = SegmentScalarVolume<int64_t>(this, dims, featureIds, m_InputData, goodVoxels, m_ScalarTolerance);
+  }
+  else if(dType.compare("uint64_t") == 0)
+  {
+    numFeatures = SegmentScalarVolume<uint64_t>(this, dims, featureIds, m_InputData, goodVoxels, m_ScalarTolerance);
+  }
+  else if(dType.compare("float") == 0)
+  {
+    numFeatures = SegmentScalarVolume<float>(this, dims, featureIds, m_InputData, goodVoxels, m_ScalarTolerance);
+  }
+  else if(dType.compare("double") == 0)
+  {
+    numFeatures = SegmentScalarVolume<double>(this, dims, featureIds, m_InputData, goodVoxels, m_ScalarTolerance);
+  }
+  else
+  {
+    SegmentFeatures::segmentParallel(dims, featureIds);
+    return;
+  }
+
+  if(getCancel())
+  {
+    return;
+  }
+  resizeSegmentedFeatures(numFeatures + 1);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -463,47 +561,47 @@ void ScalarSegmentFeatures::execute()
   }
   else if(dType.compare("int8_t") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<int8_t>>(new TSpecificCompareFunctor<int8_t>(m_InputData, inDataPoints, static_cast<int8_t>(m_ScalarTolerance), m_FeatureIds));
+    m_Compare = std::shared_ptr<TSpecificCompareFunctor<int8_t>>(new TSpecificCompareFunctor<int8_t>(m_InputData, inDataPoints, static_cast<int8_t>(m_ScalarTolerance)));
   }
   else if(dType.compare("uint8_t") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<uint8_t>>(new TSpecificCompareFunctor<uint8_t>(m_InputData, inDataPoints, static_cast<uint8_t>(m_ScalarTolerance), m_FeatureIds));
+    m_Compare = std::shared_ptr<TSpecificCompareFunctor<uint8_t>>(new TSpecificCompareFunctor<uint8_t>(m_InputData, inDataPoints, static_cast<uint8_t>(m_ScalarTolerance)));
   }
   else if(dType.compare("bool") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctorBool>(new TSpecificCompareFunctorBool(m_InputData, inDataPoints, static_cast<bool>(m_ScalarTolerance), m_FeatureIds));
+    m_Compare = std::shared_ptr<TSpecificCompareFunctorBool>(new TSpecificCompareFunctorBool(m_InputData, inDataPoints, static_cast<bool>(m_ScalarTolerance)));
   }
   else if(dType.compare("int16_t") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<int16_t>>(new TSpecificCompareFunctor<int16_t>(m_InputData, inDataPoints, static_cast<int16_t>(m_ScalarTolerance), m_FeatureIds));
+    m_Compare = std::shared_ptr<TSpecificCompareFunctor<int16_t>>(new TSpecificCompareFunctor<int16_t>(m_InputData, inDataPoints, static_cast<int16_t>(m_ScalarTolerance)));
   }
   else if(dType.compare("uint16_t") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<uint16_t>>(new TSpecificCompareFunctor<uint16_t>(m_InputData, inDataPoints, static_cast<uint16_t>(m_ScalarTolerance), m_FeatureIds));
+    m_Compare = std::shared_ptr<TSpecificCompareFunctor<uint16_t>>(new TSpecificCompareFunctor<uint16_t>(m_InputData, inDataPoints, static_cast<uint16_t>(m_ScalarTolerance)));
   }
   else if(dType.compare("int32_t") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<int32_t>>(new TSpecificCompareFunctor<int32_t>(m_InputData, inDataPoints, static_cast<int32_t>(m_ScalarTolerance), m_FeatureIds));
+    m_Compare = std::shared_ptr<TSpecificCompareFunctor<int32_t>>(new TSpecificCompareFunctor<int32_t>(m_InputData, inDataPoints, static_cast<int32_t>(m_ScalarTolerance)));
   }
   else if(dType.compare("uint32_t") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<uint32_t>>(new TSpecificCompareFunctor<uint32_t>(m_InputData, inDataPoints, static_cast<uint32_t>(m_ScalarTolerance), m_FeatureIds));
+    m_Compare = std::shared_ptr<TSpecificCompareFunctor<uint32_t>>(new TSpecificCompareFunctor<uint32_t>(m_InputData, inDataPoints, static_cast<uint32_t>(m_ScalarTolerance)));
   }
   else if(dType.compare("int64_t") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<int64_t>>(new TSpecificCompareFunctor<int64_t>(m_InputData, inDataPoints, static_cast<int64_t>(m_ScalarTolerance), m_FeatureIds));
+    m_Compare = std::shared_ptr<TSpecificCompareFunctor<int64_t>>(new TSpecificCompareFunctor<int64_t>(m_InputData, inDataPoints, static_cast<int64_t>(m_ScalarTolerance)));
   }
   else if(dType.compare("uint64_t") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<uint64_t>>(new TSpecificCompareFunctor<uint64_t>(m_InputData, inDataPoints, static_cast<uint64_t>(m_ScalarTolerance), m_FeatureIds));
+    m_Compare = std::shared_ptr<TSpecificCompareFunctor<uint64_t>>(new TSpecificCompareFunctor<uint64_t>(m_InputData, inDataPoints, static_cast<uint64_t>(m_ScalarTolerance)));
   }
   else if(dType.compare("float") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<float>>(new TSpecificCompareFunctor<float>(m_InputData, inDataPoints, m_ScalarTolerance, m_FeatureIds));
+    m_Compare = std::shared_ptr<TSpecificCompareFunctor<float>>(new TSpecificCompareFunctor<float>(m_InputData, inDataPoints, m_ScalarTolerance));
   }
   else if(dType.compare("double") == 0)
   {
-    m_Compare = std::shared_ptr<TSpecificCompareFunctor<double>>(new TSpecificCompareFunctor<double>(m_InputData, inDataPoints, static_cast<double>(m_ScalarTolerance), m_FeatureIds));
+    m_Compare = std::shared_ptr<TSpecificCompareFunctor<double>>(new TSpecificCompareFunctor<double>(m_InputData, inDataPoints, static_cast<double>(m_ScalarTolerance)));
   }
 
   // Generate the random voxel indices that will be used for the seed points to start a new grain growth/agglomeration
@@ -42,8 +42,40 @@
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 #include "Reconstruction/ReconstructionConstants.h"
+#include "Reconstruction/ReconstructionFilters/Utils/SegmentFeaturesKernels.hpp"
 #include "Reconstruction/ReconstructionVersion.h"
 
+/**
+ * @brief The SegmentFeaturesVirtualPredicate class adapts the virtual grouping criteria of a SegmentFeatures
+ * subclass to the predicate interface of the templated labeling engine
+ */
+class SegmentFeaturesVirtualPredicate
+{
+public:
+  explicit SegmentFeaturesVirtualPredicate(const SegmentFeatures* filter)
+  : m_Filter(filter)
+  {
+  }
+
+  bool isSeedCandidate(int64_t point) const
+  {
+    return m_Filter->isSeedCandidate(point);
+  }
+
+  bool isGroupCandidate(int64_t point) const
+  {
+    return m_Filter->isGroupCandidate(point);
+  }
+
+  bool compareNeighbors(int64_t referencepoint, int64_t neighborpoint) const
+  {
+    return m_Filter->compareNeighbors(referencepoint, neighborpoint);
+  }
+
+private:
+  const SegmentFeatures* m_Filter = nullptr;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -97,6 +129,69 @@ bool SegmentFeatures::determineGrouping(int64_t referencepoint, int64_t neighbor
   return false;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t* SegmentFeatures::getSegmentationFeatureIds()
+{
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString SegmentFeatures::getCellFeatureAttributeMatrixName() const
+{
+  return QString();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SegmentFeatures::updateFeatureInstancePointers()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SegmentFeatures::resizeSegmentedFeatures(size_t numTuples)
+{
+  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
+  AttributeMatrix::Pointer cellFeatureAttrMat = m->getAttributeMatrix(getCellFeatureAttributeMatrixName());
+  if(nullptr == cellFeatureAttrMat)
+  {
+    return;
+  }
+  std::vector<size_t> tDims(1, numTuples);
+  cellFeatureAttrMat->resizeAttributeArrays(tDims);
+  updateFeatureInstancePointers();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SegmentFeatures::isSeedCandidate(int64_t point) const
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SegmentFeatures::isGroupCandidate(int64_t point) const
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SegmentFeatures::compareNeighbors(int64_t referencepoint, int64_t neighborpoint) const
+{
+  return false;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -120,6 +215,22 @@ void SegmentFeatures::execute()
       static_cast<int64_t>(udims[2]),
   };
 
+  int32_t* featureIds = getSegmentationFeatureIds();
+  if(getUseParallelSegmentation() && nullptr != featureIds)
+  {
+    segmentParallel(dims, featureIds);
+  }
+  else
+  {
+    segmentSerial(dims);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SegmentFeatures::segmentSerial(const int64_t dims[3])
+{
   int32_t gnum = 1;
   int64_t seed = 0;
   int64_t neighbor = 0;
@@ -220,6 +331,19 @@ void SegmentFeatures::execute()
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SegmentFeatures::segmentParallel(const int64_t dims[3], int32_t* featureIds)
+{
+  size_t numFeatures = SegmentFeaturesKernels::SegmentVolume(this, dims, featureIds, SegmentFeaturesVirtualPredicate(this));
+  if(getCancel())
+  {
+    return;
+  }
+  resizeSegmentedFeatures(numFeatures + 1);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -331,3 +455,15 @@ QString SegmentFeatures::getDataContainerName() const
 {
   return m_DataContainerName;
 }
+
+// -----------------------------------------------------------------------------
+void SegmentFeatures::setUseParallelSegmentation(bool value)
+{
+  m_UseParallelSegmentation = value;
+}
+
+// -----------------------------------------------------------------------------
+bool SegmentFeatures::getUseParallelSegmentation() const
+{
+  return m_UseParallelSegmentation;
+}
@@ -59,6 +59,7 @@ class Reconstruction_EXPORT SegmentFeatures : public AbstractFilter
   PYB11_SHARED_POINTERS(SegmentFeatures)
   PYB11_FILTER_NEW_MACRO(SegmentFeatures)
   PYB11_PROPERTY(QString DataContainerName READ getDataContainerName WRITE setDataContainerName)
+  PYB11_PROPERTY(bool UseParallelSegmentation READ getUseParallelSegmentation WRITE setUseParallelSegmentation)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -104,6 +105,25 @@ public:
 
   Q_PROPERTY(QString DataContainerName READ getDataContainerName WRITE setDataContainerName)
 
+  /**
+   * @brief Setter property for UseParallelSegmentation
+   */
+  void setUseParallelSegmentation(bool value);
+  /**
+   * @brief Getter property for UseParallelSegmentation
+   * @return Value of UseParallelSegmentation
+   */
+  bool getUseParallelSegmentation() const;
+
+  Q_PROPERTY(bool UseParallelSegmentation READ getUseParallelSegmentation WRITE setUseParallelSegmentation)
+
+  /**
+   * @brief getCellFeatureAttributeMatrixName Returns the name of the Feature Attribute Matrix that is resized
+   * once the parallel labeling engine has determined the final number of Features
+   * @return Name of the Feature Attribute Matrix
+   */
+  virtual QString getCellFeatureAttributeMatrixName() const;
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -188,6 +208,57 @@ protected:
    */
   virtual bool determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum);
 
+  /**
+   * @brief getSegmentationFeatureIds Returns the Feature Ids the parallel labeling engine writes into. Subclasses
+   * that return nullptr (the default) are always segmented with the serial burn algorithm
+   * @return Raw pointer to the Feature Ids
+   */
+  virtual int32_t* getSegmentationFeatureIds();
+
+  /**
+   * @brief updateFeatureInstancePointers Updates the raw Feature pointers after the Feature Attribute Matrix was resized
+   */
+  virtual void updateFeatureInstancePointers();
+
+  /**
+   * @brief resizeSegmentedFeatures Resizes the Feature Attribute Matrix once the parallel labeling engine has
+   * determined the final number of Features
+   * @param numTuples Number of Features, including the zero Feature
+   */
+  void resizeSegmentedFeatures(size_t numTuples);
+
+  /**
+   * @brief isSeedCandidate Determines if a point may start a new Feature, ignoring the current Feature Ids
+   * @param point Point to check
+   * @return Boolean check for whether the point is a valid seed
+   */
+  virtual bool isSeedCandidate(int64_t point) const;
+
+  /**
+   * @brief isGroupCandidate Determines if a point may be added to a growing Feature, ignoring the current Feature Ids
+   * @param point Point to check
+   * @return Boolean check for whether the point may be grouped
+   */
+  virtual bool isGroupCandidate(int64_t point) const;
+
+  /**
+   * @brief compareNeighbors Side effect free version of determineGrouping that only applies the grouping criterion
+   * @param referencepoint Point of growing seed
+   * @param neighborpoint Point to be compared for adding
+   * @return Boolean check for whether the two points belong to the same Feature
+   */
+  virtual bool compareNeighbors(int64_t referencepoint, int64_t neighborpoint) const;
+
+  /**
+   * @brief segmentParallel Segments the volume by labeling slabs of the grid concurrently and merging the
+   * labels across the slab boundaries with a union-find. The resulting Feature Ids are identical to the
+   * ones produced by the serial burn algorithm. The default implementation evaluates the virtual grouping
+   * criteria; subclasses may override it to run the labeling engine with a concrete predicate instead.
+   * @param dims Dimensions of the grid
+   * @param featureIds Feature Ids to label
+   */
+  virtual void segmentParallel(const int64_t dims[3], int32_t* featureIds);
+
 public:
   SegmentFeatures(const SegmentFeatures&) = delete;            // Copy Constructor Not Implemented
   SegmentFeatures(SegmentFeatures&&) = delete;                 // Move Constructor Not Implemented
@@ -196,4 +267,13 @@ public:
 
 private:
   QString m_DataContainerName = {SIMPL::Defaults::ImageDataContainerName};
+  bool m_UseParallelSegmentation = {true};
+
+  friend class SegmentFeaturesVirtualPredicate;
+
+  /**
+   * @brief segmentSerial Segments the volume with the seed ordered burn algorithm
+   * @param dims Dimensions of the grid
+   */
+  void segmentSerial(const int64_t dims[3]);
 };
@@ -119,7 +119,7 @@ public:
    * @brief Getter property for CellFeatureAttributeMatrixName
    * @return Value of CellFeatureAttributeMatrixName
    */
-  QString getCellFeatureAttributeMatrixName() const;
+  QString getCellFeatureAttributeMatrixName() const override;
   Q_PROPERTY(QString CellFeatureAttributeMatrixName READ getCellFeatureAttributeMatrixName WRITE setCellFeatureAttributeMatrixName)
 
   /**
@@ -261,6 +261,10 @@ protected:
 
   int64_t getSeed(int32_t gnum, int64_t nextSeed) override;
   bool determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum) override;
+  int32_t* getSegmentationFeatureIds() override;
+  bool isSeedCandidate(int64_t point) const override;
+  bool isGroupCandidate(int64_t point) const override;
+  bool compareNeighbors(int64_t referencepoint, int64_t neighborpoint) const override;
 
 private:
   std::weak_ptr<DataArray<float>> m_SineParamsPtr;
@@ -304,7 +308,7 @@ private:
   /**
    * @brief updateFeatureInstancePointers Updates raw Feature pointers
    */
-  void updateFeatureInstancePointers();
+  void updateFeatureInstancePointers() override;
 
   bool m_MissingGoodVoxels;
 
@@ -0,0 +1,705 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+#include "EbsdLib/Core/Orientation.hpp"
+#include "EbsdLib/Core/OrientationTransformation.hpp"
+#include "EbsdLib/Core/Quaternion.hpp"
+#include "EbsdLib/LaueOps/LaueOps.h"
+
+/**
+ * @brief The SegmentFeaturesKernels namespace holds the slab parallel labeling engine used by the SegmentFeatures
+ * family of filters along with the neighbor predicates that it is instantiated with. A predicate is any class that
+ * provides the following const member functions:
+ *
+ *   bool isSeedCandidate(int64_t point)  - The point may start a new Feature
+ *   bool isGroupCandidate(int64_t point) - The point may be added to a growing Feature
+ *   bool compareNeighbors(int64_t referencepoint, int64_t neighborpoint) - The two points belong to the same Feature
+ *
+ * Because the engine is a template over the predicate, the whole burn loop inlines for each predicate type.
+ */
+namespace SegmentFeaturesKernels
+{
+
+/**
+ * @brief The Slab struct describes a contiguous range of grid lines (rows of constant y and z index) that is
+ * labeled independently of the rest of the volume. The slab keeps the lowest seed candidate of each locally
+ * labeled region and the pairs of provisional labels that connect across its upper boundary.
+ */
+struct Slab
+{
+  int64_t beginLine = 0;
+  int64_t endLine = 0;
+  int64_t labelOffset = 0;
+  std::vector<int64_t> seeds;
+  std::vector<std::pair<int64_t, int64_t>> seams;
+};
+
+/**
+ * @brief The LabelSlabsImpl class runs the burn algorithm inside each slab, writing slab local labels into the
+ * Feature Ids. Any point that may be grouped starts a region so that regions which only reach a valid seed through
+ * a neighboring slab are still found.
+ */
+template <typename Predicate>
+class LabelSlabsImpl
+{
+public:
+  LabelSlabsImpl(AbstractFilter* filter, const int64_t* dims, int32_t* featureIds, const Predicate& predicate, std::vector<Slab>& slabs)
+  : m_Filter(filter)
+  , m_Dims(dims)
+  , m_FeatureIds(featureIds)
+  , m_Predicate(predicate)
+  , m_Slabs(slabs)
+  {
+  }
+
+  void labelSlab(Slab& slab) const
+  {
+    const int64_t dimX = m_Dims[0];
+    const int64_t dimY = m_Dims[1];
+    const int64_t dimXY = m_Dims[0] * m_Dims[1];
+    const int64_t begin = slab.beginLine * dimX;
+    const int64_t end = slab.endLine * dimX;
+
+    std::vector<int64_t> voxelsList;
+    int64_t neighbors[6] = {0, 0, 0, 0, 0, 0};
+    int32_t label = 0;
+    for(int64_t seed = begin; seed < end; seed++)
+    {
+      if(m_FeatureIds[seed] != 0 || !m_Predicate.isGroupCandidate(seed))
+      {
+        continue;
+      }
+      if(m_Filter->getCancel())
+      {
+        return;
+      }
+
+      label++;
+      m_FeatureIds[seed] = label;
+      int64_t firstSeed = m_Predicate.isSeedCandidate(seed) ? seed : -1;
+      voxelsList.push_back(seed);
+      while(!voxelsList.empty())
+      {
+        int64_t currentpoint = voxelsList.back();
+        voxelsList.pop_back();
+        int64_t col = currentpoint % dimX;
+        int64_t line = currentpoint / dimX;
+        int64_t row = line % dimY;
+
+        // Only visit neighbors that lie inside this slab; the slab boundaries are stitched afterwards
+        int32_t numNeighbors = 0;
+        if(line - dimY >= slab.beginLine)
+        {
+          neighbors[numNeighbors++] = currentpoint - dimXY;
+        }
+        if(row > 0 && line - 1 >= slab.beginLine)
+        {
+          neighbors[numNeighbors++] = currentpoint - dimX;
+        }
+        if(col > 0)
+        {
+          neighbors[numNeighbors++] = currentpoint - 1;
+        }
+        if(col < dimX - 1)
+        {
+          neighbors[numNeighbors++] = currentpoint + 1;
+        }
+        if(row < dimY - 1 && line + 1 < slab.endLine)
+        {
+          neighbors[numNeighbors++] = currentpoint + dimX;
+        }
+        if(line + dimY < slab.endLine)
+        {
+          neighbors[numNeighbors++] = currentpoint + dimXY;
+        }
+
+        for(int32_t i = 0; i < numNeighbors; i++)
+        {
+          int64_t neighbor = neighbors[i];
+          if(m_FeatureIds[neighbor] == 0 && m_Predicate.isGroupCandidate(neighbor) && m_Predicate.compareNeighbors(currentpoint, neighbor))
+          {
+            m_FeatureIds[neighbor] = label;
+            voxelsList.push_back(neighbor);
+            if((firstSeed < 0 || neighbor < firstSeed) && m_Predicate.isSeedCandidate(neighbor))
+            {
+              firstSeed = neighbor;
+            }
+          }
+        }
+      }
+      slab.seeds.push_back(firstSeed);
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      labelSlab(m_Slabs[i]);
+    }
+  }
+
+private:
+  AbstractFilter* m_Filter = nullptr;
+  const int64_t* m_Dims = nullptr;
+  int32_t* m_FeatureIds = nullptr;
+  const Predicate& m_Predicate;
+  std::vector<Slab>& m_Slabs;
+};
+
+/**
+ * @brief The FindSeamsImpl class collects the pairs of provisional labels that are grouped across the upper
+ * boundary of each slab
+ */
+template <typename Predicate>
+class FindSeamsImpl
+{
+public:
+  FindSeamsImpl(AbstractFilter* filter, const int64_t* dims, int64_t linesPerSlab, int32_t* featureIds, const Predicate& predicate, std::vector<Slab>& slabs)
+  : m_Filter(filter)
+  , m_Dims(dims)
+  , m_LinesPerSlab(linesPerSlab)
+  , m_FeatureIds(featureIds)
+  , m_Predicate(predicate)
+  , m_Slabs(slabs)
+  {
+  }
+
+  int64_t provisionalLabel(int64_t point) const
+  {
+    const Slab& slab = m_Slabs[(point / m_Dims[0]) / m_LinesPerSlab];
+    return slab.labelOffset + m_FeatureIds[point] - 1;
+  }
+
+  void addSeam(Slab& slab, int64_t point, int64_t neighbor) const
+  {
+    if(m_FeatureIds[neighbor] == 0 || !m_Predicate.compareNeighbors(point, neighbor))
+    {
+      return;
+    }
+    std::pair<int64_t, int64_t> seam(provisionalLabel(point), provisionalLabel(neighbor));
+    if(slab.seams.empty() || slab.seams.back() != seam)
+    {
+      slab.seams.push_back(seam);
+    }
+  }
+
+  void findSeams(Slab& slab) const
+  {
+    const int64_t dimX = m_Dims[0];
+    const int64_t dimY = m_Dims[1];
+    const int64_t dimXY = m_Dims[0] * m_Dims[1];
+    const int64_t numLines = m_Dims[1] * m_Dims[2];
+    if(slab.endLine >= numLines)
+    {
+      return;
+    }
+
+    // Only the last plane worth of lines can have forward neighbors outside of the slab
+    for(int64_t line = std::max(slab.beginLine, slab.endLine - dimY); line < slab.endLine; line++)
+    {
+      if(m_Filter->getCancel())
+      {
+        return;
+      }
+      bool lastLine = (line == slab.endLine - 1) && (line % dimY) < (dimY - 1);
+      bool hasPlaneAbove = line + dimY < numLines;
+      for(int64_t col = 0; col < dimX; col++)
+      {
+        int64_t point = line * dimX + col;
+        if(m_FeatureIds[point] == 0)
+        {
+          continue;
+        }
+        if(hasPlaneAbove)
+        {
+          addSeam(slab, point, point + dimXY);
+        }
+        if(lastLine)
+        {
+          addSeam(slab, point, point + dimX);
+        }
+      }
+    }
+
+    std::sort(slab.seams.begin(), slab.seams.end());
+    slab.seams.erase(std::unique(slab.seams.begin(), slab.seams.end()), slab.seams.end());
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      findSeams(m_Slabs[i]);
+    }
+  }
+
+private:
+  AbstractFilter* m_Filter = nullptr;
+  const int64_t* m_Dims = nullptr;
+  int64_t m_LinesPerSlab = 1;
+  int32_t* m_FeatureIds = nullptr;
+  const Predicate& m_Predicate;
+  std::vector<Slab>& m_Slabs;
+};
+
+/**
+ * @brief The RelabelImpl class replaces the slab local labels with the final Feature Ids
+ */
+class RelabelImpl
+{
+public:
+  RelabelImpl(const int64_t* dims, int32_t* featureIds, const std::vector<Slab>& slabs, const std::vector<int32_t>& finalIds)
+  : m_Dims(dims)
+  , m_FeatureIds(featureIds)
+  , m_Slabs(slabs)
+  , m_FinalIds(finalIds)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      const Slab& slab = m_Slabs[i];
+      const int64_t end = slab.endLine * m_Dims[0];
+      for(int64_t point = slab.beginLine * m_Dims[0]; point < end; point++)
+      {
+        if(m_FeatureIds[point] != 0)
+        {
+          m_FeatureIds[point] = m_FinalIds[slab.labelOffset + m_FeatureIds[point] - 1];
+        }
+      }
+    }
+  }
+
+private:
+  const int64_t* m_Dims = nullptr;
+  int32_t* m_FeatureIds = nullptr;
+  const std::vector<Slab>& m_Slabs;
+  const std::vector<int32_t>& m_FinalIds;
+};
+
+/**
+ * @brief SegmentVolume Labels the Features of a grid by burning slabs of the grid concurrently and merging the
+ * labels across the slab boundaries with a union-find. Features are numbered in the order of their lowest seed
+ * candidate, which makes the Feature Ids identical to the ones produced by the serial, seed ordered burn algorithm.
+ * @param filter Filter used for cancellation and status messages
+ * @param dims Dimensions of the grid
+ * @param featureIds Feature Ids to label. All values are expected to be zero on entry
+ * @param predicate Neighbor predicate
+ * @return Number of Features found, not counting the zero Feature
+ */
+template <typename Predicate>
+size_t SegmentVolume(AbstractFilter* filter, const int64_t dims[3], int32_t* featureIds, const Predicate& predicate)
+{
+  // Split the volume into slabs of whole grid lines, preferring whole planes so that each seam is a single plane
+  const int64_t numLines = dims[1] * dims[2];
+  const int64_t numThreads = std::max(static_cast<int64_t>(std::thread::hardware_concurrency()), static_cast<int64_t>(1));
+  int64_t linesPerSlab = std::max((numLines + 2 * numThreads - 1) / (2 * numThreads), static_cast<int64_t>(1));
+  if(linesPerSlab > dims[1])
+  {
+    linesPerSlab = ((linesPerSlab + dims[1] - 1) / dims[1]) * dims[1];
+  }
+  const int64_t numSlabs = (numLines + linesPerSlab - 1) / linesPerSlab;
+
+  std::vector<Slab> slabs(static_cast<size_t>(numSlabs));
+  for(int64_t i = 0; i < numSlabs; i++)
+  {
+    slabs[i].beginLine = i * linesPerSlab;
+    slabs[i].endLine = std::min((i + 1) * linesPerSlab, numLines);
+  }
+
+  filter->notifyStatusMessage(QObject::tr("Labeling %1 Slabs").arg(numSlabs));
+  ParallelDataAlgorithm labelAlg;
+  labelAlg.setRange(0, static_cast<size_t>(numSlabs));
+  labelAlg.setGrain(1);
+  labelAlg.execute(LabelSlabsImpl<Predicate>(filter, dims, featureIds, predicate, slabs));
+  if(filter->getCancel())
+  {
+    return 0;
+  }
+
+  int64_t numProvisional = 0;
+  for(auto& slab : slabs)
+  {
+    slab.labelOffset = numProvisional;
+    numProvisional += static_cast<int64_t>(slab.seeds.size());
+  }
+
+  filter->notifyStatusMessage("Merging Slab Boundaries");
+  ParallelDataAlgorithm seamAlg;
+  seamAlg.setRange(0, static_cast<size_t>(numSlabs));
+  seamAlg.setGrain(1);
+  seamAlg.execute(FindSeamsImpl<Predicate>(filter, dims, linesPerSlab, featureIds, predicate, slabs));
+  if(filter->getCancel())
+  {
+    return 0;
+  }
+
+  // Union-find over the provisional labels, always keeping the lower label as the root
+  std::vector<int64_t> parents(static_cast<size_t>(numProvisional));
+  std::iota(parents.begin(), parents.end(), 0);
+  auto findRoot = [&parents](int64_t label) {
+    while(parents[label] != label)
+    {
+      parents[label] = parents[parents[label]];
+      label = parents[label];
+    }
+    return label;
+  };
+  for(const auto& slab : slabs)
+  {
+    for(const auto& seam : slab.seams)
+    {
+      int64_t root1 = findRoot(seam.first);
+      int64_t root2 = findRoot(seam.second);
+      if(root1 != root2)
+      {
+        parents[std::max(root1, root2)] = std::min(root1, root2);
+      }
+    }
+  }
+
+  // A merged region becomes a Feature only if it holds a valid seed
+  std::vector<int64_t> rootSeeds(static_cast<size_t>(numProvisional), -1);
+  for(const auto& slab : slabs)
+  {
+    for(size_t i = 0; i < slab.seeds.size(); i++)
+    {
+      int64_t seed = slab.seeds[i];
+      int64_t root = findRoot(slab.labelOffset + static_cast<int64_t>(i));
+      if(seed >= 0 && (rootSeeds[root] < 0 || seed < rootSeeds[root]))
+      {
+        rootSeeds[root] = seed;
+      }
+    }
+  }
+
+  std::vector<std::pair<int64_t, int64_t>> orderedRoots;
+  for(int64_t i = 0; i < numProvisional; i++)
+  {
+    if(parents[i] == i && rootSeeds[i] >= 0)
+    {
+      orderedRoots.emplace_back(rootSeeds[i], i);
+    }
+  }
+  std::sort(orderedRoots.begin(), orderedRoots.end());
+
+  std::vector<int32_t> finalIds(static_cast<size_t>(numProvisional), 0);
+  for(size_t i = 0; i < orderedRoots.size(); i++)
+  {
+    finalIds[orderedRoots[i].second] = static_cast<int32_t>(i + 1);
+  }
+  for(int64_t i = 0; i < numProvisional; i++)
+  {
+    finalIds[i] = finalIds[findRoot(i)];
+  }
+
+  ParallelDataAlgorithm relabelAlg;
+  relabelAlg.setRange(0, static_cast<size_t>(numSlabs));
+  relabelAlg.setGrain(1);
+  relabelAlg.execute(RelabelImpl(dims, featureIds, slabs, finalIds));
+
+  filter->notifyStatusMessage(QObject::tr("Total Features: %1").arg(orderedRoots.size() + 1));
+  return orderedRoots.size();
+}
+
+/**
+ * @brief The ScalarPredicate class groups neighboring points whose scalar values differ by no more than the
+ * tolerance. Boolean arrays are grouped on equality.
+ */
+template <typename T>
+class ScalarPredicate
+{
+public:
+  ScalarPredicate(const T* data, const bool* goodVoxels, T tolerance)
+  : m_Data(data)
+  , m_GoodVoxels(goodVoxels)
+  , m_Tolerance(tolerance)
+  {
+  }
+
+  inline bool isSeedCandidate(int64_t point) const
+  {
+    return nullptr == m_GoodVoxels || m_GoodVoxels[point];
+  }
+
+  inline bool isGroupCandidate(int64_t point) const
+  {
+    return nullptr == m_GoodVoxels || m_GoodVoxels[point];
+  }
+
+  inline bool compareNeighbors(int64_t referencepoint, int64_t neighborpoint) const
+  {
+    const T value1 = m_Data[referencepoint];
+    const T value2 = m_Data[neighborpoint];
+    if constexpr(std::is_same<T, bool>::value)
+    {
+      return value1 == value2;
+    }
+    else
+    {
+      return value1 >= value2 ? (value1 - value2) <= m_Tolerance : (value2 - value1) <= m_Tolerance;
+    }
+  }
+
+private:
+  const T* m_Data = nullptr;
+  const bool* m_GoodVoxels = nullptr;
+  T m_Tolerance = static_cast<T>(0);
+};
+
+/**
+ * @brief FastPathQuaternionDot Returns the absolute quaternion dot product above which two orientations are
+ * within half of the tolerance without applying any symmetry operator. Since the symmetry reduced misorientation
+ * can only be smaller, such pairs are accepted without evaluating the full symmetry loop.
+ * @param tolerance Misorientation tolerance in radians
+ * @return
+ */
+inline float FastPathQuaternionDot(float tolerance)
+{
+  return tolerance > 0.0f ? std::cos(0.25f * tolerance) : 2.0f;
+}
+
+/**
+ * @brief QuaternionDot Returns the absolute dot product of two quaternions stored as 4 consecutive floats
+ */
+inline float QuaternionDot(const float* q1, const float* q2)
+{
+  return std::fabs(q1[0] * q2[0] + q1[1] * q2[1] + q1[2] * q2[2] + q1[3] * q2[3]);
+}
+
+/**
+ * @brief The MisorientationPredicate class groups neighboring points of the same phase whose misorientation is
+ * below the tolerance for volumes in which every valid phase shares the crystal structure of LaueOpsType. Holding
+ * the LaueOps by value lets the compiler resolve the symmetry operators statically.
+ */
+template <typename LaueOpsType>
+class MisorientationPredicate
+{
+public:
+  MisorientationPredicate(const float* quats, const int32_t* cellPhases, const bool* goodVoxels, std::vector<uint8_t> validPhases, float tolerance)
+  : m_Quats(quats)
+  , m_CellPhases(cellPhases)
+  , m_GoodVoxels(goodVoxels)
+  , m_ValidPhases(std::move(validPhases))
+  , m_Tolerance(tolerance)
+  , m_FastPathDot(FastPathQuaternionDot(tolerance))
+  {
+  }
+
+  inline bool isSeedCandidate(int64_t point) const
+  {
+    return (nullptr == m_GoodVoxels || m_GoodVoxels[point]) && m_CellPhases[point] > 0;
+  }
+
+  inline bool isGroupCandidate(int64_t point) const
+  {
+    return nullptr == m_GoodVoxels || m_GoodVoxels[point];
+  }
+
+  inline bool compareNeighbors(int64_t referencepoint, int64_t neighborpoint) const
+  {
+    const int32_t phase = m_CellPhases[referencepoint];
+    if(phase != m_CellPhases[neighborpoint] || m_ValidPhases[phase] == 0)
+    {
+      return false;
+    }
+    const float* quat1 = m_Quats + referencepoint * 4;
+    const float* quat2 = m_Quats + neighborpoint * 4;
+    if(QuaternionDot(quat1, quat2) > m_FastPathDot)
+    {
+      return true;
+    }
+    QuatF q1(quat1[0], quat1[1], quat1[2], quat1[3]);
+    QuatF q2(quat2[0], quat2[1], quat2[2], quat2[3]);
+    OrientationF axisAngle = m_Ops.calculateMisorientation(q1, q2);
+    return axisAngle[3] < m_Tolerance;
+  }
+
+private:
+  const float* m_Quats = nullptr;
+  const int32_t* m_CellPhases = nullptr;
+  const bool* m_GoodVoxels = nullptr;
+  std::vector<uint8_t> m_ValidPhases;
+  float m_Tolerance = 0.0f;
+  float m_FastPathDot = 2.0f;
+  LaueOpsType m_Ops;
+};
+
+/**
+ * @brief The MultiPhaseMisorientationPredicate class groups neighboring points of the same phase whose
+ * misorientation is below the tolerance when the phases have different crystal structures. The LaueOps of each
+ * phase is resolved once up front instead of for every pair of points.
+ */
+class MultiPhaseMisorientationPredicate
+{
+public:
+  MultiPhaseMisorientationPredicate(const float* quats, const int32_t* cellPhases, const bool* goodVoxels, std::vector<const LaueOps*> phaseOps, float tolerance)
+  : m_Quats(quats)
+  , m_CellPhases(cellPhases)
+  , m_GoodVoxels(goodVoxels)
+  , m_PhaseOps(std::move(phaseOps))
+  , m_Tolerance(tolerance)
+  , m_FastPathDot(FastPathQuaternionDot(tolerance))
+  {
+  }
+
+  inline bool isSeedCandidate(int64_t point) const
+  {
+    return (nullptr == m_GoodVoxels || m_GoodVoxels[point]) && m_CellPhases[point] > 0;
+  }
+
+  inline bool isGroupCandidate(int64_t point) const
+  {
+    return nullptr == m_GoodVoxels || m_GoodVoxels[point];
+  }
+
+  inline bool compareNeighbors(int64_t referencepoint, int64_t neighborpoint) const
+  {
+    const int32_t phase = m_CellPhases[referencepoint];
+    if(phase != m_CellPhases[neighborpoint] || nullptr == m_PhaseOps[phase])
+    {
+      return false;
+    }
+    const float* quat1 = m_Quats + referencepoint * 4;
+    const float* quat2 = m_Quats + neighborpoint * 4;
+    if(QuaternionDot(quat1, quat2) > m_FastPathDot)
+    {
+      return true;
+    }
+    QuatF q1(quat1[0], quat1[1], quat1[2], quat1[3]);
+    QuatF q2(quat2[0], quat2[1], quat2[2], quat2[3]);
+    OrientationF axisAngle = m_PhaseOps[phase]->calculateMisorientation(q1, q2);
+    return axisAngle[3] < m_Tolerance;
+  }
+
+private:
+  const float* m_Quats = nullptr;
+  const int32_t* m_CellPhases = nullptr;
+  const bool* m_GoodVoxels = nullptr;
+  std::vector<const LaueOps*> m_PhaseOps;
+  float m_Tolerance = 0.0f;
+  float m_FastPathDot = 2.0f;
+};
+
+/**
+ * @brief The CAxisPredicate class groups neighboring points of the same phase whose c-axes are aligned within the
+ * tolerance, regardless of the sense of the c-axis
+ */
+class CAxisPredicate
+{
+public:
+  CAxisPredicate(const float* quats, const int32_t* cellPhases, const bool* goodVoxels, float tolerance)
+  : m_Quats(quats)
+  , m_CellPhases(cellPhases)
+  , m_GoodVoxels(goodVoxels)
+  , m_Tolerance(tolerance)
+  , m_FastPathDot(FastPathQuaternionDot(tolerance))
+  {
+  }
+
+  inline bool isSeedCandidate(int64_t point) const
+  {
+    return (nullptr == m_GoodVoxels || m_GoodVoxels[point]) && m_CellPhases[point] > 0;
+  }
+
+  inline bool isGroupCandidate(int64_t point) const
+  {
+    return nullptr == m_GoodVoxels || m_GoodVoxels[point];
+  }
+
+  /**
+   * @brief cAxis Computes the normalized sample direction of the c-axis, i.e., the transpose of the orientation
+   * matrix applied to [001], which is simply its last row
+   */
+  inline void cAxis(const float* quat, float c[3]) const
+  {
+    float g[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+    QuatF q(quat[0], quat[1], quat[2], quat[3]);
+    OrientationTransformation::qu2om<QuatF, Orientation<float>>(q).toGMatrix(g);
+    float norm = std::sqrt(g[2][0] * g[2][0] + g[2][1] * g[2][1] + g[2][2] * g[2][2]);
+    c[0] = g[2][0] / norm;
+    c[1] = g[2][1] / norm;
+    c[2] = g[2][2] / norm;
+  }
+
+  inline bool compareNeighbors(int64_t referencepoint, int64_t neighborpoint) const
+  {
+    if(m_CellPhases[referencepoint] != m_CellPhases[neighborpoint])
+    {
+      return false;
+    }
+    const float* quat1 = m_Quats + referencepoint * 4;
+    const float* quat2 = m_Quats + neighborpoint * 4;
+    // A rotation by less than the tolerance can not tilt the c-axis by more than the tolerance
+    if(QuaternionDot(quat1, quat2) > m_FastPathDot)
+    {
+      return true;
+    }
+    float c1[3] = {0.0f, 0.0f, 0.0f};
+    float c2[3] = {0.0f, 0.0f, 0.0f};
+    cAxis(quat1, c1);
+    cAxis(quat2, c2);
+
+    // Validate value of w falls between [-1, 1] to ensure that acos returns a valid value
+    float w = std::clamp(((c1[0] * c2[0]) + (c1[1] * c2[1]) + (c1[2] * c2[2])), -1.0F, 1.0F);
+    w = std::acos(w);
+    return w <= m_Tolerance || (SIMPLib::Constants::k_PiD - w) <= m_Tolerance;
+  }
+
+private:
+  const float* m_Quats = nullptr;
+  const int32_t* m_CellPhases = nullptr;
+  const bool* m_GoodVoxels = nullptr;
+  float m_Tolerance = 0.0f;
+  float m_FastPathDot = 2.0f;
+};
+
+} // namespace SegmentFeaturesKernels
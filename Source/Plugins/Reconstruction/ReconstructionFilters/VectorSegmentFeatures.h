@@ -106,7 +106,7 @@ public:
    * @brief Getter property for CellFeatureAttributeMatrixName
    * @return Value of CellFeatureAttributeMatrixName
    */
-  QString getCellFeatureAttributeMatrixName() const;
+  QString getCellFeatureAttributeMatrixName() const override;
   Q_PROPERTY(QString CellFeatureAttributeMatrixName READ getCellFeatureAttributeMatrixName WRITE setCellFeatureAttributeMatrixName)
 
   /**
@@ -267,6 +267,26 @@ protected:
    */
   bool determineGrouping(int64_t referencepoint, int64_t neighborpoint, int32_t gnum) override;
 
+  /**
+   * @brief getSegmentationFeatureIds Reimplemented from @see SegmentFeatures class
+   */
+  int32_t* getSegmentationFeatureIds() override;
+
+  /**
+   * @brief isSeedCandidate Reimplemented from @see SegmentFeatures class
+   */
+  bool isSeedCandidate(int64_t point) const override;
+
+  /**
+   * @brief isGroupCandidate Reimplemented from @see SegmentFeatures class
+   */
+  bool isGroupCandidate(int64_t point) const override;
+
+  /**
+   * @brief compareNeighbors Reimplemented from @see SegmentFeatures class
+   */
+  bool compareNeighbors(int64_t referencepoint, int64_t neighborpoint) const override;
+
 private:
   std::weak_ptr<DataArray<float>> m_VectorsPtr;
   float* m_Vectors = nullptr;
@@ -309,7 +329,7 @@ private:
   /**
    * @brief updateFeatureInstancePointers Updates raw Feature pointers
    */
-  void updateFeatureInstancePointers();
+  void updateFeatureInstancePointers() override;
 
 public:
   VectorSegmentFeatures(const VectorSegmentFeatures&) = delete;            // Copy Constructor Not Implemented
@@ -0,0 +1,177 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include <map>
+
+#include <QtCore/QFile>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "ReconstructionTestFileLocations.h"
+
+class ScalarSegmentFeaturesTest
+{
+
+public:
+  ScalarSegmentFeaturesTest() = default;
+  virtual ~ScalarSegmentFeaturesTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFilterAvailability()
+  {
+    // Now instantiate the ScalarSegmentFeatures Filter from the FilterManager
+    QString filtName = "ScalarSegmentFeatures";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    if(nullptr == filterFactory.get())
+    {
+      std::stringstream ss;
+      ss << "The Reconstruction Requires the use of the " << filtName.toStdString() << " filter which is found in the Reconstruction Plugin";
+      DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer CreateTestData()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("Test");
+    dca->addOrReplaceDataContainer(dc);
+
+    std::vector<size_t> dims = {37, 23, 19};
+    ImageGeom::Pointer igeom = ImageGeom::New();
+    size_t dims_in[3] = {dims[0], dims[1], dims[2]};
+    igeom->setDimensions(dims_in);
+    dc->setGeometry(igeom);
+
+    AttributeMatrix::Pointer cellAM = AttributeMatrix::New(dims, "CellData", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(cellAM);
+
+    size_t totalPoints = dims[0] * dims[1] * dims[2];
+    UInt8ArrayType::Pointer scalars = UInt8ArrayType::CreateArray(totalPoints, std::string("Scalars"), true);
+    BoolArrayType::Pointer mask = BoolArrayType::CreateArray(totalPoints, std::string("Mask"), true);
+    // Blocks of constant value that are connected across planes and rows in ways that split across any
+    // slab decomposition, perforated by a scattered set of masked out voxels
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          size_t index = (z * dims[1] + y) * dims[0] + x;
+          scalars->setValue(index, static_cast<uint8_t>((((x + z) / 5) + (y / 4) * 3 + (z / 3) * 7) % 4 * 10));
+          mask->setValue(index, (x * 7 + y * 13 + z * 17) % 11 != 0);
+        }
+      }
+    }
+    cellAM->insertOrAssign(scalars);
+    cellAM->insertOrAssign(mask);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  Int32ArrayType::Pointer RunSegmentation(bool useParallelSegmentation)
+  {
+    DataContainerArray::Pointer dca = CreateTestData();
+
+    QString filtName = "ScalarSegmentFeatures";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant variant;
+    variant.setValue(DataArrayPath("Test", "CellData", "Scalars"));
+    bool ok = filter->setProperty("ScalarArrayPath", variant);
+    DREAM3D_REQUIRE_EQUAL(ok, true)
+
+    variant.setValue(DataArrayPath("Test", "CellData", "Mask"));
+    ok = filter->setProperty("GoodVoxelsArrayPath", variant);
+    DREAM3D_REQUIRE_EQUAL(ok, true)
+
+    ok = filter->setProperty("UseGoodVoxels", true);
+    DREAM3D_REQUIRE_EQUAL(ok, true)
+
+    ok = filter->setProperty("ScalarTolerance", 0.0f);
+    DREAM3D_REQUIRE_EQUAL(ok, true)
+
+    ok = filter->setProperty("UseParallelSegmentation", useParallelSegmentation);
+    DREAM3D_REQUIRE_EQUAL(ok, true)
+
+    filter->execute();
+    int err = filter->getErrorCode();
+    DREAM3D_REQUIRE(err >= 0)
+
+    return dca->getAttributeMatrix(DataArrayPath("Test", "CellData", ""))->getAttributeArrayAs<Int32ArrayType>(SIMPL::CellData::FeatureIds);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestParallelSegmentation()
+  {
+    Int32ArrayType::Pointer serialIds = RunSegmentation(false);
+    Int32ArrayType::Pointer parallelIds = RunSegmentation(true);
+    DREAM3D_REQUIRE_VALID_POINTER(serialIds.get())
+    DREAM3D_REQUIRE_VALID_POINTER(parallelIds.get())
+    DREAM3D_REQUIRE_EQUAL(serialIds->getNumberOfTuples(), parallelIds->getNumberOfTuples())
+
+    // Feature Ids are randomized, so compare the partitions through a one to one mapping of the Ids
+    std::map<int32_t, int32_t> serialToParallel;
+    std::map<int32_t, int32_t> parallelToSerial;
+    for(size_t i = 0; i < serialIds->getNumberOfTuples(); i++)
+    {
+      int32_t serialId = serialIds->getValue(i);
+      int32_t parallelId = parallelIds->getValue(i);
+      DREAM3D_REQUIRE_EQUAL(serialId == 0, parallelId == 0)
+
+      auto serialIter = serialToParallel.emplace(serialId, parallelId).first;
+      DREAM3D_REQUIRE_EQUAL(serialIter->second, parallelId)
+      auto parallelIter = parallelToSerial.emplace(parallelId, serialId).first;
+      DREAM3D_REQUIRE_EQUAL(parallelIter->second, serialId)
+    }
+    DREAM3D_REQUIRE(serialToParallel.size() > 2)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestFilterAvailability());
+
+    DREAM3D_REGISTER_TEST(TestParallelSegmentation())
+  }
+
+public:
+  ScalarSegmentFeaturesTest(const ScalarSegmentFeaturesTest&) = delete;            // Copy Constructor Not Implemented
+  ScalarSegmentFeaturesTest(ScalarSegmentFeaturesTest&&) = delete;                 // Move Constructor Not Implemented
+  ScalarSegmentFeaturesTest& operator=(const ScalarSegmentFeaturesTest&) = delete; // Copy Assignment Not Implemented
+  ScalarSegmentFeaturesTest& operator=(ScalarSegmentFeaturesTest&&) = delete;      // Move Assignment Not Implemented
+};
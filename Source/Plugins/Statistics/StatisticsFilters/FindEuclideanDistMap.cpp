@@ -42,6 +42,10 @@
 #include <tbb/tick_count.h>
 #endif
 
+#include <cmath>
+#include <limits>
+#include <vector>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -56,6 +60,7 @@
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "Statistics/StatisticsConstants.h"
 #include "Statistics/StatisticsVersion.h"
@@ -73,8 +78,194 @@ enum createdPathID : RenameDataPath::DataID_t
 };
 
 /**
- * @brief The ComputeDistanceMapImpl class implements a threaded algorithm that computes the  distance map
- * for each point in the supplied volume
+ * @brief The DistanceTransformLinesImpl class runs the 1D pass of the separable distance transform along
+ * one axis of the volume. Every line parallel to that axis is independent of the others so a range of
+ * lines can be handed to each thread. The Euclidean pass takes the lower envelope of the parabolas rooted
+ * at each voxel (Felzenszwalb & Huttenlocher) on squared physical distances; the Manhattan pass is the
+ * usual forward/backward sweep in voxel steps. The nearest seed voxel is carried along with the distance.
+ */
+class DistanceTransformLinesImpl
+{
+  double* m_Distances;
+  int64_t* m_NearestSeeds;
+  int64_t m_Dims[3];
+  int32_t m_Axis;
+  double m_Spacing;
+  bool m_CalcManhattanDist;
+
+public:
+  DistanceTransformLinesImpl(double* distances, int64_t* nearestSeeds, const int64_t* dims, int32_t axis, double spacing, bool calcManhattanDist)
+  : m_Distances(distances)
+  , m_NearestSeeds(nearestSeeds)
+  , m_Dims{dims[0], dims[1], dims[2]}
+  , m_Axis(axis)
+  , m_Spacing(spacing)
+  , m_CalcManhattanDist(calcManhattanDist)
+  {
+  }
+
+  virtual ~DistanceTransformLinesImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    const int64_t xyPoints = m_Dims[0] * m_Dims[1];
+    const int64_t length = m_Dims[m_Axis];
+    const int64_t stride = (m_Axis == 0) ? 1 : ((m_Axis == 1) ? m_Dims[0] : xyPoints);
+
+    std::vector<double> lineDist(length);
+    std::vector<int64_t> lineSeeds(m_NearestSeeds != nullptr ? length : 0);
+    std::vector<double> outDist(m_CalcManhattanDist ? 0 : length);
+    std::vector<int64_t> outSeeds(m_CalcManhattanDist ? 0 : lineSeeds.size());
+    std::vector<int64_t> envelope(length);
+    std::vector<double> boundaries(length);
+
+    for(size_t line = range.min(); line < range.max(); line++)
+    {
+      int64_t start = 0;
+      if(m_Axis == 0)
+      {
+        start = static_cast<int64_t>(line) * m_Dims[0];
+      }
+      else if(m_Axis == 1)
+      {
+        start = (static_cast<int64_t>(line) / m_Dims[0]) * xyPoints + static_cast<int64_t>(line) % m_Dims[0];
+      }
+      else
+      {
+        start = static_cast<int64_t>(line);
+      }
+
+      for(int64_t q = 0; q < length; q++)
+      {
+        lineDist[q] = m_Distances[start + q * stride];
+        if(m_NearestSeeds != nullptr)
+        {
+          lineSeeds[q] = m_NearestSeeds[start + q * stride];
+        }
+      }
+
+      if(m_CalcManhattanDist)
+      {
+        manhattanPass(lineDist, lineSeeds);
+      }
+      else
+      {
+        if(!euclideanPass(lineDist, lineSeeds, outDist, outSeeds, envelope, boundaries))
+        {
+          continue;
+        }
+        lineDist.swap(outDist);
+        lineSeeds.swap(outSeeds);
+      }
+
+      for(int64_t q = 0; q < length; q++)
+      {
+        m_Distances[start + q * stride] = lineDist[q];
+        if(m_NearestSeeds != nullptr)
+        {
+          m_NearestSeeds[start + q * stride] = lineSeeds[q];
+        }
+      }
+    }
+  }
+
+private:
+  void manhattanPass(std::vector<double>& lineDist, std::vector<int64_t>& lineSeeds) const
+  {
+    const int64_t length = static_cast<int64_t>(lineDist.size());
+    for(int64_t q = 1; q < length; q++)
+    {
+      if(lineDist[q - 1] + 1.0 < lineDist[q])
+      {
+        lineDist[q] = lineDist[q - 1] + 1.0;
+        if(m_NearestSeeds != nullptr)
+        {
+          lineSeeds[q] = lineSeeds[q - 1];
+        }
+      }
+    }
+    for(int64_t q = length - 2; q >= 0; q--)
+    {
+      if(lineDist[q + 1] + 1.0 < lineDist[q])
+      {
+        lineDist[q] = lineDist[q + 1] + 1.0;
+        if(m_NearestSeeds != nullptr)
+        {
+          lineSeeds[q] = lineSeeds[q + 1];
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Returns false when the line holds no seed yet, in which case the outputs are untouched
+   */
+  bool euclideanPass(const std::vector<double>& lineDist, const std::vector<int64_t>& lineSeeds, std::vector<double>& outDist, std::vector<int64_t>& outSeeds, std::vector<int64_t>& envelope,
+                     std::vector<double>& boundaries) const
+  {
+    const int64_t length = static_cast<int64_t>(lineDist.size());
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    // Build the lower envelope of the parabolas f(q) + (p - q)^2. boundaries[k] is where parabola k starts to be the lowest
+    int64_t k = -1;
+    for(int64_t q = 0; q < length; q++)
+    {
+      if(lineDist[q] == infinity)
+      {
+        continue;
+      }
+      const double pq = static_cast<double>(q) * m_Spacing;
+      double s = -infinity;
+      while(k >= 0)
+      {
+        const double pv = static_cast<double>(envelope[k]) * m_Spacing;
+        s = ((lineDist[q] + pq * pq) - (lineDist[envelope[k]] + pv * pv)) / (2.0 * (pq - pv));
+        if(s > boundaries[k])
+        {
+          break;
+        }
+        k--;
+      }
+      if(k < 0)
+      {
+        s = -infinity;
+      }
+      k++;
+      envelope[k] = q;
+      boundaries[k] = s;
+    }
+
+    // No seed anywhere on this line yet; leave it for the next axis
+    if(k < 0)
+    {
+      return false;
+    }
+
+    const int64_t last = k;
+    k = 0;
+    for(int64_t q = 0; q < length; q++)
+    {
+      const double pq = static_cast<double>(q) * m_Spacing;
+      while(k < last && boundaries[k + 1] < pq)
+      {
+        k++;
+      }
+      const int64_t site = envelope[k];
+      const double delta = pq - static_cast<double>(site) * m_Spacing;
+      outDist[q] = lineDist[site] + delta * delta;
+      if(m_NearestSeeds != nullptr)
+      {
+        outSeeds[q] = lineSeeds[site];
+      }
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief The ComputeDistanceMapImpl class computes the distance map of every point in the supplied volume to the
+ * nearest boundary, triple line or quadruple point voxel. The distance transform is exact and separable: one
+ * pass along X, then Y, then Z, with the lines of each pass spread across threads.
  */
 template <typename T>
 class ComputeDistanceMapImpl
@@ -83,17 +274,20 @@ class ComputeDistanceMapImpl
   int32_t* m_FeatureIds;
   int32_t* m_NearestNeighbors;
   bool m_CalcManhattanDist;
+  bool m_SaveNearestNeighbors;
   T* m_GBManhattanDistances;
   T* m_TJManhattanDistances;
   T* m_QPManhattanDistances;
   FindEuclideanDistMap::MapType m_MapType;
 
 public:
-  ComputeDistanceMapImpl(DataContainer::Pointer datacontainer, int32_t* fIds, int32_t* nearNeighs, bool calcManhattanDist, T* gbDists, T* tjDists, T* qpDists, FindEuclideanDistMap::MapType mapType)
+  ComputeDistanceMapImpl(DataContainer::Pointer datacontainer, int32_t* fIds, int32_t* nearNeighs, bool calcManhattanDist, bool saveNearestNeighbors, T* gbDists, T* tjDists, T* qpDists,
+                         FindEuclideanDistMap::MapType mapType)
   : m_DataContainer(datacontainer)
   , m_FeatureIds(fIds)
   , m_NearestNeighbors(nearNeighs)
   , m_CalcManhattanDist(calcManhattanDist)
+  , m_SaveNearestNeighbors(saveNearestNeighbors)
   , m_GBManhattanDistances(gbDists)
   , m_TJManhattanDistances(tjDists)
   , m_QPManhattanDistances(qpDists)
@@ -107,182 +301,68 @@ public:
   {
     ImageGeom::Pointer imageGeom = m_DataContainer->getGeometryAs<ImageGeom>();
     size_t totalPoints = imageGeom->getNumberOfElements();
-    double Distance = 0.0;
-    size_t count = 1;
-    size_t changed = 1;
-    size_t neighpoint = 0;
-    int64_t nearestneighbor;
-    int64_t neighbors[6] = {0, 0, 0, 0, 0, 0};
-    int64_t xpoints = static_cast<int64_t>(imageGeom->getXPoints());
-    int64_t ypoints = static_cast<int64_t>(imageGeom->getYPoints());
-    int64_t zpoints = static_cast<int64_t>(imageGeom->getZPoints());
+    int64_t dims[3] = {static_cast<int64_t>(imageGeom->getXPoints()), static_cast<int64_t>(imageGeom->getYPoints()), static_cast<int64_t>(imageGeom->getZPoints())};
     FloatVec3Type spacing = imageGeom->getSpacing();
+    const size_t mapIndex = static_cast<size_t>(m_MapType);
 
-    neighbors[0] = -xpoints * ypoints;
-    neighbors[1] = -xpoints;
-    neighbors[2] = -1;
-    neighbors[3] = 1;
-    neighbors[4] = xpoints;
-    neighbors[5] = xpoints * ypoints;
-
-    // Use a std::vector to get an auto cleaned up array thus not needing the 'delete' keyword later on.
-    std::vector<int32_t> voxNN(totalPoints, 0);
-    int32_t* voxel_NearestNeighbor = &(voxNN.front());
-    std::vector<double> voxEDist(totalPoints, 0.0);
-    double* voxel_Distance = &(voxEDist.front());
-
-    Distance = 0;
-    for(size_t a = 0; a < totalPoints; ++a)
+    T* distances = m_GBManhattanDistances;
+    if(m_MapType == FindEuclideanDistMap::MapType::TripleJunction)
     {
-      if(m_NearestNeighbors[a * 3 + static_cast<uint32_t>(m_MapType)] >= 0)
-      {
-        voxel_NearestNeighbor[a] = static_cast<int32_t>(a);
-      } // if voxel is boundary voxel, then want to use itself as nearest boundary voxel
-      else
-      {
-        voxel_NearestNeighbor[a] = -1;
-      }
-      if(m_MapType == FindEuclideanDistMap::MapType::FeatureBoundary)
-      {
-        voxel_Distance[a] = static_cast<double>(m_GBManhattanDistances[a]);
-      }
-      else if(m_MapType == FindEuclideanDistMap::MapType::TripleJunction)
-      {
-        voxel_Distance[a] = static_cast<double>(m_TJManhattanDistances[a]);
-      }
-      else if(m_MapType == FindEuclideanDistMap::MapType::QuadPoint)
-      {
-        voxel_Distance[a] = static_cast<double>(m_QPManhattanDistances[a]);
-      }
+      distances = m_TJManhattanDistances;
     }
-
-    // ------------- Calculate the Manhattan Distance ----------------
-    count = 1;
-    changed = 1;
-    int64_t i = 0;
-    int64_t zBlock = xpoints * ypoints;
-    int64_t zStride = 0, yStride = 0;
-    char mask[6] = {0, 0, 0, 0, 0, 0};
-    while(count > 0 && changed > 0)
+    else if(m_MapType == FindEuclideanDistMap::MapType::QuadPoint)
     {
-      count = 0;
-      changed = 0;
-      Distance++;
-
-      for(int64_t z = 0; z < zpoints; ++z)
-      {
-        zStride = z * zBlock;
-        mask[0] = mask[5] = 1;
-        if(z == 0)
-        {
-          mask[0] = 0;
-        }
-        if(z == zpoints - 1)
-        {
-          mask[5] = 0;
-        }
-
-        for(int64_t y = 0; y < ypoints; ++y)
-        {
-          yStride = y * xpoints;
-          mask[1] = mask[4] = 1;
-          if(y == 0)
-          {
-            mask[1] = 0;
-          }
-          if(y == ypoints - 1)
-          {
-            mask[4] = 0;
-          }
-
-          for(int64_t x = 0; x < xpoints; ++x)
-          {
-            mask[2] = mask[3] = 1;
-            if(x == 0)
-            {
-              mask[2] = 0;
-            }
-            if(x == xpoints - 1)
-            {
-              mask[3] = 0;
-            }
+      distances = m_QPManhattanDistances;
+    }
 
-            i = zStride + yStride + x;
-            if(voxel_NearestNeighbor[i] == -1 && m_FeatureIds[i] > 0)
-            {
-              count++;
-              for(int32_t j = 0; j < 6; j++)
-              {
-                neighpoint = i + neighbors[j];
-                if(mask[j] == 1)
-                {
-                  if(voxel_Distance[neighpoint] != -1.0)
-                  {
-                    voxel_NearestNeighbor[i] = voxel_NearestNeighbor[neighpoint];
-                  }
-                }
-              }
-            }
-          }
-        }
-      }
-      for(size_t j = 0; j < totalPoints; ++j)
+    // Seeds start at zero, everything else at infinity. The Euclidean passes work on squared distances.
+    std::vector<double> voxEDist(totalPoints, std::numeric_limits<double>::infinity());
+    double* voxel_Distance = voxEDist.data();
+    std::vector<int64_t> voxNN(m_SaveNearestNeighbors ? totalPoints : 0, -1);
+    int64_t* voxel_NearestNeighbor = m_SaveNearestNeighbors ? voxNN.data() : nullptr;
+    for(size_t a = 0; a < totalPoints; ++a)
+    {
+      if(m_FeatureIds[a] > 0 && m_NearestNeighbors[a * 3 + mapIndex] >= 0)
       {
-        if(voxel_NearestNeighbor[j] != -1 && voxel_Distance[j] == -1.0 && m_FeatureIds[j] > 0)
+        voxel_Distance[a] = 0.0;
+        if(voxel_NearestNeighbor != nullptr)
         {
-          changed++;
-          voxel_Distance[j] = Distance;
+          voxel_NearestNeighbor[a] = static_cast<int64_t>(a);
         }
       }
     }
 
-    // ------------- Calculate the Euclidian Distance ----------------
-
-    if(m_CalcManhattanDist == false)
+    for(int32_t axis = 0; axis < 3; axis++)
     {
-      double x1 = 0.0, x2 = 0.0, y1 = 0.0, y2 = 0.0, z1 = 0.0, z2 = 0.0;
-      double dist = 0.0;
-      double oneOverzBlock = 1.0 / double(zBlock);
-      double oneOverxpoints = 1.0 / double(xpoints);
-      for(int64_t m = 0; m < zpoints; m++)
-      {
-        zStride = m * zBlock;
-        for(int64_t n = 0; n < ypoints; n++)
-        {
-          yStride = n * xpoints;
-          for(int64_t p = 0; p < xpoints; p++)
-          {
-            x1 = static_cast<double>(p) * spacing[0];
-            y1 = static_cast<double>(n) * spacing[1];
-            z1 = static_cast<double>(m) * spacing[2];
-            nearestneighbor = voxel_NearestNeighbor[zStride + yStride + p];
-            if(nearestneighbor >= 0)
-            {
-              x2 = spacing[0] * double(nearestneighbor % xpoints);                           // find_xcoord(nearestneighbor);
-              y2 = spacing[1] * double(int64_t(nearestneighbor * oneOverxpoints) % ypoints); // find_ycoord(nearestneighbor);
-              z2 = spacing[2] * floor(nearestneighbor * oneOverzBlock);                      // find_zcoord(nearestneighbor);
-              dist = ((x1 - x2) * (x1 - x2)) + ((y1 - y2) * (y1 - y2)) + ((z1 - z2) * (z1 - z2));
-              dist = sqrt(dist);
-              voxel_Distance[zStride + yStride + p] = dist;
-            }
-          }
-        }
+      if(dims[axis] < 2)
+      {
+        continue;
       }
+      size_t numLines = totalPoints / static_cast<size_t>(dims[axis]);
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, numLines);
+      dataAlg.execute(DistanceTransformLinesImpl(voxel_Distance, voxel_NearestNeighbor, dims, axis, static_cast<double>(spacing[axis]), m_CalcManhattanDist));
     }
+
+    // Cells outside of any Feature and Cells that never saw a seed keep the -1 flag
     for(size_t a = 0; a < totalPoints; ++a)
     {
-      m_NearestNeighbors[a * 3 + static_cast<uint32_t>(m_MapType)] = voxel_NearestNeighbor[a];
-      if(m_MapType == FindEuclideanDistMap::MapType::FeatureBoundary)
+      bool valid = (m_FeatureIds[a] > 0 && voxel_Distance[a] != std::numeric_limits<double>::infinity());
+      if(!valid)
+      {
+        distances[a] = static_cast<T>(-1);
+      }
+      else if(m_CalcManhattanDist)
       {
-        m_GBManhattanDistances[a] = static_cast<T>(voxel_Distance[a]);
+        distances[a] = static_cast<T>(voxel_Distance[a]);
       }
-      else if(m_MapType == FindEuclideanDistMap::MapType::TripleJunction)
+      else
       {
-        m_TJManhattanDistances[a] = static_cast<T>(voxel_Distance[a]);
+        distances[a] = static_cast<T>(std::sqrt(voxel_Distance[a]));
       }
-      else if(m_MapType == FindEuclideanDistMap::MapType::QuadPoint)
+      if(voxel_NearestNeighbor != nullptr)
       {
-        m_QPManhattanDistances[a] = static_cast<T>(voxel_Distance[a]);
+        m_NearestNeighbors[a * 3 + mapIndex] = valid ? static_cast<int32_t>(voxel_NearestNeighbor[a]) : -1;
       }
     }
   }
@@ -665,13 +745,13 @@ void FindEuclideanDistMap::findDistanceMap()
     {
       if(m_CalcManhattanDist)
       {
-        g->run(ComputeDistanceMapImpl<int32_t>(m, m_FeatureIds, m_NearestNeighbors, m_CalcManhattanDist, m_GBManhattanDistances, m_TJManhattanDistances, m_QPManhattanDistances,
+        g->run(ComputeDistanceMapImpl<int32_t>(m, m_FeatureIds, m_NearestNeighbors, m_CalcManhattanDist, m_SaveNearestNeighbors, m_GBManhattanDistances, m_TJManhattanDistances, m_QPManhattanDistances,
                                                MapType::FeatureBoundary));
       }
       else
       {
         g->run(
-            ComputeDistanceMapImpl<float>(m, m_FeatureIds, m_NearestNeighbors, m_CalcManhattanDist, m_GBEuclideanDistances, m_TJEuclideanDistances, m_QPEuclideanDistances, MapType::FeatureBoundary));
+            ComputeDistanceMapImpl<float>(m, m_FeatureIds, m_NearestNeighbors, m_CalcManhattanDist, m_SaveNearestNeighbors, m_GBEuclideanDistances, m_TJEuclideanDistances, m_QPEuclideanDistances, MapType::FeatureBoundary));
       }
     }
     if(m_DoTripleLines)
@@ -679,23 +759,23 @@ void FindEuclideanDistMap::findDistanceMap()
       if(m_CalcManhattanDist)
       {
         g->run(
-            ComputeDistanceMapImpl<int32_t>(m, m_FeatureIds, m_NearestNeighbors, m_CalcManhattanDist, m_GBManhattanDistances, m_TJManhattanDistances, m_QPManhattanDistances, MapType::TripleJunction));
+            ComputeDistanceMapImpl<int32_t>(m, m_FeatureIds, m_NearestNeighbors, m_CalcManhattanDist, m_SaveNearestNeighbors, m_GBManhattanDistances, m_TJManhattanDistances, m_QPManhattanDistances, MapType::TripleJunction));
       }
       else
       {
         g->run(
-            ComputeDistanceMapImpl<float>(m, m_FeatureIds, m_NearestNeighbors, m_CalcManhattanDist, m_GBEuclideanDistances, m_TJEuclideanDistances, m_QPEuclideanDistances, MapType::TripleJunction));
+            ComputeDistanceMapImpl<float>(m, m_FeatureIds, m_NearestNeighbors, m_CalcManhattanDist, m_SaveNearestNeighbors, m_GBEuclideanDistances, m_TJEuclideanDistances, m_QPEuclideanDistances, MapType::TripleJunction));
       }
     }
     if(m_DoQuadPoints)
     {
       if(m_CalcManhattanDist)
       {
-        g->run(ComputeDistanceMapImpl<int32_t>(m, m_FeatureIds, m_NearestNeighbors, m_CalcManhattanDist, m_GBManhattanDistances, m_TJManhattanDistances, m_QPManhattanDistances, MapType::QuadPoint));
+        g->run(ComputeDistanceMapImpl<int32_t>(m, m_FeatureIds, m_NearestNeighbors, m_CalcManhattanDist, m_SaveNearestNeighbors, m_GBManhattanDistances, m_TJManhattanDistances, m_QPManhattanDistances, MapType::QuadPoint));
       }
       else
       {
-        g->run(ComputeDistanceMapImpl<float>(m, m_FeatureIds, m_NearestNeighbors, m_CalcManhattanDist, m_GBEuclideanDistances, m_TJEuclideanDistances, m_QPEuclideanDistances, MapType::QuadPoint));
+        g->run(ComputeDistanceMapImpl<float>(m, m_FeatureIds, m_NearestNeighbors, m_CalcManhattanDist, m_SaveNearestNeighbors, m_GBEuclideanDistances, m_TJEuclideanDistances, m_QPEuclideanDistances, MapType::QuadPoint));
       }
     }
     g->wait();
@@ -719,12 +799,12 @@ void FindEuclideanDistMap::findDistanceMap()
       {
         if(m_CalcManhattanDist)
         {
-          ComputeDistanceMapImpl<int32_t> f(m, m_FeatureIds, m_NearestNeighbors, m_CalcManhattanDist, m_GBManhattanDistances, m_TJManhattanDistances, m_QPManhattanDistances, mapType);
+          ComputeDistanceMapImpl<int32_t> f(m, m_FeatureIds, m_NearestNeighbors, m_CalcManhattanDist, m_SaveNearestNeighbors, m_GBManhattanDistances, m_TJManhattanDistances, m_QPManhattanDistances, mapType);
           f();
         }
         else
         {
-          ComputeDistanceMapImpl<float> f(m, m_FeatureIds, m_NearestNeighbors, m_CalcManhattanDist, m_GBEuclideanDistances, m_TJEuclideanDistances, m_QPEuclideanDistances, mapType);
+          ComputeDistanceMapImpl<float> f(m, m_FeatureIds, m_NearestNeighbors, m_CalcManhattanDist, m_SaveNearestNeighbors, m_GBEuclideanDistances, m_TJEuclideanDistances, m_QPEuclideanDistances, mapType);
           f();
         }
       }
@@ -52,6 +52,7 @@
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Math/RadialDistributionFunction.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "Statistics/StatisticsConstants.h"
 #include "Statistics/StatisticsVersion.h"
@@ -64,6 +65,51 @@ enum createdPathID : RenameDataPath::DataID_t
   DataArrayID32 = 32,
 };
 
+/**
+ * @brief The FindFeatureClusteringImpl class computes the centroid distances between the Features of one phase. Each pair
+ * is computed once by the thread that owns the lower ranked Feature and written into both Features' lists. The lists are
+ * sized up front (one slot per other Feature of the phase) so the two writes land in distinct slots and need no locking.
+ */
+class FindFeatureClusteringImpl
+{
+public:
+  FindFeatureClusteringImpl(const float* centroids, const std::vector<int32_t>& phaseFeatures, std::vector<NeighborList<float>::SharedVectorType>& distances)
+  : m_Centroids(centroids)
+  , m_PhaseFeatures(phaseFeatures)
+  , m_Distances(distances)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    size_t numFeatures = m_PhaseFeatures.size();
+    for(size_t a = range.min(); a < range.max(); a++)
+    {
+      size_t i = static_cast<size_t>(m_PhaseFeatures[a]);
+      float x = m_Centroids[3 * i];
+      float y = m_Centroids[3 * i + 1];
+      float z = m_Centroids[3 * i + 2];
+      std::vector<float>& rowA = *(m_Distances[a]);
+      for(size_t b = a + 1; b < numFeatures; b++)
+      {
+        size_t j = static_cast<size_t>(m_PhaseFeatures[b]);
+        float xn = m_Centroids[3 * j];
+        float yn = m_Centroids[3 * j + 1];
+        float zn = m_Centroids[3 * j + 2];
+        float r = sqrtf((x - xn) * (x - xn) + (y - yn) * (y - yn) + (z - zn) * (z - zn));
+        // Feature a's list skips itself; Feature b's list has a in position a since a < b
+        rowA[b - 1] = r;
+        (*(m_Distances[b]))[a] = r;
+      }
+    }
+  }
+
+private:
+  const float* m_Centroids = nullptr;
+  const std::vector<int32_t>& m_PhaseFeatures;
+  std::vector<NeighborList<float>::SharedVectorType>& m_Distances;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -229,20 +275,14 @@ void FindFeatureClustering::find_clustering()
     writeErrorFile = true;
   }
 
-  float x = 0.0f, y = 0.0f, z = 0.0f;
-  float xn = 0.0f, yn = 0.0f, zn = 0.0f;
-  float r = 0.0f;
-
   int32_t bin = 0;
   int32_t ensemble = 0;
   int32_t totalPPTfeatures = 0;
   float min = std::numeric_limits<float>::max();
   float max = 0.0f;
-  float value = 0.0f;
   float sizex = 0.0f, sizey = 0.0f, sizez = 0.0f, totalvol = 0.0f, totalpoints = 0.0f;
   float normFactor = 0.0f;
 
-  std::vector<std::vector<float>> clusteringlist;
   std::vector<float> oldcount(m_NumberOfBins);
   std::vector<float> randomRDF;
 
@@ -266,67 +306,54 @@ void FindFeatureClustering::find_clustering()
   FloatVec3Type vec3 = m->getGeometryAs<ImageGeom>()->getSpacing();
   std::array<float, 3> boxres = {vec3[0], vec3[1], vec3[2]};
 
+  // Only Features of the selected phase take part, so gather them once instead of scanning every Feature per pair
+  std::vector<int32_t> phaseFeatures;
   for(size_t i = 1; i < totalFeatures; i++)
   {
     if(m_FeaturePhases[i] == m_PhaseNumber)
     {
-      totalPPTfeatures++;
+      phaseFeatures.push_back(static_cast<int32_t>(i));
     }
   }
+  totalPPTfeatures = static_cast<int32_t>(phaseFeatures.size());
 
-  clusteringlist.resize(totalFeatures);
+  QString ss = QObject::tr("Computing the centroid distances between %1 Features").arg(totalPPTfeatures);
+  notifyStatusMessage(ss);
 
-  for(size_t i = 1; i < totalFeatures; i++)
+  // Every Feature of the phase gets the distance to every other Feature of the phase, ordered by Feature Id
+  std::vector<NeighborList<float>::SharedVectorType> clusteringlist(phaseFeatures.size());
+  for(auto& distances : clusteringlist)
   {
-    if(m_FeaturePhases[i] == m_PhaseNumber)
-    {
-      if(i % 1000 == 0)
-      {
-        QString ss = QObject::tr("Working on Feature %1 of %2").arg(i).arg(totalPPTfeatures);
-        notifyStatusMessage(ss);
-      }
+    distances = NeighborList<float>::SharedVectorType(new std::vector<float>(phaseFeatures.size() - 1));
+  }
 
-      x = m_Centroids[3 * i];
-      y = m_Centroids[3 * i + 1];
-      z = m_Centroids[3 * i + 2];
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, phaseFeatures.size());
+  dataAlg.execute(FindFeatureClusteringImpl(m_Centroids, phaseFeatures, clusteringlist));
 
-      for(size_t j = i + 1; j < totalFeatures; j++)
+  if(writeErrorFile && outFile.is_open() && m_PhaseNumber == 2)
+  {
+    for(size_t a = 0; a < phaseFeatures.size(); a++)
+    {
+      for(size_t b = a + 1; b < phaseFeatures.size(); b++)
       {
-        if(m_FeaturePhases[i] == m_FeaturePhases[j])
-        {
-          xn = m_Centroids[3 * j];
-          yn = m_Centroids[3 * j + 1];
-          zn = m_Centroids[3 * j + 2];
-
-          r = sqrtf((x - xn) * (x - xn) + (y - yn) * (y - yn) + (z - zn) * (z - zn));
-
-          clusteringlist[i].push_back(r);
-          clusteringlist[j].push_back(r);
-
-          if(writeErrorFile && m_FeaturePhases[j] == 2)
-          {
-            outFile << r << "\n" << r << "\n";
-          }
-        }
+        float r = (*clusteringlist[a])[b - 1];
+        outFile << r << "\n" << r << "\n";
       }
     }
   }
 
-  for(size_t i = 1; i < totalFeatures; i++)
+  for(const auto& distances : clusteringlist)
   {
-    for(size_t j = 0; j < clusteringlist[i].size(); j++)
+    for(float value : *distances)
     {
-      if(m_FeaturePhases[i] == m_PhaseNumber)
+      if(value > max)
       {
-        value = clusteringlist[i][j];
-        if(value > max)
-        {
-          max = value;
-        }
-        if(value < min)
-        {
-          min = value;
-        }
+        max = value;
+      }
+      if(value < min)
+      {
+        min = value;
       }
     }
   }
@@ -336,22 +363,20 @@ void FindFeatureClustering::find_clustering()
   m_MaxMinArray[(m_PhaseNumber * 2)] = max;
   m_MaxMinArray[(m_PhaseNumber * 2) + 1] = min;
 
-  for(size_t i = 1; i < totalFeatures; i++)
+  for(size_t a = 0; a < phaseFeatures.size(); a++)
   {
-    for(size_t j = 0; j < clusteringlist[i].size(); j++)
+    size_t i = static_cast<size_t>(phaseFeatures[a]);
+    if(!m_RemoveBiasedFeatures || !m_BiasedFeatures[i])
     {
-      if(m_FeaturePhases[i] == m_PhaseNumber)
+      ensemble = m_FeaturePhases[i];
+      for(float value : *clusteringlist[a])
       {
-        if(!m_RemoveBiasedFeatures || !m_BiasedFeatures[i])
+        bin = (value - min) / stepsize;
+        if(bin >= m_NumberOfBins)
         {
-          ensemble = m_FeaturePhases[i];
-          bin = (clusteringlist[i][j] - min) / stepsize;
-          if(bin >= m_NumberOfBins)
-          {
-            bin = m_NumberOfBins - 1;
-          }
-          m_NewEnsembleArray[(m_NumberOfBins * ensemble) + bin]++;
+          bin = m_NumberOfBins - 1;
         }
+        m_NewEnsembleArray[(m_NumberOfBins * ensemble) + bin]++;
       }
     }
   }
@@ -401,12 +426,19 @@ void FindFeatureClustering::find_clustering()
   //    }
   //    testFile7.close();
 
+  // Hand the distance lists straight to the Clustering Object; Features of the other phases get an empty list
+  size_t phaseIndex = 0;
   for(size_t i = 1; i < totalFeatures; i++)
   {
-    // Set the vector for each list into the Clustering Object
-    NeighborList<float>::SharedVectorType sharedClustLst(new std::vector<float>);
-    sharedClustLst->assign(clusteringlist[i].begin(), clusteringlist[i].end());
-    m_ClusteringList.lock()->setList(static_cast<int>(i), sharedClustLst);
+    if(phaseIndex < phaseFeatures.size() && static_cast<size_t>(phaseFeatures[phaseIndex]) == i)
+    {
+      m_ClusteringList.lock()->setList(static_cast<int>(i), clusteringlist[phaseIndex]);
+      phaseIndex++;
+    }
+    else
+    {
+      m_ClusteringList.lock()->setList(static_cast<int>(i), NeighborList<float>::SharedVectorType(new std::vector<float>));
+    }
   }
 }
 
@@ -34,6 +34,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "FindNeighborhoods.h"
 
+#include <algorithm>
+#include <cmath>
 #include <mutex>
 
 #include <QtCore/QTextStream>
@@ -66,24 +68,30 @@ enum createdPathID : RenameDataPath::DataID_t
   DataArrayID31 = 31,
 };
 
+/**
+ * @brief The FindNeighborhoodsImpl class finds, for a range of Features, every other Feature whose centroid bin lies within
+ * that Feature's critical distance. The centroids are bucketed into a uniform grid of bins (stored as compressed rows:
+ * cellStarts/cellFeatures) so each Feature only visits the bins inside its own search box instead of every other Feature.
+ */
 class FindNeighborhoodsImpl
 {
 public:
-  FindNeighborhoodsImpl(FindNeighborhoods* filter, size_t totalFeatures, float* centroids, const std::vector<int64_t>& bins, const std::vector<float>& criticalDistance)
+  FindNeighborhoodsImpl(FindNeighborhoods* filter, size_t totalFeatures, const std::vector<int64_t>& bins, const std::vector<float>& criticalDistance, const int64_t* minBin, const int64_t* gridDims,
+                        const std::vector<size_t>& cellStarts, const std::vector<int32_t>& cellFeatures)
   : m_Filter(filter)
   , m_TotalFeatures(totalFeatures)
-  , m_Centroids(centroids)
   , m_Bins(bins)
   , m_CriticalDistance(criticalDistance)
+  , m_MinBin{minBin[0], minBin[1], minBin[2]}
+  , m_GridDims{gridDims[0], gridDims[1], gridDims[2]}
+  , m_CellStarts(cellStarts)
+  , m_CellFeatures(cellFeatures)
   {
   }
 
   void convert(size_t start, size_t end) const
   {
-    float x = 0.0f, y = 0.0f, z = 0.0f;
-    int64_t bin1x = 0, bin2x = 0, bin1y = 0, bin2y = 0, bin1z = 0, bin2z = 0;
-    float dBinX = 0, dBinY = 0, dBinZ = 0;
-    float criticalDistance1 = 0, criticalDistance2 = 0;
+    std::vector<int32_t> neighborhood;
 
     size_t increment = (end - start) / 100;
     size_t incCount = 0;
@@ -104,36 +112,39 @@ public:
       {
         break;
       }
-      x = m_Centroids[3 * i];
-      y = m_Centroids[3 * i + 1];
-      z = m_Centroids[3 * i + 2];
-      bin1x = m_Bins[3 * i];
-      bin1y = m_Bins[3 * i + 1];
-      bin1z = m_Bins[3 * i + 2];
-      criticalDistance1 = m_CriticalDistance[i];
-
-      for(size_t j = i + 1; j < m_TotalFeatures; j++)
+
+      neighborhood.clear();
+      // A Feature j is in the neighborhood when every bin offset is strictly less than the critical distance,
+      // which for whole bin offsets means an offset of at most ceil(criticalDistance) - 1
+      float criticalDistance = m_CriticalDistance[i];
+      if(criticalDistance > 0.0f)
       {
-        bin2x = m_Bins[3 * j];
-        bin2y = m_Bins[3 * j + 1];
-        bin2z = m_Bins[3 * j + 2];
-        criticalDistance2 = m_CriticalDistance[j];
-        // Use the llabs version of the "C" abs function because we are using int64_t
-        // do NOT try to use the std::abs() function as this is C++11 ONLY
-        dBinX = llabs(bin2x - bin1x);
-        dBinY = llabs(bin2y - bin1y);
-        dBinZ = llabs(bin2z - bin1z);
-
-        if(dBinX < criticalDistance1 && dBinY < criticalDistance1 && dBinZ < criticalDistance1)
+        int64_t reach = static_cast<int64_t>(std::ceil(criticalDistance)) - 1;
+        int64_t lo[3] = {0, 0, 0};
+        int64_t hi[3] = {0, 0, 0};
+        for(size_t d = 0; d < 3; d++)
         {
-          m_Filter->updateNeighborHood(i, j);
+          int64_t cell = m_Bins[3 * i + d] - m_MinBin[d];
+          lo[d] = std::max<int64_t>(cell - reach, 0);
+          hi[d] = std::min<int64_t>(cell + reach, m_GridDims[d] - 1);
         }
-
-        if(dBinX < criticalDistance2 && dBinY < criticalDistance2 && dBinZ < criticalDistance2)
+        for(int64_t cz = lo[2]; cz <= hi[2]; cz++)
         {
-          m_Filter->updateNeighborHood(j, i);
+          for(int64_t cy = lo[1]; cy <= hi[1]; cy++)
+          {
+            size_t rowStart = static_cast<size_t>((cz * m_GridDims[1] + cy) * m_GridDims[0]);
+            for(size_t f = m_CellStarts[rowStart + lo[0]]; f < m_CellStarts[rowStart + hi[0] + 1]; f++)
+            {
+              if(static_cast<size_t>(m_CellFeatures[f]) != i)
+              {
+                neighborhood.push_back(m_CellFeatures[f]);
+              }
+            }
+          }
         }
+        std::sort(neighborhood.begin(), neighborhood.end());
       }
+      m_Filter->updateNeighborHood(i, neighborhood);
     }
   }
 
@@ -147,9 +158,12 @@ public:
 private:
   FindNeighborhoods* m_Filter = nullptr;
   size_t m_TotalFeatures = 0;
-  float* m_Centroids = nullptr;
   const std::vector<int64_t>& m_Bins;
   const std::vector<float>& m_CriticalDistance;
+  int64_t m_MinBin[3];
+  int64_t m_GridDims[3];
+  const std::vector<size_t>& m_CellStarts;
+  const std::vector<int32_t>& m_CellFeatures;
 };
 
 // -----------------------------------------------------------------------------
@@ -347,15 +361,59 @@ void FindNeighborhoods::execute()
     bins[3 * i + 2] = static_cast<int64_t>(zbin);
   }
 
+  // Bucket the Features by bin. Within each grid cell the Features stay in increasing order
+  int64_t minBin[3] = {0, 0, 0};
+  int64_t gridDims[3] = {1, 1, 1};
+  if(totalFeatures > 1)
+  {
+    int64_t maxBin[3] = {bins[3], bins[4], bins[5]};
+    minBin[0] = bins[3];
+    minBin[1] = bins[4];
+    minBin[2] = bins[5];
+    for(size_t i = 2; i < totalFeatures; i++)
+    {
+      for(size_t d = 0; d < 3; d++)
+      {
+        minBin[d] = std::min(minBin[d], bins[3 * i + d]);
+        maxBin[d] = std::max(maxBin[d], bins[3 * i + d]);
+      }
+    }
+    for(size_t d = 0; d < 3; d++)
+    {
+      gridDims[d] = maxBin[d] - minBin[d] + 1;
+    }
+  }
+  size_t numCells = static_cast<size_t>(gridDims[0] * gridDims[1] * gridDims[2]);
+  std::vector<size_t> cellStarts(numCells + 1, 0);
+  std::vector<size_t> featureCell(totalFeatures, 0);
+  for(size_t i = 1; i < totalFeatures; i++)
+  {
+    featureCell[i] = static_cast<size_t>(((bins[3 * i + 2] - minBin[2]) * gridDims[1] + (bins[3 * i + 1] - minBin[1])) * gridDims[0] + (bins[3 * i] - minBin[0]));
+    cellStarts[featureCell[i] + 1]++;
+  }
+  for(size_t c = 0; c < numCells; c++)
+  {
+    cellStarts[c + 1] += cellStarts[c];
+  }
+  std::vector<int32_t> cellFeatures(totalFeatures > 0 ? totalFeatures - 1 : 0);
+  {
+    std::vector<size_t> cellFill(cellStarts.begin(), cellStarts.end() - 1);
+    for(size_t i = 1; i < totalFeatures; i++)
+    {
+      cellFeatures[cellFill[featureCell[i]]++] = static_cast<int32_t>(i);
+    }
+  }
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(true)
   {
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, totalFeatures), FindNeighborhoodsImpl(this, totalFeatures, m_Centroids, bins, criticalDistance), tbb::auto_partitioner());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, totalFeatures), FindNeighborhoodsImpl(this, totalFeatures, bins, criticalDistance, minBin, gridDims, cellStarts, cellFeatures),
+                      tbb::auto_partitioner());
   }
   else
 #endif
   {
-    FindNeighborhoodsImpl serial(this, totalFeatures, m_Centroids, bins, criticalDistance);
+    FindNeighborhoodsImpl serial(this, totalFeatures, bins, criticalDistance, minBin, gridDims, cellStarts, cellFeatures);
     serial.convert(0, totalFeatures);
   }
 
@@ -371,12 +429,11 @@ void FindNeighborhoods::execute()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void FindNeighborhoods::updateNeighborHood(size_t sourceIndex, size_t destIndex)
+void FindNeighborhoods::updateNeighborHood(size_t sourceIndex, const std::vector<int32_t>& neighborhood)
 {
-  static std::mutex mutex;
-  std::lock_guard<std::mutex> lock(mutex);
-  m_Neighborhoods[sourceIndex]++;
-  m_LocalNeighborhoodList[sourceIndex].push_back(static_cast<int32_t>(destIndex));
+  // Each Feature's neighborhood is written by exactly one thread so no locking is needed here
+  m_Neighborhoods[sourceIndex] = static_cast<int32_t>(neighborhood.size());
+  m_LocalNeighborhoodList[sourceIndex] = neighborhood;
 }
 
 // -----------------------------------------------------------------------------
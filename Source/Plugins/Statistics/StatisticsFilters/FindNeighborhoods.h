@@ -161,7 +161,7 @@ public:
   QString getNeighborhoodsArrayName() const;
   Q_PROPERTY(QString NeighborhoodsArrayName READ getNeighborhoodsArrayName WRITE setNeighborhoodsArrayName)
 
-  void updateNeighborHood(size_t sourceIndex, size_t targetIndex);
+  void updateNeighborHood(size_t sourceIndex, const std::vector<int32_t>& neighborhood);
   void updateProgress(size_t numCompleted, size_t totalFeatures);
 
   /**
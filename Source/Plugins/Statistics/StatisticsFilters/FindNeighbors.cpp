@@ -34,7 +34,10 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "FindNeighbors.h"
 
-#include <QtCore/QDateTime>
+#include <algorithm>
+#include <thread>
+#include <unordered_map>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -48,6 +51,7 @@
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "Statistics/StatisticsConstants.h"
 #include "Statistics/StatisticsVersion.h"
@@ -60,6 +64,130 @@ enum createdPathID : RenameDataPath::DataID_t
   DataArrayID32 = 32,
 };
 
+namespace
+{
+using FeaturePairKey = uint64_t;
+using FeatureContact = std::pair<FeaturePairKey, int32_t>;
+
+/**
+ * @brief MakeFeaturePairKey Packs an unordered pair of Feature Ids into a single key, smaller Id first
+ */
+inline FeaturePairKey MakeFeaturePairKey(int32_t feature1, int32_t feature2)
+{
+  if(feature1 > feature2)
+  {
+    std::swap(feature1, feature2);
+  }
+  return (static_cast<uint64_t>(static_cast<uint32_t>(feature1)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(feature2));
+}
+
+/**
+ * @brief The FindNeighborsChunk struct holds the results of scanning one contiguous block of cells
+ */
+struct FindNeighborsChunk
+{
+  int64_t begin = 0;
+  int64_t end = 0;
+  std::vector<FeatureContact> contacts;
+  std::vector<int32_t> surfaceFeatures;
+};
+} // namespace
+
+/**
+ * @brief The FindNeighborsImpl class scans blocks of cells, counting the faces shared by each pair of Features in
+ * a block local hash map. Each shared face is only counted once, from the cell with the lower index, since the
+ * count is the same from either side of the boundary.
+ */
+class FindNeighborsImpl
+{
+public:
+  FindNeighborsImpl(const int64_t* dims, const int32_t* featureIds, int8_t* boundaryCells, bool storeSurfaceFeatures, std::vector<FindNeighborsChunk>& chunks)
+  : m_Dims(dims)
+  , m_FeatureIds(featureIds)
+  , m_BoundaryCells(boundaryCells)
+  , m_StoreSurfaceFeatures(storeSurfaceFeatures)
+  , m_Chunks(chunks)
+  {
+  }
+
+  void scanChunk(FindNeighborsChunk& chunk) const
+  {
+    const int64_t dimX = m_Dims[0];
+    const int64_t dimY = m_Dims[1];
+    const int64_t dimZ = m_Dims[2];
+    const int64_t dimXY = dimX * dimY;
+
+    std::unordered_map<FeaturePairKey, int32_t> contactCounts;
+    for(int64_t j = chunk.begin; j < chunk.end; j++)
+    {
+      int8_t onsurf = 0;
+      const int32_t feature = m_FeatureIds[j];
+      if(feature > 0)
+      {
+        const int64_t column = j % dimX;
+        const int64_t row = (j / dimX) % dimY;
+        const int64_t plane = j / dimXY;
+        if(m_StoreSurfaceFeatures)
+        {
+          bool onBoundary = (column == 0 || column == dimX - 1 || row == 0 || row == dimY - 1);
+          if(dimZ != 1)
+          {
+            onBoundary = onBoundary || plane == 0 || plane == dimZ - 1;
+          }
+          if(onBoundary && (chunk.surfaceFeatures.empty() || chunk.surfaceFeatures.back() != feature))
+          {
+            chunk.surfaceFeatures.push_back(feature);
+          }
+        }
+
+        // Backward neighbors only contribute to the boundary cell count; their shared faces were counted by them
+        if(plane > 0 && m_FeatureIds[j - dimXY] != feature && m_FeatureIds[j - dimXY] > 0)
+        {
+          onsurf++;
+        }
+        if(row > 0 && m_FeatureIds[j - dimX] != feature && m_FeatureIds[j - dimX] > 0)
+        {
+          onsurf++;
+        }
+        if(column > 0 && m_FeatureIds[j - 1] != feature && m_FeatureIds[j - 1] > 0)
+        {
+          onsurf++;
+        }
+        const int64_t forward[3] = {column < dimX - 1 ? j + 1 : -1, row < dimY - 1 ? j + dimX : -1, plane < dimZ - 1 ? j + dimXY : -1};
+        for(int64_t neighbor : forward)
+        {
+          if(neighbor >= 0 && m_FeatureIds[neighbor] != feature && m_FeatureIds[neighbor] > 0)
+          {
+            onsurf++;
+            contactCounts[MakeFeaturePairKey(feature, m_FeatureIds[neighbor])]++;
+          }
+        }
+      }
+      if(nullptr != m_BoundaryCells)
+      {
+        m_BoundaryCells[j] = onsurf;
+      }
+    }
+
+    chunk.contacts.assign(contactCounts.begin(), contactCounts.end());
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      scanChunk(m_Chunks[i]);
+    }
+  }
+
+private:
+  const int64_t* m_Dims = nullptr;
+  const int32_t* m_FeatureIds = nullptr;
+  int8_t* m_BoundaryCells = nullptr;
+  bool m_StoreSurfaceFeatures = false;
+  std::vector<FindNeighborsChunk>& m_Chunks;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -214,10 +342,11 @@ void FindNeighbors::execute()
   }
 
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(m_FeatureIdsArrayPath.getDataContainerName());
-  size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
-  size_t totalFeatures = m_NumNeighborsPtr.lock()->getNumberOfTuples();
+  ImageGeom::Pointer imageGeom = m->getGeometryAs<ImageGeom>();
+  const int64_t totalPoints = static_cast<int64_t>(m_FeatureIdsPtr.lock()->getNumberOfTuples());
+  const size_t totalFeatures = m_NumNeighborsPtr.lock()->getNumberOfTuples();
 
-  SizeVec3Type udims = m->getGeometryAs<ImageGeom>()->getDimensions();
+  SizeVec3Type udims = imageGeom->getDimensions();
 
   int64_t dims[3] = {
       static_cast<int64_t>(udims[0]),
@@ -225,190 +354,136 @@ void FindNeighbors::execute()
       static_cast<int64_t>(udims[2]),
   };
 
-  int64_t neighpoints[6] = {0, 0, 0, 0, 0, 0};
-  neighpoints[0] = -dims[0] * dims[1];
-  neighpoints[1] = -dims[0];
-  neighpoints[2] = -1;
-  neighpoints[3] = 1;
-  neighpoints[4] = dims[0];
-  neighpoints[5] = dims[0] * dims[1];
-
-  int64_t column = 0, row = 0, plane = 0;
-  int32_t feature = 0;
-  int32_t nnum = 0;
-  int8_t onsurf = 0;
-  bool good = false;
-  int64_t neighbor = 0;
-
-  std::vector<std::vector<int32_t>> neighborlist;
-  std::vector<std::vector<float>> neighborsurfacearealist;
-
-  int32_t nListSize = 100;
-  neighborlist.resize(totalFeatures);
-  neighborsurfacearealist.resize(totalFeatures);
+  if(m_StoreSurfaceFeatures)
+  {
+    std::fill_n(m_SurfaceFeatures, totalFeatures, false);
+  }
 
-  uint64_t millis = QDateTime::currentMSecsSinceEpoch();
-  uint64_t currentMillis = millis;
+  // Split the cells into blocks that are scanned concurrently. The blocks are processed in batches so that
+  // progress can be reported and cancellation honored between batches.
+  const int64_t numThreads = std::max(static_cast<int64_t>(std::thread::hardware_concurrency()), static_cast<int64_t>(1));
+  const int64_t cellsPerChunk = std::max(totalPoints / (numThreads * 8), static_cast<int64_t>(4096));
+  const int64_t numChunks = (totalPoints + cellsPerChunk - 1) / cellsPerChunk;
+  const int64_t chunksPerBatch = numThreads * 2;
 
-  for(size_t i = 1; i < totalFeatures; i++)
+  std::vector<FindNeighborsChunk> chunks(static_cast<size_t>(numChunks));
+  for(int64_t i = 0; i < numChunks; i++)
   {
-    currentMillis = QDateTime::currentMSecsSinceEpoch();
-    if(currentMillis - millis > 1000)
-    {
-      QString ss = QObject::tr("Finding Neighbors || Initializing Neighbor Lists || %1% Complete").arg((static_cast<float>(i) / totalFeatures) * 100);
-      notifyStatusMessage(ss);
-      millis = QDateTime::currentMSecsSinceEpoch();
-    }
+    chunks[i].begin = i * cellsPerChunk;
+    chunks[i].end = std::min((i + 1) * cellsPerChunk, totalPoints);
+  }
 
+  int8_t* boundaryCells = m_StoreBoundaryCells ? m_BoundaryCells : nullptr;
+  for(int64_t batch = 0; batch < numChunks; batch += chunksPerBatch)
+  {
     if(getCancel())
     {
       return;
     }
+    QString ss = QObject::tr("Finding Neighbors || Determining Neighbor Lists || %1% Complete").arg(static_cast<int32_t>(100 * batch / numChunks));
+    notifyStatusMessage(ss);
 
-    m_NumNeighbors[i] = 0;
-    neighborlist[i].resize(nListSize);
-    neighborsurfacearealist[i].assign(nListSize, -1.0f);
-    if(m_StoreSurfaceFeatures)
-    {
-      m_SurfaceFeatures[i] = false;
-    }
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(static_cast<size_t>(batch), static_cast<size_t>(std::min(batch + chunksPerBatch, numChunks)));
+    dataAlg.setGrain(1);
+    dataAlg.execute(FindNeighborsImpl(dims, m_FeatureIds, boundaryCells, m_StoreSurfaceFeatures, chunks));
   }
 
-  for(size_t j = 0; j < totalPoints; j++)
+  // Merge the block local contact counts into one sorted list of unique Feature pairs
+  notifyStatusMessage("Finding Neighbors || Merging Contacts");
+  std::vector<FeatureContact> contacts;
   {
-    currentMillis = QDateTime::currentMSecsSinceEpoch();
-    if(currentMillis - millis > 1000)
+    size_t numContacts = 0;
+    for(const auto& chunk : chunks)
     {
-      QString ss = QObject::tr("Finding Neighbors || Determining Neighbor Lists || %1% Complete").arg((static_cast<float>(j) / totalPoints) * 100);
-      notifyStatusMessage(ss);
-      millis = QDateTime::currentMSecsSinceEpoch();
+      numContacts += chunk.contacts.size();
     }
-
-    if(getCancel())
-    {
-      return;
-    }
-
-    onsurf = 0;
-    feature = m_FeatureIds[j];
-    if(feature > 0)
+    contacts.reserve(numContacts);
+  }
+  for(auto& chunk : chunks)
+  {
+    contacts.insert(contacts.end(), chunk.contacts.begin(), chunk.contacts.end());
+    std::vector<FeatureContact>().swap(chunk.contacts);
+    if(m_StoreSurfaceFeatures)
     {
-      column = static_cast<int64_t>(j % m->getGeometryAs<ImageGeom>()->getXPoints());
-      row = static_cast<int64_t>((j / m->getGeometryAs<ImageGeom>()->getXPoints()) % m->getGeometryAs<ImageGeom>()->getYPoints());
-      plane = static_cast<int64_t>(j / (m->getGeometryAs<ImageGeom>()->getXPoints() * m->getGeometryAs<ImageGeom>()->getYPoints()));
-      if(m_StoreSurfaceFeatures)
-      {
-        if((column == 0 || column == static_cast<int64_t>((m->getGeometryAs<ImageGeom>()->getXPoints() - 1)) || row == 0 ||
-            row == static_cast<int64_t>((m->getGeometryAs<ImageGeom>()->getYPoints()) - 1) || plane == 0 || plane == static_cast<int64_t>((m->getGeometryAs<ImageGeom>()->getZPoints() - 1))) &&
-           m->getGeometryAs<ImageGeom>()->getZPoints() != 1)
-        {
-          m_SurfaceFeatures[feature] = true;
-        }
-        if((column == 0 || column == static_cast<int64_t>((m->getGeometryAs<ImageGeom>()->getXPoints() - 1)) || row == 0 ||
-            row == static_cast<int64_t>((m->getGeometryAs<ImageGeom>()->getYPoints() - 1))) &&
-           m->getGeometryAs<ImageGeom>()->getZPoints() == 1)
-        {
-          m_SurfaceFeatures[feature] = true;
-        }
-      }
-      for(int32_t k = 0; k < 6; k++)
+      for(int32_t feature : chunk.surfaceFeatures)
       {
-        good = true;
-        neighbor = static_cast<int64_t>(j + neighpoints[k]);
-        if(k == 0 && plane == 0)
-        {
-          good = false;
-        }
-        if(k == 5 && plane == (m->getGeometryAs<ImageGeom>()->getZPoints() - 1))
-        {
-          good = false;
-        }
-        if(k == 1 && row == 0)
-        {
-          good = false;
-        }
-        if(k == 4 && row == (m->getGeometryAs<ImageGeom>()->getYPoints() - 1))
-        {
-          good = false;
-        }
-        if(k == 2 && column == 0)
-        {
-          good = false;
-        }
-        if(k == 3 && column == (m->getGeometryAs<ImageGeom>()->getXPoints() - 1))
-        {
-          good = false;
-        }
-        if(good && m_FeatureIds[neighbor] != feature && m_FeatureIds[neighbor] > 0)
-        {
-          onsurf++;
-          nnum = m_NumNeighbors[feature];
-          neighborlist[feature].push_back(m_FeatureIds[neighbor]);
-          nnum++;
-          m_NumNeighbors[feature] = nnum;
-        }
+        m_SurfaceFeatures[feature] = true;
       }
     }
-    if(m_StoreBoundaryCells)
-    {
-      m_BoundaryCells[j] = onsurf;
-    }
   }
-
-  FloatVec3Type spacing = m->getGeometryAs<ImageGeom>()->getSpacing();
-
-  // We do this to create new set of NeighborList objects
-  for(size_t i = 1; i < totalFeatures; i++)
+  std::sort(contacts.begin(), contacts.end());
+  size_t numUnique = 0;
+  for(size_t i = 0; i < contacts.size(); i++)
   {
-    currentMillis = QDateTime::currentMSecsSinceEpoch();
-    if(currentMillis - millis > 1000)
+    if(numUnique > 0 && contacts[numUnique - 1].first == contacts[i].first)
     {
-      QString ss = QObject::tr("Finding Neighbors || Calculating Surface Areas || %1% Complete").arg(((float)i / totalFeatures) * 100);
-      notifyStatusMessage(ss);
-      millis = QDateTime::currentMSecsSinceEpoch();
+      contacts[numUnique - 1].second += contacts[i].second;
     }
-
-    if(getCancel())
+    else
     {
-      return;
+      contacts[numUnique++] = contacts[i];
     }
+  }
+  contacts.resize(numUnique);
+
+  if(getCancel())
+  {
+    return;
+  }
 
-    QMap<int32_t, int32_t> neighToCount;
-    int32_t numneighs = static_cast<int32_t>(neighborlist[i].size());
+  // Build the compressed sparse row neighbor storage. Since the pairs are sorted on the smaller Id first, each row
+  // receives its smaller neighbors in ascending order before its larger neighbors in ascending order.
+  std::vector<size_t> rowOffsets(totalFeatures + 1, 0);
+  for(const auto& contact : contacts)
+  {
+    rowOffsets[(contact.first >> 32) + 1]++;
+    rowOffsets[(contact.first & 0xFFFFFFFF) + 1]++;
+  }
+  for(size_t i = 0; i < totalFeatures; i++)
+  {
+    rowOffsets[i + 1] += rowOffsets[i];
+  }
 
-    // this increments the voxel counts for each feature
-    for(int32_t j = 0; j < numneighs; j++)
+  FloatVec3Type spacing = imageGeom->getSpacing();
+  std::vector<int32_t> csrNeighbors(rowOffsets[totalFeatures]);
+  std::vector<float> csrAreas(rowOffsets[totalFeatures]);
+  {
+    std::vector<size_t> rowFill(rowOffsets.begin(), rowOffsets.end() - 1);
+    for(const auto& contact : contacts)
     {
-      neighToCount[neighborlist[i][j]]++;
+      int32_t feature1 = static_cast<int32_t>(contact.first >> 32);
+      int32_t feature2 = static_cast<int32_t>(contact.first & 0xFFFFFFFF);
+      float area = float(contact.second) * spacing[0] * spacing[1];
+      csrNeighbors[rowFill[feature1]] = feature2;
+      csrAreas[rowFill[feature1]++] = area;
+      csrNeighbors[rowFill[feature2]] = feature1;
+      csrAreas[rowFill[feature2]++] = area;
     }
+  }
+  std::vector<FeatureContact>().swap(contacts);
 
-    QMap<int32_t, int32_t>::Iterator neighiter = neighToCount.find(0);
-    neighToCount.erase(neighiter);
-    neighiter = neighToCount.find(-1);
-    neighToCount.erase(neighiter);
-    // Resize the features neighbor list to zero
-    neighborlist[i].resize(0);
-    neighborsurfacearealist[i].resize(0);
-
-    for(QMap<int32_t, int32_t>::iterator iter = neighToCount.begin(); iter != neighToCount.end(); ++iter)
+  // We do this to create new set of NeighborList objects
+  const size_t featuresPerStatus = std::max(totalFeatures / 20, static_cast<size_t>(1));
+  for(size_t i = 1; i < totalFeatures; i++)
+  {
+    if(i % featuresPerStatus == 0)
     {
-      int32_t neigh = iter.key();    // get the neighbor feature
-      int32_t number = iter.value(); // get the number of voxels
-      float area = float(number) * spacing[0] * spacing[1];
-
-      // Push the neighbor feature id back onto the list so we stay synced up
-      neighborlist[i].push_back(neigh);
-      neighborsurfacearealist[i].push_back(area);
+      if(getCancel())
+      {
+        return;
+      }
+      QString ss = QObject::tr("Finding Neighbors || Storing Neighbor Lists || %1% Complete").arg(static_cast<int32_t>(100 * i / totalFeatures));
+      notifyStatusMessage(ss);
     }
-    m_NumNeighbors[i] = int32_t(neighborlist[i].size());
+
+    m_NumNeighbors[i] = static_cast<int32_t>(rowOffsets[i + 1] - rowOffsets[i]);
 
     // Set the vector for each list into the NeighborList Object
-    NeighborList<int32_t>::SharedVectorType sharedNeiLst(new std::vector<int32_t>);
-    sharedNeiLst->assign(neighborlist[i].begin(), neighborlist[i].end());
+    NeighborList<int32_t>::SharedVectorType sharedNeiLst(new std::vector<int32_t>(csrNeighbors.begin() + rowOffsets[i], csrNeighbors.begin() + rowOffsets[i + 1]));
     m_NeighborList.lock()->setList(static_cast<int32_t>(i), sharedNeiLst);
 
-    NeighborList<float>::SharedVectorType sharedSAL(new std::vector<float>);
-    sharedSAL->assign(neighborsurfacearealist[i].begin(), neighborsurfacearealist[i].end());
+    NeighborList<float>::SharedVectorType sharedSAL(new std::vector<float>(csrAreas.begin() + rowOffsets[i], csrAreas.begin() + rowOffsets[i + 1]));
     m_SharedSurfaceAreaList.lock()->setList(static_cast<int32_t>(i), sharedSAL);
   }
 }
@@ -0,0 +1,313 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <QtCore/QDebug>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "StatisticsTestFileLocations.h"
+
+namespace FindNeighborsTestConsts
+{
+const QString k_DataContainerName("NeighborsDataContainer");
+const QString k_CellAttributeMatrixName("CellData");
+const QString k_FeatureAttributeMatrixName("FeatureData");
+} // namespace FindNeighborsTestConsts
+
+class FindNeighborsTest
+{
+public:
+  FindNeighborsTest() = default;
+  virtual ~FindNeighborsTest() = default;
+  FindNeighborsTest(const FindNeighborsTest&) = delete;            // Copy Constructor Not Implemented
+  FindNeighborsTest(FindNeighborsTest&&) = delete;                 // Move Constructor Not Implemented
+  FindNeighborsTest& operator=(const FindNeighborsTest&) = delete; // Copy Assignment Not Implemented
+  FindNeighborsTest& operator=(FindNeighborsTest&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Returns the name of the class for FindNeighborsTest
+   */
+  QString getNameOfClass() const
+  {
+    return QString("FindNeighborsTest");
+  }
+
+  /**
+   * @brief Returns the name of the class for FindNeighborsTest
+   */
+  QString ClassName()
+  {
+    return QString("FindNeighborsTest");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFilterAvailability()
+  {
+    // Now instantiate the FindNeighbors Filter from the FilterManager
+    QString filtName = "FindNeighbors";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    if(nullptr == filterFactory.get())
+    {
+      std::stringstream ss;
+      ss << "The FindNeighborsTest requires the use of the " << filtName.toStdString() << " filter which is found in the Statistics Plugin";
+      DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+    }
+
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Creates an image of the given Feature Ids with a spacing of 0.5 so every shared face has an area of 0.25
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer initializeDataContainerArray(std::vector<size_t> tDims, const std::vector<int32_t>& features, size_t numFeatures)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+
+    DataContainer::Pointer m = DataContainer::New(FindNeighborsTestConsts::k_DataContainerName);
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry("ImageGeometry");
+    m->setGeometry(geom);
+    geom->setDimensions(tDims.data());
+    FloatVec3Type res = {0.5f, 0.5f, 0.5f};
+    geom->setSpacing(res);
+    dca->addOrReplaceDataContainer(m);
+
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tDims, FindNeighborsTestConsts::k_CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+    m->addOrReplaceAttributeMatrix(cellAttrMat);
+
+    std::vector<size_t> cDims(1, 1);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(tDims, cDims, SIMPL::CellData::FeatureIds, true);
+    int err = cellAttrMat->insertOrAssign(featureIds);
+    DREAM3D_REQUIRE(err >= 0);
+    DREAM3D_REQUIRE_EQUAL(featureIds->getNumberOfTuples(), features.size());
+    for(size_t i = 0; i < features.size(); i++)
+    {
+      featureIds->setValue(i, features[i]);
+    }
+
+    std::vector<size_t> featureDims(1, numFeatures + 1);
+    AttributeMatrix::Pointer featureAttrMat = AttributeMatrix::New(featureDims, FindNeighborsTestConsts::k_FeatureAttributeMatrixName, AttributeMatrix::Type::CellFeature);
+    m->addOrReplaceAttributeMatrix(featureAttrMat);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void runFindNeighbors(const DataContainerArray::Pointer& dca)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName("FindNeighbors");
+    DREAM3D_REQUIRE_VALID_POINTER(filterFactory.get());
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    var.setValue(DataArrayPath(FindNeighborsTestConsts::k_DataContainerName, FindNeighborsTestConsts::k_CellAttributeMatrixName, SIMPL::CellData::FeatureIds));
+    DREAM3D_REQUIRE(filter->setProperty("FeatureIdsArrayPath", var));
+    var.setValue(DataArrayPath(FindNeighborsTestConsts::k_DataContainerName, FindNeighborsTestConsts::k_FeatureAttributeMatrixName, ""));
+    DREAM3D_REQUIRE(filter->setProperty("CellFeatureAttributeMatrixPath", var));
+    var.setValue(true);
+    DREAM3D_REQUIRE(filter->setProperty("StoreBoundaryCells", var));
+    DREAM3D_REQUIRE(filter->setProperty("StoreSurfaceFeatures", var));
+
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0);
+  }
+
+  // -----------------------------------------------------------------------------
+  // Requires the neighbors of each Feature in ascending Id order together with the number of faces they share
+  // -----------------------------------------------------------------------------
+  void validateNeighbors(const DataContainerArray::Pointer& dca, const std::vector<std::vector<int32_t>>& neighbors, const std::vector<std::vector<int32_t>>& sharedFaces,
+                         const std::vector<bool>& surfaceFeatures)
+  {
+    AttributeMatrix::Pointer featureAttrMat = dca->getAttributeMatrix(DataArrayPath(FindNeighborsTestConsts::k_DataContainerName, FindNeighborsTestConsts::k_FeatureAttributeMatrixName, ""));
+    DREAM3D_REQUIRE_VALID_POINTER(featureAttrMat.get());
+    Int32ArrayType::Pointer numNeighbors = featureAttrMat->getAttributeArrayAs<Int32ArrayType>(SIMPL::FeatureData::NumNeighbors);
+    NeighborList<int32_t>::Pointer neighborList = featureAttrMat->getAttributeArrayAs<NeighborList<int32_t>>(SIMPL::FeatureData::NeighborList);
+    NeighborList<float>::Pointer sharedSurfaceAreaList = featureAttrMat->getAttributeArrayAs<NeighborList<float>>(SIMPL::FeatureData::SharedSurfaceAreaList);
+    BoolArrayType::Pointer surfaceFeaturesArray = featureAttrMat->getAttributeArrayAs<BoolArrayType>(SIMPL::FeatureData::SurfaceFeatures);
+    DREAM3D_REQUIRE_VALID_POINTER(numNeighbors.get());
+    DREAM3D_REQUIRE_VALID_POINTER(neighborList.get());
+    DREAM3D_REQUIRE_VALID_POINTER(sharedSurfaceAreaList.get());
+    DREAM3D_REQUIRE_VALID_POINTER(surfaceFeaturesArray.get());
+
+    NeighborList<int32_t>& neighborLists = *neighborList;
+    NeighborList<float>& sharedSurfaceAreaLists = *sharedSurfaceAreaList;
+    // Feature 0 holds the bad cells and is never anyone's neighbor
+    for(size_t i = 1; i < neighbors.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(numNeighbors->getValue(i), static_cast<int32_t>(neighbors[i].size()));
+      DREAM3D_REQUIRE_EQUAL(neighborLists[i].size(), neighbors[i].size());
+      DREAM3D_REQUIRE_EQUAL(sharedSurfaceAreaLists[i].size(), neighbors[i].size());
+      for(size_t j = 0; j < neighbors[i].size(); j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(neighborLists[i][j], neighbors[i][j]);
+        DREAM3D_REQUIRE_EQUAL(sharedSurfaceAreaLists[i][j], 0.25f * static_cast<float>(sharedFaces[i][j]));
+      }
+      DREAM3D_REQUIRE_EQUAL(surfaceFeaturesArray->getValue(i), surfaceFeatures[i]);
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void validateBoundaryCells(const DataContainerArray::Pointer& dca, const std::vector<int8_t>& boundaryCells)
+  {
+    AttributeMatrix::Pointer cellAttrMat = dca->getAttributeMatrix(DataArrayPath(FindNeighborsTestConsts::k_DataContainerName, FindNeighborsTestConsts::k_CellAttributeMatrixName, ""));
+    Int8ArrayType::Pointer boundaryCellsArray = cellAttrMat->getAttributeArrayAs<Int8ArrayType>(SIMPL::CellData::BoundaryCells);
+    DREAM3D_REQUIRE_VALID_POINTER(boundaryCellsArray.get());
+    DREAM3D_REQUIRE_EQUAL(boundaryCellsArray->getNumberOfTuples(), boundaryCells.size());
+    for(size_t i = 0; i < boundaryCells.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(boundaryCellsArray->getValue(i), boundaryCells[i]);
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // A 4x4x3 volume: two Features side by side in the bottom plane, a ring of two Features around the interior
+  // Feature 5 in the middle plane with one bad cell, and one Feature covering the top plane
+  // -----------------------------------------------------------------------------
+  int TestKnownVolume()
+  {
+    // clang-format off
+    std::vector<int32_t> features = {
+        1, 1, 2, 2,   1, 1, 2, 2,   1, 1, 2, 2,   1, 1, 2, 2,
+        0, 3, 4, 4,   3, 5, 5, 4,   3, 5, 5, 4,   3, 3, 4, 4,
+        6, 6, 6, 6,   6, 6, 6, 6,   6, 6, 6, 6,   6, 6, 6, 6,
+    };
+    std::vector<int8_t> boundaryCells = {
+        0, 2, 2, 1,   1, 2, 2, 1,   1, 2, 2, 1,   1, 2, 2, 1,
+        0, 4, 4, 2,   3, 4, 4, 3,   3, 4, 4, 3,   2, 4, 4, 2,
+        0, 1, 1, 1,   1, 1, 1, 1,   1, 1, 1, 1,   1, 1, 1, 1,
+    };
+    // clang-format on
+    std::vector<std::vector<int32_t>> neighbors = {{}, {2, 3, 5}, {1, 4, 5}, {1, 4, 5, 6}, {2, 3, 5, 6}, {1, 2, 3, 4, 6}, {3, 4, 5}};
+    std::vector<std::vector<int32_t>> sharedFaces = {{}, {4, 5, 2}, {4, 6, 2}, {5, 2, 4, 5}, {6, 2, 4, 6}, {2, 2, 4, 4, 4}, {5, 6, 4}};
+    std::vector<bool> surfaceFeatures = {false, true, true, true, true, false, true};
+
+    DataContainerArray::Pointer dca = initializeDataContainerArray({4, 4, 3}, features, 6);
+    runFindNeighbors(dca);
+    validateNeighbors(dca, neighbors, sharedFaces, surfaceFeatures);
+    validateBoundaryCells(dca, boundaryCells);
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // A stack of 15 slabs, 3 cells thick, in a 31x29x45 volume. The volume is large enough to be scanned in several
+  // blocks of cells and a 31x29 plane does not fit a whole number of times into a block, so the faces between two
+  // slabs are split across blocks and have to be merged
+  // -----------------------------------------------------------------------------
+  int TestSplitContacts()
+  {
+    const size_t dimX = 31;
+    const size_t dimY = 29;
+    const size_t dimZ = 45;
+    const size_t numSlabs = dimZ / 3;
+    const int32_t planeFaces = static_cast<int32_t>(dimX * dimY);
+
+    std::vector<int32_t> features(dimX * dimY * dimZ);
+    std::vector<int8_t> boundaryCells(features.size());
+    for(size_t z = 0; z < dimZ; z++)
+    {
+      // Only the first and last plane of a slab touch another slab
+      int8_t onsurf = 0;
+      if(z % 3 == 0 && z > 0)
+      {
+        onsurf++;
+      }
+      if(z % 3 == 2 && z < dimZ - 1)
+      {
+        onsurf++;
+      }
+      for(size_t i = 0; i < dimX * dimY; i++)
+      {
+        features[z * dimX * dimY + i] = static_cast<int32_t>(z / 3 + 1);
+        boundaryCells[z * dimX * dimY + i] = onsurf;
+      }
+    }
+
+    std::vector<std::vector<int32_t>> neighbors(numSlabs + 1);
+    std::vector<std::vector<int32_t>> sharedFaces(numSlabs + 1);
+    for(int32_t slab = 1; slab <= static_cast<int32_t>(numSlabs); slab++)
+    {
+      if(slab > 1)
+      {
+        neighbors[slab].push_back(slab - 1);
+        sharedFaces[slab].push_back(planeFaces);
+      }
+      if(slab < static_cast<int32_t>(numSlabs))
+      {
+        neighbors[slab].push_back(slab + 1);
+        sharedFaces[slab].push_back(planeFaces);
+      }
+    }
+    std::vector<bool> surfaceFeatures(numSlabs + 1, true);
+
+    DataContainerArray::Pointer dca = initializeDataContainerArray({dimX, dimY, dimZ}, features, numSlabs);
+    runFindNeighbors(dca);
+    validateNeighbors(dca, neighbors, sharedFaces, surfaceFeatures);
+    validateBoundaryCells(dca, boundaryCells);
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "#### FindNeighborsTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestFilterAvailability());
+
+    DREAM3D_REGISTER_TEST(TestKnownVolume())
+    DREAM3D_REGISTER_TEST(TestSplitContacts())
+  }
+};
@@ -34,8 +34,10 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "LaplacianSmoothing.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <sstream>
+#include <vector>
 
 #include <QtCore/QDebug>
 #include <QtCore/QTextStream>
@@ -50,10 +52,94 @@
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "SurfaceMeshing/SurfaceMeshingConstants.h"
 #include "SurfaceMeshing/SurfaceMeshingVersion.h"
 
+namespace
+{
+/**
+ * @brief The VertexAdjacency struct lists the vertices that share an edge with each vertex in
+ * compressed sparse row form: the neighbors of vertex i are neighbors[offsets[i]] to neighbors[offsets[i + 1] - 1].
+ */
+struct VertexAdjacency
+{
+  std::vector<MeshIndexType> offsets;
+  std::vector<MeshIndexType> neighbors;
+};
+
+/**
+ * @brief createVertexAdjacency Builds the vertex adjacency of a unique edge list. The neighbors of each
+ * vertex are kept in edge list order, so sums gathered over them match a scatter over the edge list exactly
+ */
+VertexAdjacency createVertexAdjacency(const MeshIndexType* edges, MeshIndexType numEdges, MeshIndexType numVerts)
+{
+  VertexAdjacency adjacency;
+  adjacency.offsets.assign(numVerts + 1, 0);
+  for(MeshIndexType i = 0; i < numEdges * 2; i++)
+  {
+    adjacency.offsets[edges[i] + 1]++;
+  }
+  for(MeshIndexType i = 0; i < numVerts; i++)
+  {
+    adjacency.offsets[i + 1] += adjacency.offsets[i];
+  }
+
+  std::vector<MeshIndexType> cursor(adjacency.offsets.begin(), adjacency.offsets.end() - 1);
+  adjacency.neighbors.resize(numEdges * 2);
+  for(MeshIndexType i = 0; i < numEdges; i++)
+  {
+    MeshIndexType in1 = edges[2 * i];
+    MeshIndexType in2 = edges[2 * i + 1];
+    adjacency.neighbors[cursor[in1]++] = in2;
+    adjacency.neighbors[cursor[in2]++] = in1;
+  }
+  return adjacency;
+}
+
+/**
+ * @brief smoothVertices Performs one Laplacian step: every vertex of src moves by lambda * factor times the
+ * mean offset to its neighbors and the result is written to dst. Vertices without neighbors do not move
+ */
+void smoothVertices(const VertexAdjacency& adjacency, const float* lambda, float factor, const float* src, float* dst, MeshIndexType numVerts)
+{
+  auto smoothRange = [&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      MeshIndexType begin = adjacency.offsets[i];
+      MeshIndexType end = adjacency.offsets[i + 1];
+      if(begin == end)
+      {
+        std::copy(src + (3 * i), src + (3 * i + 3), dst + (3 * i));
+        continue;
+      }
+
+      double delta[3] = {0.0, 0.0, 0.0};
+      for(MeshIndexType n = begin; n < end; n++)
+      {
+        const float* neighbor = src + (3 * adjacency.neighbors[n]);
+        for(size_t j = 0; j < 3; j++)
+        {
+          delta[j] += static_cast<double>(neighbor[j] - src[3 * i + j]);
+        }
+      }
+
+      float ll = lambda[i] * factor;
+      double numConnections = static_cast<double>(end - begin);
+      for(size_t j = 0; j < 3; j++)
+      {
+        dst[3 * i + j] = static_cast<float>(src[3 * i + j] + ll * (delta[j] / numConnections));
+      }
+    }
+  };
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numVerts);
+  dataAlg.execute(smoothRange);
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -270,16 +356,15 @@ int32_t LaplacianSmoothing::edgeBasedSmoothing()
   MeshIndexType* uedges = surfaceMesh->getEdgePointer(0);
   MeshIndexType nedges = surfaceMesh->getNumberOfEdges();
 
-  DataArray<int32_t>::Pointer numConnections = DataArray<int32_t>::CreateArray(nvert, std::string("_INTERNAL_USE_ONLY_Laplacian_Smoothing_NumberConnections_Array"), true);
-  numConnections->initializeWithZeros();
-  int32_t* ncon = numConnections->getPointer(0);
+  // The edges are turned into a vertex adjacency once so every iteration gathers from each vertex's
+  // neighbors in parallel instead of scattering into a shared delta array
+  VertexAdjacency adjacency = createVertexAdjacency(uedges, nedges, nvert);
 
-  std::vector<size_t> cDims(1, 3);
-  DataArray<double>::Pointer deltaArray = DataArray<double>::CreateArray(nvert, cDims, "_INTERNAL_USE_ONLY_Laplacian_Smoothing_Delta_Array", true);
-  deltaArray->initializeWithZeros();
-  double* delta = deltaArray->getPointer(0);
+  // Each step reads the positions of the previous step from src and writes the new positions to dst
+  std::vector<float> vertsBuffer(nvert * 3);
+  float* src = verts;
+  float* dst = vertsBuffer.data();
 
-  double dlta = 0.0;
   for(int32_t q = 0; q < m_IterationSteps; q++)
   {
     if(getCancel())
@@ -288,88 +373,28 @@ int32_t LaplacianSmoothing::edgeBasedSmoothing()
     }
     QString ss = QObject::tr("Iteration %1 of %2").arg(q).arg(m_IterationSteps);
     notifyStatusMessage(ss);
-    // Compute the Deltas for each point
-    for(MeshIndexType i = 0; i < nedges; i++)
-    {
-      MeshIndexType in1 = uedges[2 * i];     // row of the first vertex
-      MeshIndexType in2 = uedges[2 * i + 1]; // row the second vertex
-
-      for(MeshIndexType j = 0; j < 3; j++)
-      {
-        Q_ASSERT(static_cast<size_t>(3 * in1 + j) < static_cast<size_t>(nvert * 3));
-        Q_ASSERT(static_cast<size_t>(3 * in2 + j) < static_cast<size_t>(nvert * 3));
-        dlta = static_cast<double>(verts[3 * in2 + j] - verts[3 * in1 + j]);
-        delta[3 * in1 + j] += dlta;
-        delta[3 * in2 + j] += -1.0 * dlta;
-      }
-      ncon[in1] += 1;
-      ncon[in2] += 1;
-    }
-
-    // Move each point
-    float ll = 0.0f;
-    for(MeshIndexType i = 0; i < nvert; i++)
-    {
-      for(MeshIndexType j = 0; j < 3; j++)
-      {
-        MeshIndexType in0 = 3 * i + j;
-        dlta = delta[in0] / ncon[i];
-
-        ll = lambda[i];
-        verts[3 * i + j] += ll * dlta;
-        delta[in0] = 0.0; // reset for next iteration
-      }
-      ncon[i] = 0; // reset for next iteration
-    }
+    smoothVertices(adjacency, lambda, 1.0f, src, dst, nvert);
+    std::swap(src, dst);
 
     // Now optionally apply a negative lambda based on the mu Factor value.
     // This is from Taubin's paper on smoothing without shrinkage. This effectively
     // runs a low pass filter on the data
     if(m_UseTaubinSmoothing)
     {
-
       if(getCancel())
       {
         return -1;
       }
-      QString ss = QObject::tr("Iteration %1 of %2").arg(q).arg(m_IterationSteps);
-      notifyStatusMessage(ss);
-      // Compute the Delta's
-      for(MeshIndexType i = 0; i < nedges; i++)
-      {
-        MeshIndexType in1 = uedges[2 * i];     // row of the first vertex
-        MeshIndexType in2 = uedges[2 * i + 1]; // row the second vertex
-
-        for(int32_t j = 0; j < 3; j++)
-        {
-          Q_ASSERT(static_cast<size_t>(3 * in1 + j) < static_cast<size_t>(nvert * 3));
-          Q_ASSERT(static_cast<size_t>(3 * in2 + j) < static_cast<size_t>(nvert * 3));
-          dlta = verts[3 * in2 + j] - verts[3 * in1 + j];
-          delta[3 * in1 + j] += dlta;
-          delta[3 * in2 + j] += -1.0 * dlta;
-        }
-        ncon[in1] += 1;
-        ncon[in2] += 1;
-      }
-
-      // MOve the points
-      float ll = 0.0f;
-      for(MeshIndexType i = 0; i < nvert; i++)
-      {
-        for(MeshIndexType j = 0; j < 3; j++)
-        {
-          MeshIndexType in0 = 3 * i + j;
-          dlta = delta[in0] / ncon[i];
-
-          ll = lambda[i] * m_MuFactor;
-          verts[3 * i + j] += ll * dlta;
-          delta[in0] = 0.0; // reset for next iteration
-        }
-        ncon[i] = 0; // reset for next iteration
-      }
+      smoothVertices(adjacency, lambda, m_MuFactor, src, dst, nvert);
+      std::swap(src, dst);
     }
   }
 
+  if(src != verts)
+  {
+    std::copy(src, src + (nvert * 3), verts);
+  }
+
   return err;
 }
 
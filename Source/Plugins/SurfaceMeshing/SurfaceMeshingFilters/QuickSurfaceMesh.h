@@ -324,9 +324,29 @@ private:
 
   void correctProblemVoxels();
 
-  void determineActiveNodes(std::vector<MeshIndexType>& m_NodeIds, MeshIndexType& nodeCount, MeshIndexType& triangleCount);
+  /**
+   * @brief The MeshSlab struct holds the node and triangle bookkeeping for a range of voxel layers
+   * that is meshed by a single task
+   */
+  struct MeshSlab;
 
-  void createNodesAndTriangles(std::vector<MeshIndexType> m_NodeIds, MeshIndexType nodeCount, MeshIndexType triangleCount);
+  /**
+   * @brief determineActiveNodes Splits the grid into slabs of voxel layers and counts, in parallel, the
+   * boundary nodes and triangles of each slab. The counts are prefix-summed into per slab offsets
+   * @param slabs
+   * @param nodeCount
+   * @param triangleCount
+   */
+  void determineActiveNodes(std::vector<MeshSlab>& slabs, MeshIndexType& nodeCount, MeshIndexType& triangleCount);
+
+  /**
+   * @brief createNodesAndTriangles Numbers the nodes and emits the triangles of every slab in parallel,
+   * then reconciles the owners of the nodes on the planes that neighboring slabs share
+   * @param slabs
+   * @param nodeCount
+   * @param triangleCount
+   */
+  void createNodesAndTriangles(std::vector<MeshSlab>& slabs, MeshIndexType nodeCount, MeshIndexType triangleCount);
 
   /**
    * @brief updateFaceInstancePointers Updates raw Face pointers
@@ -0,0 +1,859 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "QuickSurfaceMeshOutOfCore.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QTextStream>
+
+#include "H5Support/H5Lite.h"
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/H5Utilities.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/HDF5/VTKH5Constants.h"
+#include "SIMPLib/Utilities/FileSystemPathHelper.h"
+
+#include "SurfaceMeshing/SurfaceMeshingConstants.h"
+#include "SurfaceMeshing/SurfaceMeshingFilters/util/QuickMeshFaces.h"
+#include "SurfaceMeshing/SurfaceMeshingVersion.h"
+
+using namespace QuickMeshFaces;
+
+namespace
+{
+// Rows per chunk of the output datasets
+constexpr hsize_t k_ChunkTuples = 65536;
+
+/**
+ * @brief The AppendableDataset class is a chunked 2D dataset of unlimited length that
+ * tuples are appended to as they are produced, so the whole array never has to be in memory.
+ */
+class AppendableDataset
+{
+public:
+  AppendableDataset(hid_t parentId, const std::string& name, hid_t dataType, hsize_t numComps)
+  : m_DataType(dataType)
+  , m_NumComps(numComps)
+  {
+    hsize_t dims[2] = {0, numComps};
+    hsize_t maxDims[2] = {H5S_UNLIMITED, numComps};
+    hsize_t chunkDims[2] = {k_ChunkTuples, numComps};
+    hid_t spaceId = H5Screate_simple(2, dims, maxDims);
+    hid_t propertyId = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(propertyId, 2, chunkDims);
+    m_DatasetId = H5Dcreate(parentId, name.c_str(), dataType, spaceId, H5P_DEFAULT, propertyId, H5P_DEFAULT);
+    H5Pclose(propertyId);
+    H5Sclose(spaceId);
+  }
+
+  ~AppendableDataset()
+  {
+    if(m_DatasetId >= 0)
+    {
+      H5Dclose(m_DatasetId);
+    }
+  }
+
+  bool isValid() const
+  {
+    return m_DatasetId >= 0;
+  }
+
+  hsize_t getNumberOfTuples() const
+  {
+    return m_NumTuples;
+  }
+
+  /**
+   * @brief append Grows the dataset and writes the tuples held in data to the end of it
+   */
+  template <typename T>
+  herr_t append(const std::vector<T>& data)
+  {
+    hsize_t numTuples = data.size() / m_NumComps;
+    if(numTuples == 0)
+    {
+      return 0;
+    }
+    hsize_t newDims[2] = {m_NumTuples + numTuples, m_NumComps};
+    herr_t err = H5Dset_extent(m_DatasetId, newDims);
+    if(err < 0)
+    {
+      return err;
+    }
+    hsize_t offset[2] = {m_NumTuples, 0};
+    hsize_t count[2] = {numTuples, m_NumComps};
+    hid_t fileSpaceId = H5Dget_space(m_DatasetId);
+    hid_t memSpaceId = H5Screate_simple(2, count, nullptr);
+    err = H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, offset, nullptr, count, nullptr);
+    if(err >= 0)
+    {
+      err = H5Dwrite(m_DatasetId, m_DataType, memSpaceId, fileSpaceId, H5P_DEFAULT, data.data());
+    }
+    H5Sclose(memSpaceId);
+    H5Sclose(fileSpaceId);
+    if(err >= 0)
+    {
+      m_NumTuples += numTuples;
+    }
+    return err;
+  }
+
+  AppendableDataset(const AppendableDataset&) = delete;            // Copy Constructor Not Implemented
+  AppendableDataset(AppendableDataset&&) = delete;                 // Move Constructor Not Implemented
+  AppendableDataset& operator=(const AppendableDataset&) = delete; // Copy Assignment Not Implemented
+  AppendableDataset& operator=(AppendableDataset&&) = delete;      // Move Assignment Not Implemented
+
+private:
+  hid_t m_DatasetId = -1;
+  hid_t m_DataType = -1;
+  hsize_t m_NumComps = 1;
+  hsize_t m_NumTuples = 0;
+};
+
+/**
+ * @brief writeDataArrayAttributes Writes the attributes that let a DataContainerReader load a dataset as a DataArray
+ */
+herr_t writeDataArrayAttributes(hid_t parentId, const std::string& name, const std::string& objectType, hsize_t numTuples, hsize_t numComps)
+{
+  std::vector<hsize_t> attrDims = {1};
+  std::vector<uint64_t> tupleDims = {numTuples};
+  std::vector<uint64_t> compDims = {numComps};
+  herr_t err = H5Lite::writeVectorAttribute(parentId, name, SIMPL::HDF5::TupleDimensions.toStdString(), attrDims, tupleDims);
+  err = (err < 0) ? err : H5Lite::writeVectorAttribute(parentId, name, SIMPL::HDF5::ComponentDimensions.toStdString(), attrDims, compDims);
+  err = (err < 0) ? err : H5Lite::writeScalarAttribute(parentId, name, SIMPL::HDF5::DataArrayVersion.toStdString(), static_cast<int32_t>(2));
+  err = (err < 0) ? err : H5Lite::writeStringAttribute(parentId, name, SIMPL::HDF5::ObjectType.toStdString(), objectType);
+  return err;
+}
+
+/**
+ * @brief writeAttributeMatrixAttributes Writes the type and tuple count of an Attribute Matrix group
+ */
+herr_t writeAttributeMatrixAttributes(hid_t dcGid, const std::string& name, AttributeMatrix::Type type, hsize_t numTuples)
+{
+  std::vector<hsize_t> attrDims = {1};
+  std::vector<uint64_t> tupleDims = {numTuples};
+  herr_t err = H5Lite::writeScalarAttribute(dcGid, name, SIMPL::StringConstants::AttributeMatrixType.toStdString(), static_cast<uint32_t>(type));
+  err = (err < 0) ? err : H5Lite::writeVectorAttribute(dcGid, name, SIMPL::HDF5::TupleDimensions.toStdString(), attrDims, tupleDims);
+  return err;
+}
+
+/**
+ * @brief readGridNodeCoordinates Fills in the coordinate of every node along each axis of the
+ * Image or Rectilinear Grid geometry stored in the Data Container group dcGid
+ */
+herr_t readGridNodeCoordinates(hid_t dcGid, const std::array<MeshIndexType, 3>& dims, std::array<std::vector<float>, 3>& coords)
+{
+  const std::string geometryName = SIMPL::Geometry::Geometry.toStdString();
+  std::string geometryTypeName;
+  herr_t err = H5Lite::readStringAttribute(dcGid, geometryName, SIMPL::Geometry::GeometryTypeName.toStdString(), geometryTypeName);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  if(geometryTypeName == SIMPL::Geometry::ImageGeometry.toStdString())
+  {
+    std::vector<float> origin;
+    std::vector<float> spacing;
+    err = H5Lite::readVectorDataset(dcGid, geometryName + "/" + H5_ORIGIN, origin);
+    err = (err < 0) ? err : H5Lite::readVectorDataset(dcGid, geometryName + "/" + H5_SPACING, spacing);
+    if(err < 0 || origin.size() != 3 || spacing.size() != 3)
+    {
+      return -1;
+    }
+    for(size_t d = 0; d < 3; d++)
+    {
+      coords[d].resize(dims[d] + 1);
+      for(MeshIndexType n = 0; n <= dims[d]; n++)
+      {
+        coords[d][n] = static_cast<float>(n) * spacing[d] + origin[d];
+      }
+    }
+    return 0;
+  }
+
+  if(geometryTypeName == SIMPL::Geometry::RectGridGeometry.toStdString())
+  {
+    const std::array<QString, 3> boundsNames = {{SIMPL::Geometry::xBoundsList, SIMPL::Geometry::yBoundsList, SIMPL::Geometry::zBoundsList}};
+    for(size_t d = 0; d < 3; d++)
+    {
+      err = H5Lite::readVectorDataset(dcGid, geometryName + "/" + boundsNames[d].toStdString(), coords[d]);
+      if(err < 0 || coords[d].size() != dims[d] + 1)
+      {
+        return -1;
+      }
+    }
+    return 0;
+  }
+
+  return -1;
+}
+
+/**
+ * @brief readFeatureIdLayers Reads numLayers Z layers of the Feature Ids dataset starting at zStart
+ */
+herr_t readFeatureIdLayers(hid_t amGid, const std::string& name, const std::vector<hsize_t>& dims, MeshIndexType zStart, MeshIndexType numLayers, std::vector<int32_t>& featureIds)
+{
+  hid_t datasetId = H5Dopen(amGid, name.c_str(), H5P_DEFAULT);
+  if(datasetId < 0)
+  {
+    return -1;
+  }
+  std::vector<hsize_t> offset(dims.size(), 0);
+  std::vector<hsize_t> count = dims;
+  offset[0] = zStart;
+  count[0] = numLayers;
+  size_t numValues = 1;
+  for(const auto& value : count)
+  {
+    numValues *= value;
+  }
+  featureIds.resize(numValues);
+
+  hid_t fileSpaceId = H5Dget_space(datasetId);
+  hid_t memSpaceId = H5Screate_simple(static_cast<int>(count.size()), count.data(), nullptr);
+  herr_t err = H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr);
+  if(err >= 0)
+  {
+    err = H5Dread(datasetId, H5T_NATIVE_INT32, memSpaceId, fileSpaceId, H5P_DEFAULT, featureIds.data());
+  }
+  H5Sclose(memSpaceId);
+  H5Sclose(fileSpaceId);
+  H5Dclose(datasetId);
+  return err;
+}
+
+/**
+ * @brief The PartialOutputFileRemover class deletes the output file when it goes out of scope unless
+ * the file was completed, so a canceled or failed run does not leave a half written .dream3d file behind.
+ * It must be declared before the sentinel that closes the file so that it runs after the file is closed.
+ */
+class PartialOutputFileRemover
+{
+public:
+  explicit PartialOutputFileRemover(QString filePath)
+  : m_FilePath(std::move(filePath))
+  {
+  }
+
+  ~PartialOutputFileRemover()
+  {
+    if(!m_Completed)
+    {
+      QFile::remove(m_FilePath);
+    }
+  }
+
+  void setCompleted()
+  {
+    m_Completed = true;
+  }
+
+  PartialOutputFileRemover(const PartialOutputFileRemover&) = delete;            // Copy Constructor Not Implemented
+  PartialOutputFileRemover(PartialOutputFileRemover&&) = delete;                 // Move Constructor Not Implemented
+  PartialOutputFileRemover& operator=(const PartialOutputFileRemover&) = delete; // Copy Assignment Not Implemented
+  PartialOutputFileRemover& operator=(PartialOutputFileRemover&&) = delete;      // Move Assignment Not Implemented
+
+private:
+  QString m_FilePath;
+  bool m_Completed = false;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QuickSurfaceMeshOutOfCore::QuickSurfaceMeshOutOfCore() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QuickSurfaceMeshOutOfCore::~QuickSurfaceMeshOutOfCore() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void QuickSurfaceMeshOutOfCore::setupFilterParameters()
+{
+  FilterParameterVectorType parameters;
+  parameters.push_back(SIMPL_NEW_INPUT_FILE_FP("Input File", InputFile, FilterParameter::Category::Parameter, QuickSurfaceMeshOutOfCore, "*.dream3d", "DREAM3D File"));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Feature Ids Path", FeatureIdsArrayPath, FilterParameter::Category::Parameter, QuickSurfaceMeshOutOfCore));
+  parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output File", OutputFile, FilterParameter::Category::Parameter, QuickSurfaceMeshOutOfCore, "*.dream3d", "DREAM3D File"));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Slab Thickness (Voxel Layers)", SlabThickness, FilterParameter::Category::Parameter, QuickSurfaceMeshOutOfCore));
+  parameters.push_back(SeparatorFilterParameter::Create("Created Data", FilterParameter::Category::Parameter));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Data Container", SurfaceDataContainerName, FilterParameter::Category::Parameter, QuickSurfaceMeshOutOfCore));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Vertex Attribute Matrix", VertexAttributeMatrixName, FilterParameter::Category::Parameter, QuickSurfaceMeshOutOfCore));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Node Types", NodeTypesArrayName, FilterParameter::Category::Parameter, QuickSurfaceMeshOutOfCore));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Face Attribute Matrix", FaceAttributeMatrixName, FilterParameter::Category::Parameter, QuickSurfaceMeshOutOfCore));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Face Labels", FaceLabelsArrayName, FilterParameter::Category::Parameter, QuickSurfaceMeshOutOfCore));
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void QuickSurfaceMeshOutOfCore::readFilterParameters(AbstractFilterParametersReader* reader, int index)
+{
+  reader->openFilterGroup(this, index);
+  setInputFile(reader->readString("InputFile", getInputFile()));
+  setFeatureIdsArrayPath(reader->readString("FeatureIdsArrayPath", getFeatureIdsArrayPath()));
+  setOutputFile(reader->readString("OutputFile", getOutputFile()));
+  setSlabThickness(reader->readValue("SlabThickness", getSlabThickness()));
+  setSurfaceDataContainerName(reader->readString("SurfaceDataContainerName", getSurfaceDataContainerName()));
+  setVertexAttributeMatrixName(reader->readString("VertexAttributeMatrixName", getVertexAttributeMatrixName()));
+  setNodeTypesArrayName(reader->readString("NodeTypesArrayName", getNodeTypesArrayName()));
+  setFaceAttributeMatrixName(reader->readString("FaceAttributeMatrixName", getFaceAttributeMatrixName()));
+  setFaceLabelsArrayName(reader->readString("FaceLabelsArrayName", getFaceLabelsArrayName()));
+  reader->closeFilterGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void QuickSurfaceMeshOutOfCore::initialize()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void QuickSurfaceMeshOutOfCore::dataCheck()
+{
+  clearErrorCode();
+  clearWarningCode();
+
+  QFileInfo fi(getInputFile());
+  if(getInputFile().isEmpty())
+  {
+    setErrorCondition(-11000, "The input file must be set");
+  }
+  else if(!fi.exists())
+  {
+    QString ss = QObject::tr("The input file '%1' does not exist").arg(getInputFile());
+    if(getInPreflight())
+    {
+      setWarningCondition(-11001, ss);
+    }
+    else
+    {
+      setErrorCondition(-11002, ss);
+    }
+  }
+
+  QStringList pathParts = getFeatureIdsArrayPath().split('/');
+  if(pathParts.size() != 3 || pathParts.contains(QString("")))
+  {
+    QString ss = QObject::tr("The Feature Ids path '%1' must be written as DataContainer/AttributeMatrix/Array").arg(getFeatureIdsArrayPath());
+    setErrorCondition(-11003, ss);
+  }
+
+  FileSystemPathHelper::CheckOutputFile(this, "Output File", getOutputFile(), true);
+  if(!getOutputFile().isEmpty() && QFileInfo(getOutputFile()).absoluteFilePath() == fi.absoluteFilePath())
+  {
+    setErrorCondition(-11004, "The output file must be different from the input file");
+  }
+
+  if(getSlabThickness() < 1)
+  {
+    QString ss = QObject::tr("The slab thickness must be at least 1 voxel layer; the current value is %1").arg(getSlabThickness());
+    setErrorCondition(-11005, ss);
+  }
+
+  if(getSurfaceDataContainerName().isEmpty() || getVertexAttributeMatrixName().isEmpty() || getFaceAttributeMatrixName().isEmpty() || getNodeTypesArrayName().isEmpty() ||
+     getFaceLabelsArrayName().isEmpty())
+  {
+    setErrorCondition(-11006, "The names of the created Data Container, Attribute Matrices and Attribute Arrays must all be set");
+  }
+  if(getVertexAttributeMatrixName() == getFaceAttributeMatrixName())
+  {
+    setErrorCondition(-11007, "The Vertex and Face Attribute Matrices must have different names");
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void QuickSurfaceMeshOutOfCore::execute()
+{
+  dataCheck();
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  QStringList pathParts = getFeatureIdsArrayPath().split('/');
+  std::string featureIdsName = pathParts[2].toStdString();
+
+  hid_t inputFileId = H5Utilities::openFile(getInputFile().toStdString(), true);
+  if(inputFileId < 0)
+  {
+    QString ss = QObject::tr("Error opening input file '%1'").arg(getInputFile());
+    setErrorCondition(-11010, ss);
+    return;
+  }
+  H5ScopedFileSentinel inputSentinel(inputFileId, true);
+  hid_t dcaGid = H5Gopen(inputFileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().constData(), H5P_DEFAULT);
+  inputSentinel.addGroupId(dcaGid);
+  hid_t dcGid = (dcaGid < 0) ? -1 : H5Gopen(dcaGid, pathParts[0].toLatin1().constData(), H5P_DEFAULT);
+  inputSentinel.addGroupId(dcGid);
+  hid_t amGid = (dcGid < 0) ? -1 : H5Gopen(dcGid, pathParts[1].toLatin1().constData(), H5P_DEFAULT);
+  inputSentinel.addGroupId(amGid);
+  if(amGid < 0)
+  {
+    QString ss = QObject::tr("The Attribute Matrix '%1/%2' does not exist in the input file").arg(pathParts[0]).arg(pathParts[1]);
+    setErrorCondition(-11011, ss);
+    return;
+  }
+
+  // Feature Ids are stored with the slowest dimension first: [Z, Y, X] followed by the component dimension
+  std::vector<hsize_t> dims;
+  H5T_class_t classType = H5T_NO_CLASS;
+  size_t typeSize = 0;
+  herr_t err = H5Lite::getDatasetInfo(amGid, featureIdsName, dims, classType, typeSize);
+  if(err < 0 || classType != H5T_INTEGER || typeSize != 4 || dims.size() < 3 || dims.size() > 4 || (dims.size() == 4 && dims[3] != 1))
+  {
+    QString ss = QObject::tr("The Feature Ids array '%1' must exist in the input file as a single component 32 bit integer array with 3 tuple dimensions").arg(getFeatureIdsArrayPath());
+    setErrorCondition(-11012, ss);
+    return;
+  }
+  const MeshIndexType xP = dims[2];
+  const MeshIndexType yP = dims[1];
+  const MeshIndexType zP = dims[0];
+  const MeshIndexType layerSize = xP * yP;
+  const MeshIndexType planeSize = (xP + 1) * (yP + 1);
+
+  std::array<std::vector<float>, 3> coords;
+  if(readGridNodeCoordinates(dcGid, {{xP, yP, zP}}, coords) < 0)
+  {
+    QString ss = QObject::tr("The geometry of Data Container '%1' could not be read. Only Image and Rectilinear Grid geometries can be meshed").arg(pathParts[0]);
+    setErrorCondition(-11013, ss);
+    return;
+  }
+
+  hid_t outputFileId = H5Utilities::createFile(getOutputFile().toStdString());
+  if(outputFileId < 0)
+  {
+    QString ss = QObject::tr("The output file '%1' could not be created").arg(getOutputFile());
+    setErrorCondition(-11014, ss);
+    return;
+  }
+  PartialOutputFileRemover outputRemover(getOutputFile());
+  H5ScopedFileSentinel outputSentinel(outputFileId, true);
+  const std::string dcPath = SIMPL::StringConstants::DataContainerGroupName.toStdString() + "/" + getSurfaceDataContainerName().toStdString();
+  const std::string vertexAmName = getVertexAttributeMatrixName().toStdString();
+  const std::string faceAmName = getFaceAttributeMatrixName().toStdString();
+  const std::string geometryName = SIMPL::Geometry::Geometry.toStdString();
+  err = H5Utilities::createGroupsFromPath(dcPath + "/" + geometryName, outputFileId);
+  err = (err < 0) ? err : H5Utilities::createGroupsFromPath(dcPath + "/" + vertexAmName, outputFileId);
+  err = (err < 0) ? err : H5Utilities::createGroupsFromPath(dcPath + "/" + faceAmName, outputFileId);
+  hid_t outDcGid = (err < 0) ? -1 : H5Gopen(outputFileId, dcPath.c_str(), H5P_DEFAULT);
+  outputSentinel.addGroupId(outDcGid);
+  hid_t geometryGid = (outDcGid < 0) ? -1 : H5Gopen(outDcGid, geometryName.c_str(), H5P_DEFAULT);
+  outputSentinel.addGroupId(geometryGid);
+  hid_t vertexAmGid = (outDcGid < 0) ? -1 : H5Gopen(outDcGid, vertexAmName.c_str(), H5P_DEFAULT);
+  outputSentinel.addGroupId(vertexAmGid);
+  hid_t faceAmGid = (outDcGid < 0) ? -1 : H5Gopen(outDcGid, faceAmName.c_str(), H5P_DEFAULT);
+  outputSentinel.addGroupId(faceAmGid);
+  if(geometryGid < 0 || vertexAmGid < 0 || faceAmGid < 0)
+  {
+    QString ss = QObject::tr("The groups of Data Container '%1' could not be created in the output file").arg(getSurfaceDataContainerName());
+    setErrorCondition(-11015, ss);
+    return;
+  }
+
+  const std::string vertexListName = SIMPL::Geometry::SharedVertexList.toStdString();
+  const std::string nodeTypesName = getNodeTypesArrayName().toStdString();
+  const std::string faceLabelsName = getFaceLabelsArrayName().toStdString();
+  AppendableDataset vertexList(geometryGid, vertexListName, H5T_NATIVE_FLOAT, 3);
+  AppendableDataset triList(geometryGid, SIMPL::Geometry::SharedTriList.toStdString(), H5T_NATIVE_UINT64, 3);
+  AppendableDataset nodeTypes(vertexAmGid, nodeTypesName, H5T_NATIVE_INT8, 1);
+  AppendableDataset faceLabels(faceAmGid, faceLabelsName, H5T_NATIVE_INT32, 2);
+  if(!vertexList.isValid() || !triList.isValid() || !nodeTypes.isValid() || !faceLabels.isValid())
+  {
+    QString ss = QObject::tr("The mesh arrays could not be created in the output file '%1'").arg(getOutputFile());
+    setErrorCondition(-11016, ss);
+    return;
+  }
+
+  // Nodes and triangles are numbered by the same layer by layer scan as QuickSurfaceMesh, but only a
+  // slab of Feature Id layers is resident at a time and each slab's mesh is appended to the output
+  // file as soon as it is done. A node can still be touched by the layer above the one that created
+  // it, so the owners of the nodes created by the last layer of a slab stay open until the next slab
+  std::vector<int32_t> slabFeatureIds;
+  std::vector<MeshIndexType> bottomPlane(planeSize, k_InvalidNode);
+  std::vector<MeshIndexType> topPlane(planeSize, k_InvalidNode);
+  std::vector<NodeOwners> openNodeOwners;
+  MeshIndexType firstOpenNode = 0;
+  MeshIndexType nextNodeId = 0;
+
+  std::vector<float> slabVertices;
+  std::vector<uint64_t> slabTriangles;
+  std::vector<int32_t> slabFaceLabels;
+  std::vector<int8_t> closedNodeTypes;
+
+  auto closeNodes = [&](MeshIndexType endNode) {
+    MeshIndexType numClosed = endNode - firstOpenNode;
+    closedNodeTypes.resize(numClosed);
+    for(MeshIndexType n = 0; n < numClosed; n++)
+    {
+      closedNodeTypes[n] = openNodeOwners[n].nodeType();
+    }
+    openNodeOwners.erase(openNodeOwners.begin(), openNodeOwners.begin() + numClosed);
+    firstOpenNode = endNode;
+    return nodeTypes.append(closedNodeTypes);
+  };
+
+  const MeshIndexType slabThickness = static_cast<MeshIndexType>(getSlabThickness());
+  for(MeshIndexType zStart = 0; zStart < zP; zStart += slabThickness)
+  {
+    if(getCancel())
+    {
+      return;
+    }
+    MeshIndexType zEnd = std::min(zP, zStart + slabThickness);
+    QString ss = QObject::tr("Meshing Voxel Layers %1 to %2 of %3").arg(zStart + 1).arg(zEnd).arg(zP);
+    notifyStatusMessage(ss);
+
+    // The layer above the slab is read as well so the +Z faces of the slab's last layer can be found
+    MeshIndexType numLayers = std::min(zP, zEnd + 1) - zStart;
+    if(readFeatureIdLayers(amGid, featureIdsName, dims, zStart, numLayers, slabFeatureIds) < 0)
+    {
+      ss = QObject::tr("Error reading voxel layers %1 to %2 of the Feature Ids array").arg(zStart).arg(zStart + numLayers - 1);
+      setErrorCondition(-11017, ss);
+      return;
+    }
+    auto layerOf = [&](MeshIndexType k) -> const int32_t* { return (k < zP) ? slabFeatureIds.data() + ((k - zStart) * layerSize) : nullptr; };
+
+    slabVertices.clear();
+    slabTriangles.clear();
+    slabFaceLabels.clear();
+    MeshIndexType lastLayerFirstNode = nextNodeId;
+    for(MeshIndexType k = zStart; k < zEnd; k++)
+    {
+      lastLayerFirstNode = nextNodeId;
+      std::fill(topPlane.begin(), topPlane.end(), k_InvalidNode);
+      ForEachFaceInLayer(layerOf(k), layerOf(k + 1), xP, yP, zP, k, [&](const VoxelFace& face) {
+        std::array<MeshIndexType, 4> nodes = {{0, 0, 0, 0}};
+        for(size_t n = 0; n < 4; n++)
+        {
+          const auto& corner = (*face.corners)[n];
+          MeshIndexType planeIndex = (face.j + corner[1]) * (xP + 1) + face.i + corner[0];
+          MeshIndexType& nodeId = (corner[2] == 0) ? bottomPlane[planeIndex] : topPlane[planeIndex];
+          if(nodeId == k_InvalidNode)
+          {
+            nodeId = nextNodeId++;
+            openNodeOwners.emplace_back();
+            slabVertices.push_back(coords[0][face.i + corner[0]]);
+            slabVertices.push_back(coords[1][face.j + corner[1]]);
+            slabVertices.push_back(coords[2][k + corner[2]]);
+          }
+          nodes[n] = nodeId;
+          NodeOwners& owners = openNodeOwners[nodeId - firstOpenNode];
+          owners.insert(face.labels[0]);
+          owners.insert(face.labels[1]);
+        }
+
+        std::array<MeshIndexType, 6> triangleNodes = {{nodes[0], nodes[1], nodes[2], nodes[1], nodes[3], nodes[2]}};
+        if(face.reversed)
+        {
+          triangleNodes = {{nodes[0], nodes[2], nodes[1], nodes[1], nodes[2], nodes[3]}};
+        }
+        slabTriangles.insert(slabTriangles.end(), triangleNodes.begin(), triangleNodes.end());
+        for(size_t t = 0; t < 2; t++)
+        {
+          slabFaceLabels.push_back(face.labels[0]);
+          slabFaceLabels.push_back(face.labels[1]);
+        }
+      });
+      std::swap(bottomPlane, topPlane);
+    }
+
+    err = vertexList.append(slabVertices);
+    err = (err < 0) ? err : triList.append(slabTriangles);
+    err = (err < 0) ? err : faceLabels.append(slabFaceLabels);
+    err = (err < 0) ? err : closeNodes(zEnd < zP ? lastLayerFirstNode : nextNodeId);
+    if(err < 0)
+    {
+      ss = QObject::tr("Error writing the mesh of voxel layers %1 to %2 to the output file").arg(zStart).arg(zEnd - 1);
+      setErrorCondition(-11018, ss);
+      return;
+    }
+  }
+
+  const hsize_t numVertices = vertexList.getNumberOfTuples();
+  const hsize_t numTriangles = triList.getNumberOfTuples();
+  const std::string triangleGeometryName = SIMPL::Geometry::TriangleGeometry.toStdString();
+  err = writeDataArrayAttributes(geometryGid, vertexListName, "DataArray<float>", numVertices, 3);
+  err = (err < 0) ? err : writeDataArrayAttributes(geometryGid, SIMPL::Geometry::SharedTriList.toStdString(), "DataArray<uint64_t>", numTriangles, 3);
+  err = (err < 0) ? err : writeDataArrayAttributes(vertexAmGid, nodeTypesName, "DataArray<int8_t>", numVertices, 1);
+  err = (err < 0) ? err : writeDataArrayAttributes(faceAmGid, faceLabelsName, "DataArray<int32_t>", numTriangles, 2);
+  err = (err < 0) ? err : writeAttributeMatrixAttributes(outDcGid, vertexAmName, AttributeMatrix::Type::Vertex, numVertices);
+  err = (err < 0) ? err : writeAttributeMatrixAttributes(outDcGid, faceAmName, AttributeMatrix::Type::Face, numTriangles);
+  err = (err < 0) ? err : H5Lite::writeStringAttribute(outDcGid, geometryName, SIMPL::Geometry::GeometryName.toStdString(), triangleGeometryName);
+  err = (err < 0) ? err : H5Lite::writeStringAttribute(outDcGid, geometryName, SIMPL::Geometry::GeometryTypeName.toStdString(), triangleGeometryName);
+  err = (err < 0) ? err : H5Lite::writeScalarAttribute(outDcGid, geometryName, SIMPL::Geometry::GeometryType.toStdString(), static_cast<uint32_t>(IGeometry::Type::Triangle));
+  err = (err < 0) ? err : H5Lite::writeScalarAttribute(outDcGid, geometryName, SIMPL::Geometry::SpatialDimensionality.toStdString(), static_cast<uint32_t>(3));
+  err = (err < 0) ? err : H5Lite::writeScalarAttribute(outDcGid, geometryName, SIMPL::Geometry::UnitDimensionality.toStdString(), static_cast<uint32_t>(2));
+  err = (err < 0) ? err : H5Lite::writeStringAttribute(outputFileId, "/", SIMPL::HDF5::FileVersionName.toStdString(), SIMPL::HDF5::FileVersion.toStdString());
+  if(err < 0)
+  {
+    QString ss = QObject::tr("Error writing the Data Container attributes to the output file '%1'").arg(getOutputFile());
+    setErrorCondition(-11019, ss);
+    return;
+  }
+
+  outputRemover.setCompleted();
+  QString ss = QObject::tr("Wrote %1 Vertices and %2 Triangles").arg(numVertices).arg(numTriangles);
+  notifyStatusMessage(ss);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer QuickSurfaceMeshOutOfCore::newFilterInstance(bool copyFilterParameters) const
+{
+  QuickSurfaceMeshOutOfCore::Pointer filter = QuickSurfaceMeshOutOfCore::New();
+  if(copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString QuickSurfaceMeshOutOfCore::getCompiledLibraryName() const
+{
+  return SurfaceMeshingConstants::SurfaceMeshingBaseName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString QuickSurfaceMeshOutOfCore::getBrandingString() const
+{
+  return "SurfaceMeshing";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString QuickSurfaceMeshOutOfCore::getFilterVersion() const
+{
+  QString version;
+  QTextStream vStream(&version);
+  vStream << SurfaceMeshing::Version::Major() << "." << SurfaceMeshing::Version::Minor() << "." << SurfaceMeshing::Version::Patch();
+  return version;
+}
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString QuickSurfaceMeshOutOfCore::getGroupName() const
+{
+  return SIMPL::FilterGroups::SurfaceMeshingFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QUuid QuickSurfaceMeshOutOfCore::getUuid() const
+{
+  return QUuid("{388f07f2-6e2f-4e82-a1fd-f2415ff5cbbb}");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString QuickSurfaceMeshOutOfCore::getSubGroupName() const
+{
+  return SIMPL::FilterSubGroups::GenerationFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString QuickSurfaceMeshOutOfCore::getHumanLabel() const
+{
+  return "Quick Surface Mesh (Out of Core)";
+}
+
+// -----------------------------------------------------------------------------
+QuickSurfaceMeshOutOfCore::Pointer QuickSurfaceMeshOutOfCore::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+std::shared_ptr<QuickSurfaceMeshOutOfCore> QuickSurfaceMeshOutOfCore::New()
+{
+  struct make_shared_enabler : public QuickSurfaceMeshOutOfCore
+  {
+  };
+  std::shared_ptr<make_shared_enabler> val = std::make_shared<make_shared_enabler>();
+  val->setupFilterParameters();
+  return val;
+}
+
+// -----------------------------------------------------------------------------
+QString QuickSurfaceMeshOutOfCore::getNameOfClass() const
+{
+  return QString("QuickSurfaceMeshOutOfCore");
+}
+
+// -----------------------------------------------------------------------------
+QString QuickSurfaceMeshOutOfCore::ClassName()
+{
+  return QString("QuickSurfaceMeshOutOfCore");
+}
+
+// -----------------------------------------------------------------------------
+void QuickSurfaceMeshOutOfCore::setInputFile(const QString& value)
+{
+  m_InputFile = value;
+}
+
+// -----------------------------------------------------------------------------
+QString QuickSurfaceMeshOutOfCore::getInputFile() const
+{
+  return m_InputFile;
+}
+
+// -----------------------------------------------------------------------------
+void QuickSurfaceMeshOutOfCore::setFeatureIdsArrayPath(const QString& value)
+{
+  m_FeatureIdsArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+QString QuickSurfaceMeshOutOfCore::getFeatureIdsArrayPath() const
+{
+  return m_FeatureIdsArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void QuickSurfaceMeshOutOfCore::setOutputFile(const QString& value)
+{
+  m_OutputFile = value;
+}
+
+// -----------------------------------------------------------------------------
+QString QuickSurfaceMeshOutOfCore::getOutputFile() const
+{
+  return m_OutputFile;
+}
+
+// -----------------------------------------------------------------------------
+void QuickSurfaceMeshOutOfCore::setSlabThickness(int value)
+{
+  m_SlabThickness = value;
+}
+
+// -----------------------------------------------------------------------------
+int QuickSurfaceMeshOutOfCore::getSlabThickness() const
+{
+  return m_SlabThickness;
+}
+
+// -----------------------------------------------------------------------------
+void QuickSurfaceMeshOutOfCore::setSurfaceDataContainerName(const QString& value)
+{
+  m_SurfaceDataContainerName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString QuickSurfaceMeshOutOfCore::getSurfaceDataContainerName() const
+{
+  return m_SurfaceDataContainerName;
+}
+
+// -----------------------------------------------------------------------------
+void QuickSurfaceMeshOutOfCore::setVertexAttributeMatrixName(const QString& value)
+{
+  m_VertexAttributeMatrixName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString QuickSurfaceMeshOutOfCore::getVertexAttributeMatrixName() const
+{
+  return m_VertexAttributeMatrixName;
+}
+
+// -----------------------------------------------------------------------------
+void QuickSurfaceMeshOutOfCore::setFaceAttributeMatrixName(const QString& value)
+{
+  m_FaceAttributeMatrixName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString QuickSurfaceMeshOutOfCore::getFaceAttributeMatrixName() const
+{
+  return m_FaceAttributeMatrixName;
+}
+
+// -----------------------------------------------------------------------------
+void QuickSurfaceMeshOutOfCore::setFaceLabelsArrayName(const QString& value)
+{
+  m_FaceLabelsArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString QuickSurfaceMeshOutOfCore::getFaceLabelsArrayName() const
+{
+  return m_FaceLabelsArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void QuickSurfaceMeshOutOfCore::setNodeTypesArrayName(const QString& value)
+{
+  m_NodeTypesArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString QuickSurfaceMeshOutOfCore::getNodeTypesArrayName() const
+{
+  return m_NodeTypesArrayName;
+}
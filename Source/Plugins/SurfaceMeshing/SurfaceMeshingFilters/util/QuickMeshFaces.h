@@ -0,0 +1,210 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+
+#include "SIMPLib/Geometry/IGeometry.h"
+
+/**
+ * @brief The QuickMeshFaces namespace holds the pieces of the QuickSurfaceMesh algorithm that do not
+ * depend on where the Feature Ids live, so the in memory and the out of core meshers number nodes and
+ * emit triangles identically.
+ */
+namespace QuickMeshFaces
+{
+constexpr MeshIndexType k_InvalidNode = std::numeric_limits<MeshIndexType>::max();
+
+/**
+ * @brief The NodeOwners struct is a fixed width replacement for a std::set of the Feature Ids
+ * that touch a node. The node type saturates at 4 owners, so only the first 4 distinct Feature
+ * Ids are kept; the exterior (Feature Id -1) is tracked as a separate flag.
+ */
+struct NodeOwners
+{
+  std::array<int32_t, 4> featureIds = {{0, 0, 0, 0}};
+  int8_t count = 0;
+  bool exterior = false;
+
+  void insert(int32_t featureId)
+  {
+    if(featureId == -1)
+    {
+      exterior = true;
+      return;
+    }
+    for(int8_t n = 0; n < count; n++)
+    {
+      if(featureIds[n] == featureId)
+      {
+        return;
+      }
+    }
+    if(count < 4)
+    {
+      featureIds[count++] = featureId;
+    }
+  }
+
+  void merge(const NodeOwners& other)
+  {
+    for(int8_t n = 0; n < other.count; n++)
+    {
+      insert(other.featureIds[n]);
+    }
+    exterior = exterior || other.exterior;
+  }
+
+  int8_t nodeType() const
+  {
+    int8_t nodeType = std::min<int8_t>(count + (exterior ? 1 : 0), 4);
+    return exterior ? nodeType + 10 : nodeType;
+  }
+};
+
+// (i, j, k) offset of the 4 corners of a voxel face, in the order they are numbered
+using FaceCorners = std::array<std::array<uint8_t, 3>, 4>;
+
+constexpr FaceCorners k_XMinCorners = {{{{0, 0, 0}}, {{0, 1, 0}}, {{0, 0, 1}}, {{0, 1, 1}}}};
+constexpr FaceCorners k_YMinCorners = {{{{0, 0, 0}}, {{1, 0, 0}}, {{0, 0, 1}}, {{1, 0, 1}}}};
+constexpr FaceCorners k_ZMinCorners = {{{{0, 0, 0}}, {{1, 0, 0}}, {{0, 1, 0}}, {{1, 1, 0}}}};
+constexpr FaceCorners k_XMaxCorners = {{{{1, 0, 0}}, {{1, 1, 0}}, {{1, 0, 1}}, {{1, 1, 1}}}};
+constexpr FaceCorners k_YMaxCorners = {{{{1, 1, 0}}, {{0, 1, 0}}, {{1, 1, 1}}, {{0, 1, 1}}}};
+constexpr FaceCorners k_ZMaxCorners = {{{{1, 0, 1}}, {{0, 0, 1}}, {{1, 1, 1}}, {{0, 1, 1}}}};
+
+/**
+ * @brief The VoxelFace struct is one voxel face that becomes a pair of triangles. The triangles are
+ * (n1, n2, n3) and (n2, n4, n3), or (n1, n3, n2) and (n2, n3, n4) when reversed is set. point and
+ * neighbor are indices into the whole grid.
+ */
+struct VoxelFace
+{
+  MeshIndexType i = 0;
+  MeshIndexType j = 0;
+  MeshIndexType point = 0;
+  MeshIndexType neighbor = 0;
+  const FaceCorners* corners = nullptr;
+  bool reversed = false;
+  bool exterior = false;
+  int32_t labels[2] = {0, 0};
+};
+
+/**
+ * @brief ForEachFaceInLayer visits the boundary faces of voxel layer k in the order the mesh
+ * is numbered: voxel by voxel, then -X, -Y, -Z, +X, +Y and +Z faces.
+ * @param layer Feature Ids of layer k
+ * @param nextLayer Feature Ids of layer k + 1, or nullptr for the last layer of the grid
+ */
+template <typename FaceFunc>
+void ForEachFaceInLayer(const int32_t* layer, const int32_t* nextLayer, MeshIndexType xP, MeshIndexType yP, MeshIndexType zP, MeshIndexType k, FaceFunc&& faceFunc)
+{
+  const MeshIndexType layerOffset = k * xP * yP;
+  VoxelFace face;
+  int32_t pointId = 0;
+  auto exteriorFace = [&](const FaceCorners& corners, bool reversed) {
+    face.corners = &corners;
+    face.reversed = reversed;
+    face.exterior = true;
+    face.neighbor = face.point;
+    face.labels[0] = -1;
+    face.labels[1] = pointId;
+    faceFunc(face);
+  };
+  auto interiorFace = [&](const FaceCorners& corners, MeshIndexType neighbor, int32_t neighborId, bool reversedWhenLower) {
+    if(pointId == neighborId)
+    {
+      return;
+    }
+    bool lower = pointId < neighborId;
+    face.corners = &corners;
+    face.reversed = (lower == reversedWhenLower);
+    face.exterior = false;
+    face.neighbor = neighbor;
+    face.labels[0] = lower ? pointId : neighborId;
+    face.labels[1] = lower ? neighborId : pointId;
+    faceFunc(face);
+  };
+
+  for(MeshIndexType j = 0; j < yP; j++)
+  {
+    for(MeshIndexType i = 0; i < xP; i++)
+    {
+      MeshIndexType index = (j * xP) + i;
+      face.i = i;
+      face.j = j;
+      face.point = layerOffset + index;
+      pointId = layer[index];
+
+      if(i == 0)
+      {
+        exteriorFace(k_XMinCorners, true);
+      }
+      if(j == 0)
+      {
+        exteriorFace(k_YMinCorners, false);
+      }
+      if(k == 0)
+      {
+        exteriorFace(k_ZMinCorners, true);
+      }
+      if(i == (xP - 1))
+      {
+        exteriorFace(k_XMaxCorners, false);
+      }
+      else
+      {
+        interiorFace(k_XMaxCorners, face.point + 1, layer[index + 1], true);
+      }
+      if(j == (yP - 1))
+      {
+        exteriorFace(k_YMaxCorners, false);
+      }
+      else
+      {
+        interiorFace(k_YMaxCorners, face.point + xP, layer[index + xP], false);
+      }
+      if(k == (zP - 1))
+      {
+        exteriorFace(k_ZMaxCorners, true);
+      }
+      else
+      {
+        interiorFace(k_ZMaxCorners, face.point + (xP * yP), nextLayer[index], true);
+      }
+    }
+  }
+}
+} // namespace QuickMeshFaces
@@ -0,0 +1,367 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <array>
+
+#include <QtCore/QDebug>
+#include <QtCore/QFile>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "SurfaceMeshingTestFileLocations.h"
+
+#define SET_FILTER_PROPERTY_WITH_CHECK(filter, key, value)                                                                                                                                             \
+  var.setValue(value);                                                                                                                                                                                 \
+  propWasSet = filter->setProperty(key, var);                                                                                                                                                          \
+  if(!propWasSet)                                                                                                                                                                                      \
+  {                                                                                                                                                                                                    \
+    qDebug() << "Unable to set property " << key;                                                                                                                                                      \
+  }                                                                                                                                                                                                    \
+  DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+/**
+ * @brief The QuickSurfaceMeshOutOfCoreTest class meshes the same volume with QuickSurfaceMesh and with
+ * QuickSurfaceMeshOutOfCore at several slab thicknesses and requires the two meshes to be identical
+ */
+class QuickSurfaceMeshOutOfCoreTest
+{
+  const QString k_ImageDataContainerName = {"ImageDataContainer"};
+  const QString k_CellAttributeMatrixName = {"CellData"};
+  const QString k_SurfaceDataContainerName = {"TriangleDataContainer"};
+  const QString k_VertexAttributeMatrixName = {"VertexData"};
+  const QString k_FaceAttributeMatrixName = {"FaceData"};
+
+  // The volume is deeper than the thinnest slabs so nodes are created on, and closed across, several slab boundaries
+  const size_t k_XPoints = 4;
+  const size_t k_YPoints = 3;
+  const size_t k_ZPoints = 5;
+
+public:
+  QuickSurfaceMeshOutOfCoreTest() = default;
+  ~QuickSurfaceMeshOutOfCoreTest() = default;
+
+  /**
+   * @brief Returns the name of the class for QuickSurfaceMeshOutOfCoreTest
+   */
+  QString getNameOfClass() const
+  {
+    return QString("QuickSurfaceMeshOutOfCoreTest");
+  }
+
+  /**
+   * @brief Returns the name of the class for QuickSurfaceMeshOutOfCoreTest
+   */
+  QString ClassName()
+  {
+    return QString("QuickSurfaceMeshOutOfCoreTest");
+  }
+
+  QuickSurfaceMeshOutOfCoreTest(const QuickSurfaceMeshOutOfCoreTest&) = delete;            // Copy Constructor Not Implemented
+  QuickSurfaceMeshOutOfCoreTest(QuickSurfaceMeshOutOfCoreTest&&) = delete;                 // Move Constructor Not Implemented
+  QuickSurfaceMeshOutOfCoreTest& operator=(const QuickSurfaceMeshOutOfCoreTest&) = delete; // Copy Assignment Not Implemented
+  QuickSurfaceMeshOutOfCoreTest& operator=(QuickSurfaceMeshOutOfCoreTest&&) = delete;      // Move Assignment Not Implemented
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::QuickSurfaceMeshOutOfCoreTest::InputFile);
+    QFile::remove(UnitTest::QuickSurfaceMeshOutOfCoreTest::OutputFile);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFilterAvailability()
+  {
+    // Now instantiate the QuickSurfaceMeshOutOfCore and QuickSurfaceMesh Filters from the FilterManager
+    QStringList filtNames = {"QuickSurfaceMeshOutOfCore", "QuickSurfaceMesh"};
+    FilterManager* fm = FilterManager::Instance();
+    for(const QString& filtName : filtNames)
+    {
+      IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+      if(nullptr == filterFactory.get())
+      {
+        std::stringstream ss;
+        ss << "The QuickSurfaceMeshOutOfCoreTest Requires the use of the " << filtName.toStdString() << " filter which is found in the SurfaceMeshing Plugin";
+        DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+      }
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer initializeDataContainerArray()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+
+    DataContainer::Pointer imageDC = DataContainer::New(k_ImageDataContainerName);
+    dca->addOrReplaceDataContainer(imageDC);
+
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    size_t dims[3] = {k_XPoints, k_YPoints, k_ZPoints};
+    FloatVec3Type origin = {1.0f, -2.0f, 3.0f};
+    FloatVec3Type spacing = {0.5f, 0.25f, 2.0f};
+    image->setDimensions(dims);
+    image->setOrigin(origin);
+    image->setSpacing(spacing);
+    imageDC->setGeometry(image);
+
+    // The volume is cut into axis aligned blocks with one feature per block. Block faces lie on the Z planes 2
+    // and 3, which are slab boundaries for slab thicknesses of 1 and 2, so nodes owned by several features
+    // are closed across slabs. Blocks never touch along an edge or corner only, which keeps the problem
+    // voxel correction of QuickSurfaceMesh from rewriting the Feature Ids before they are meshed
+    std::vector<size_t> tDims = {k_XPoints, k_YPoints, k_ZPoints};
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tDims, k_CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(k_XPoints * k_YPoints * k_ZPoints, SIMPL::CellData::FeatureIds, true);
+    for(size_t k = 0; k < k_ZPoints; k++)
+    {
+      size_t zBlock = (k < 2) ? 0 : ((k < 3) ? 1 : 2);
+      for(size_t j = 0; j < k_YPoints; j++)
+      {
+        size_t yBlock = (j < 1) ? 0 : 1;
+        for(size_t i = 0; i < k_XPoints; i++)
+        {
+          size_t xBlock = (i < 3) ? 0 : 1;
+          size_t index = (k * k_YPoints + j) * k_XPoints + i;
+          featureIds->setValue(index, static_cast<int32_t>(1 + xBlock + 2 * (yBlock + 2 * zBlock)));
+        }
+      }
+    }
+    cellAttrMat->insertOrAssign(featureIds);
+    imageDC->addOrReplaceAttributeMatrix(cellAttrMat);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Returns true if, inside any 2x2x2 window of cells, the cells of one feature do not fill an axis aligned
+  // box. Those are the edge and corner only contacts that QuickSurfaceMesh::correctProblemVoxels() flips
+  // -----------------------------------------------------------------------------
+  bool hasDiagonalContacts(const Int32ArrayType& featureIds)
+  {
+    for(size_t k = 1; k < k_ZPoints; k++)
+    {
+      for(size_t j = 1; j < k_YPoints; j++)
+      {
+        for(size_t i = 1; i < k_XPoints; i++)
+        {
+          std::array<int32_t, 8> window = {{0, 0, 0, 0, 0, 0, 0, 0}};
+          for(size_t c = 0; c < 8; c++)
+          {
+            size_t index = ((k - 1 + c / 4) * k_YPoints + (j - 1 + (c / 2) % 2)) * k_XPoints + (i - 1 + c % 2);
+            window[c] = featureIds.getValue(index);
+          }
+          for(size_t c = 0; c < 8; c++)
+          {
+            std::array<size_t, 3> minCorner = {{1, 1, 1}};
+            std::array<size_t, 3> maxCorner = {{0, 0, 0}};
+            size_t numCells = 0;
+            for(size_t n = 0; n < 8; n++)
+            {
+              if(window[n] != window[c])
+              {
+                continue;
+              }
+              std::array<size_t, 3> corner = {{n % 2, (n / 2) % 2, n / 4}};
+              for(size_t d = 0; d < 3; d++)
+              {
+                minCorner[d] = std::min(minCorner[d], corner[d]);
+                maxCorner[d] = std::max(maxCorner[d], corner[d]);
+              }
+              numCells++;
+            }
+            size_t boxCells = (maxCorner[0] - minCorner[0] + 1) * (maxCorner[1] - minCorner[1] + 1) * (maxCorner[2] - minCorner[2] + 1);
+            if(numCells != boxCells)
+            {
+              return true;
+            }
+          }
+        }
+      }
+    }
+    return false;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer readDataContainerArray(const QString& filePath)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setDataContainerArray(dca);
+    reader->setInputFile(filePath);
+    DataContainerArrayProxy dcaProxy = reader->readDataContainerArrayStructure(filePath);
+    reader->setInputFileDataContainerArrayProxy(dcaProxy);
+    reader->execute();
+    DREAM3D_REQUIRE_EQUAL(reader->getErrorCode(), 0);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void compareArrays(const typename DataArray<T>::Pointer& exemplar, const typename DataArray<T>::Pointer& computed)
+  {
+    DREAM3D_REQUIRE_VALID_POINTER(exemplar.get())
+    DREAM3D_REQUIRE_VALID_POINTER(computed.get())
+    DREAM3D_REQUIRE_EQUAL(computed->getNumberOfTuples(), exemplar->getNumberOfTuples())
+    DREAM3D_REQUIRE_EQUAL(computed->getNumberOfComponents(), exemplar->getNumberOfComponents())
+    for(size_t i = 0; i < exemplar->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(computed->getValue(i), exemplar->getValue(i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void validateMesh(const DataContainer::Pointer& exemplarDC, const DataContainer::Pointer& computedDC)
+  {
+    DREAM3D_REQUIRE_VALID_POINTER(computedDC.get())
+    TriangleGeom::Pointer exemplarGeom = exemplarDC->getGeometryAs<TriangleGeom>();
+    TriangleGeom::Pointer computedGeom = computedDC->getGeometryAs<TriangleGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(computedGeom.get())
+
+    compareArrays<float>(exemplarGeom->getVertices(), computedGeom->getVertices());
+    compareArrays<MeshIndexType>(exemplarGeom->getTriangles(), computedGeom->getTriangles());
+
+    AttributeMatrix::Pointer exemplarFaceAttrMat = exemplarDC->getAttributeMatrix(k_FaceAttributeMatrixName);
+    AttributeMatrix::Pointer computedFaceAttrMat = computedDC->getAttributeMatrix(k_FaceAttributeMatrixName);
+    DREAM3D_REQUIRE_VALID_POINTER(computedFaceAttrMat.get())
+    compareArrays<int32_t>(exemplarFaceAttrMat->getAttributeArrayAs<Int32ArrayType>(SIMPL::FaceData::SurfaceMeshFaceLabels),
+                           computedFaceAttrMat->getAttributeArrayAs<Int32ArrayType>(SIMPL::FaceData::SurfaceMeshFaceLabels));
+
+    AttributeMatrix::Pointer exemplarVertexAttrMat = exemplarDC->getAttributeMatrix(k_VertexAttributeMatrixName);
+    AttributeMatrix::Pointer computedVertexAttrMat = computedDC->getAttributeMatrix(k_VertexAttributeMatrixName);
+    DREAM3D_REQUIRE_VALID_POINTER(computedVertexAttrMat.get())
+    compareArrays<int8_t>(exemplarVertexAttrMat->getAttributeArrayAs<Int8ArrayType>(SIMPL::VertexData::SurfaceMeshNodeType),
+                          computedVertexAttrMat->getAttributeArrayAs<Int8ArrayType>(SIMPL::VertexData::SurfaceMeshNodeType));
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int RunTest()
+  {
+    QVariant var;
+    bool propWasSet = false;
+    FilterManager* fm = FilterManager::Instance();
+
+    DataContainerArray::Pointer dca = initializeDataContainerArray();
+
+    // Write the volume out before it is meshed so the input file only holds the Image geometry
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(UnitTest::QuickSurfaceMeshOutOfCoreTest::InputFile);
+    writer->setWriteXdmfFile(false);
+    writer->execute();
+    DREAM3D_REQUIRED(writer->getErrorCode(), >=, 0)
+
+    // QuickSurfaceMesh must not correct any problem voxels, otherwise it meshes different Feature Ids than the file holds
+    Int32ArrayType::Pointer featureIds =
+        dca->getDataContainer(k_ImageDataContainerName)->getAttributeMatrix(k_CellAttributeMatrixName)->getAttributeArrayAs<Int32ArrayType>(SIMPL::CellData::FeatureIds);
+    DREAM3D_REQUIRE_EQUAL(hasDiagonalContacts(*featureIds), false)
+
+    // Mesh the volume in memory to get the exemplar mesh
+    IFilterFactory::Pointer factory = fm->getFactoryFromClassName("QuickSurfaceMesh");
+    DREAM3D_REQUIRE(factory.get() != nullptr)
+    AbstractFilter::Pointer meshFilter = factory->create();
+    DREAM3D_REQUIRE(meshFilter.get() != nullptr)
+    meshFilter->setDataContainerArray(dca);
+    DataArrayPath featureIdsPath(k_ImageDataContainerName, k_CellAttributeMatrixName, SIMPL::CellData::FeatureIds);
+    DataArrayPath surfaceDCPath(k_SurfaceDataContainerName, "", "");
+    SET_FILTER_PROPERTY_WITH_CHECK(meshFilter, "FeatureIdsArrayPath", featureIdsPath)
+    SET_FILTER_PROPERTY_WITH_CHECK(meshFilter, "SurfaceDataContainerName", surfaceDCPath)
+    meshFilter->execute();
+    DREAM3D_REQUIRE_EQUAL(meshFilter->getErrorCode(), 0);
+    DataContainer::Pointer exemplarDC = dca->getDataContainer(k_SurfaceDataContainerName);
+
+    // A single layer per slab, slabs that end part way through the volume, and one slab for the whole volume
+    std::vector<int> slabThicknesses = {1, 2, static_cast<int>(k_ZPoints)};
+    for(int slabThickness : slabThicknesses)
+    {
+      factory = fm->getFactoryFromClassName("QuickSurfaceMeshOutOfCore");
+      DREAM3D_REQUIRE(factory.get() != nullptr)
+      AbstractFilter::Pointer outOfCoreFilter = factory->create();
+      DREAM3D_REQUIRE(outOfCoreFilter.get() != nullptr)
+      SET_FILTER_PROPERTY_WITH_CHECK(outOfCoreFilter, "InputFile", UnitTest::QuickSurfaceMeshOutOfCoreTest::InputFile)
+      SET_FILTER_PROPERTY_WITH_CHECK(outOfCoreFilter, "FeatureIdsArrayPath", featureIdsPath.serialize("/"))
+      SET_FILTER_PROPERTY_WITH_CHECK(outOfCoreFilter, "OutputFile", UnitTest::QuickSurfaceMeshOutOfCoreTest::OutputFile)
+      SET_FILTER_PROPERTY_WITH_CHECK(outOfCoreFilter, "SlabThickness", slabThickness)
+      SET_FILTER_PROPERTY_WITH_CHECK(outOfCoreFilter, "SurfaceDataContainerName", k_SurfaceDataContainerName)
+      outOfCoreFilter->execute();
+      DREAM3D_REQUIRE_EQUAL(outOfCoreFilter->getErrorCode(), 0);
+
+      DataContainerArray::Pointer computedDca = readDataContainerArray(UnitTest::QuickSurfaceMeshOutOfCoreTest::OutputFile);
+      validateMesh(exemplarDC, computedDca->getDataContainer(k_SurfaceDataContainerName));
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  /**
+   * @brief
+   */
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "---- " << getNameOfClass().toStdString() << " ----" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestFilterAvailability());
+
+    DREAM3D_REGISTER_TEST(RunTest())
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+private:
+};
@@ -33,6 +33,12 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <set>
+
 #include <QtCore/QDebug>
 #include <QtCore/QFile>
 
@@ -63,6 +69,12 @@
   }                                                                                                                                                                                                    \
   DREAM3D_REQUIRE_EQUAL(propWasSet, true)
 
+namespace
+{
+// 12 z layers give three slabs of k_MinLayersPerSlab layers each
+const int64_t k_MultiSlabDims[3] = {6, 5, 12};
+} // namespace
+
 /**
  * @brief The QuickSurfaceMeshTest class
  */
@@ -410,6 +422,222 @@ public:
 
     return EXIT_SUCCESS;
   }
+
+  // -----------------------------------------------------------------------------
+  // Feature layout of the multi slab volume: the volume is meshed in slabs of 4 z layers, so the feature
+  // boundaries at z = 4 and z = 8 lie exactly on the planes shared by neighboring slabs
+  // -----------------------------------------------------------------------------
+  int32_t multiSlabFeatureId(int64_t i, int64_t j, int64_t k) const
+  {
+    if(i < 0 || j < 0 || k < 0 || i >= k_MultiSlabDims[0] || j >= k_MultiSlabDims[1] || k >= k_MultiSlabDims[2])
+    {
+      return -1;
+    }
+    if(k < 4)
+    {
+      return (i < 3) ? 1 : 2;
+    }
+    if(k < 8)
+    {
+      return (j < 2) ? 3 : 4;
+    }
+    if(i < 2)
+    {
+      return 5;
+    }
+    return (j < 3) ? 6 : 7;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestMultiSlab()
+  {
+    using NodeKey = std::array<int64_t, 3>;
+    using FaceKey = std::array<int64_t, 4>;
+
+    struct ExpectedFace
+    {
+      int32_t labels[2];
+      int normalSign;
+      int cornersSeen;
+      int triangles;
+    };
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("MultiSlab");
+    dca->addOrReplaceDataContainer(dc);
+
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    size_t dims[3] = {static_cast<size_t>(k_MultiSlabDims[0]), static_cast<size_t>(k_MultiSlabDims[1]), static_cast<size_t>(k_MultiSlabDims[2])};
+    image->setDimensions(dims);
+    dc->setGeometry(image);
+
+    size_t numVoxels = dims[0] * dims[1] * dims[2];
+    std::vector<size_t> tDims(1, numVoxels);
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(numVoxels, SIMPL::CellData::FeatureIds, true);
+    for(int64_t k = 0; k < k_MultiSlabDims[2]; k++)
+    {
+      for(int64_t j = 0; j < k_MultiSlabDims[1]; j++)
+      {
+        for(int64_t i = 0; i < k_MultiSlabDims[0]; i++)
+        {
+          featureIds->setValue((k * k_MultiSlabDims[1] + j) * k_MultiSlabDims[0] + i, multiSlabFeatureId(i, j, k));
+        }
+      }
+    }
+    cellAttrMat->insertOrAssign(featureIds);
+    dc->addOrReplaceAttributeMatrix(cellAttrMat);
+
+    // Build the expected boundary faces and node owners directly from the voxels
+    std::map<FaceKey, ExpectedFace> expectedFaces;
+    std::map<NodeKey, std::set<int32_t>> expectedOwners;
+    for(int64_t axis = 0; axis < 3; axis++)
+    {
+      for(int64_t k = 0; k <= k_MultiSlabDims[2]; k++)
+      {
+        for(int64_t j = 0; j <= k_MultiSlabDims[1]; j++)
+        {
+          for(int64_t i = 0; i <= k_MultiSlabDims[0]; i++)
+          {
+            NodeKey corner = {{i, j, k}};
+            if((axis != 0 && i == k_MultiSlabDims[0]) || (axis != 1 && j == k_MultiSlabDims[1]) || (axis != 2 && k == k_MultiSlabDims[2]))
+            {
+              continue;
+            }
+            NodeKey lowerVoxel = corner;
+            lowerVoxel[axis]--;
+            int32_t lower = multiSlabFeatureId(lowerVoxel[0], lowerVoxel[1], lowerVoxel[2]);
+            int32_t upper = multiSlabFeatureId(i, j, k);
+            if(lower == upper)
+            {
+              continue;
+            }
+            ExpectedFace face;
+            face.labels[0] = std::min(lower, upper);
+            face.labels[1] = std::max(lower, upper);
+            face.normalSign = (upper < lower) ? 1 : -1;
+            face.cornersSeen = 0;
+            face.triangles = 0;
+            expectedFaces[{{axis, i, j, k}}] = face;
+
+            for(int64_t c = 0; c < 4; c++)
+            {
+              NodeKey node = corner;
+              node[(axis + 1) % 3] += c & 1;
+              node[(axis + 2) % 3] += (c >> 1) & 1;
+              expectedOwners[node].insert(lower);
+              expectedOwners[node].insert(upper);
+            }
+          }
+        }
+      }
+    }
+
+    QString filtName = "QuickSurfaceMesh";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer factory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE(factory.get() != nullptr)
+
+    AbstractFilter::Pointer meshFilter = factory->create();
+    DREAM3D_REQUIRE(meshFilter.get() != nullptr)
+    meshFilter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    SET_FILTER_PROPERTY_WITH_CHECK(meshFilter, "FeatureIdsArrayPath", DataArrayPath("MultiSlab", "CellData", SIMPL::CellData::FeatureIds), 0)
+    SET_FILTER_PROPERTY_WITH_CHECK(meshFilter, "SurfaceDataContainerName", DataArrayPath("MultiSlabSurfMesh", "", ""), 0)
+    SET_FILTER_PROPERTY_WITH_CHECK(meshFilter, "TripleLineDataContainerName", DataArrayPath("MultiSlab TripleLines", "", ""), 0)
+    meshFilter->execute();
+    DREAM3D_REQUIRE_EQUAL(meshFilter->getErrorCode(), 0);
+
+    DataContainer::Pointer sm = dca->getDataContainer("MultiSlabSurfMesh");
+    TriangleGeom::Pointer triangleGeom = sm->getGeometryAs<TriangleGeom>();
+    DREAM3D_REQUIRE_EQUAL(triangleGeom->getNumberOfTris(), expectedFaces.size() * 2);
+    DREAM3D_REQUIRE_EQUAL(triangleGeom->getNumberOfVertices(), expectedOwners.size());
+
+    AttributeMatrix::Pointer faceAttrMat = sm->getAttributeMatrix(meshFilter->property("FaceAttributeMatrixName").toString());
+    AttributeMatrix::Pointer vertexAttrMat = sm->getAttributeMatrix(meshFilter->property("VertexAttributeMatrixName").toString());
+    Int32ArrayType::Pointer faceLabels = faceAttrMat->getAttributeArrayAs<Int32ArrayType>(meshFilter->property("FaceLabelsArrayName").toString());
+    Int8ArrayType::Pointer nodeTypes = vertexAttrMat->getAttributeArrayAs<Int8ArrayType>(meshFilter->property("NodeTypesArrayName").toString());
+    DREAM3D_REQUIRE_VALID_POINTER(faceLabels.get())
+    DREAM3D_REQUIRE_VALID_POINTER(nodeTypes.get())
+
+    // Every vertex is a distinct grid node on a boundary face and its type follows from its owners
+    std::vector<NodeKey> vertexNodes(triangleGeom->getNumberOfVertices());
+    std::set<NodeKey> seenNodes;
+    for(size_t v = 0; v < vertexNodes.size(); v++)
+    {
+      float* coords = triangleGeom->getVertexPointer(v);
+      NodeKey node = {{std::llround(coords[0]), std::llround(coords[1]), std::llround(coords[2])}};
+      vertexNodes[v] = node;
+      DREAM3D_REQUIRE(seenNodes.insert(node).second)
+
+      auto owners = expectedOwners.find(node);
+      DREAM3D_REQUIRE(owners != expectedOwners.end())
+      bool exterior = owners->second.count(-1) > 0;
+      int8_t expectedType = static_cast<int8_t>(std::min<size_t>(owners->second.size(), 4));
+      if(exterior)
+      {
+        expectedType += 10;
+      }
+      DREAM3D_REQUIRE_EQUAL(nodeTypes->getValue(v), expectedType)
+    }
+
+    // Quadruple points sitting on the slab planes
+    const NodeKey k_QuadOnLowerPlane = {{3, 2, 4}};
+    const NodeKey k_QuadOnUpperPlane = {{2, 3, 8}};
+    DREAM3D_REQUIRE_EQUAL(expectedOwners[k_QuadOnLowerPlane].size(), 4u)
+    DREAM3D_REQUIRE_EQUAL(expectedOwners[k_QuadOnUpperPlane].size(), 4u)
+
+    // Every triangle covers half of one boundary face, carries its labels and points toward the lower label
+    MeshIndexType* triPtr = triangleGeom->getTriPointer(0);
+    for(size_t t = 0; t < triangleGeom->getNumberOfTris(); t++)
+    {
+      const NodeKey& n0 = vertexNodes[triPtr[t * 3 + 0]];
+      const NodeKey& n1 = vertexNodes[triPtr[t * 3 + 1]];
+      const NodeKey& n2 = vertexNodes[triPtr[t * 3 + 2]];
+
+      int64_t axis = -1;
+      for(int64_t a = 0; a < 3; a++)
+      {
+        if(n0[a] == n1[a] && n0[a] == n2[a])
+        {
+          DREAM3D_REQUIRE_EQUAL(axis, -1)
+          axis = a;
+        }
+      }
+      DREAM3D_REQUIRE(axis >= 0)
+
+      FaceKey faceKey = {{axis, std::min({n0[0], n1[0], n2[0]}), std::min({n0[1], n1[1], n2[1]}), std::min({n0[2], n1[2], n2[2]})}};
+      auto face = expectedFaces.find(faceKey);
+      DREAM3D_REQUIRE(face != expectedFaces.end())
+      DREAM3D_REQUIRE_EQUAL(faceLabels->getComponent(t, 0), face->second.labels[0])
+      DREAM3D_REQUIRE_EQUAL(faceLabels->getComponent(t, 1), face->second.labels[1])
+
+      int64_t a1 = (axis + 1) % 3;
+      int64_t a2 = (axis + 2) % 3;
+      int64_t normal = (n1[a1] - n0[a1]) * (n2[a2] - n0[a2]) - (n1[a2] - n0[a2]) * (n2[a1] - n0[a1]);
+      DREAM3D_REQUIRE_EQUAL(normal, face->second.normalSign)
+
+      for(const NodeKey* node : {&n0, &n1, &n2})
+      {
+        DREAM3D_REQUIRED((*node)[a1] - faceKey[a1 + 1], <=, 1)
+        DREAM3D_REQUIRED((*node)[a2] - faceKey[a2 + 1], <=, 1)
+        face->second.cornersSeen |= 1 << (((*node)[a1] - faceKey[a1 + 1]) + 2 * ((*node)[a2] - faceKey[a2 + 1]));
+      }
+      face->second.triangles++;
+    }
+
+    for(const auto& face : expectedFaces)
+    {
+      DREAM3D_REQUIRE_EQUAL(face.second.triangles, 2)
+      DREAM3D_REQUIRE_EQUAL(face.second.cornersSeen, 0xF)
+    }
+
+    return EXIT_SUCCESS;
+  }
   /**
    * @brief
    */
@@ -421,6 +649,7 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(RunTest())
+    DREAM3D_REGISTER_TEST(TestMultiSlab())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
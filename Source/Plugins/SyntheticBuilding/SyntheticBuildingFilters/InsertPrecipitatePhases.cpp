@@ -912,7 +912,6 @@ void InsertPrecipitatePhases::place_precipitates(Int32ArrayType::Pointer exclusi
     phase = m_PrecipitatePhases[i];
     PrecipitateStatsData::Pointer pp = std::dynamic_pointer_cast<PrecipitateStatsData>(statsDataArray[phase]);
     m_FeatureSizeDist[i].resize(40);
-    m_SimFeatureSizeDist[i].resize(40);
     m_FeatureSizeDistStep[i] = static_cast<float>(((2.0f * pp->getMaxFeatureDiameter()) - (pp->getMinFeatureDiameter() / 2.0f)) / m_FeatureSizeDist[i].size());
     float input = 0.0f;
     float previoustotal = 0.0f;
@@ -936,6 +935,7 @@ void InsertPrecipitatePhases::place_precipitates(Int32ArrayType::Pointer exclusi
       }
       previoustotal = previoustotal + m_FeatureSizeDist[i][j];
     }
+    m_SimFeatureSizeDist[i].initialize(m_FeatureSizeDist[i]);
   }
 
   if(getCancel())
@@ -981,6 +981,7 @@ void InsertPrecipitatePhases::place_precipitates(Int32ArrayType::Pointer exclusi
         m->getAttributeMatrix(getFeaturePhasesArrayPath().getAttributeMatrixName())->resizeAttributeArrays(tDims);
         updateFeatureInstancePointers();
         transfer_attributes(currentnumfeatures, &precip);
+        m_SimFeatureSizeDist[j].add(0, sizedist_bin(j, m_EquivalentDiameters[currentnumfeatures]));
         m_OldSizeDistError = m_CurrentSizeDistError;
         curphasevol[j] = curphasevol[j] + m_Volumes[currentnumfeatures];
         // FIXME: Initialize the Feature with some sort of default data
@@ -2133,18 +2134,12 @@ float InsertPrecipitatePhases::check_RDFerror(int32_t gadd, int32_t gremove, boo
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void InsertPrecipitatePhases::compare_1Ddistributions(std::vector<float> array1, std::vector<float> array2, float& bhattdist)
+void InsertPrecipitatePhases::compare_1Ddistributions(const std::vector<float>& array1, const std::vector<float>& array2, float& bhattdist)
 {
   bhattdist = 0;
   float sum_array1 = 0.0f;
   float sum_array2 = 0.0f;
 
-  //  for (std::vector<float>::iterator j=array1.begin(); j!=array1.end(); j++)
-  //  {sum_array1 += *j;}
-
-  //  for (std::vector<float>::iterator j=array2.begin(); j!=array2.end(); j++)
-  //  {sum_array2 += *j;}
-
   size_t array1Size = array1.size();
   for(size_t i = 0; i < array1Size; i++)
   {
@@ -2154,16 +2149,14 @@ void InsertPrecipitatePhases::compare_1Ddistributions(std::vector<float> array1,
 
   for(size_t i = 0; i < array1Size; i++)
   {
-    array1[i] = array1[i] / sum_array1;
-    array2[i] = array2[i] / sum_array2;
-    bhattdist = bhattdist + sqrtf((array1[i] * array2[i]));
+    bhattdist = bhattdist + sqrtf(((array1[i] / sum_array1) * (array2[i] / sum_array2)));
   }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void InsertPrecipitatePhases::compare_2Ddistributions(std::vector<std::vector<float>> array1, std::vector<std::vector<float>> array2, float& bhattdist)
+void InsertPrecipitatePhases::compare_2Ddistributions(const std::vector<std::vector<float>>& array1, const std::vector<std::vector<float>>& array2, float& bhattdist)
 {
   bhattdist = 0;
   size_t array1Size = array1.size();
@@ -2180,36 +2173,28 @@ void InsertPrecipitatePhases::compare_2Ddistributions(std::vector<std::vector<fl
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void InsertPrecipitatePhases::compare_3Ddistributions(std::vector<std::vector<std::vector<float>>> array1, std::vector<std::vector<std::vector<float>>> array2, float& bhattdist)
+void InsertPrecipitatePhases::compare_3Ddistributions(const std::vector<std::vector<std::vector<float>>>& array1, const std::vector<std::vector<std::vector<float>>>& array2, float& bhattdist)
 {
   bhattdist = 0;
-  std::vector<std::vector<float>> counts1(array1.size());
-  std::vector<std::vector<float>> counts2(array2.size());
   size_t array1Size = array1.size();
   for(size_t i = 0; i < array1Size; i++)
   {
-    counts1[i].resize(array1[i].size());
-    counts2[i].resize(array2[i].size());
     size_t array2Size = array1[i].size();
     for(size_t j = 0; j < array2Size; j++)
     {
-      size_t array3Size = array1[i][j].size();
+      const std::vector<float>& dist1 = array1[i][j];
+      const std::vector<float>& dist2 = array2[i][j];
+      size_t array3Size = dist1.size();
+      float counts1 = 0.0f;
+      float counts2 = 0.0f;
       for(size_t k = 0; k < array3Size; k++)
       {
-        counts1[i][j] += array1[i][j][k];
-        counts2[i][j] += array2[i][j][k];
+        counts1 += dist1[k];
+        counts2 += dist2[k];
       }
-    }
-  }
-  for(size_t i = 0; i < array1Size; i++)
-  {
-    size_t array2Size = array1[i].size();
-    for(size_t j = 0; j < array2Size; j++)
-    {
-      size_t array3Size = array1[i][j].size();
       for(size_t k = 0; k < array3Size; k++)
       {
-        bhattdist = bhattdist + sqrtf(((array1[i][j][k] / counts1[i][j]) * (array2[i][j][k] / counts2[i][j])));
+        bhattdist = bhattdist + sqrtf(((dist1[k] / counts1) * (dist2[k] / counts2)));
       }
     }
   }
@@ -2220,92 +2205,55 @@ void InsertPrecipitatePhases::compare_3Ddistributions(std::vector<std::vector<st
 // -----------------------------------------------------------------------------
 float InsertPrecipitatePhases::check_sizedisterror(Precip_t* precip)
 {
-  // DataContainer::Pointer m =
-  // getDataContainerArray()->getDataContainer(m_FeatureIdsArrayPath.getDataContainerName());
-
-  StatsDataArray& statsDataArray = *(m_StatsDataArray.lock());
-
-  float dia;
-  float sizedisterror = 0;
-  float bhattdist;
-  int index;
-  int count = 0;
-  int phase;
-  size_t featureSizeDist_Size = m_FeatureSizeDist.size();
-  for(size_t iter = 0; iter < featureSizeDist_Size; ++iter)
+  // The simulated size distributions hold every precipitate generated so far; the trial precipitate is only
+  // added to the distribution of its phase while the error is computed
+  size_t numPhases = m_SimFeatureSizeDist.size();
+  size_t precipPhaseIndex = numPhases;
+  size_t precipBin = 0;
+  for(size_t iter = 0; iter < numPhases; ++iter)
   {
-    phase = m_PrecipitatePhases[iter];
-    PrecipitateStatsData::Pointer pp = std::dynamic_pointer_cast<PrecipitateStatsData>(statsDataArray[phase]);
-    count = 0;
-    std::vector<float>& curFeatureSizeDist = m_FeatureSizeDist[iter];
-    std::vector<float>::size_type curFeatureSizeDistSize = curFeatureSizeDist.size();
-    std::vector<float>& curSimFeatureSizeDist = m_SimFeatureSizeDist[iter];
-    // Initialize all Values to Zero
-    for(size_t i = 0; i < curFeatureSizeDistSize; i++)
+    if(m_PrecipitatePhases[iter] == precip->m_FeaturePhases)
     {
-      curSimFeatureSizeDist[i] = 0.0f;
-    }
-
-    size_t nFeatureTuples = m_FeaturePhasesPtr.lock()->getNumberOfTuples();
-    float oneOverCurFeatureSizeDistStep = 1.0f / m_FeatureSizeDistStep[iter];
-    float halfMinFeatureDiameter = pp->getMinFeatureDiameter() * 0.5f;
-    for(size_t b = m_FirstPrecipitateFeature; b < nFeatureTuples; b++)
-    {
-      index = b;
-      if(m_FeaturePhases[index] == phase)
-      {
-        dia = m_EquivalentDiameters[index];
-        dia = (dia - halfMinFeatureDiameter) * oneOverCurFeatureSizeDistStep;
-        if(dia < 0)
-        {
-          dia = 0;
-        }
-        if(dia > curFeatureSizeDistSize - 1.0f)
-        {
-          dia = curFeatureSizeDistSize - 1.0f;
-        }
-        curSimFeatureSizeDist[int(dia)]++;
-        count++;
-      }
+      precipPhaseIndex = iter;
+      precipBin = sizedist_bin(iter, precip->m_EquivalentDiameters);
+      m_SimFeatureSizeDist[iter].add(0, precipBin);
+      break;
     }
+  }
 
-    if(precip->m_FeaturePhases == phase)
-    {
-      dia = precip->m_EquivalentDiameters;
-      dia = (dia - halfMinFeatureDiameter) * oneOverCurFeatureSizeDistStep;
-      if(dia < 0)
-      {
-        dia = 0;
-      }
-      if(dia > curFeatureSizeDistSize - 1.0f)
-      {
-        dia = curFeatureSizeDistSize - 1.0f;
-      }
-      curSimFeatureSizeDist[int(dia)]++;
-      count++;
-    }
-    float oneOverCount = 1.0f / count;
+  float sizedisterror = 0.0f;
+  for(size_t iter = 0; iter < numPhases; ++iter)
+  {
+    sizedisterror = sizedisterror + m_SimFeatureSizeDist[iter].bhattacharyya();
+  }
 
-    if(count == 0)
-    {
-      for(size_t i = 0; i < curFeatureSizeDistSize; i++)
-      {
-        curSimFeatureSizeDist[i] = 0.0;
-      }
-    }
-    else
-    {
-      for(size_t i = 0; i < curFeatureSizeDistSize; i++)
-      {
-        curSimFeatureSizeDist[i] = curSimFeatureSizeDist[i] * oneOverCount;
-      }
-    }
+  if(precipPhaseIndex < numPhases)
+  {
+    m_SimFeatureSizeDist[precipPhaseIndex].remove(0, precipBin);
   }
-  compare_2Ddistributions(m_SimFeatureSizeDist, m_FeatureSizeDist, bhattdist);
-  sizedisterror = bhattdist;
   return sizedisterror;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t InsertPrecipitatePhases::sizedist_bin(size_t iter, float equivalentDiameter)
+{
+  StatsDataArray& statsDataArray = *(m_StatsDataArray.lock());
+  PrecipitateStatsData::Pointer pp = std::dynamic_pointer_cast<PrecipitateStatsData>(statsDataArray[m_PrecipitatePhases[iter]]);
+  float numBins = static_cast<float>(m_SimFeatureSizeDist[iter].numBins());
+  float dia = (equivalentDiameter - pp->getMinFeatureDiameter() * 0.5f) * (1.0f / m_FeatureSizeDistStep[iter]);
+  if(dia < 0)
+  {
+    dia = 0;
+  }
+  if(dia > numBins - 1.0f)
+  {
+    dia = numBins - 1.0f;
+  }
+  return static_cast<size_t>(int(dia));
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -45,6 +45,8 @@
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Geometry/ShapeOps/ShapeOps.h"
 
+#include "SyntheticBuilding/SyntheticBuildingFilters/Utils/DistributionHistogram.hpp"
+
 class IDataArray;
 using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
 
@@ -577,6 +579,14 @@ protected:
    */
   float check_sizedisterror(Precip_t* precip);
 
+  /**
+   * @brief sizedist_bin Returns the bin of the simulated size distribution that a precipitate falls into
+   * @param iter Index of the precipitate phase
+   * @param equivalentDiameter Equivalent diameter of the precipitate
+   * @return Bin index
+   */
+  size_t sizedist_bin(size_t iter, float equivalentDiameter);
+
   /**
    * @brief update_exclusionZones Updates the exclusion owners pointer based on the associated incoming Ids
    * @param gadd Index used to determine which precipitate to add
@@ -678,19 +688,19 @@ protected:
    * @brief compare_1Ddistributions Computes the 1D Bhattacharyya distance
    * @param sqrerror Float 1D Bhattacharyya distance
    */
-  void compare_1Ddistributions(std::vector<float>, std::vector<float>, float& sqrerror);
+  void compare_1Ddistributions(const std::vector<float>&, const std::vector<float>&, float& sqrerror);
 
   /**
    * @brief compare_2Ddistributions Computes the 2D Bhattacharyya distance
    * @param sqrerror Float 1D Bhattacharyya distance
    */
-  void compare_2Ddistributions(std::vector<std::vector<float>>, std::vector<std::vector<float>>, float& sqrerror);
+  void compare_2Ddistributions(const std::vector<std::vector<float>>&, const std::vector<std::vector<float>>&, float& sqrerror);
 
   /**
    * @brief compare_3Ddistributions Computes the 3D Bhattacharyya distance
    * @param sqrerror Float 1D Bhattacharyya distance
    */
-  void compare_3Ddistributions(std::vector<std::vector<std::vector<float>>>, std::vector<std::vector<std::vector<float>>>, float& sqrerror);
+  void compare_3Ddistributions(const std::vector<std::vector<std::vector<float>>>&, const std::vector<std::vector<std::vector<float>>>&, float& sqrerror);
 
   /**
    * @brief Moves the temporary arrays that hold the inputs into the shape algorithms
@@ -802,7 +812,7 @@ private:
   uint64_t m_Seed;
 
   std::vector<std::vector<float>> m_FeatureSizeDist;
-  std::vector<std::vector<float>> m_SimFeatureSizeDist;
+  std::vector<SyntheticBuilding::DistributionHistogram> m_SimFeatureSizeDist;
   std::vector<float> m_RdfTargetDist;
   std::vector<float> m_RdfCurrentDist;
   std::vector<float> m_RdfCurrentDistNorm;
@@ -35,6 +35,7 @@
 
 #include "MatchCrystallography.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include <QtCore/QTextStream>
@@ -45,6 +46,7 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -64,6 +66,7 @@
 
 #include "SyntheticBuilding/SyntheticBuildingConstants.h"
 #include "SyntheticBuilding/SyntheticBuildingVersion.h"
+#include "SyntheticBuilding/SyntheticBuildingFilters/Utils/FixedRandomSeed.hpp"
 
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
 enum createdPathID : RenameDataPath::DataID_t
@@ -74,6 +77,17 @@ enum createdPathID : RenameDataPath::DataID_t
   DataArrayID33 = 33,
 };
 
+namespace
+{
+// The ODF and MDF errors are updated incrementally as bins change. They are recomputed
+// over all bins this often to remove accumulated round off.
+constexpr int32_t k_ErrorRecomputeInterval = 1000;
+
+// Each stage of the filter draws from its own random stream
+constexpr uint32_t k_AssignEulersStage = 0;
+constexpr uint32_t k_SwapOrientationsStage = 1;
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -103,6 +117,7 @@ void MatchCrystallography::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Maximum Number of Iterations (Swaps)", MaxIterations, FilterParameter::Category::Parameter, MatchCrystallography));
+  FIXED_RANDOM_SEED_NEW_FPS(parameters, MatchCrystallography)
 
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
@@ -182,6 +197,8 @@ void MatchCrystallography::readFilterParameters(AbstractFilterParametersReader*
 {
   reader->openFilterGroup(this, index);
   setMaxIterations(reader->readValue("MaxIterations", getMaxIterations()));
+  setUseFixedSeed(reader->readValue("UseFixedSeed", getUseFixedSeed()));
+  setRandomSeed(reader->readValue("RandomSeed", getRandomSeed()));
   setInputStatsArrayPath(reader->readDataArrayPath("InputStatsArrayPath", getInputStatsArrayPath()));
   setCrystalStructuresArrayPath(reader->readDataArrayPath("CrystalStructuresArrayPath", getCrystalStructuresArrayPath()));
   setPhaseTypesArrayPath(reader->readDataArrayPath("PhaseTypesArrayPath", getPhaseTypesArrayPath()));
@@ -337,6 +354,8 @@ void MatchCrystallography::execute()
 
   size_t totalEnsembles = m_CrystalStructuresPtr.lock()->getNumberOfTuples();
 
+  m_Seed = FixedRandomSeed::Resolve(m_UseFixedSeed, m_RandomSeed);
+
   QString ss;
   ss = QObject::tr("Determining Volumes");
   notifyStatusMessage(ss);
@@ -539,10 +558,7 @@ void MatchCrystallography::determine_boundary_areas()
 // -----------------------------------------------------------------------------
 void MatchCrystallography::assign_eulers(size_t ensem)
 {
-  std::random_device randomDevice;           // Will be used to obtain a seed for the random number engine
-  std::mt19937_64 generator(randomDevice()); // Standard mersenne_twister_engine seeded with rd()
-  std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-  generator.seed(seed);
+  std::mt19937_64 generator = createGenerator(ensem, k_AssignEulersStage);
   std::uniform_real_distribution<> distribution(0.0, 1.0);
   std::array<double, 3> randx3;
 
@@ -651,12 +667,21 @@ void MatchCrystallography::MC_LoopBody1(int32_t feature, size_t ensem, size_t j,
 
   rod = OrientationTransformation::ax2ro<OrientationD, OrientationD>(axisAngle);
   newmisobin = ops->getMisoBin(rod);
-  m_MdfChange = m_MdfChange + (((m_ActualMdf->getValue(curmisobin) - m_SimMdf->getValue(curmisobin)) * (m_ActualMdf->getValue(curmisobin) - m_SimMdf->getValue(curmisobin))) -
-                               ((m_ActualMdf->getValue(curmisobin) - (m_SimMdf->getValue(curmisobin) - (neighsurfarea / m_TotalSurfaceArea[ensem]))) *
-                                (m_ActualMdf->getValue(curmisobin) - (m_SimMdf->getValue(curmisobin) - (neighsurfarea / m_TotalSurfaceArea[ensem])))));
-  m_MdfChange = m_MdfChange + (((m_ActualMdf->getValue(newmisobin) - m_SimMdf->getValue(newmisobin)) * (m_ActualMdf->getValue(newmisobin) - m_SimMdf->getValue(newmisobin))) -
-                               ((m_ActualMdf->getValue(newmisobin) - (m_SimMdf->getValue(newmisobin) + (neighsurfarea / m_TotalSurfaceArea[ensem]))) *
-                                (m_ActualMdf->getValue(newmisobin) - (m_SimMdf->getValue(newmisobin) + (neighsurfarea / m_TotalSurfaceArea[ensem])))));
+  const float* actualMdf = m_ActualMdf->getPointer(0);
+  const float* simMdf = m_SimMdf->getPointer(0);
+  const size_t mdfBins = m_SimMdf->getNumberOfTuples();
+  const float areaFraction = neighsurfarea / m_TotalSurfaceArea[ensem];
+  // Misorientation bins past the end of the MDF from the statistics are not matched
+  if(curmisobin < mdfBins)
+  {
+    const float curDiff = actualMdf[curmisobin] - simMdf[curmisobin];
+    m_MdfChange = m_MdfChange + ((curDiff * curDiff) - ((curDiff + areaFraction) * (curDiff + areaFraction)));
+  }
+  if(newmisobin < mdfBins)
+  {
+    const float newDiff = actualMdf[newmisobin] - simMdf[newmisobin];
+    m_MdfChange = m_MdfChange + ((newDiff * newDiff) - ((newDiff - areaFraction) * (newDiff - areaFraction)));
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -694,8 +719,78 @@ void MatchCrystallography::MC_LoopBody2(int32_t feature, size_t ensem, size_t j,
   m_MisorientationLists[feature][3 * j] = miso1;
   m_MisorientationLists[feature][3 * j + 1] = miso2;
   m_MisorientationLists[feature][3 * j + 2] = miso3;
-  m_SimMdf->setValue(curmisobin, (m_SimMdf->getValue(curmisobin) - (neighsurfarea / m_TotalSurfaceArea[ensem])));
-  m_SimMdf->setValue(newmisobin, (m_SimMdf->getValue(newmisobin) + (neighsurfarea / m_TotalSurfaceArea[ensem])));
+  updateSimMdfBin(curmisobin, -(neighsurfarea / m_TotalSurfaceArea[ensem]));
+  updateSimMdfBin(newmisobin, (neighsurfarea / m_TotalSurfaceArea[ensem]));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MatchCrystallography::computeErrors(int32_t numbins)
+{
+  m_ErrorBins = std::min(numbins, static_cast<int32_t>(m_SimMdf->getNumberOfTuples()));
+  const float* actualOdf = m_ActualOdf->getPointer(0);
+  const float* simOdf = m_SimOdf->getPointer(0);
+  const float* actualMdf = m_ActualMdf->getPointer(0);
+  const float* simMdf = m_SimMdf->getPointer(0);
+
+  m_CurrentOdfError = 0.0;
+  for(int32_t i = 0; i < numbins; i++)
+  {
+    const double delta = actualOdf[i] - simOdf[i];
+    m_CurrentOdfError += delta * delta;
+  }
+  m_CurrentMdfError = 0.0;
+  for(int32_t i = 0; i < m_ErrorBins; i++)
+  {
+    const double delta = actualMdf[i] - simMdf[i];
+    m_CurrentMdfError += delta * delta;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MatchCrystallography::updateSimOdfBin(size_t bin, float delta)
+{
+  const float oldValue = m_SimOdf->getValue(bin);
+  const float newValue = oldValue + delta;
+  m_SimOdf->setValue(bin, newValue);
+
+  const double actual = m_ActualOdf->getValue(bin);
+  m_CurrentOdfError += (actual - newValue) * (actual - newValue) - (actual - oldValue) * (actual - oldValue);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MatchCrystallography::updateSimMdfBin(size_t bin, float delta)
+{
+  // Misorientation bins past the end of the MDF from the statistics are not matched
+  if(bin >= m_SimMdf->getNumberOfTuples())
+  {
+    return;
+  }
+  const float oldValue = m_SimMdf->getValue(bin);
+  const float newValue = oldValue + delta;
+  m_SimMdf->setValue(bin, newValue);
+
+  // Only the first m_ErrorBins bins take part in the MDF error
+  if(bin < static_cast<size_t>(m_ErrorBins))
+  {
+    const double actual = m_ActualMdf->getValue(bin);
+    m_CurrentMdfError += (actual - newValue) * (actual - newValue) - (actual - oldValue) * (actual - oldValue);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::mt19937_64 MatchCrystallography::createGenerator(size_t ensem, uint32_t stage) const
+{
+  // Each phase and stage gets its own stream derived from the filter seed
+  std::seed_seq seedSequence{static_cast<uint32_t>(m_Seed), static_cast<uint32_t>(m_Seed >> 32), static_cast<uint32_t>(ensem), stage};
+  return std::mt19937_64(seedSequence);
 }
 
 // -----------------------------------------------------------------------------
@@ -711,10 +806,7 @@ void MatchCrystallography::matchCrystallography(size_t ensem)
   size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
   size_t totalFeatures = m_FeaturePhasesPtr.lock()->getNumberOfTuples();
 
-  std::random_device randomDevice;           // Will be used to obtain a seed for the random number engine
-  std::mt19937_64 generator(randomDevice()); // Standard mersenne_twister_engine seeded with rd()
-  std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-  generator.seed(seed);
+  std::mt19937_64 generator = createGenerator(ensem, k_SwapOrientationsStage);
   std::uniform_real_distribution<> distribution(0.0, 1.0);
   std::array<double, 3> randx3;
 
@@ -744,6 +836,7 @@ void MatchCrystallography::matchCrystallography(size_t ensem)
   uint64_t millis = QDateTime::currentMSecsSinceEpoch();
   uint64_t startMillis = millis;
   int32_t lastIteration = 0;
+  computeErrors(numbins);
   while(badtrycount < (m_MaxIterations / 10) && iterations < m_MaxIterations)
   {
     uint64_t currentMillis = QDateTime::currentMSecsSinceEpoch();
@@ -759,20 +852,13 @@ void MatchCrystallography::matchCrystallography(size_t ensem)
       millis = QDateTime::currentMSecsSinceEpoch();
       lastIteration = iterations;
     }
-    currentodferror = 0;
-    currentmdferror = 0;
-    float* actualOdfPtr = m_ActualOdf->getPointer(0);
-    float* simOdfPtr = m_SimOdf->getPointer(0);
-    float delta = 0.0f;
-    for(int32_t i = 0; i < numbins; i++)
+    // The errors are kept up to date by updateSimOdfBin()/updateSimMdfBin() as moves are accepted
+    if(iterations > 0 && iterations % k_ErrorRecomputeInterval == 0)
     {
-      delta = actualOdfPtr[i] - simOdfPtr[i];
-      currentodferror = currentodferror + (delta * delta);
-    }
-    for(int32_t i = 0; i < (numbins); i++)
-    {
-      currentmdferror = currentmdferror + ((m_ActualMdf->getValue(i) - m_SimMdf->getValue(i)) * (m_ActualMdf->getValue(i) - m_SimMdf->getValue(i)));
+      computeErrors(numbins);
     }
+    currentodferror = static_cast<float>(m_CurrentOdfError);
+    currentmdferror = static_cast<float>(m_CurrentMdfError);
     iterations++;
     badtrycount++;
     random = static_cast<float>(distribution(generator));
@@ -862,8 +948,8 @@ void MatchCrystallography::matchCrystallography(size_t ensem)
           m_FeatureEulerAngles[3 * selectedfeature1 + 1] = g1ea2;
           m_FeatureEulerAngles[3 * selectedfeature1 + 2] = g1ea3;
           q1.copyInto(m_AvgQuats + selectedfeature1 * 4, Quaternion<float>::Order::VectorScalar);
-          m_SimOdf->setValue(choose, (m_SimOdf->getValue(choose) + (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem])));
-          m_SimOdf->setValue(g1odfbin, (m_SimOdf->getValue(g1odfbin) - (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem])));
+          updateSimOdfBin(choose, (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem]));
+          updateSimOdfBin(g1odfbin, -(m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem]));
           size = 0;
           if(!neighborlist[selectedfeature1].empty())
           {
@@ -1016,8 +1102,8 @@ void MatchCrystallography::matchCrystallography(size_t ensem)
             m_FeatureEulerAngles[3 * selectedfeature2] = g1ea1;
             m_FeatureEulerAngles[3 * selectedfeature2 + 1] = g1ea2;
             m_FeatureEulerAngles[3 * selectedfeature2 + 2] = g1ea3;
-            m_SimOdf->setValue(g1odfbin, (m_SimOdf->getValue(g1odfbin) + (m_Volumes[selectedfeature2] / m_UnbiasedVolume[ensem]) - (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem])));
-            m_SimOdf->setValue(g2odfbin, (m_SimOdf->getValue(g2odfbin) + (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem]) - (m_Volumes[selectedfeature2] / m_UnbiasedVolume[ensem])));
+            updateSimOdfBin(g1odfbin, (m_Volumes[selectedfeature2] / m_UnbiasedVolume[ensem]) - (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem]));
+            updateSimOdfBin(g2odfbin, (m_Volumes[selectedfeature1] / m_UnbiasedVolume[ensem]) - (m_Volumes[selectedfeature2] / m_UnbiasedVolume[ensem]));
 
             q1 = OrientationTransformation::eu2qu<OrientationD, QuatF>(OrientationD(g1ea1, g1ea2, g1ea3));
             q1.copyInto(m_AvgQuats + selectedfeature1 * 4, Quaternion<float>::Order::VectorScalar);
@@ -1139,7 +1225,7 @@ void MatchCrystallography::measure_misorientations(size_t ensem)
           m_MisorientationLists[i][3 * j + 1] = rod[1];
           m_MisorientationLists[i][3 * j + 2] = rod[2];
           mbin = laueOp->getMisoBin(rod);
-          if(!m_SurfaceFeatures[i] && (nname > static_cast<int32_t>(i) || m_SurfaceFeatures[nname]))
+          if(!m_SurfaceFeatures[i] && (nname > static_cast<int32_t>(i) || m_SurfaceFeatures[nname]) && static_cast<size_t>(mbin) < m_SimMdf->getNumberOfTuples())
           {
             float neighsurfarea = neighborsurfacearealist[i][j];
             m_SimMdf->setValue(mbin, (m_SimMdf->getValue(mbin) + (neighsurfarea / m_TotalSurfaceArea[m_FeaturePhases[i]])));
@@ -1423,3 +1509,27 @@ int MatchCrystallography::getMaxIterations() const
 {
   return m_MaxIterations;
 }
+
+// -----------------------------------------------------------------------------
+void MatchCrystallography::setUseFixedSeed(bool value)
+{
+  m_UseFixedSeed = value;
+}
+
+// -----------------------------------------------------------------------------
+bool MatchCrystallography::getUseFixedSeed() const
+{
+  return m_UseFixedSeed;
+}
+
+// -----------------------------------------------------------------------------
+void MatchCrystallography::setRandomSeed(int value)
+{
+  m_RandomSeed = value;
+}
+
+// -----------------------------------------------------------------------------
+int MatchCrystallography::getRandomSeed() const
+{
+  return m_RandomSeed;
+}
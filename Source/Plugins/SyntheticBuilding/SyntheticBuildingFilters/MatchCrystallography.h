@@ -36,6 +36,7 @@
 #pragma once
 
 #include <memory>
+#include <random>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
@@ -77,6 +78,8 @@ class SyntheticBuilding_EXPORT MatchCrystallography : public AbstractFilter
   PYB11_PROPERTY(QString FeatureEulerAnglesArrayName READ getFeatureEulerAnglesArrayName WRITE setFeatureEulerAnglesArrayName)
   PYB11_PROPERTY(QString AvgQuatsArrayName READ getAvgQuatsArrayName WRITE setAvgQuatsArrayName)
   PYB11_PROPERTY(int MaxIterations READ getMaxIterations WRITE setMaxIterations)
+  PYB11_PROPERTY(bool UseFixedSeed READ getUseFixedSeed WRITE setUseFixedSeed)
+  PYB11_PROPERTY(int RandomSeed READ getRandomSeed WRITE setRandomSeed)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -267,6 +270,28 @@ public:
   int getMaxIterations() const;
   Q_PROPERTY(int MaxIterations READ getMaxIterations WRITE setMaxIterations)
 
+  /**
+   * @brief Setter property for UseFixedSeed
+   */
+  void setUseFixedSeed(bool value);
+  /**
+   * @brief Getter property for UseFixedSeed
+   * @return Value of UseFixedSeed
+   */
+  bool getUseFixedSeed() const;
+  Q_PROPERTY(bool UseFixedSeed READ getUseFixedSeed WRITE setUseFixedSeed)
+
+  /**
+   * @brief Setter property for RandomSeed
+   */
+  void setRandomSeed(int value);
+  /**
+   * @brief Getter property for RandomSeed
+   * @return Value of RandomSeed
+   */
+  int getRandomSeed() const;
+  Q_PROPERTY(int RandomSeed READ getRandomSeed WRITE setRandomSeed)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -395,6 +420,34 @@ protected:
    */
   void MC_LoopBody2(int32_t feature, size_t phase, size_t j, float neighsurfarea, QuatF& q1, QuatF& q2, LaueOps* ops);
 
+  /**
+   * @brief computeErrors Recomputes the squared ODF and MDF errors over all bins
+   * @param numbins Number of bins that take part in the errors
+   */
+  void computeErrors(int32_t numbins);
+
+  /**
+   * @brief updateSimOdfBin Adds delta to a bin of the simulated ODF and updates the ODF error
+   * @param bin ODF bin
+   * @param delta Change of the bin value
+   */
+  void updateSimOdfBin(size_t bin, float delta);
+
+  /**
+   * @brief updateSimMdfBin Adds delta to a bin of the simulated MDF and updates the MDF error
+   * @param bin MDF bin
+   * @param delta Change of the bin value
+   */
+  void updateSimMdfBin(size_t bin, float delta);
+
+  /**
+   * @brief createGenerator Creates the random number generator for one stage of one phase
+   * @param ensem Ensemble index of the current phase
+   * @param stage Stage of the filter that will use the generator
+   * @return Seeded generator
+   */
+  std::mt19937_64 createGenerator(size_t ensem, uint32_t stage) const;
+
   /**
    * @brief matchCrystallography Swaps orientations for Features unitl convergence to
    * the input statistics
@@ -446,6 +499,8 @@ private:
   QString m_FeatureEulerAnglesArrayName = {SIMPL::FeatureData::EulerAngles};
   QString m_AvgQuatsArrayName = {SIMPL::FeatureData::AvgQuats};
   int m_MaxIterations = {1};
+  bool m_UseFixedSeed = {false};
+  int m_RandomSeed = {5489};
 
   // Cell Data
 
@@ -462,6 +517,11 @@ private:
   float m_MdfChange;
   float m_OdfChange;
 
+  uint64_t m_Seed = 0;
+  int32_t m_ErrorBins = 0;
+  double m_CurrentOdfError = 0.0;
+  double m_CurrentMdfError = 0.0;
+
   std::vector<float> m_UnbiasedVolume;
   std::vector<float> m_TotalSurfaceArea;
 
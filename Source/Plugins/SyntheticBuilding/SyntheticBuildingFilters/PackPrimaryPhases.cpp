@@ -35,7 +35,11 @@
 
 #include "PackPrimaryPhases.h"
 
+#include <algorithm>
 #include <fstream>
+#include <numeric>
+#include <random>
+#include <unordered_map>
 
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
@@ -54,6 +58,7 @@
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
@@ -66,10 +71,12 @@
 #include "SIMPLib/Math/SIMPLibRandom.h"
 #include "SIMPLib/StatsData/PrimaryStatsData.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 #include "SIMPLib/Utilities/TimeUtilities.h"
 
 #include "SyntheticBuilding/SyntheticBuildingConstants.h"
 #include "SyntheticBuilding/SyntheticBuildingVersion.h"
+#include "SyntheticBuilding/SyntheticBuildingFilters/Utils/FixedRandomSeed.hpp"
 
 #include "EbsdLib/Core/Orientation.hpp"
 #include "EbsdLib/Core/OrientationTransformation.hpp"
@@ -262,6 +269,145 @@ public:
 private:
 };
 
+/**
+ * @brief The PlacementMoveCandidate struct holds one speculative JUMP or NUDGE move of the
+ * batched placement together with its evaluated change in filling error.
+ */
+struct PlacementMoveCandidate
+{
+  int32_t feature = 0;
+  float xc = 0.0f;
+  float yc = 0.0f;
+  float zc = 0.0f;
+  int64_t delta = 0;
+  std::vector<int64_t> touched;
+};
+
+/**
+ * @brief The EvaluatePlacementMovesImpl class computes, for each candidate move, the exact change in the
+ * unnormalized filling error that PackPrimaryPhases::checkFillingError would produce when removing the Feature
+ * and re-inserting it at the candidate centroid. The packing grid is only read; owner changes made by a move
+ * are kept in a local overlay. The packing points touched by the move are recorded so that moves with
+ * disjoint footprints can be committed together.
+ */
+class EvaluatePlacementMovesImpl
+{
+public:
+  EvaluatePlacementMovesImpl(const int32_t* featureOwners, const int64_t* packingPoints, const FloatVec3Type& halfPackingRes, const FloatVec3Type& oneOverPackingRes, bool periodicBoundaries,
+                             const float* centroids, const std::vector<std::vector<int64_t>>& columnList, const std::vector<std::vector<int64_t>>& rowList,
+                             const std::vector<std::vector<int64_t>>& planeList, std::vector<PlacementMoveCandidate>& candidates)
+  : m_FeatureOwners(featureOwners)
+  , m_PackingPoints(packingPoints)
+  , m_HalfPackingRes(halfPackingRes)
+  , m_OneOverPackingRes(oneOverPackingRes)
+  , m_PeriodicBoundaries(periodicBoundaries)
+  , m_Centroids(centroids)
+  , m_ColumnList(columnList)
+  , m_RowList(rowList)
+  , m_PlaneList(planeList)
+  , m_Candidates(candidates)
+  {
+  }
+  virtual ~EvaluatePlacementMovesImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    std::unordered_map<int64_t, int32_t> owners;
+    for(size_t c = range.min(); c < range.max(); c++)
+    {
+      PlacementMoveCandidate& candidate = m_Candidates[c];
+      owners.clear();
+      candidate.touched.clear();
+
+      const size_t gnum = static_cast<size_t>(candidate.feature);
+      // Same shift as PackPrimaryPhases::moveFeature()
+      int64_t shiftcolumn = static_cast<int64_t>((candidate.xc - m_HalfPackingRes[0]) * m_OneOverPackingRes[0]) -
+                            static_cast<int64_t>((m_Centroids[3 * gnum] - m_HalfPackingRes[0]) * m_OneOverPackingRes[0]);
+      int64_t shiftrow = static_cast<int64_t>((candidate.yc - m_HalfPackingRes[1]) * m_OneOverPackingRes[1]) -
+                         static_cast<int64_t>((m_Centroids[3 * gnum + 1] - m_HalfPackingRes[1]) * m_OneOverPackingRes[1]);
+      int64_t shiftplane = static_cast<int64_t>((candidate.zc - m_HalfPackingRes[2]) * m_OneOverPackingRes[2]) -
+                           static_cast<int64_t>((m_Centroids[3 * gnum + 2] - m_HalfPackingRes[2]) * m_OneOverPackingRes[2]);
+
+      const std::vector<int64_t>& cl = m_ColumnList[gnum];
+      const std::vector<int64_t>& rl = m_RowList[gnum];
+      const std::vector<int64_t>& pl = m_PlaneList[gnum];
+      size_t size = cl.size();
+      int64_t delta = 0;
+      // Removal from the current position
+      for(size_t i = 0; i < size; i++)
+      {
+        int64_t featureOwnersIdx = packingIndex(cl[i], rl[i], pl[i]);
+        if(featureOwnersIdx < 0)
+        {
+          continue;
+        }
+        int32_t& owner = currentOwner(owners, featureOwnersIdx);
+        delta += 3 - 2 * static_cast<int64_t>(owner);
+        owner--;
+        candidate.touched.push_back(featureOwnersIdx);
+      }
+      // Insertion at the candidate position
+      for(size_t i = 0; i < size; i++)
+      {
+        int64_t featureOwnersIdx = packingIndex(cl[i] + shiftcolumn, rl[i] + shiftrow, pl[i] + shiftplane);
+        if(featureOwnersIdx < 0)
+        {
+          continue;
+        }
+        int32_t& owner = currentOwner(owners, featureOwnersIdx);
+        delta += 2 * static_cast<int64_t>(owner) - 1;
+        owner++;
+        candidate.touched.push_back(featureOwnersIdx);
+      }
+      candidate.delta = delta;
+    }
+  }
+
+private:
+  const int32_t* m_FeatureOwners;
+  const int64_t* m_PackingPoints;
+  FloatVec3Type m_HalfPackingRes;
+  FloatVec3Type m_OneOverPackingRes;
+  bool m_PeriodicBoundaries;
+  const float* m_Centroids;
+  const std::vector<std::vector<int64_t>>& m_ColumnList;
+  const std::vector<std::vector<int64_t>>& m_RowList;
+  const std::vector<std::vector<int64_t>>& m_PlaneList;
+  std::vector<PlacementMoveCandidate>& m_Candidates;
+
+  /**
+   * @brief packingIndex Returns the packing point index of (col, row, plane), wrapping the coordinates
+   * for periodic boundaries, or -1 if the point lies outside of a non-periodic packing grid
+   */
+  int64_t packingIndex(int64_t col, int64_t row, int64_t plane) const
+  {
+    if(m_PeriodicBoundaries)
+    {
+      col = col % m_PackingPoints[0];
+      row = row % m_PackingPoints[1];
+      plane = plane % m_PackingPoints[2];
+      col = col < 0 ? col + m_PackingPoints[0] : col;
+      row = row < 0 ? row + m_PackingPoints[1] : row;
+      plane = plane < 0 ? plane + m_PackingPoints[2] : plane;
+    }
+    else if(col < 0 || col >= m_PackingPoints[0] || row < 0 || row >= m_PackingPoints[1] || plane < 0 || plane >= m_PackingPoints[2])
+    {
+      return -1;
+    }
+    return (m_PackingPoints[0] * m_PackingPoints[1] * plane) + (m_PackingPoints[0] * row) + col;
+  }
+
+  int32_t& currentOwner(std::unordered_map<int64_t, int32_t>& owners, int64_t featureOwnersIdx) const
+  {
+    auto iter = owners.find(featureOwnersIdx);
+    if(iter == owners.end())
+    {
+      iter = owners.emplace(featureOwnersIdx, m_FeatureOwners[featureOwnersIdx]).first;
+    }
+    return iter->second;
+  }
+};
+
 const QString PrimaryPhaseSyntheticShapeParametersName("Synthetic Shape Parameters (Primary Phase)");
 
 // -----------------------------------------------------------------------------
@@ -286,6 +432,9 @@ PackPrimaryPhases::PackPrimaryPhases()
 , m_CsvOutputFile("")
 , m_PeriodicBoundaries(false)
 , m_WriteGoalAttributes(false)
+, m_UseParallelPlacement(false)
+, m_UseFixedSeed(false)
+, m_RandomSeed(5489)
 , m_SaveGeometricDescriptions(0)
 , m_NewAttributeMatrixPath(SIMPL::Defaults::SyntheticVolumeDataContainerName, PrimaryPhaseSyntheticShapeParametersName, "")
 , m_NeighborhoodsArrayName(SIMPL::FeatureData::Neighborhoods)
@@ -348,6 +497,8 @@ void PackPrimaryPhases::initialize()
   m_SimFeatureSizeDist.clear();
   m_NeighborDist.clear();
   m_SimNeighborDist.clear();
+  m_NeighborDistPhaseIndices.clear();
+  m_NeighborDistRows.clear();
 
   m_FeatureSizeDistStep.clear();
   m_NeighborDistStep.clear();
@@ -371,6 +522,8 @@ void PackPrimaryPhases::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
   parameters.push_back(SIMPL_NEW_BOOL_FP("Periodic Boundaries", PeriodicBoundaries, FilterParameter::Category::Parameter, PackPrimaryPhases));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Evaluate Placement Moves in Parallel", UseParallelPlacement, FilterParameter::Category::Parameter, PackPrimaryPhases));
+  FIXED_RANDOM_SEED_NEW_FPS(parameters, PackPrimaryPhases)
   std::vector<QString> linkedProps = {"MaskArrayPath"};
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Mask", UseMask, FilterParameter::Category::Parameter, PackPrimaryPhases, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
@@ -523,6 +676,9 @@ void PackPrimaryPhases::readFilterParameters(AbstractFilterParametersReader* rea
   setNumFeaturesArrayName(reader->readString("NumFeaturesArrayName", getNumFeaturesArrayName()));
   setPeriodicBoundaries(reader->readValue("PeriodicBoundaries", false));
   setWriteGoalAttributes(reader->readValue("WriteGoalAttributes", false));
+  setUseParallelPlacement(reader->readValue("UseParallelPlacement", getUseParallelPlacement()));
+  setUseFixedSeed(reader->readValue("UseFixedSeed", getUseFixedSeed()));
+  setRandomSeed(reader->readValue("RandomSeed", getRandomSeed()));
   setUseMask(reader->readValue("UseMask", getUseMask()));
 
   bool haveFeatures = reader->readValue("HaveFeatures", false);
@@ -1098,7 +1254,8 @@ void PackPrimaryPhases::placeFeatures(Int32ArrayType::Pointer featureOwnersPtr)
     writeErrorFile = outFile.is_open();
   }
 
-  m_Seed = QDateTime::currentMSecsSinceEpoch();
+  // Every random number of the placement derives from this seed, so a fixed seed reproduces the same packing
+  m_Seed = FixedRandomSeed::Resolve(m_UseFixedSeed, m_RandomSeed);
   SIMPL_RANDOMNG_NEW_SEEDED(m_Seed);
 
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getOutputCellAttributeMatrixPath().getDataContainerName());
@@ -1186,8 +1343,8 @@ void PackPrimaryPhases::placeFeatures(Int32ArrayType::Pointer featureOwnersPtr)
   exclusionOwnersPtr->initializeWithValue(0);
 
   // This is the set that we are going to keep updated with the points that are not in an exclusion zone
-  std::map<size_t, size_t> availablePoints;
-  std::map<size_t, size_t> availablePointsInv;
+  SyntheticBuilding::PackingAvailablePoints availablePoints;
+  availablePoints.initialize(static_cast<size_t>(m_TotalPackingPoints));
 
   // Get a pointer to the Feature Owners that was just initialized in the initialize_packinggrid() method
   int32_t* featureOwners = featureOwnersPtr->getPointer(0);
@@ -1200,8 +1357,8 @@ void PackPrimaryPhases::placeFeatures(Int32ArrayType::Pointer featureOwnersPtr)
   {
     if((exclusionOwners[i] == 0 && !m_UseMask) || (exclusionOwners[i] == 0 && m_UseMask && m_Mask[i]))
     {
-      availablePoints[i] = m_AvailablePointsCount;
-      availablePointsInv[m_AvailablePointsCount] = i;
+      availablePoints.position(i) = m_AvailablePointsCount;
+      availablePoints.point(m_AvailablePointsCount) = i;
       m_AvailablePointsCount++;
     }
   }
@@ -1219,7 +1376,6 @@ void PackPrimaryPhases::placeFeatures(Int32ArrayType::Pointer featureOwnersPtr)
     phase = m_PrimaryPhases[i];
     PrimaryStatsData::Pointer pp = std::dynamic_pointer_cast<PrimaryStatsData>(statsDataArray[phase]);
     m_FeatureSizeDist[i].resize(40);
-    m_SimFeatureSizeDist[i].resize(40);
     m_FeatureSizeDistStep[i] = static_cast<float>(((2 * pp->getMaxFeatureDiameter()) - (pp->getMinFeatureDiameter() / 2.0f)) / m_FeatureSizeDist[i].size());
     float input = 0.0f;
     float previoustotal = 0.0f;
@@ -1242,6 +1398,7 @@ void PackPrimaryPhases::placeFeatures(Int32ArrayType::Pointer featureOwnersPtr)
       }
       previoustotal = previoustotal + m_FeatureSizeDist[i][j];
     }
+    m_SimFeatureSizeDist[i].initialize(m_FeatureSizeDist[i]);
   }
 
   if(getCancel())
@@ -1293,6 +1450,7 @@ void PackPrimaryPhases::placeFeatures(Int32ArrayType::Pointer featureOwnersPtr)
         }
 
         transferAttributes(gid, &feature);
+        m_SimFeatureSizeDist[j].add(0, featureSizeDistBin(j, m_EquivalentDiameters[gid]));
         m_OldSizeDistError = m_CurrentSizeDistError;
         curphasevol[j] = curphasevol[j] + m_Volumes[gid];
         iter = 0;
@@ -1336,6 +1494,7 @@ void PackPrimaryPhases::placeFeatures(Int32ArrayType::Pointer featureOwnersPtr)
             updateFeatureInstancePointers();
           }
           transferAttributes(gid, &feature);
+          m_SimFeatureSizeDist[j].add(0, featureSizeDistBin(j, m_EquivalentDiameters[gid]));
           m_OldSizeDistError = m_CurrentSizeDistError;
           curphasevol[j] = curphasevol[j] + m_Volumes[gid];
           iter = 0;
@@ -1366,13 +1525,14 @@ void PackPrimaryPhases::placeFeatures(Int32ArrayType::Pointer featureOwnersPtr)
   // initialize the sim and goal neighbor distribution for the primary phases
   m_NeighborDist.resize(m_PrimaryPhases.size());
   m_SimNeighborDist.resize(m_PrimaryPhases.size());
+  m_NeighborDistPhaseIndices.clear();
+  m_NeighborDistRows.clear();
   m_NeighborDistStep.resize(m_PrimaryPhases.size());
   for(size_t i = 0; i < numPrimaryPhases; i++)
   {
     phase = m_PrimaryPhases[i];
     PrimaryStatsData::Pointer pp = std::dynamic_pointer_cast<PrimaryStatsData>(statsDataArray[phase]);
     m_NeighborDist[i].resize(pp->getBinNumbers()->getSize());
-    m_SimNeighborDist[i].resize(pp->getBinNumbers()->getSize());
     VectorOfFloatArray Neighdist = pp->getFeatureSize_Neighbors();
     float normalizer = 0.0f;
     size_t numNeighborDistBins = m_NeighborDist[i].size();
@@ -1409,6 +1569,7 @@ void PackPrimaryPhases::placeFeatures(Int32ArrayType::Pointer featureOwnersPtr)
         m_NeighborDist[i][j][k] = m_NeighborDist[i][j][k] * normalizer;
       }
     }
+    m_SimNeighborDist[i].initialize(m_NeighborDist[i]);
   }
 
   if(getCancel())
@@ -1510,6 +1671,7 @@ void PackPrimaryPhases::placeFeatures(Int32ArrayType::Pointer featureOwnersPtr)
     }
     determineNeighbors(i, true);
   }
+  initializeNeighborDistributions();
   m_OldNeighborhoodError = checkNeighborhoodError(-1000, -1000);
 
   // begin swaping/moving/adding/removing features to try to improve packing
@@ -1521,8 +1683,8 @@ void PackPrimaryPhases::placeFeatures(Int32ArrayType::Pointer featureOwnersPtr)
   {
     if((exclusionOwners[i] == 0 && !m_UseMask) || (exclusionOwners[i] == 0 && m_UseMask && m_Mask[i]))
     {
-      availablePoints[i] = m_AvailablePointsCount;
-      availablePointsInv[m_AvailablePointsCount] = i;
+      availablePoints.position(i) = m_AvailablePointsCount;
+      availablePoints.point(m_AvailablePointsCount) = i;
       m_AvailablePointsCount++;
     }
   }
@@ -1531,26 +1693,257 @@ void PackPrimaryPhases::placeFeatures(Int32ArrayType::Pointer featureOwnersPtr)
   m_PointsToRemove.clear();
   m_PointsToAdd.clear();
 
-  millis = QDateTime::currentMSecsSinceEpoch();
-  startMillis = millis;
-  bool good = false;
-  size_t key = 0;
-  float xshift = 0.0f, yshift = 0.0f, zshift = 0.0f;
-  int32_t lastIteration = 0;
-  for(int32_t iteration = 0; iteration < totalAdjustments; ++iteration)
+  if(m_UseParallelPlacement)
   {
+    adjustFeaturesInBatches(featureOwnersPtr, exclusionOwnersPtr, availablePoints, totalAdjustments, outFile, writeErrorFile);
+  }
+  else
+  {
+    millis = QDateTime::currentMSecsSinceEpoch();
+    startMillis = millis;
+    bool good = false;
+    size_t key = 0;
+    float xshift = 0.0f, yshift = 0.0f, zshift = 0.0f;
+    int32_t lastIteration = 0;
+    for(int32_t iteration = 0; iteration < totalAdjustments; ++iteration)
+    {
+      uint64_t currentMillis = QDateTime::currentMSecsSinceEpoch();
+      if(currentMillis - millis > 1000)
+      {
+        QString ss = QObject::tr("Swapping/Moving/Adding/Removing Features Iteration %1/%2").arg(iteration).arg(totalAdjustments);
+        timeDiff = ((float)iteration / (float)(currentMillis - startMillis));
+        estimatedTime = (float)(totalAdjustments - iteration) / timeDiff;
+
+        ss += QObject::tr(" || Est. Time Remain: %1 || Iterations/Sec: %2").arg(DREAM3D::convertMillisToHrsMinSecs(estimatedTime)).arg(timeDiff * 1000);
+        notifyStatusMessage(ss);
+
+        millis = QDateTime::currentMSecsSinceEpoch();
+        lastIteration = iteration;
+      }
+
+      if(getCancel())
+      {
+        return;
+      }
+
+      int32_t option = iteration % 2;
+
+      if(writeErrorFile && iteration % 25 == 0)
+      {
+        outFile << iteration << " " << m_FillingError << "  " << availablePoints.size() << "  " << m_AvailablePointsCount << " " << totalFeatures << " " << acceptedmoves << "\n";
+      }
+
+      // JUMP - this option moves one feature to a random spot in the volume
+      if(option == 0)
+      {
+        randomfeature = m_FirstPrimaryFeature + int32_t(rg.genrand_res53() * (totalFeatures - m_FirstPrimaryFeature));
+        good = false;
+        count = 0;
+        while(!good && count < static_cast<int32_t>((totalFeatures - m_FirstPrimaryFeature)))
+        {
+          xc = m_Centroids[3 * randomfeature];
+          yc = m_Centroids[3 * randomfeature + 1];
+          zc = m_Centroids[3 * randomfeature + 2];
+          column = static_cast<int64_t>((xc - (m_HalfPackingRes[0])) * m_OneOverPackingRes[0]);
+          row = static_cast<int64_t>((yc - (m_HalfPackingRes[1])) * m_OneOverPackingRes[1]);
+          plane = static_cast<int64_t>((zc - (m_HalfPackingRes[2])) * m_OneOverPackingRes[2]);
+          featureOwnersIdx = (m_PackingPoints[0] * m_PackingPoints[1] * plane) + (m_PackingPoints[0] * row) + column;
+          if(featureOwners[featureOwnersIdx] > 1)
+          {
+            good = true;
+          }
+          else
+          {
+            randomfeature++;
+          }
+          if(static_cast<size_t>(randomfeature) >= totalFeatures)
+          {
+            randomfeature = m_FirstPrimaryFeature;
+          }
+          count++;
+        }
+        m_Seed++;
+
+        if(!availablePoints.empty())
+        {
+          key = static_cast<size_t>(rg.genrand_res53() * (m_AvailablePointsCount - 1));
+          featureOwnersIdx = availablePoints.point(key);
+        }
+        else
+        {
+          featureOwnersIdx = static_cast<size_t>(rg.genrand_res53() * m_TotalPackingPoints);
+        }
+
+        // find the column row and plane of that point
+        column = static_cast<int64_t>(featureOwnersIdx % m_PackingPoints[0]);
+        row = static_cast<int64_t>(featureOwnersIdx / m_PackingPoints[0]) % m_PackingPoints[1];
+        plane = static_cast<int64_t>(featureOwnersIdx / (m_PackingPoints[0] * m_PackingPoints[1]));
+        xc = static_cast<float>((column * m_PackingRes[0]) + (m_PackingRes[0] * 0.5));
+        yc = static_cast<float>((row * m_PackingRes[1]) + (m_PackingRes[1] * 0.5));
+        zc = static_cast<float>((plane * m_PackingRes[2]) + (m_PackingRes[2] * 0.5));
+        oldxc = m_Centroids[3 * randomfeature];
+        oldyc = m_Centroids[3 * randomfeature + 1];
+        oldzc = m_Centroids[3 * randomfeature + 2];
+        m_OldFillingError = m_FillingError;
+        m_FillingError = checkFillingError(-1000, static_cast<int32_t>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
+        moveFeature(randomfeature, xc, yc, zc);
+        m_FillingError = checkFillingError(static_cast<int32_t>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
+        m_CurrentNeighborhoodError = checkNeighborhoodError(-1000, randomfeature);
+        if(m_FillingError <= m_OldFillingError)
+        {
+          m_OldNeighborhoodError = m_CurrentNeighborhoodError;
+          updateAvailablePoints(availablePoints);
+          acceptedmoves++;
+        }
+        else if(m_FillingError > m_OldFillingError)
+        {
+          m_FillingError = checkFillingError(-1000, static_cast<int32_t>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
+          moveFeature(randomfeature, oldxc, oldyc, oldzc);
+          m_FillingError = checkFillingError(static_cast<int32_t>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
+          m_PointsToRemove.clear();
+          m_PointsToAdd.clear();
+        }
+      }
+
+      // NUDGE - this option moves one feature to a spot close to its current centroid
+      if(option == 1)
+      {
+        randomfeature = m_FirstPrimaryFeature + int32_t(rg.genrand_res53() * (totalFeatures - m_FirstPrimaryFeature));
+        good = false;
+        count = 0;
+        while(!good && count < static_cast<int32_t>((totalFeatures - m_FirstPrimaryFeature)))
+        {
+          xc = m_Centroids[3 * randomfeature];
+          yc = m_Centroids[3 * randomfeature + 1];
+          zc = m_Centroids[3 * randomfeature + 2];
+          column = static_cast<int64_t>((xc - (m_HalfPackingRes[0])) * m_OneOverPackingRes[0]);
+          row = static_cast<int64_t>((yc - (m_HalfPackingRes[1])) * m_OneOverPackingRes[1]);
+          plane = static_cast<int64_t>((zc - (m_HalfPackingRes[2])) * m_OneOverPackingRes[2]);
+          featureOwnersIdx = (m_PackingPoints[0] * m_PackingPoints[1] * plane) + (m_PackingPoints[0] * row) + column;
+          if(featureOwners[featureOwnersIdx] > 1)
+          {
+            good = true;
+          }
+          else
+          {
+            randomfeature++;
+          }
+          if(static_cast<size_t>(randomfeature) >= totalFeatures)
+          {
+            randomfeature = m_FirstPrimaryFeature;
+          }
+          count++;
+        }
+        m_Seed++;
+        oldxc = m_Centroids[3 * randomfeature];
+        oldyc = m_Centroids[3 * randomfeature + 1];
+        oldzc = m_Centroids[3 * randomfeature + 2];
+        xshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[0])));
+        yshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[1])));
+        zshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[2])));
+        if((oldxc + xshift) < m_SizeX && (oldxc + xshift) > 0)
+        {
+          xc = oldxc + xshift;
+        }
+        else
+        {
+          xc = oldxc;
+        }
+        if((oldyc + yshift) < m_SizeY && (oldyc + yshift) > 0)
+        {
+          yc = oldyc + yshift;
+        }
+        else
+        {
+          yc = oldyc;
+        }
+        if((oldzc + zshift) < m_SizeZ && (oldzc + zshift) > 0)
+        {
+          zc = oldzc + zshift;
+        }
+        else
+        {
+          zc = oldzc;
+        }
+        m_OldFillingError = m_FillingError;
+        m_FillingError = checkFillingError(-1000, static_cast<int32_t>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
+        moveFeature(randomfeature, xc, yc, zc);
+        m_FillingError = checkFillingError(static_cast<int32_t>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
+        m_CurrentNeighborhoodError = checkNeighborhoodError(-1000, randomfeature);
+        //      change2 = (currentneighborhooderror * currentneighborhooderror) - (oldneighborhooderror * oldneighborhooderror);
+        //      if(fillingerror <= oldfillingerror && currentneighborhooderror >= oldneighborhooderror)
+        if(m_FillingError <= m_OldFillingError)
+        {
+          m_OldNeighborhoodError = m_CurrentNeighborhoodError;
+          updateAvailablePoints(availablePoints);
+          acceptedmoves++;
+        }
+        //      else if(fillingerror > oldfillingerror || currentneighborhooderror < oldneighborhooderror)
+        else if(m_FillingError > m_OldFillingError)
+        {
+          m_FillingError = checkFillingError(-1000, static_cast<int>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
+          moveFeature(randomfeature, oldxc, oldyc, oldzc);
+          m_FillingError = checkFillingError(static_cast<int>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
+          m_PointsToRemove.clear();
+          m_PointsToAdd.clear();
+        }
+      }
+    }
+  }
+
+  if(!m_VtkOutputFile.isEmpty())
+  {
+    int32_t err = writeVtkFile(featureOwnersPtr->getPointer(0), exclusionOwnersPtr->getPointer(0));
+    if(err < 0)
+    {
+      QString ss = QObject::tr("Error writing Vtk file");
+      setErrorCondition(-78008, ss);
+      return;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PackPrimaryPhases::adjustFeaturesInBatches(Int32ArrayType::Pointer featureOwnersPtr, Int32ArrayType::Pointer exclusionOwnersPtr, SyntheticBuilding::PackingAvailablePoints& availablePoints,
+                                                int32_t totalAdjustments, std::ofstream& outFile, bool writeErrorFile)
+{
+  // The batch size is fixed so that the proposed moves, and therefore the packing, do not depend on the number of threads
+  const int32_t batchSize = 256;
+
+  int32_t* featureOwners = featureOwnersPtr->getPointer(0);
+  size_t totalFeatures = m_FeaturePhasesPtr.lock()->getNumberOfTuples();
+  int32_t numMovableFeatures = static_cast<int32_t>(totalFeatures) - m_FirstPrimaryFeature;
+  if(numMovableFeatures <= 0)
+  {
+    return;
+  }
+
+  std::vector<PlacementMoveCandidate> candidates(batchSize);
+  std::vector<size_t> order(batchSize);
+  std::vector<int32_t> claimedPoints(m_TotalPackingPoints, -1);
+  std::vector<int32_t> movedFeatures(totalFeatures, -1);
+  std::uniform_real_distribution<> distribution(0.0, 1.0);
+  uint64_t baseSeed = m_Seed;
+  int32_t acceptedmoves = 0;
+
+  uint64_t millis = QDateTime::currentMSecsSinceEpoch();
+  uint64_t startMillis = millis;
+  int32_t numBatches = (totalAdjustments + batchSize - 1) / batchSize;
+  for(int32_t batch = 0; batch < numBatches; batch++)
+  {
+    int32_t firstIteration = batch * batchSize;
     uint64_t currentMillis = QDateTime::currentMSecsSinceEpoch();
     if(currentMillis - millis > 1000)
     {
-      QString ss = QObject::tr("Swapping/Moving/Adding/Removing Features Iteration %1/%2").arg(iteration).arg(totalAdjustments);
-      timeDiff = ((float)iteration / (float)(currentMillis - startMillis));
-      estimatedTime = (float)(totalAdjustments - iteration) / timeDiff;
-
+      QString ss = QObject::tr("Swapping/Moving/Adding/Removing Features Iteration %1/%2").arg(firstIteration).arg(totalAdjustments);
+      float timeDiff = ((float)firstIteration / (float)(currentMillis - startMillis));
+      float estimatedTime = (float)(totalAdjustments - firstIteration) / timeDiff;
       ss += QObject::tr(" || Est. Time Remain: %1 || Iterations/Sec: %2").arg(DREAM3D::convertMillisToHrsMinSecs(estimatedTime)).arg(timeDiff * 1000);
       notifyStatusMessage(ss);
 
       millis = QDateTime::currentMSecsSinceEpoch();
-      lastIteration = iteration;
     }
 
     if(getCancel())
@@ -1558,28 +1951,27 @@ void PackPrimaryPhases::placeFeatures(Int32ArrayType::Pointer featureOwnersPtr)
       return;
     }
 
-    int32_t option = iteration % 2;
-
-    if(writeErrorFile && iteration % 25 == 0)
+    if(writeErrorFile)
     {
-      outFile << iteration << " " << m_FillingError << "  " << availablePoints.size() << "  " << m_AvailablePointsCount << " " << totalFeatures << " " << acceptedmoves << "\n";
+      outFile << firstIteration << " " << m_FillingError << "  " << availablePoints.size() << "  " << m_AvailablePointsCount << " " << totalFeatures << " " << acceptedmoves << "\n";
     }
 
-    // JUMP - this option moves one feature to a random spot in the volume
-    if(option == 0)
+    // Propose the moves of this batch serially from a generator seeded by the batch index, using the
+    // same JUMP/NUDGE alternation and Feature selection as the serial placement
+    std::mt19937_64 generator(baseSeed + static_cast<uint64_t>(batch));
+    size_t numCandidates = static_cast<size_t>(std::min(batchSize, totalAdjustments - firstIteration));
+    for(size_t c = 0; c < numCandidates; c++)
     {
-      randomfeature = m_FirstPrimaryFeature + int32_t(rg.genrand_res53() * (totalFeatures - m_FirstPrimaryFeature));
-      good = false;
-      count = 0;
-      while(!good && count < static_cast<int32_t>((totalFeatures - m_FirstPrimaryFeature)))
-      {
-        xc = m_Centroids[3 * randomfeature];
-        yc = m_Centroids[3 * randomfeature + 1];
-        zc = m_Centroids[3 * randomfeature + 2];
-        column = static_cast<int64_t>((xc - (m_HalfPackingRes[0])) * m_OneOverPackingRes[0]);
-        row = static_cast<int64_t>((yc - (m_HalfPackingRes[1])) * m_OneOverPackingRes[1]);
-        plane = static_cast<int64_t>((zc - (m_HalfPackingRes[2])) * m_OneOverPackingRes[2]);
-        featureOwnersIdx = (m_PackingPoints[0] * m_PackingPoints[1] * plane) + (m_PackingPoints[0] * row) + column;
+      int32_t option = (firstIteration + static_cast<int32_t>(c)) % 2;
+      int32_t randomfeature = m_FirstPrimaryFeature + int32_t(distribution(generator) * numMovableFeatures);
+      bool good = false;
+      int32_t count = 0;
+      while(!good && count < numMovableFeatures)
+      {
+        int64_t column = static_cast<int64_t>((m_Centroids[3 * randomfeature] - (m_HalfPackingRes[0])) * m_OneOverPackingRes[0]);
+        int64_t row = static_cast<int64_t>((m_Centroids[3 * randomfeature + 1] - (m_HalfPackingRes[1])) * m_OneOverPackingRes[1]);
+        int64_t plane = static_cast<int64_t>((m_Centroids[3 * randomfeature + 2] - (m_HalfPackingRes[2])) * m_OneOverPackingRes[2]);
+        int64_t featureOwnersIdx = (m_PackingPoints[0] * m_PackingPoints[1] * plane) + (m_PackingPoints[0] * row) + column;
         if(featureOwners[featureOwnersIdx] > 1)
         {
           good = true;
@@ -1594,142 +1986,83 @@ void PackPrimaryPhases::placeFeatures(Int32ArrayType::Pointer featureOwnersPtr)
         }
         count++;
       }
-      m_Seed++;
 
-      if(!availablePoints.empty())
+      PlacementMoveCandidate& candidate = candidates[c];
+      candidate.feature = randomfeature;
+      float oldxc = m_Centroids[3 * randomfeature];
+      float oldyc = m_Centroids[3 * randomfeature + 1];
+      float oldzc = m_Centroids[3 * randomfeature + 2];
+      // JUMP - this option moves one feature to a random spot in the volume
+      if(option == 0)
       {
-        key = static_cast<size_t>(rg.genrand_res53() * (m_AvailablePointsCount - 1));
-        featureOwnersIdx = availablePointsInv[key];
-      }
-      else
-      {
-        featureOwnersIdx = static_cast<size_t>(rg.genrand_res53() * m_TotalPackingPoints);
-      }
-
-      // find the column row and plane of that point
-      column = static_cast<int64_t>(featureOwnersIdx % m_PackingPoints[0]);
-      row = static_cast<int64_t>(featureOwnersIdx / m_PackingPoints[0]) % m_PackingPoints[1];
-      plane = static_cast<int64_t>(featureOwnersIdx / (m_PackingPoints[0] * m_PackingPoints[1]));
-      xc = static_cast<float>((column * m_PackingRes[0]) + (m_PackingRes[0] * 0.5));
-      yc = static_cast<float>((row * m_PackingRes[1]) + (m_PackingRes[1] * 0.5));
-      zc = static_cast<float>((plane * m_PackingRes[2]) + (m_PackingRes[2] * 0.5));
-      oldxc = m_Centroids[3 * randomfeature];
-      oldyc = m_Centroids[3 * randomfeature + 1];
-      oldzc = m_Centroids[3 * randomfeature + 2];
-      m_OldFillingError = m_FillingError;
-      m_FillingError = checkFillingError(-1000, static_cast<int32_t>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
-      moveFeature(randomfeature, xc, yc, zc);
-      m_FillingError = checkFillingError(static_cast<int32_t>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
-      m_CurrentNeighborhoodError = checkNeighborhoodError(-1000, randomfeature);
-      if(m_FillingError <= m_OldFillingError)
-      {
-        m_OldNeighborhoodError = m_CurrentNeighborhoodError;
-        updateAvailablePoints(availablePoints, availablePointsInv);
-        acceptedmoves++;
-      }
-      else if(m_FillingError > m_OldFillingError)
-      {
-        m_FillingError = checkFillingError(-1000, static_cast<int32_t>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
-        moveFeature(randomfeature, oldxc, oldyc, oldzc);
-        m_FillingError = checkFillingError(static_cast<int32_t>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
-        m_PointsToRemove.clear();
-        m_PointsToAdd.clear();
-      }
-    }
-
-    // NUDGE - this option moves one feature to a spot close to its current centroid
-    if(option == 1)
-    {
-      randomfeature = m_FirstPrimaryFeature + int32_t(rg.genrand_res53() * (totalFeatures - m_FirstPrimaryFeature));
-      good = false;
-      count = 0;
-      while(!good && count < static_cast<int32_t>((totalFeatures - m_FirstPrimaryFeature)))
-      {
-        xc = m_Centroids[3 * randomfeature];
-        yc = m_Centroids[3 * randomfeature + 1];
-        zc = m_Centroids[3 * randomfeature + 2];
-        column = static_cast<int64_t>((xc - (m_HalfPackingRes[0])) * m_OneOverPackingRes[0]);
-        row = static_cast<int64_t>((yc - (m_HalfPackingRes[1])) * m_OneOverPackingRes[1]);
-        plane = static_cast<int64_t>((zc - (m_HalfPackingRes[2])) * m_OneOverPackingRes[2]);
-        featureOwnersIdx = (m_PackingPoints[0] * m_PackingPoints[1] * plane) + (m_PackingPoints[0] * row) + column;
-        if(featureOwners[featureOwnersIdx] > 1)
+        size_t featureOwnersIdx = 0;
+        if(!availablePoints.empty())
         {
-          good = true;
+          size_t key = static_cast<size_t>(distribution(generator) * (m_AvailablePointsCount - 1));
+          featureOwnersIdx = availablePoints.point(key);
         }
         else
         {
-          randomfeature++;
-        }
-        if(static_cast<size_t>(randomfeature) >= totalFeatures)
-        {
-          randomfeature = m_FirstPrimaryFeature;
+          featureOwnersIdx = static_cast<size_t>(distribution(generator) * m_TotalPackingPoints);
         }
-        count++;
-      }
-      m_Seed++;
-      oldxc = m_Centroids[3 * randomfeature];
-      oldyc = m_Centroids[3 * randomfeature + 1];
-      oldzc = m_Centroids[3 * randomfeature + 2];
-      xshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[0])));
-      yshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[1])));
-      zshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[2])));
-      if((oldxc + xshift) < m_SizeX && (oldxc + xshift) > 0)
-      {
-        xc = oldxc + xshift;
+        int64_t column = static_cast<int64_t>(featureOwnersIdx % m_PackingPoints[0]);
+        int64_t row = static_cast<int64_t>(featureOwnersIdx / m_PackingPoints[0]) % m_PackingPoints[1];
+        int64_t plane = static_cast<int64_t>(featureOwnersIdx / (m_PackingPoints[0] * m_PackingPoints[1]));
+        candidate.xc = static_cast<float>((column * m_PackingRes[0]) + (m_PackingRes[0] * 0.5));
+        candidate.yc = static_cast<float>((row * m_PackingRes[1]) + (m_PackingRes[1] * 0.5));
+        candidate.zc = static_cast<float>((plane * m_PackingRes[2]) + (m_PackingRes[2] * 0.5));
       }
+      // NUDGE - this option moves one feature to a spot close to its current centroid
       else
       {
-        xc = oldxc;
+        float xshift = static_cast<float>(((2.0f * (distribution(generator) - 0.5f)) * (2.0f * m_PackingRes[0])));
+        float yshift = static_cast<float>(((2.0f * (distribution(generator) - 0.5f)) * (2.0f * m_PackingRes[1])));
+        float zshift = static_cast<float>(((2.0f * (distribution(generator) - 0.5f)) * (2.0f * m_PackingRes[2])));
+        candidate.xc = ((oldxc + xshift) < m_SizeX && (oldxc + xshift) > 0) ? oldxc + xshift : oldxc;
+        candidate.yc = ((oldyc + yshift) < m_SizeY && (oldyc + yshift) > 0) ? oldyc + yshift : oldyc;
+        candidate.zc = ((oldzc + zshift) < m_SizeZ && (oldzc + zshift) > 0) ? oldzc + zshift : oldzc;
       }
-      if((oldyc + yshift) < m_SizeY && (oldyc + yshift) > 0)
-      {
-        yc = oldyc + yshift;
-      }
-      else
-      {
-        yc = oldyc;
-      }
-      if((oldzc + zshift) < m_SizeZ && (oldzc + zshift) > 0)
+    }
+
+    // Evaluate every candidate against the unmodified packing grid
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numCandidates);
+    dataAlg.setGrain(1);
+    dataAlg.execute(EvaluatePlacementMovesImpl(featureOwners, m_PackingPoints, m_HalfPackingRes, m_OneOverPackingRes, m_PeriodicBoundaries, m_Centroids, m_ColumnList, m_RowList, m_PlaneList,
+                                               candidates));
+
+    // Commit the non-worsening moves best first, skipping any move that shares a packing point or a Feature with
+    // an already committed move of this batch. Moves with disjoint footprints do not interact, so each committed
+    // move changes the filling error by exactly its evaluated delta.
+    std::iota(order.begin(), order.begin() + numCandidates, 0);
+    std::stable_sort(order.begin(), order.begin() + numCandidates, [&candidates](size_t a, size_t b) { return candidates[a].delta < candidates[b].delta; });
+    for(size_t c = 0; c < numCandidates; c++)
+    {
+      const PlacementMoveCandidate& candidate = candidates[order[c]];
+      if(candidate.delta > 0)
       {
-        zc = oldzc + zshift;
+        break;
       }
-      else
+      if(movedFeatures[candidate.feature] == batch)
       {
-        zc = oldzc;
+        continue;
       }
-      m_OldFillingError = m_FillingError;
-      m_FillingError = checkFillingError(-1000, static_cast<int32_t>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
-      moveFeature(randomfeature, xc, yc, zc);
-      m_FillingError = checkFillingError(static_cast<int32_t>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
-      m_CurrentNeighborhoodError = checkNeighborhoodError(-1000, randomfeature);
-      //      change2 = (currentneighborhooderror * currentneighborhooderror) - (oldneighborhooderror * oldneighborhooderror);
-      //      if(fillingerror <= oldfillingerror && currentneighborhooderror >= oldneighborhooderror)
-      if(m_FillingError <= m_OldFillingError)
+      bool overlaps = std::any_of(candidate.touched.begin(), candidate.touched.end(), [&claimedPoints, batch](int64_t idx) { return claimedPoints[idx] == batch; });
+      if(overlaps)
       {
-        m_OldNeighborhoodError = m_CurrentNeighborhoodError;
-        updateAvailablePoints(availablePoints, availablePointsInv);
-        acceptedmoves++;
+        continue;
       }
-      //      else if(fillingerror > oldfillingerror || currentneighborhooderror < oldneighborhooderror)
-      else if(m_FillingError > m_OldFillingError)
+      for(const int64_t& idx : candidate.touched)
       {
-        m_FillingError = checkFillingError(-1000, static_cast<int>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
-        moveFeature(randomfeature, oldxc, oldyc, oldzc);
-        m_FillingError = checkFillingError(static_cast<int>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
-        m_PointsToRemove.clear();
-        m_PointsToAdd.clear();
+        claimedPoints[idx] = batch;
       }
-    }
-  }
+      movedFeatures[candidate.feature] = batch;
 
-  if(!m_VtkOutputFile.isEmpty())
-  {
-    int32_t err = writeVtkFile(featureOwnersPtr->getPointer(0), exclusionOwnersPtr->getPointer(0));
-    if(err < 0)
-    {
-      QString ss = QObject::tr("Error writing Vtk file");
-      setErrorCondition(-78008, ss);
-      return;
+      m_FillingError = checkFillingError(-1000, candidate.feature, featureOwnersPtr, exclusionOwnersPtr);
+      moveFeature(candidate.feature, candidate.xc, candidate.yc, candidate.zc);
+      m_FillingError = checkFillingError(candidate.feature, -1000, featureOwnersPtr, exclusionOwnersPtr);
+      updateAvailablePoints(availablePoints);
+      acceptedmoves++;
     }
   }
 }
@@ -1985,11 +2318,11 @@ void PackPrimaryPhases::determineNeighbors(size_t gnum, bool add)
     dz = fabs(z - zn);
     if(dx < dia && dy < dia && dz < dia)
     {
-      m_Neighborhoods[gnum] = m_Neighborhoods[gnum] + increment;
+      updateNeighborhood(gnum, increment);
     }
     if(dx < dia2 && dy < dia2 && dz < dia2)
     {
-      m_Neighborhoods[n] = m_Neighborhoods[n] + increment;
+      updateNeighborhood(n, increment);
     }
   }
 }
@@ -1997,88 +2330,70 @@ void PackPrimaryPhases::determineNeighbors(size_t gnum, bool add)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float PackPrimaryPhases::checkNeighborhoodError(int32_t gadd, int32_t gremove)
+void PackPrimaryPhases::updateNeighborhood(size_t gnum, int32_t increment)
+{
+  int32_t iter = gnum < m_NeighborDistPhaseIndices.size() ? m_NeighborDistPhaseIndices[gnum] : -1;
+  if(iter < 0)
+  {
+    m_Neighborhoods[gnum] = m_Neighborhoods[gnum] + increment;
+    return;
+  }
+  SyntheticBuilding::DistributionHistogram& simNeighborDist = m_SimNeighborDist[iter];
+  simNeighborDist.remove(m_NeighborDistRows[gnum], neighborDistBin(gnum));
+  m_Neighborhoods[gnum] = m_Neighborhoods[gnum] + increment;
+  simNeighborDist.add(m_NeighborDistRows[gnum], neighborDistBin(gnum));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PackPrimaryPhases::neighborDistBin(size_t gnum) const
+{
+  float oneOverNeighborDistStep = 1.0f / m_NeighborDistStep[m_NeighborDistPhaseIndices[gnum]];
+  size_t nnumbin = static_cast<size_t>(m_Neighborhoods[gnum] * oneOverNeighborDistStep);
+  if(nnumbin >= 40)
+  {
+    nnumbin = 39;
+  }
+  return nnumbin;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PackPrimaryPhases::initializeNeighborDistributions()
 {
-  // Optimized Code
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getOutputCellAttributeMatrixPath().getDataContainerName());
 
   StatsDataArray& statsDataArray = *(m_StatsDataArray.lock().get());
 
-  float neighborerror = 0.0f;
-  float bhattdist = 0.0f;
-  float dia = 0.0f;
-  int32_t nnum = 0;
-  size_t diabin = 0;
-  size_t nnumbin = 0;
-  int32_t index = 0;
-  int32_t phase = 0;
+  size_t totalFeatures = m->getAttributeMatrix(m_OutputCellFeatureAttributeMatrixName)->getNumberOfTuples();
+  m_NeighborDistPhaseIndices.assign(totalFeatures, -1);
+  m_NeighborDistRows.assign(totalFeatures, 0);
 
-  using VectOfVectFloat_t = std::vector<std::vector<float>>;
   size_t numPhases = m_SimNeighborDist.size();
   for(size_t iter = 0; iter < numPhases; ++iter)
   {
-    phase = m_PrimaryPhases[iter];
+    int32_t phase = m_PrimaryPhases[iter];
     PrimaryStatsData::Pointer pp = std::dynamic_pointer_cast<PrimaryStatsData>(statsDataArray[phase]);
-    VectOfVectFloat_t& curSimNeighborDist = m_SimNeighborDist[iter];
-    size_t curSImNeighborDist_Size = curSimNeighborDist.size();
-    float oneOverNeighborDistStep = 1.0f / m_NeighborDistStep[iter];
-
-    std::vector<int32_t> count(curSImNeighborDist_Size, 0);
-    for(size_t i = 0; i < curSImNeighborDist_Size; i++)
-    {
-      curSimNeighborDist[i].resize(40);
-      for(size_t j = 0; j < 40; j++)
-      {
-        curSimNeighborDist[i][j] = 0;
-      }
-    }
-    if(gadd > 0 && m_FeaturePhases[gadd] == phase)
-    {
-      determineNeighbors(gadd, true);
-    }
-    if(gremove > 0 && m_FeaturePhases[gremove] == phase)
+    SyntheticBuilding::DistributionHistogram& simNeighborDist = m_SimNeighborDist[iter];
+    simNeighborDist.clear();
+    size_t numRows = simNeighborDist.numRows();
+    if(numRows == 0)
     {
-      determineNeighbors(gremove, false);
+      continue;
     }
 
     float maxFeatureDia = pp->getMaxFeatureDiameter();
     float minFeatureDia = pp->getMinFeatureDiameter();
     float oneOverBinStepSize = 1.0f / pp->getBinStepSize();
-
-    size_t totalFeatures = m->getAttributeMatrix(m_OutputCellFeatureAttributeMatrixName)->getNumberOfTuples();
     for(size_t i = m_FirstPrimaryFeature; i < totalFeatures; i++)
     {
-      nnum = 0;
-      index = static_cast<int32_t>(i);
-      if(index != gremove && m_FeaturePhases[index] == phase)
+      if(m_FeaturePhases[i] != phase)
       {
-        dia = m_EquivalentDiameters[index];
-        if(dia > maxFeatureDia)
-        {
-          dia = maxFeatureDia;
-        }
-        if(dia < minFeatureDia)
-        {
-          dia = minFeatureDia;
-        }
-        diabin = static_cast<size_t>(((dia - minFeatureDia) * oneOverBinStepSize));
-        if(diabin >= curSImNeighborDist_Size)
-        {
-          diabin = curSImNeighborDist_Size - 1;
-        }
-        nnum = m_Neighborhoods[index];
-        nnumbin = static_cast<size_t>(nnum * oneOverNeighborDistStep);
-        if(nnumbin >= 40)
-        {
-          nnumbin = 39;
-        }
-        curSimNeighborDist[diabin][nnumbin]++;
-        count[diabin]++;
+        continue;
       }
-    }
-    if(gadd > 0 && m_FeaturePhases[gadd] == phase)
-    {
-      dia = m_EquivalentDiameters[gadd];
+      float dia = m_EquivalentDiameters[i];
       if(dia > maxFeatureDia)
       {
         dia = maxFeatureDia;
@@ -2087,70 +2402,60 @@ float PackPrimaryPhases::checkNeighborhoodError(int32_t gadd, int32_t gremove)
       {
         dia = minFeatureDia;
       }
-      diabin = static_cast<size_t>(((dia - minFeatureDia) * oneOverBinStepSize));
-      if(diabin >= curSImNeighborDist_Size)
-      {
-        diabin = curSImNeighborDist_Size - 1;
-      }
-      nnum = m_Neighborhoods[gadd];
-      nnumbin = static_cast<size_t>(nnum * oneOverNeighborDistStep);
-      if(nnumbin >= 40)
-      {
-        nnumbin = 39;
-      }
-      curSimNeighborDist[diabin][nnumbin]++;
-      count[diabin]++;
-    }
-    float runningtotal = 0.0f;
-
-    for(size_t i = 0; i < curSImNeighborDist_Size; i++)
-    {
-      if(count[i] == 0)
-      {
-        for(size_t j = 0; j < 40; j++)
-        {
-          curSimNeighborDist[i][j] = 0.0f;
-        }
-      }
-      else
+      size_t diabin = static_cast<size_t>(((dia - minFeatureDia) * oneOverBinStepSize));
+      if(diabin >= numRows)
       {
-        float oneOverCount = 1.0f / static_cast<float>(count[i]);
-        for(size_t j = 0; j < 40; j++)
-        {
-          curSimNeighborDist[i][j] = curSimNeighborDist[i][j] * oneOverCount;
-          runningtotal = runningtotal + curSimNeighborDist[i][j];
-        }
+        diabin = numRows - 1;
       }
+      m_NeighborDistPhaseIndices[i] = static_cast<int32_t>(iter);
+      m_NeighborDistRows[i] = diabin;
+      simNeighborDist.add(diabin, neighborDistBin(i));
     }
+  }
+}
 
-    runningtotal = 1.0f / runningtotal; // Flip this so that we have a multiply instead of a divide.
-    for(size_t i = 0; i < curSImNeighborDist_Size; i++)
-    {
-      for(size_t j = 0; j < 40; j++)
-      {
-        curSimNeighborDist[i][j] = curSimNeighborDist[i][j] * runningtotal;
-      }
-    }
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float PackPrimaryPhases::checkNeighborhoodError(int32_t gadd, int32_t gremove)
+{
+  // The simulated neighbor distributions always hold the current Neighborhoods of every primary Feature, so the
+  // trial addition/removal only updates the entries of the Features whose Neighborhoods change and is reverted
+  // once the error has been computed.
+  if(gadd > 0 && m_NeighborDistPhaseIndices[gadd] >= 0)
+  {
+    determineNeighbors(gadd, true);
+    m_SimNeighborDist[m_NeighborDistPhaseIndices[gadd]].add(m_NeighborDistRows[gadd], neighborDistBin(gadd));
+  }
+  if(gremove > 0 && m_NeighborDistPhaseIndices[gremove] >= 0)
+  {
+    determineNeighbors(gremove, false);
+    m_SimNeighborDist[m_NeighborDistPhaseIndices[gremove]].remove(m_NeighborDistRows[gremove], neighborDistBin(gremove));
+  }
 
-    if(gadd > 0 && m_FeaturePhases[gadd] == phase)
-    {
-      determineNeighbors(gadd, false);
-    }
+  float neighborerror = 0.0f;
+  for(const auto& simNeighborDist : m_SimNeighborDist)
+  {
+    neighborerror = neighborerror + simNeighborDist.bhattacharyya();
+  }
 
-    if(gremove > 0 && m_FeaturePhases[gremove] == phase)
-    {
-      determineNeighbors(gremove, true);
-    }
+  if(gadd > 0 && m_NeighborDistPhaseIndices[gadd] >= 0)
+  {
+    m_SimNeighborDist[m_NeighborDistPhaseIndices[gadd]].remove(m_NeighborDistRows[gadd], neighborDistBin(gadd));
+    determineNeighbors(gadd, false);
+  }
+  if(gremove > 0 && m_NeighborDistPhaseIndices[gremove] >= 0)
+  {
+    m_SimNeighborDist[m_NeighborDistPhaseIndices[gremove]].add(m_NeighborDistRows[gremove], neighborDistBin(gremove));
+    determineNeighbors(gremove, true);
   }
-  compare3dDistributions(m_SimNeighborDist, m_NeighborDist, bhattdist);
-  neighborerror = bhattdist;
   return neighborerror;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void PackPrimaryPhases::compare1dDistributions(std::vector<float> array1, std::vector<float> array2, float& bhattdist)
+void PackPrimaryPhases::compare1dDistributions(const std::vector<float>& array1, const std::vector<float>& array2, float& bhattdist)
 {
   bhattdist = 0.0f;
   size_t array1Size = array1.size();
@@ -2163,7 +2468,7 @@ void PackPrimaryPhases::compare1dDistributions(std::vector<float> array1, std::v
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void PackPrimaryPhases::compare2dDistributions(std::vector<std::vector<float>> array1, std::vector<std::vector<float>> array2, float& bhattdist)
+void PackPrimaryPhases::compare2dDistributions(const std::vector<std::vector<float>>& array1, const std::vector<std::vector<float>>& array2, float& bhattdist)
 {
   bhattdist = 0.0f;
   size_t array1Size = array1.size();
@@ -2180,7 +2485,7 @@ void PackPrimaryPhases::compare2dDistributions(std::vector<std::vector<float>> a
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void PackPrimaryPhases::compare3dDistributions(std::vector<std::vector<std::vector<float>>> array1, std::vector<std::vector<std::vector<float>>> array2, float& bhattdist)
+void PackPrimaryPhases::compare3dDistributions(const std::vector<std::vector<std::vector<float>>>& array1, const std::vector<std::vector<std::vector<float>>>& array2, float& bhattdist)
 {
   bhattdist = 0.0f;
   size_t array1Size = array1.size();
@@ -2203,90 +2508,55 @@ void PackPrimaryPhases::compare3dDistributions(std::vector<std::vector<std::vect
 // -----------------------------------------------------------------------------
 float PackPrimaryPhases::checkSizeDistError(Feature_t* feature)
 {
-  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getOutputCellAttributeMatrixPath().getDataContainerName());
-
-  StatsDataArray& statsDataArray = *(m_StatsDataArray.lock().get());
-
-  float dia = 0.0f;
-  float sizedisterror = 0.0f;
-  float bhattdist = 0.0f;
-  int32_t index = 0;
-  int32_t count = 0;
-  int32_t phase = 0;
-  size_t featureSizeDist_Size = m_FeatureSizeDist.size();
-  for(size_t iter = 0; iter < featureSizeDist_Size; ++iter)
+  // The simulated size distributions hold every Feature generated so far; the trial Feature is only added to
+  // the distribution of its phase while the error is computed
+  size_t numPhases = m_SimFeatureSizeDist.size();
+  size_t featurePhaseIndex = numPhases;
+  size_t featureBin = 0;
+  for(size_t iter = 0; iter < numPhases; ++iter)
   {
-    phase = m_PrimaryPhases[iter];
-    PrimaryStatsData::Pointer pp = std::dynamic_pointer_cast<PrimaryStatsData>(statsDataArray[phase]);
-    count = 0;
-    std::vector<float>& curFeatureSizeDist = m_FeatureSizeDist[iter];
-    std::vector<float>::size_type curFeatureSizeDistSize = curFeatureSizeDist.size();
-    std::vector<float>& curSimFeatureSizeDist = m_SimFeatureSizeDist[iter];
-    // Initialize all Values to Zero
-    for(size_t i = 0; i < curFeatureSizeDistSize; i++)
+    if(m_PrimaryPhases[iter] == feature->m_FeaturePhases)
     {
-      curSimFeatureSizeDist[i] = 0.0f;
-    }
-    int64_t totalFeatures = m->getAttributeMatrix(m_OutputCellFeatureAttributeMatrixName)->getNumberOfTuples();
-    float oneOverCurFeatureSizeDistStep = 1.0f / m_FeatureSizeDistStep[iter];
-    float halfMinFeatureDiameter = pp->getMinFeatureDiameter() * 0.5f;
-    for(int32_t b = m_FirstPrimaryFeature; b < totalFeatures; b++)
-    {
-      index = b;
-      if(m_FeaturePhases[index] == phase)
-      {
-        dia = m_EquivalentDiameters[index];
-        dia = (dia - halfMinFeatureDiameter) * oneOverCurFeatureSizeDistStep;
-        if(dia < 0)
-        {
-          dia = 0.0f;
-        }
-        if(dia > curFeatureSizeDistSize - 1.0f)
-        {
-          dia = curFeatureSizeDistSize - 1.0f;
-        }
-        curSimFeatureSizeDist[int32_t(dia)]++;
-        count++;
-      }
+      featurePhaseIndex = iter;
+      featureBin = featureSizeDistBin(iter, feature->m_EquivalentDiameters);
+      m_SimFeatureSizeDist[iter].add(0, featureBin);
+      break;
     }
+  }
 
-    if(feature->m_FeaturePhases == phase)
-    {
-      dia = feature->m_EquivalentDiameters;
-      dia = (dia - halfMinFeatureDiameter) * oneOverCurFeatureSizeDistStep;
-      if(dia < 0)
-      {
-        dia = 0.0f;
-      }
-      if(dia > curFeatureSizeDistSize - 1.0f)
-      {
-        dia = curFeatureSizeDistSize - 1.0f;
-      }
-      curSimFeatureSizeDist[int32_t(dia)]++;
-      count++;
-    }
-    float oneOverCount = 1.0f / count;
+  float sizedisterror = 0.0f;
+  for(size_t iter = 0; iter < numPhases; ++iter)
+  {
+    sizedisterror = sizedisterror + m_SimFeatureSizeDist[iter].bhattacharyya();
+  }
 
-    if(count == 0)
-    {
-      for(size_t i = 0; i < curFeatureSizeDistSize; i++)
-      {
-        curSimFeatureSizeDist[i] = 0.0;
-      }
-    }
-    else
-    {
-      for(size_t i = 0; i < curFeatureSizeDistSize; i++)
-      {
-        curSimFeatureSizeDist[i] = curSimFeatureSizeDist[i] * oneOverCount;
-      }
-    }
+  if(featurePhaseIndex < numPhases)
+  {
+    m_SimFeatureSizeDist[featurePhaseIndex].remove(0, featureBin);
   }
-  compare2dDistributions(m_SimFeatureSizeDist, m_FeatureSizeDist, bhattdist);
-  sizedisterror = bhattdist;
   return sizedisterror;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PackPrimaryPhases::featureSizeDistBin(size_t iter, float equivalentDiameter)
+{
+  StatsDataArray& statsDataArray = *(m_StatsDataArray.lock().get());
+  PrimaryStatsData::Pointer pp = std::dynamic_pointer_cast<PrimaryStatsData>(statsDataArray[m_PrimaryPhases[iter]]);
+  float numBins = static_cast<float>(m_SimFeatureSizeDist[iter].numBins());
+  float dia = (equivalentDiameter - pp->getMinFeatureDiameter() * 0.5f) * (1.0f / m_FeatureSizeDistStep[iter]);
+  if(dia < 0)
+  {
+    dia = 0.0f;
+  }
+  if(dia > numBins - 1.0f)
+  {
+    dia = numBins - 1.0f;
+  }
+  return static_cast<size_t>(int32_t(dia));
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -2475,7 +2745,7 @@ float PackPrimaryPhases::checkFillingError(int32_t gadd, int32_t gremove, Int32A
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void PackPrimaryPhases::updateAvailablePoints(std::map<size_t, size_t>& availablePoints, std::map<size_t, size_t>& availablePointsInv)
+void PackPrimaryPhases::updateAvailablePoints(SyntheticBuilding::PackingAvailablePoints& availablePoints)
 {
   size_t removeSize = m_PointsToRemove.size();
   size_t addSize = m_PointsToAdd.size();
@@ -2484,22 +2754,20 @@ void PackPrimaryPhases::updateAvailablePoints(std::map<size_t, size_t>& availabl
   for(size_t i = 0; i < removeSize; i++)
   {
     featureOwnersIdx = m_PointsToRemove[i];
-    key = availablePoints[featureOwnersIdx];
-    //  availablePoints.erase(featureOwnersIdx);
-    val = availablePointsInv[m_AvailablePointsCount - 1];
-    //  availablePointsInv.erase(availablePointsCount-1);
+    key = availablePoints.position(featureOwnersIdx);
+    val = availablePoints.point(m_AvailablePointsCount - 1);
     if(key < m_AvailablePointsCount - 1)
     {
-      availablePointsInv[key] = val;
-      availablePoints[val] = key;
+      availablePoints.point(key) = val;
+      availablePoints.position(val) = key;
     }
     m_AvailablePointsCount--;
   }
   for(size_t i = 0; i < addSize; i++)
   {
     featureOwnersIdx = m_PointsToAdd[i];
-    availablePoints[featureOwnersIdx] = m_AvailablePointsCount;
-    availablePointsInv[m_AvailablePointsCount] = featureOwnersIdx;
+    availablePoints.position(featureOwnersIdx) = m_AvailablePointsCount;
+    availablePoints.point(m_AvailablePointsCount) = featureOwnersIdx;
     m_AvailablePointsCount++;
   }
   m_PointsToRemove.clear();
@@ -3296,7 +3564,7 @@ int32_t PackPrimaryPhases::estimateNumFeatures(size_t xpoints, size_t ypoints, s
   // Create a Reference Variable so we can use the [] syntax
   StatsDataArray& statsDataArray = *(m_StatsDataArray.lock().get());
 
-  SIMPL_RANDOMNG_NEW()
+  SIMPL_RANDOMNG_NEW_SEEDED(m_Seed)
 
   std::vector<int32_t> primaryPhasesLocal;
   std::vector<double> primaryPhaseFractionsLocal;
@@ -3849,6 +4117,42 @@ bool PackPrimaryPhases::getWriteGoalAttributes() const
   return m_WriteGoalAttributes;
 }
 
+// -----------------------------------------------------------------------------
+void PackPrimaryPhases::setUseParallelPlacement(bool value)
+{
+  m_UseParallelPlacement = value;
+}
+
+// -----------------------------------------------------------------------------
+bool PackPrimaryPhases::getUseParallelPlacement() const
+{
+  return m_UseParallelPlacement;
+}
+
+// -----------------------------------------------------------------------------
+void PackPrimaryPhases::setUseFixedSeed(bool value)
+{
+  m_UseFixedSeed = value;
+}
+
+// -----------------------------------------------------------------------------
+bool PackPrimaryPhases::getUseFixedSeed() const
+{
+  return m_UseFixedSeed;
+}
+
+// -----------------------------------------------------------------------------
+void PackPrimaryPhases::setRandomSeed(int value)
+{
+  m_RandomSeed = value;
+}
+
+// -----------------------------------------------------------------------------
+int PackPrimaryPhases::getRandomSeed() const
+{
+  return m_RandomSeed;
+}
+
 // -----------------------------------------------------------------------------
 void PackPrimaryPhases::setSaveGeometricDescriptions(int value)
 {
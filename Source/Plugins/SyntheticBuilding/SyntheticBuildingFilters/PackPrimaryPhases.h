@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <memory>
 
 #include "SIMPLib/SIMPLib.h"
@@ -47,6 +48,9 @@
 
 #include "EbsdLib/LaueOps/OrthoRhombicOps.h"
 
+#include "SyntheticBuilding/SyntheticBuildingFilters/Utils/DistributionHistogram.hpp"
+#include "SyntheticBuilding/SyntheticBuildingFilters/Utils/PackingAvailablePoints.hpp"
+
 struct Feature_t
 {
   float m_Volumes;
@@ -90,6 +94,9 @@ class SyntheticBuilding_EXPORT PackPrimaryPhases : public AbstractFilter
   PYB11_PROPERTY(QString CsvOutputFile READ getCsvOutputFile WRITE setCsvOutputFile)
   PYB11_PROPERTY(bool PeriodicBoundaries READ getPeriodicBoundaries WRITE setPeriodicBoundaries)
   PYB11_PROPERTY(bool WriteGoalAttributes READ getWriteGoalAttributes WRITE setWriteGoalAttributes)
+  PYB11_PROPERTY(bool UseParallelPlacement READ getUseParallelPlacement WRITE setUseParallelPlacement)
+  PYB11_PROPERTY(bool UseFixedSeed READ getUseFixedSeed WRITE setUseFixedSeed)
+  PYB11_PROPERTY(int RandomSeed READ getRandomSeed WRITE setRandomSeed)
   PYB11_PROPERTY(int SaveGeometricDescriptions READ getSaveGeometricDescriptions WRITE setSaveGeometricDescriptions)
   PYB11_PROPERTY(DataArrayPath NewAttributeMatrixPath READ getNewAttributeMatrixPath WRITE setNewAttributeMatrixPath)
   PYB11_PROPERTY(DataArrayPath SelectedAttributeMatrixPath READ getSelectedAttributeMatrixPath WRITE setSelectedAttributeMatrixPath)
@@ -333,6 +340,39 @@ public:
   bool getWriteGoalAttributes() const;
   Q_PROPERTY(bool WriteGoalAttributes READ getWriteGoalAttributes WRITE setWriteGoalAttributes)
 
+  /**
+   * @brief Setter property for UseParallelPlacement
+   */
+  void setUseParallelPlacement(bool value);
+  /**
+   * @brief Getter property for UseParallelPlacement
+   * @return Value of UseParallelPlacement
+   */
+  bool getUseParallelPlacement() const;
+  Q_PROPERTY(bool UseParallelPlacement READ getUseParallelPlacement WRITE setUseParallelPlacement)
+
+  /**
+   * @brief Setter property for UseFixedSeed
+   */
+  void setUseFixedSeed(bool value);
+  /**
+   * @brief Getter property for UseFixedSeed
+   * @return Value of UseFixedSeed
+   */
+  bool getUseFixedSeed() const;
+  Q_PROPERTY(bool UseFixedSeed READ getUseFixedSeed WRITE setUseFixedSeed)
+
+  /**
+   * @brief Setter property for RandomSeed
+   */
+  void setRandomSeed(int value);
+  /**
+   * @brief Getter property for RandomSeed
+   * @return Value of RandomSeed
+   */
+  int getRandomSeed() const;
+  Q_PROPERTY(int RandomSeed READ getRandomSeed WRITE setRandomSeed)
+
   /**
    * @brief Setter property for SaveGeometricDescriptions
    */
@@ -470,6 +510,21 @@ protected:
    */
   void placeFeatures(Int32ArrayType::Pointer featureOwnersPtr);
 
+  /**
+   * @brief adjustFeaturesInBatches Runs the swapping/moving stage of the placement as a sequence of batches.
+   * The candidate moves of a batch are drawn from a generator seeded by the batch index, their filling
+   * error changes are evaluated in parallel against the unmodified packing grid and the best subset of
+   * non-overlapping, non-worsening moves is then committed serially
+   * @param featureOwnersPtr Array of Feature Ids for each packing point
+   * @param exclusionOwnersPtr Array of exlusion Ids for each packing point
+   * @param availablePoints Associations between packing points and their slots in the list of available points
+   * @param totalAdjustments Total number of candidate moves to propose
+   * @param outFile Stream receiving the error log, only written if writeErrorFile is true
+   * @param writeErrorFile Whether the error log should be written
+   */
+  void adjustFeaturesInBatches(Int32ArrayType::Pointer featureOwnersPtr, Int32ArrayType::Pointer exclusionOwnersPtr, SyntheticBuilding::PackingAvailablePoints& availablePoints,
+                               int32_t totalAdjustments, std::ofstream& outFile, bool writeErrorFile);
+
   /**
    * @brief generate_feature Creates a Feature by sampling the size and morphological statistical distributions
    * @param phase Index of the Ensemble type for the Feature to be generated
@@ -513,6 +568,14 @@ protected:
    */
   float checkSizeDistError(Feature_t* feature);
 
+  /**
+   * @brief featureSizeDistBin Returns the bin of the simulated size distribution that a Feature falls into
+   * @param iter Index of the primary phase
+   * @param equivalentDiameter Equivalent diameter of the Feature
+   * @return Bin index
+   */
+  size_t featureSizeDistBin(size_t iter, float equivalentDiameter);
+
   /**
    * @brief determine_neighbors Determines the neighbors for a given Feature
    * @param gnum Id for the Feature for which to find neighboring Features
@@ -521,6 +584,27 @@ protected:
    */
   void determineNeighbors(size_t gnum, bool add);
 
+  /**
+   * @brief updateNeighborhood Changes the Neighborhoods value of a Feature and keeps the simulated
+   * neighbor distribution in sync with it
+   * @param gnum Id for the Feature
+   * @param increment Change of the Neighborhoods value
+   */
+  void updateNeighborhood(size_t gnum, int32_t increment);
+
+  /**
+   * @brief neighborDistBin Returns the neighbor count bin of a Feature in the simulated neighbor distribution
+   * @param gnum Id for the Feature
+   * @return Bin index
+   */
+  size_t neighborDistBin(size_t gnum) const;
+
+  /**
+   * @brief initializeNeighborDistributions Fills the simulated neighbor distributions from the current
+   * Neighborhoods of all primary Features
+   */
+  void initializeNeighborDistributions();
+
   /**
    * @brief check_neighborhooderror Computes the error between the current Feature neighbor distribution
    * and the goal Feature neighbor distribution
@@ -541,11 +625,10 @@ protected:
   float checkFillingError(int32_t gadd, int32_t gremove, Int32ArrayType::Pointer featureOwnersPtr, Int32ArrayType::Pointer exclusionOwnersPtr);
 
   /**
-   * @brief update_availablepoints Updates the maps used to associate packing points with an "available" state
-   * @param availablePoints Map between Feature owners and number of available points
-   * @param availablePointsInv Inverse associations for the availablePoints map
+   * @brief update_availablepoints Updates the structure used to associate packing points with an "available" state
+   * @param availablePoints Associations between packing points and their slots in the list of available points
    */
-  void updateAvailablePoints(std::map<size_t, size_t>& availablePoints, std::map<size_t, size_t>& availablePointsInv);
+  void updateAvailablePoints(SyntheticBuilding::PackingAvailablePoints& availablePoints);
 
   /**
    * @brief assign_voxels Assigns Feature Id values to voxels within the packing grid
@@ -571,19 +654,19 @@ protected:
    * @brief compare_1Ddistributions Computes the 1D Bhattacharyya distance
    * @param sqrerror Float 1D Bhattacharyya distance
    */
-  void compare1dDistributions(std::vector<float>, std::vector<float>, float& sqrerror);
+  void compare1dDistributions(const std::vector<float>&, const std::vector<float>&, float& sqrerror);
 
   /**
    * @brief compare_2Ddistributions Computes the 2D Bhattacharyya distance
    * @param sqrerror Float 1D Bhattacharyya distance
    */
-  void compare2dDistributions(std::vector<std::vector<float>>, std::vector<std::vector<float>>, float& sqrerror);
+  void compare2dDistributions(const std::vector<std::vector<float>>&, const std::vector<std::vector<float>>&, float& sqrerror);
 
   /**
    * @brief compare_3Ddistributions Computes the 3D Bhattacharyya distance
    * @param sqrerror Float 1D Bhattacharyya distance
    */
-  void compare3dDistributions(std::vector<std::vector<std::vector<float>>>, std::vector<std::vector<std::vector<float>>>, float& sqrerror);
+  void compare3dDistributions(const std::vector<std::vector<std::vector<float>>>&, const std::vector<std::vector<std::vector<float>>>&, float& sqrerror);
 
   /**
    * @brief writeVtkFile Outputs a debug VTK file for visualization
@@ -659,6 +742,9 @@ private:
   QString m_CsvOutputFile = {};
   bool m_PeriodicBoundaries = {};
   bool m_WriteGoalAttributes = {};
+  bool m_UseParallelPlacement = {};
+  bool m_UseFixedSeed = {};
+  int m_RandomSeed = {};
   int m_SaveGeometricDescriptions = {};
   DataArrayPath m_NewAttributeMatrixPath = {};
   DataArrayPath m_SelectedAttributeMatrixPath = {};
@@ -713,9 +799,11 @@ private:
   int64_t m_TotalPackingPoints;
 
   std::vector<std::vector<float>> m_FeatureSizeDist;
-  std::vector<std::vector<float>> m_SimFeatureSizeDist;
+  std::vector<SyntheticBuilding::DistributionHistogram> m_SimFeatureSizeDist;
   std::vector<std::vector<std::vector<float>>> m_NeighborDist;
-  std::vector<std::vector<std::vector<float>>> m_SimNeighborDist;
+  std::vector<SyntheticBuilding::DistributionHistogram> m_SimNeighborDist;
+  std::vector<int32_t> m_NeighborDistPhaseIndices;
+  std::vector<size_t> m_NeighborDistRows;
 
   std::vector<float> m_FeatureSizeDistStep;
   std::vector<float> m_NeighborDistStep;
@@ -0,0 +1,182 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SyntheticBuilding
+{
+
+/**
+ * @brief The DistributionHistogram class holds a simulated distribution of the synthetic builders as integer counts
+ * in one flat, preallocated buffer, next to the goal distribution it is compared against. The distribution is made of
+ * rows of bins (e.g. neighbor count bins for every size bin); each row is normalized by its own count and the non-empty
+ * rows are weighted equally, which is how the simulated size and neighbor distributions are normalized.
+ *
+ * The Bhattacharyya coefficient against the goal is kept up to date incrementally: adding or removing one entry only
+ * touches the partial sum of its row, so evaluating a trial move costs O(rows) instead of a rebuild of the distribution.
+ */
+class DistributionHistogram
+{
+public:
+  DistributionHistogram() = default;
+  ~DistributionHistogram() = default;
+
+  /**
+   * @brief initialize Allocates the histogram and stores the goal distribution. All counts are reset.
+   * @param goal Goal distribution, one vector of bins per row
+   */
+  void initialize(const std::vector<std::vector<float>>& goal)
+  {
+    m_NumRows = goal.size();
+    m_NumBins = m_NumRows > 0 ? goal[0].size() : 0;
+    m_SqrtGoal.assign(m_NumRows * m_NumBins, 0.0);
+    for(size_t r = 0; r < m_NumRows; r++)
+    {
+      for(size_t b = 0; b < m_NumBins && b < goal[r].size(); b++)
+      {
+        m_SqrtGoal[r * m_NumBins + b] = goal[r][b] > 0.0f ? std::sqrt(static_cast<double>(goal[r][b])) : 0.0;
+      }
+    }
+    m_Counts.resize(m_NumRows * m_NumBins);
+    m_RowCounts.resize(m_NumRows);
+    m_RowSums.resize(m_NumRows);
+    clear();
+  }
+
+  /**
+   * @brief initialize Allocates a single row histogram and stores its goal distribution. All counts are reset.
+   * @param goal Goal distribution
+   */
+  void initialize(const std::vector<float>& goal)
+  {
+    initialize(std::vector<std::vector<float>>(1, goal));
+  }
+
+  /**
+   * @brief clear Resets all counts to zero
+   */
+  void clear()
+  {
+    std::fill(m_Counts.begin(), m_Counts.end(), 0);
+    std::fill(m_RowCounts.begin(), m_RowCounts.end(), 0);
+    std::fill(m_RowSums.begin(), m_RowSums.end(), 0.0);
+    m_NonEmptyRows = 0;
+  }
+
+  /**
+   * @brief numBins Returns the number of bins in each row
+   */
+  size_t numBins() const
+  {
+    return m_NumBins;
+  }
+
+  /**
+   * @brief numRows Returns the number of rows
+   */
+  size_t numRows() const
+  {
+    return m_NumRows;
+  }
+
+  /**
+   * @brief add Adds one entry to a bin
+   * @param row Row of the entry
+   * @param bin Bin of the entry within its row
+   */
+  void add(size_t row, size_t bin)
+  {
+    size_t index = row * m_NumBins + bin;
+    int32_t& count = m_Counts[index];
+    m_RowSums[row] += m_SqrtGoal[index] * (std::sqrt(static_cast<double>(count + 1)) - std::sqrt(static_cast<double>(count)));
+    count++;
+    if(m_RowCounts[row]++ == 0)
+    {
+      m_NonEmptyRows++;
+    }
+  }
+
+  /**
+   * @brief remove Removes one entry from a bin
+   * @param row Row of the entry
+   * @param bin Bin of the entry within its row
+   */
+  void remove(size_t row, size_t bin)
+  {
+    size_t index = row * m_NumBins + bin;
+    int32_t& count = m_Counts[index];
+    m_RowSums[row] += m_SqrtGoal[index] * (std::sqrt(static_cast<double>(count - 1)) - std::sqrt(static_cast<double>(count)));
+    count--;
+    if(--m_RowCounts[row] == 0)
+    {
+      m_NonEmptyRows--;
+      // Flush the accumulated rounding of the incremental updates
+      m_RowSums[row] = 0.0;
+    }
+  }
+
+  /**
+   * @brief bhattacharyya Returns the Bhattacharyya coefficient between the normalized histogram and the goal
+   */
+  float bhattacharyya() const
+  {
+    double bhattdist = 0.0;
+    for(size_t r = 0; r < m_NumRows; r++)
+    {
+      if(m_RowCounts[r] > 0)
+      {
+        bhattdist += m_RowSums[r] / std::sqrt(static_cast<double>(m_RowCounts[r]) * static_cast<double>(m_NonEmptyRows));
+      }
+    }
+    return static_cast<float>(bhattdist);
+  }
+
+private:
+  size_t m_NumRows = 0;
+  size_t m_NumBins = 0;
+  size_t m_NonEmptyRows = 0;
+  std::vector<double> m_SqrtGoal;
+  std::vector<int32_t> m_Counts;
+  std::vector<int32_t> m_RowCounts;
+  std::vector<double> m_RowSums;
+};
+
+} // namespace SyntheticBuilding
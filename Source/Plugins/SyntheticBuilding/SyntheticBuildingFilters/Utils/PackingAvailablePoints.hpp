@@ -0,0 +1,196 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace SyntheticBuilding
+{
+
+/**
+ * @brief The MapAvailablePoints class is the original bookkeeping of the packing points that are not inside of an
+ * exclusion zone: a pair of ordered maps between a packing point and its slot in the dense list of available points.
+ * Reading an entry that was never written yields 0, exactly like std::map::operator[].
+ */
+class MapAvailablePoints
+{
+public:
+  MapAvailablePoints() = default;
+  ~MapAvailablePoints() = default;
+
+  /**
+   * @brief initialize Prepares the structure for a packing grid with the given number of points
+   * @param numPoints Total number of packing points
+   */
+  void initialize(size_t numPoints)
+  {
+    (void)numPoints;
+  }
+
+  /**
+   * @brief position Returns the slot of a packing point in the list of available points
+   * @param point Packing point index
+   * @return Reference to the slot
+   */
+  size_t& position(size_t point)
+  {
+    return m_Positions[point];
+  }
+
+  /**
+   * @brief point Returns the packing point stored in a slot of the list of available points
+   * @param slot Slot in the list of available points
+   * @return Reference to the packing point index
+   */
+  size_t& point(size_t slot)
+  {
+    return m_Points[slot];
+  }
+
+  /**
+   * @brief size Returns the number of packing points that were ever assigned a slot
+   * @return
+   */
+  size_t size() const
+  {
+    return m_Positions.size();
+  }
+
+  /**
+   * @brief empty Returns whether no packing point was ever assigned a slot
+   * @return
+   */
+  bool empty() const
+  {
+    return m_Positions.empty();
+  }
+
+private:
+  std::map<size_t, size_t> m_Positions;
+  std::map<size_t, size_t> m_Points;
+};
+
+/**
+ * @brief The FlatAvailablePoints class stores the same index-swap bookkeeping as @see MapAvailablePoints in two
+ * preallocated arrays, so that adding or removing an available point is a constant time array access instead of a
+ * node allocating map insert. It reproduces the map semantics exactly, including reads of entries that were never
+ * written, so a packing run draws the same random sequence with either structure.
+ */
+class FlatAvailablePoints
+{
+public:
+  FlatAvailablePoints() = default;
+  ~FlatAvailablePoints() = default;
+
+  /**
+   * @brief initialize Allocates the arrays for a packing grid with the given number of points
+   * @param numPoints Total number of packing points
+   */
+  void initialize(size_t numPoints)
+  {
+    m_Positions.assign(numPoints, 0);
+    m_Touched.assign(numPoints, 0);
+    m_Points.assign(numPoints, 0);
+    m_OverflowPoints.clear();
+    m_NumTouched = 0;
+  }
+
+  /**
+   * @brief position Returns the slot of a packing point in the list of available points
+   * @param point Packing point index
+   * @return Reference to the slot
+   */
+  size_t& position(size_t point)
+  {
+    if(m_Touched[point] == 0)
+    {
+      m_Touched[point] = 1;
+      m_NumTouched++;
+    }
+    return m_Positions[point];
+  }
+
+  /**
+   * @brief point Returns the packing point stored in a slot of the list of available points. Slots past the end
+   * of the grid only occur when the available point count wraps around and are kept in a small overflow map.
+   * @param slot Slot in the list of available points
+   * @return Reference to the packing point index
+   */
+  size_t& point(size_t slot)
+  {
+    if(slot < m_Points.size())
+    {
+      return m_Points[slot];
+    }
+    return m_OverflowPoints[slot];
+  }
+
+  /**
+   * @brief size Returns the number of packing points that were ever assigned a slot
+   * @return
+   */
+  size_t size() const
+  {
+    return m_NumTouched;
+  }
+
+  /**
+   * @brief empty Returns whether no packing point was ever assigned a slot
+   * @return
+   */
+  bool empty() const
+  {
+    return m_NumTouched == 0;
+  }
+
+private:
+  std::vector<size_t> m_Positions;
+  std::vector<uint8_t> m_Touched;
+  std::vector<size_t> m_Points;
+  std::map<size_t, size_t> m_OverflowPoints;
+  size_t m_NumTouched = 0;
+};
+
+/**
+ * @brief PackingAvailablePoints is the available points structure used by the packing filters. Switch it to
+ * @see MapAvailablePoints to fall back to the original map based bookkeeping.
+ */
+using PackingAvailablePoints = FlatAvailablePoints;
+
+} // namespace SyntheticBuilding
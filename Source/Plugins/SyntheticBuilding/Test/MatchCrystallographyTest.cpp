@@ -0,0 +1,311 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cmath>
+
+#include <QtCore/QDebug>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/DataArrays/StatsDataArray.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/StatsData/PrimaryStatsData.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "SyntheticBuilding/SyntheticBuildingFilters/GeneratePrimaryStatsData.h"
+#include "SyntheticBuilding/SyntheticBuildingFilters/MatchCrystallography.h"
+#include "SyntheticBuildingTestFileLocations.h"
+
+/**
+ * @brief The MatchCrystallographyTest class matches the crystallography of a block shaped synthetic volume against
+ * statistics whose MDF holds fewer bins than the ODF. The MDF error must only be taken over the bins that exist
+ */
+class MatchCrystallographyTest
+{
+  const int k_RandomSeed = 5489;
+  // The volume is cut into k_Blocks^3 cubic Features of k_BlockSize^3 cells
+  const size_t k_Blocks = 4;
+  const size_t k_BlockSize = 4;
+  // Number of MDF bins kept from the generated statistics
+  const size_t k_MdfBins = 64;
+
+public:
+  MatchCrystallographyTest() = default;
+  ~MatchCrystallographyTest() = default;
+  MatchCrystallographyTest(const MatchCrystallographyTest&) = delete;            // Copy Constructor Not Implemented
+  MatchCrystallographyTest(MatchCrystallographyTest&&) = delete;                 // Move Constructor Not Implemented
+  MatchCrystallographyTest& operator=(const MatchCrystallographyTest&) = delete; // Copy Assignment Not Implemented
+  MatchCrystallographyTest& operator=(MatchCrystallographyTest&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Returns the name of the class for MatchCrystallographyTest
+   */
+  QString getNameOfClass() const
+  {
+    return QString("MatchCrystallographyTest");
+  }
+
+  /**
+   * @brief Returns the name of the class for MatchCrystallographyTest
+   */
+  QString ClassName()
+  {
+    return QString("MatchCrystallographyTest");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFilterAvailability()
+  {
+    // Now instantiate the MatchCrystallography Filter from the FilterManager
+    QString filtName = "MatchCrystallography";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    if(nullptr == filterFactory.get())
+    {
+      std::stringstream ss;
+      ss << "The MatchCrystallographyTest Requires the use of the " << filtName.toStdString() << " filter which is found in the SyntheticBuilding Plugin";
+      DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Generates cubic statistics and cuts their MDF down to k_MdfBins bins
+  // -----------------------------------------------------------------------------
+  void createStatistics(const DataContainerArray::Pointer& dca)
+  {
+    GeneratePrimaryStatsData::Pointer statsFilter = GeneratePrimaryStatsData::New();
+    statsFilter->setDataContainerArray(dca);
+    statsFilter->setCrystalSymmetry(1);
+    statsFilter->setMu(1.0);
+    statsFilter->setSigma(0.1);
+    statsFilter->setMinCutOff(5.0);
+    statsFilter->setMaxCutOff(5.0);
+    statsFilter->setBinStepSize(0.5);
+    statsFilter->execute();
+    DREAM3D_REQUIRED(statsFilter->getErrorCode(), >=, 0)
+
+    AttributeMatrix::Pointer ensembleAttrMat = dca->getDataContainer(SIMPL::Defaults::StatsGenerator)->getAttributeMatrix(SIMPL::Defaults::CellEnsembleAttributeMatrixName);
+    StatsDataArray::Pointer statsDataArray = ensembleAttrMat->getAttributeArrayAs<StatsDataArray>(SIMPL::EnsembleData::Statistics);
+    DREAM3D_REQUIRE_VALID_POINTER(statsDataArray.get())
+    PrimaryStatsData::Pointer primaryStatsData = std::dynamic_pointer_cast<PrimaryStatsData>(statsDataArray->getStatsData(1));
+    DREAM3D_REQUIRE_VALID_POINTER(primaryStatsData.get())
+
+    FloatArrayType::Pointer mdf = primaryStatsData->getMisorientationBins();
+    DREAM3D_REQUIRE_VALID_POINTER(mdf.get())
+    DREAM3D_REQUIRED(mdf->getNumberOfTuples(), >, k_MdfBins)
+    FloatArrayType::Pointer shortMdf = FloatArrayType::CopyFromPointer(mdf->getPointer(0), k_MdfBins, SIMPL::StringConstants::MisorientationBins);
+    primaryStatsData->setMisorientationBins(shortMdf);
+    DREAM3D_REQUIRED(primaryStatsData->getODF()->getNumberOfTuples(), >, k_MdfBins)
+  }
+
+  // -----------------------------------------------------------------------------
+  // Creates the synthetic volume of block Features with their phases, surface flags and face neighbors
+  // -----------------------------------------------------------------------------
+  void createBlockVolume(const DataContainerArray::Pointer& dca)
+  {
+    const size_t dim = k_Blocks * k_BlockSize;
+    const size_t numFeatures = k_Blocks * k_Blocks * k_Blocks;
+
+    DataContainer::Pointer dc = DataContainer::New(SIMPL::Defaults::SyntheticVolumeDataContainerName);
+    dca->addOrReplaceDataContainer(dc);
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    SizeVec3Type dims = {dim, dim, dim};
+    image->setDimensions(dims);
+    image->setSpacing({1.0F, 1.0F, 1.0F});
+    dc->setGeometry(image);
+
+    std::vector<size_t> cDims(1, 1);
+    std::vector<size_t> tDims = {dim, dim, dim};
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tDims, SIMPL::Defaults::CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(cellAttrMat);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(tDims, cDims, SIMPL::CellData::FeatureIds, true);
+    for(size_t z = 0; z < dim; z++)
+    {
+      for(size_t y = 0; y < dim; y++)
+      {
+        for(size_t x = 0; x < dim; x++)
+        {
+          featureIds->setValue((z * dim + y) * dim + x, blockFeatureId(x / k_BlockSize, y / k_BlockSize, z / k_BlockSize));
+        }
+      }
+    }
+    cellAttrMat->insertOrAssign(featureIds);
+
+    tDims = {numFeatures + 1};
+    AttributeMatrix::Pointer featureAttrMat = AttributeMatrix::New(tDims, SIMPL::Defaults::CellFeatureAttributeMatrixName, AttributeMatrix::Type::CellFeature);
+    dc->addOrReplaceAttributeMatrix(featureAttrMat);
+    Int32ArrayType::Pointer phases = Int32ArrayType::CreateArray(tDims, cDims, SIMPL::FeatureData::Phases, true);
+    BoolArrayType::Pointer surfaceFeatures = BoolArrayType::CreateArray(tDims, cDims, SIMPL::FeatureData::SurfaceFeatures, true);
+    NeighborList<int32_t>::Pointer neighborList = NeighborList<int32_t>::CreateArray(numFeatures + 1, SIMPL::FeatureData::NeighborList, true);
+    NeighborList<float>::Pointer sharedSurfaceAreaList = NeighborList<float>::CreateArray(numFeatures + 1, SIMPL::FeatureData::SharedSurfaceAreaList, true);
+    phases->setValue(0, 0);
+    surfaceFeatures->setValue(0, false);
+
+    // Neighboring blocks share a full k_BlockSize x k_BlockSize face
+    const float faceArea = static_cast<float>(k_BlockSize * k_BlockSize);
+    const int64_t blocks = static_cast<int64_t>(k_Blocks);
+    for(int64_t bz = 0; bz < blocks; bz++)
+    {
+      for(int64_t by = 0; by < blocks; by++)
+      {
+        for(int64_t bx = 0; bx < blocks; bx++)
+        {
+          int32_t feature = blockFeatureId(static_cast<size_t>(bx), static_cast<size_t>(by), static_cast<size_t>(bz));
+          phases->setValue(feature, 1);
+          surfaceFeatures->setValue(feature, bx == 0 || by == 0 || bz == 0 || bx == blocks - 1 || by == blocks - 1 || bz == blocks - 1);
+
+          NeighborList<int32_t>::SharedVectorType neighbors(new std::vector<int32_t>);
+          NeighborList<float>::SharedVectorType areas(new std::vector<float>);
+          const int64_t offsets[6][3] = {{-1, 0, 0}, {1, 0, 0}, {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1}};
+          for(const auto& offset : offsets)
+          {
+            int64_t nx = bx + offset[0];
+            int64_t ny = by + offset[1];
+            int64_t nz = bz + offset[2];
+            if(nx < 0 || ny < 0 || nz < 0 || nx >= blocks || ny >= blocks || nz >= blocks)
+            {
+              continue;
+            }
+            neighbors->push_back(blockFeatureId(static_cast<size_t>(nx), static_cast<size_t>(ny), static_cast<size_t>(nz)));
+            areas->push_back(faceArea);
+          }
+          neighborList->setList(feature, neighbors);
+          sharedSurfaceAreaList->setList(feature, areas);
+        }
+      }
+    }
+    featureAttrMat->insertOrAssign(phases);
+    featureAttrMat->insertOrAssign(surfaceFeatures);
+    featureAttrMat->insertOrAssign(neighborList);
+    featureAttrMat->insertOrAssign(sharedSurfaceAreaList);
+
+    tDims = {2};
+    AttributeMatrix::Pointer ensembleAttrMat = AttributeMatrix::New(tDims, SIMPL::Defaults::CellEnsembleAttributeMatrixName, AttributeMatrix::Type::CellEnsemble);
+    dc->addOrReplaceAttributeMatrix(ensembleAttrMat);
+    Int32ArrayType::Pointer numFeaturesArray = Int32ArrayType::CreateArray(tDims, cDims, SIMPL::EnsembleData::NumFeatures, true);
+    numFeaturesArray->setValue(0, 0);
+    numFeaturesArray->setValue(1, static_cast<int32_t>(numFeatures));
+    ensembleAttrMat->insertOrAssign(numFeaturesArray);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int32_t blockFeatureId(size_t bx, size_t by, size_t bz) const
+  {
+    return static_cast<int32_t>((bz * k_Blocks + by) * k_Blocks + bx + 1);
+  }
+
+  // -----------------------------------------------------------------------------
+  // Matches the crystallography of a fresh block volume and returns its Feature Euler angles
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer matchVolume()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    createStatistics(dca);
+    createBlockVolume(dca);
+
+    MatchCrystallography::Pointer matchFilter = MatchCrystallography::New();
+    matchFilter->setDataContainerArray(dca);
+    matchFilter->setMaxIterations(2000);
+    matchFilter->setUseFixedSeed(true);
+    matchFilter->setRandomSeed(k_RandomSeed);
+    matchFilter->execute();
+    DREAM3D_REQUIRE_EQUAL(matchFilter->getErrorCode(), 0)
+
+    DataContainer::Pointer dc = dca->getDataContainer(SIMPL::Defaults::SyntheticVolumeDataContainerName);
+    AttributeMatrix::Pointer featureAttrMat = dc->getAttributeMatrix(SIMPL::Defaults::CellFeatureAttributeMatrixName);
+    FloatArrayType::Pointer eulers = featureAttrMat->getAttributeArrayAs<FloatArrayType>(SIMPL::FeatureData::EulerAngles);
+    FloatArrayType::Pointer avgQuats = featureAttrMat->getAttributeArrayAs<FloatArrayType>(SIMPL::FeatureData::AvgQuats);
+    DREAM3D_REQUIRE_VALID_POINTER(eulers.get())
+    DREAM3D_REQUIRE_VALID_POINTER(avgQuats.get())
+
+    // Every Feature has been given a valid orientation
+    for(size_t i = 1; i < avgQuats->getNumberOfTuples(); i++)
+    {
+      const float* q = avgQuats->getTuplePointer(i);
+      float norm = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+      DREAM3D_REQUIRE(std::fabs(norm - 1.0f) < 1.0E-4f)
+    }
+
+    // The cells take the Euler angles of their Feature
+    Int32ArrayType::Pointer featureIds = dc->getAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName)->getAttributeArrayAs<Int32ArrayType>(SIMPL::CellData::FeatureIds);
+    FloatArrayType::Pointer cellEulers = dc->getAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName)->getAttributeArrayAs<FloatArrayType>(SIMPL::CellData::EulerAngles);
+    DREAM3D_REQUIRE_VALID_POINTER(cellEulers.get())
+    for(size_t i = 0; i < featureIds->getNumberOfTuples(); i++)
+    {
+      for(int32_t c = 0; c < 3; c++)
+      {
+        DREAM3D_REQUIRE_EQUAL(cellEulers->getComponent(i, c), eulers->getComponent(featureIds->getValue(i), c))
+      }
+    }
+    return eulers;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The ODF holds many more bins than the shortened MDF. The MDF error and the misorientation bins that are
+  // matched must stay inside the MDF, and the same seed must give the same orientations
+  // -----------------------------------------------------------------------------
+  int TestShortMdf()
+  {
+    FloatArrayType::Pointer firstRun = matchVolume();
+    FloatArrayType::Pointer secondRun = matchVolume();
+
+    DREAM3D_REQUIRE_EQUAL(firstRun->getSize(), secondRun->getSize())
+    for(size_t i = 0; i < firstRun->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(firstRun->getValue(i), secondRun->getValue(i))
+    }
+    return EXIT_SUCCESS;
+  }
+
+  /**
+   * @brief
+   */
+  void operator()()
+  {
+    std::cout << "#-- MatchCrystallographyTest Starting " << std::endl;
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestFilterAvailability());
+
+    DREAM3D_REGISTER_TEST(TestShortMdf())
+  }
+};
@@ -0,0 +1,200 @@
+/* ============================================================================
+ * Copyright (c) 2020 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+
+#include <QtCore/QDebug>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/ShapeType.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "SyntheticBuilding/SyntheticBuildingFilters/EstablishShapeTypes.h"
+#include "SyntheticBuilding/SyntheticBuildingFilters/GeneratePrimaryStatsData.h"
+#include "SyntheticBuilding/SyntheticBuildingFilters/InitializeSyntheticVolume.h"
+#include "SyntheticBuilding/SyntheticBuildingFilters/PackPrimaryPhases.h"
+#include "SyntheticBuildingTestFileLocations.h"
+
+/**
+ * @brief The PackPrimaryPhasesTest class packs the same small synthetic volume twice with the same fixed random
+ * seed, once with the serial and once with the parallel placement, and requires identical Feature Ids
+ */
+class PackPrimaryPhasesTest
+{
+  const int k_RandomSeed = 20201;
+
+public:
+  PackPrimaryPhasesTest() = default;
+  ~PackPrimaryPhasesTest() = default;
+  PackPrimaryPhasesTest(const PackPrimaryPhasesTest&) = delete;            // Copy Constructor Not Implemented
+  PackPrimaryPhasesTest(PackPrimaryPhasesTest&&) = delete;                 // Move Constructor Not Implemented
+  PackPrimaryPhasesTest& operator=(const PackPrimaryPhasesTest&) = delete; // Copy Assignment Not Implemented
+  PackPrimaryPhasesTest& operator=(PackPrimaryPhasesTest&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Returns the name of the class for PackPrimaryPhasesTest
+   */
+  QString getNameOfClass() const
+  {
+    return QString("PackPrimaryPhasesTest");
+  }
+
+  /**
+   * @brief Returns the name of the class for PackPrimaryPhasesTest
+   */
+  QString ClassName()
+  {
+    return QString("PackPrimaryPhasesTest");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFilterAvailability()
+  {
+    // Now instantiate the PackPrimaryPhases Filter from the FilterManager
+    QString filtName = "PackPrimaryPhases";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    if(nullptr == filterFactory.get())
+    {
+      std::stringstream ss;
+      ss << "The PackPrimaryPhasesTest Requires the use of the " << filtName.toStdString() << " filter which is found in the SyntheticBuilding Plugin";
+      DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Generates the statistics, the shape types and the empty volume, then packs it and returns the Feature Ids
+  // -----------------------------------------------------------------------------
+  Int32ArrayType::Pointer packVolume(bool parallelPlacement)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+
+    GeneratePrimaryStatsData::Pointer statsFilter = GeneratePrimaryStatsData::New();
+    statsFilter->setDataContainerArray(dca);
+    statsFilter->setCrystalSymmetry(1);
+    statsFilter->setMu(1.0);
+    statsFilter->setSigma(0.1);
+    statsFilter->setMinCutOff(5.0);
+    statsFilter->setMaxCutOff(5.0);
+    statsFilter->setBinStepSize(0.5);
+    statsFilter->execute();
+    DREAM3D_REQUIRED(statsFilter->getErrorCode(), >=, 0)
+
+    EstablishShapeTypes::Pointer shapeFilter = EstablishShapeTypes::New();
+    shapeFilter->setDataContainerArray(dca);
+    ShapeType::Types shapeTypes = {ShapeType::Type::Unknown, ShapeType::Type::Ellipsoid};
+    shapeFilter->setShapeTypeData(shapeTypes);
+    shapeFilter->execute();
+    DREAM3D_REQUIRED(shapeFilter->getErrorCode(), >=, 0)
+
+    InitializeSyntheticVolume::Pointer volumeFilter = InitializeSyntheticVolume::New();
+    volumeFilter->setDataContainerArray(dca);
+    IntVec3Type dims = {24, 24, 24};
+    volumeFilter->setDimensions(dims);
+    volumeFilter->execute();
+    DREAM3D_REQUIRED(volumeFilter->getErrorCode(), >=, 0)
+
+    PackPrimaryPhases::Pointer packFilter = PackPrimaryPhases::New();
+    packFilter->setDataContainerArray(dca);
+    packFilter->setUseFixedSeed(true);
+    packFilter->setRandomSeed(k_RandomSeed);
+    packFilter->setUseParallelPlacement(parallelPlacement);
+    packFilter->execute();
+    DREAM3D_REQUIRED(packFilter->getErrorCode(), >=, 0)
+
+    AttributeMatrix::Pointer cellAttrMat = dca->getDataContainer(SIMPL::Defaults::SyntheticVolumeDataContainerName)->getAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName);
+    Int32ArrayType::Pointer featureIds = cellAttrMat->getAttributeArrayAs<Int32ArrayType>(SIMPL::CellData::FeatureIds);
+    DREAM3D_REQUIRE_VALID_POINTER(featureIds.get())
+    return featureIds;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void requireSamePacking(bool parallelPlacement)
+  {
+    Int32ArrayType::Pointer firstRun = packVolume(parallelPlacement);
+    Int32ArrayType::Pointer secondRun = packVolume(parallelPlacement);
+
+    size_t numCells = firstRun->getNumberOfTuples();
+    DREAM3D_REQUIRE_EQUAL(secondRun->getNumberOfTuples(), numCells)
+
+    // More than one Feature has to be packed for the comparison to mean anything
+    int32_t maxFeatureId = 0;
+    for(size_t i = 0; i < numCells; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(firstRun->getValue(i), secondRun->getValue(i))
+      maxFeatureId = std::max(maxFeatureId, firstRun->getValue(i));
+    }
+    DREAM3D_REQUIRED(maxFeatureId, >, 1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFixedSeedSerial()
+  {
+    requireSamePacking(false);
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFixedSeedParallel()
+  {
+    requireSamePacking(true);
+    return EXIT_SUCCESS;
+  }
+
+  /**
+   * @brief
+   */
+  void operator()()
+  {
+    std::cout << "#-- PackPrimaryPhasesTest Starting " << std::endl;
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestFilterAvailability());
+
+    DREAM3D_REGISTER_TEST(TestFixedSeedSerial())
+    DREAM3D_REGISTER_TEST(TestFixedSeedParallel())
+  }
+};